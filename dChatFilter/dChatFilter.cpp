@@ -47,6 +47,11 @@ dChatFilter::dChatFilter(const std::string& filepath, bool dontGenerateDCF) {
 	delete stmt;
 }
 
+dChatFilter::dChatFilter(bool useWhitelist) {
+	m_DontGenerateDCF = true;
+	m_UseWhitelist = useWhitelist;
+}
+
 dChatFilter::~dChatFilter() {
 	m_ApprovedWords.clear();
 	m_DeniedWords.clear();
@@ -18,6 +18,12 @@ class dChatFilter
 {
 public:
 	dChatFilter(const std::string& filepath, bool dontGenerateDCF);
+
+	/**
+	 * Creates a filter without any words, they can be added with the ReadWordlist functions afterwards
+	 * @param useWhitelist whether messages are checked against the approved words
+	 */
+	explicit dChatFilter(bool useWhitelist);
 	~dChatFilter();
 
 	void ReadWordlistPlaintext(const std::string& filepath, bool whiteList);
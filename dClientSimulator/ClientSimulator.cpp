@@ -0,0 +1,247 @@
+#include <chrono>
+#include <csignal>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <bcrypt/BCrypt.hpp>
+#else
+#include <bcrypt.h>
+#endif
+
+//DLU Includes:
+#include "dCommonVars.h"
+#include "dLogger.h"
+#include "Database.h"
+#include "dConfig.h"
+#include "Diagnostics.h"
+#include "BinaryPathFinder.h"
+#include "GeneralUtils.h"
+
+#include "SimulatedClient.h"
+
+#include "Game.h"
+namespace Game {
+	dLogger* logger;
+	dServer* server;
+	dConfig* config;
+	std::mt19937 randomEngine;
+}
+
+dLogger* SetupLogger();
+SimulatedClientSettings ReadSettings(dConfig& config);
+bool CreateAccounts(dConfig& config, const std::string& accountPrefix, uint32_t clientCount, const std::string& password);
+void LogReport(const SimulatorReport& report, float interval);
+
+namespace {
+	volatile std::sig_atomic_t stopRequested = 0;
+}
+
+int main(int argc, char** argv) {
+	Diagnostics::SetProcessName("ClientSimulator");
+	Diagnostics::SetProcessFileName(argv[0]);
+	Diagnostics::Initialize();
+
+	signal(SIGINT, [](int) { stopRequested = 1; });
+	signal(SIGTERM, [](int) { stopRequested = 1; });
+
+	Game::logger = SetupLogger();
+	if (!Game::logger) return EXIT_FAILURE;
+	Game::logger->Log("ClientSimulator", "Starting client simulator...");
+	Game::logger->Log("ClientSimulator", "Version: %i.%i", PROJECT_VERSION_MAJOR, PROJECT_VERSION_MINOR);
+
+	//Read our config:
+	dConfig config("simulatorconfig.ini");
+	Game::config = &config;
+	Game::logger->SetLogToConsole(true);
+	Game::logger->SetLogDebugStatements(config.GetValue("log_debug_statements") == "1");
+
+	Game::randomEngine = std::mt19937(time(0));
+
+	const auto settings = ReadSettings(config);
+
+	uint32_t clientCount = 100;
+	float spawnRate = 10.0f;
+	uint32_t tickRate = 30;
+	float reportInterval = 10.0f;
+	float duration = 0.0f;
+	GeneralUtils::TryParse(config.GetValue("client_count"), clientCount);
+	GeneralUtils::TryParse(config.GetValue("spawn_rate"), spawnRate);
+	GeneralUtils::TryParse(config.GetValue("tick_rate"), tickRate);
+	GeneralUtils::TryParse(config.GetValue("report_interval"), reportInterval);
+	GeneralUtils::TryParse(config.GetValue("duration"), duration);
+
+	auto accountPrefix = config.GetValue("account_prefix");
+	if (accountPrefix.empty()) accountPrefix = "simclient";
+
+	if (config.GetValue("create_accounts") == "1" && !CreateAccounts(config, accountPrefix, clientCount, settings.password)) {
+		delete Game::logger;
+		return EXIT_FAILURE;
+	}
+
+	Game::logger->Log("ClientSimulator", "Simulating %i clients against %s:%i", clientCount, settings.authIP.c_str(), settings.authPort);
+
+	std::vector<std::unique_ptr<SimulatedClient>> clients;
+	clients.reserve(clientCount);
+
+	auto lastFrame = std::chrono::steady_clock::now();
+	float runTime = 0.0f;
+	float spawnTimer = 0.0f;
+	float reportTimer = 0.0f;
+
+	while (stopRequested == 0 && (duration <= 0.0f || runTime < duration)) {
+		const auto frameStart = std::chrono::steady_clock::now();
+		const auto deltaTime = std::chrono::duration<float>(frameStart - lastFrame).count();
+		lastFrame = frameStart;
+		runTime += deltaTime;
+
+		// Ramp the clients up instead of having all of them log in at once
+		spawnTimer += deltaTime * spawnRate;
+		while (clients.size() < clientCount && (spawnRate <= 0.0f || spawnTimer >= 1.0f)) {
+			spawnTimer -= 1.0f;
+
+			auto client = std::make_unique<SimulatedClient>(accountPrefix + std::to_string(clients.size()), settings);
+			client->Start();
+			clients.push_back(std::move(client));
+		}
+
+		for (auto& client : clients) client->Update(deltaTime);
+
+		reportTimer += deltaTime;
+		if (reportTimer >= reportInterval) {
+			SimulatorReport report;
+			for (auto& client : clients) client->CollectReport(report);
+
+			LogReport(report, reportTimer);
+			Game::logger->Flush();
+			reportTimer = 0.0f;
+		}
+
+		std::this_thread::sleep_until(frameStart + std::chrono::milliseconds(tickRate));
+	}
+
+	Game::logger->Log("ClientSimulator", "Stopping %i clients", static_cast<uint32_t>(clients.size()));
+	clients.clear();
+
+	Game::logger->Flush();
+	delete Game::logger;
+
+	return EXIT_SUCCESS;
+}
+
+dLogger* SetupLogger() {
+	std::string logPath = (BinaryPathFinder::GetBinaryDir() / ("logs/ClientSimulator_" + std::to_string(time(nullptr)) + ".log")).string();
+	bool logToConsole = true;
+	bool logDebugStatements = false;
+#ifdef _DEBUG
+	logDebugStatements = true;
+#endif
+
+	return new dLogger(logPath, logToConsole, logDebugStatements);
+}
+
+SimulatedClientSettings ReadSettings(dConfig& config) {
+	SimulatedClientSettings settings;
+
+	if (!config.GetValue("auth_ip").empty()) settings.authIP = config.GetValue("auth_ip");
+	uint32_t authPort = 0;
+	if (GeneralUtils::TryParse(config.GetValue("auth_port"), authPort)) settings.authPort = authPort;
+
+	settings.password = config.GetValue("account_password");
+	if (settings.password.empty()) settings.password = "simclient";
+
+	GeneralUtils::TryParse(config.GetValue("timeout"), settings.timeout);
+	GeneralUtils::TryParse(config.GetValue("retry_delay"), settings.retryDelay);
+	GeneralUtils::TryParse(config.GetValue("move_interval"), settings.moveInterval);
+	GeneralUtils::TryParse(config.GetValue("move_radius"), settings.moveRadius);
+	GeneralUtils::TryParse(config.GetValue("move_speed"), settings.moveSpeed);
+	GeneralUtils::TryParse(config.GetValue("chat_interval"), settings.chatInterval);
+	GeneralUtils::TryParse(config.GetValue("skill_interval"), settings.skillInterval);
+	GeneralUtils::TryParse(config.GetValue("skill_id"), settings.skillID);
+	GeneralUtils::TryParse(config.GetValue("transfer_interval"), settings.transferInterval);
+	settings.pickupLoot = config.GetValue("pickup_loot") != "0";
+
+	for (const auto& zone : GeneralUtils::SplitString(config.GetValue("transfer_zones"), ',')) {
+		uint32_t zoneID;
+		if (GeneralUtils::TryParse(zone, zoneID)) settings.transferZones.push_back(zoneID);
+	}
+
+	return settings;
+}
+
+/**
+ * Makes sure an account exists for every simulated client
+ * @param config the config to read the database connection from
+ * @param accountPrefix the prefix of the account names, the index of the client is appended to it
+ * @param clientCount the number of clients
+ * @param password the password of the accounts
+ * @return whether the accounts could be created
+ */
+bool CreateAccounts(dConfig& config, const std::string& accountPrefix, const uint32_t clientCount, const std::string& password) {
+	try {
+		Database::Connect(config.GetValue("mysql_host"), config.GetValue("mysql_database"), config.GetValue("mysql_username"), config.GetValue("mysql_password"));
+	} catch (sql::SQLException& ex) {
+		Game::logger->Log("ClientSimulator", "Got an error while connecting to the database: %s", ex.what());
+		Database::Destroy("ClientSimulator");
+		return false;
+	}
+
+	uint32_t gmLevel = 0;
+	GeneralUtils::TryParse(config.GetValue("account_gm_level"), gmLevel);
+
+	// Every account shares the password, so it only has to be hashed once
+	char salt[BCRYPT_HASHSIZE];
+	char hash[BCRYPT_HASHSIZE];
+	::bcrypt_gensalt(12, salt);
+	::bcrypt_hashpw(password.c_str(), salt, hash);
+
+	auto previousCommitValue = Database::GetAutoCommit();
+	Database::SetAutoCommit(false);
+
+	std::unique_ptr<sql::PreparedStatement> insertAccount(Database::CreatePreppedStmt("INSERT IGNORE INTO accounts (name, password, gm_level) VALUES (?, ?, ?);"));
+
+	uint32_t accountsCreated = 0;
+	for (uint32_t i = 0; i < clientCount; i++) {
+		insertAccount->setString(1, (accountPrefix + std::to_string(i)).c_str());
+		insertAccount->setString(2, std::string(hash, BCRYPT_HASHSIZE).c_str());
+		insertAccount->setUInt(3, gmLevel);
+		accountsCreated += insertAccount->executeUpdate();
+	}
+
+	Database::Commit();
+	Database::SetAutoCommit(previousCommitValue);
+
+	insertAccount.reset();
+	Database::Destroy("ClientSimulator");
+
+	Game::logger->Log("ClientSimulator", "Created %i new accounts", accountsCreated);
+	return true;
+}
+
+void LogReport(const SimulatorReport& report, const float interval) {
+	Game::logger->Log(
+		"ClientSimulator", "Clients in world: %i, loading: %i, failed: %i, failures: %i, packets sent/s: %.1f, received/s: %.1f",
+		report.clientsInWorld, report.clientsLoading, report.clientsFailed, report.failures,
+		report.packetsSent / interval, report.packetsReceived / interval);
+
+	if (report.logins > 0) {
+		Game::logger->Log("ClientSimulator", "Logins: %i, average %.1fms, max %.1fms", report.logins, report.loginTotal * 1000.0 / report.logins, report.loginMax * 1000.0);
+	}
+
+	if (report.zoneLoads > 0) {
+		Game::logger->Log("ClientSimulator", "Zone loads: %i, average %.1fms, max %.1fms", report.zoneLoads, report.zoneLoadTotal * 1000.0 / report.zoneLoads, report.zoneLoadMax * 1000.0);
+	}
+
+	for (const auto& [name, server] : report.servers) {
+		Game::logger->Log(
+			"ClientSimulator", "%s: %i clients, sent %.1fKB/s, received %.1fKB/s, ping %lldms, round trip average %.1fms max %.1fms",
+			name.c_str(), server.clients,
+			server.bytesSent / 1024.0 / interval, server.bytesReceived / 1024.0 / interval,
+			server.pingSamples > 0 ? server.pingTotal / server.pingSamples : 0,
+			server.roundTripSamples > 0 ? server.roundTripTotal * 1000.0 / server.roundTripSamples : 0.0,
+			server.roundTripMax * 1000.0);
+	}
+}
@@ -0,0 +1,655 @@
+#include "SimulatedClient.h"
+
+#include <cmath>
+
+#include "RakPeerInterface.h"
+#include "RakNetworkFactory.h"
+#include "RakNetStatistics.h"
+#include "MessageIdentifiers.h"
+
+#include "dLogger.h"
+#include "dMessageIdentifiers.h"
+#include "Game.h"
+#include "GeneralUtils.h"
+#include "PacketUtils.h"
+
+namespace {
+	/**
+	 * The password the live client connects to the auth and world servers with
+	 */
+	const char* clientPassword = "3.25 ND1";
+	const int clientPasswordLength = 8;
+
+	/**
+	 * Creating a character fails when the random predefined name is taken, so a few names are tried
+	 */
+	const uint32_t maxCreateAttempts = 5;
+
+	/**
+	 * The process ID and port the client sends along with its handshake
+	 */
+	const uint32_t clientProcessID = 0x1430;
+	const uint16_t clientPort = 0xFFFF;
+}
+
+SimulatedClient::SimulatedClient(const std::string& username, const SimulatedClientSettings& settings) : m_Settings(settings) {
+	m_Username = username;
+
+	// Every client needs a peer of its own, a peer can only hold a single connection to the same server.
+	SocketDescriptor socketDescriptor(0, 0);
+	m_Peer = RakNetworkFactory::GetRakPeerInterface();
+	m_Peer->Startup(2, 30, &socketDescriptor, 1);
+
+	// Spread the actions of the clients out, so they don't all happen in the same frame
+	m_MoveAngle = GeneralUtils::GenerateRandomNumber<float>(0, 6);
+	m_ChatTimer = GeneralUtils::GenerateRandomNumber<float>(0, static_cast<size_t>(settings.chatInterval));
+	m_SkillTimer = GeneralUtils::GenerateRandomNumber<float>(0, static_cast<size_t>(settings.skillInterval));
+	m_TransferTimer = settings.transferInterval + GeneralUtils::GenerateRandomNumber<float>(0, static_cast<size_t>(settings.transferInterval));
+}
+
+SimulatedClient::~SimulatedClient() {
+	Stop();
+
+	m_Peer->Shutdown(100);
+	RakNetworkFactory::DestroyRakPeerInterface(m_Peer);
+}
+
+void SimulatedClient::Start() {
+	m_SessionKey.clear();
+	m_CharacterID = LWOOBJID_EMPTY;
+	m_CreateAttempts = 0;
+	m_PendingChatRequests.clear();
+	m_LoginStart = std::chrono::steady_clock::now();
+
+	Connect(m_Settings.authIP, m_Settings.authPort, eSimulatedClientState::CONNECTING_TO_AUTH);
+}
+
+void SimulatedClient::Stop() {
+	Disconnect();
+	SetState(eSimulatedClientState::IDLE);
+}
+
+void SimulatedClient::Update(const float deltaTime) {
+	for (auto* packet = m_Peer->Receive(); packet != nullptr; packet = m_Peer->Receive()) {
+		m_Report.packetsReceived++;
+		HandlePacket(packet);
+		m_Peer->DeallocatePacket(packet);
+	}
+
+	m_StateTime += deltaTime;
+
+	switch (m_State) {
+	case eSimulatedClientState::IDLE:
+		return;
+	case eSimulatedClientState::FAILED:
+		if (m_StateTime >= m_Settings.retryDelay) Start();
+		return;
+	case eSimulatedClientState::IN_WORLD:
+		break;
+	default:
+		if (m_StateTime >= m_Settings.timeout) Fail("Timed out waiting on " + m_ServerName);
+		return;
+	}
+
+	m_MoveTimer += deltaTime;
+	if (m_MoveTimer >= m_Settings.moveInterval) {
+		// Walk in a circle around the spawn point, the server only has to see a plausible speed
+		if (m_Settings.moveRadius > 0.0f) m_MoveAngle += m_Settings.moveSpeed * m_MoveTimer / m_Settings.moveRadius;
+		m_MoveTimer = 0.0f;
+		SendPositionUpdate();
+	}
+
+	if (m_Settings.chatInterval > 0.0f) {
+		m_ChatTimer += deltaTime;
+		if (m_ChatTimer >= m_Settings.chatInterval) {
+			m_ChatTimer = 0.0f;
+			SendChatRequest();
+		}
+	}
+
+	if (m_Settings.skillInterval > 0.0f && m_Settings.skillID != 0) {
+		m_SkillTimer += deltaTime;
+		if (m_SkillTimer >= m_Settings.skillInterval) {
+			m_SkillTimer = 0.0f;
+			SendStartSkill();
+		}
+	}
+
+	if (m_Settings.transferInterval > 0.0f && !m_Settings.transferZones.empty()) {
+		m_TransferTimer -= deltaTime;
+		if (m_TransferTimer <= 0.0f) {
+			m_TransferTimer = m_Settings.transferInterval;
+			SendTransferRequest();
+		}
+	}
+}
+
+void SimulatedClient::CollectReport(SimulatorReport& report) {
+	CollectConnectionStatistics();
+
+	if (m_ServerAddress != UNASSIGNED_SYSTEM_ADDRESS) {
+		auto& server = m_Report.servers[m_ServerName];
+		server.clients++;
+
+		const auto ping = m_Peer->GetAveragePing(m_ServerAddress);
+		if (ping >= 0) {
+			server.pingTotal += ping;
+			server.pingSamples++;
+		}
+	}
+
+	switch (m_State) {
+	case eSimulatedClientState::IN_WORLD:
+		report.clientsInWorld++;
+		break;
+	case eSimulatedClientState::FAILED:
+		report.clientsFailed++;
+		break;
+	case eSimulatedClientState::IDLE:
+		break;
+	default:
+		report.clientsLoading++;
+		break;
+	}
+
+	for (const auto& [name, collected] : m_Report.servers) {
+		auto& server = report.servers[name];
+		server.clients += collected.clients;
+		server.bytesSent += collected.bytesSent;
+		server.bytesReceived += collected.bytesReceived;
+		server.pingTotal += collected.pingTotal;
+		server.pingSamples += collected.pingSamples;
+		server.roundTripTotal += collected.roundTripTotal;
+		server.roundTripMax = std::max(server.roundTripMax, collected.roundTripMax);
+		server.roundTripSamples += collected.roundTripSamples;
+	}
+
+	report.logins += m_Report.logins;
+	report.loginTotal += m_Report.loginTotal;
+	report.loginMax = std::max(report.loginMax, m_Report.loginMax);
+	report.zoneLoads += m_Report.zoneLoads;
+	report.zoneLoadTotal += m_Report.zoneLoadTotal;
+	report.zoneLoadMax = std::max(report.zoneLoadMax, m_Report.zoneLoadMax);
+	report.failures += m_Report.failures;
+	report.packetsSent += m_Report.packetsSent;
+	report.packetsReceived += m_Report.packetsReceived;
+
+	m_Report = SimulatorReport();
+}
+
+void SimulatedClient::HandlePacket(Packet* packet) {
+	switch (packet->data[0]) {
+	case ID_CONNECTION_REQUEST_ACCEPTED:
+		HandleConnected(packet);
+		return;
+	case ID_CONNECTION_ATTEMPT_FAILED:
+	case ID_NO_FREE_INCOMING_CONNECTIONS:
+	case ID_INVALID_PASSWORD:
+		Fail("Unable to connect to " + m_ServerName);
+		return;
+	case ID_DISCONNECTION_NOTIFICATION:
+	case ID_CONNECTION_LOST:
+		// Servers we have already moved on from may still say goodbye
+		if (packet->systemAddress != m_ServerAddress) return;
+
+		CollectConnectionStatistics();
+		m_ServerAddress = UNASSIGNED_SYSTEM_ADDRESS;
+		Fail("Disconnected by " + m_ServerName);
+		return;
+	case ID_USER_PACKET_ENUM:
+		break;
+	default:
+		return;
+	}
+
+	if (packet->length < 8) return;
+
+	if (packet->data[1] == SERVER && packet->data[3] == MSG_SERVER_VERSION_CONFIRM) {
+		HandleServerHandshake();
+		return;
+	}
+
+	if (packet->data[1] != CLIENT) return;
+
+	switch (packet->data[3]) {
+	case MSG_CLIENT_LOGIN_RESPONSE:
+		HandleLoginResponse(packet);
+		break;
+	case MSG_CLIENT_CHARACTER_LIST_RESPONSE:
+		HandleCharacterList(packet);
+		break;
+	case MSG_CLIENT_CHARACTER_CREATE_RESPONSE:
+		HandleCharacterCreateResponse(packet);
+		break;
+	case MSG_CLIENT_TRANSFER_TO_WORLD:
+		HandleTransferToWorld(packet);
+		break;
+	case MSG_CLIENT_LOAD_STATIC_ZONE:
+		HandleLoadStaticZone(packet);
+		break;
+	case MSG_CLIENT_CREATE_CHARACTER:
+		HandleCharacterData();
+		break;
+	case MSG_CLIENT_CHAT_MODERATION_STRING:
+		HandleChatModerationResponse(packet);
+		break;
+	case MSG_CLIENT_GAME_MSG:
+		HandleGameMessage(packet);
+		break;
+	default:
+		break;
+	}
+}
+
+void SimulatedClient::HandleConnected(Packet* packet) {
+	m_ServerAddress = packet->systemAddress;
+	m_CollectedBitsSent = 0;
+	m_CollectedBitsReceived = 0;
+
+	SendHandshake();
+}
+
+void SimulatedClient::HandleServerHandshake() {
+	if (m_ConnectedToAuth) {
+		SendLoginRequest();
+		SetState(eSimulatedClientState::LOGGING_IN);
+	} else {
+		SendSessionValidation();
+	}
+}
+
+void SimulatedClient::HandleLoginResponse(Packet* packet) {
+	if (packet->length < 413) return;
+
+	const auto responseCode = packet->data[8];
+	if (responseCode != LOGIN_RESPONSE_SUCCESS) {
+		Fail("Login refused with code " + std::to_string(responseCode));
+		return;
+	}
+
+	const auto loginTime = SecondsSince(m_LoginStart);
+	m_Report.logins++;
+	m_Report.loginTotal += loginTime;
+	m_Report.loginMax = std::max(m_Report.loginMax, loginTime);
+
+	m_SessionKey = PacketUtils::ReadString(279, packet, true);
+	const auto worldIP = PacketUtils::ReadString(345, packet, false);
+	const auto worldPort = PacketUtils::ReadPacketU16(411, packet);
+
+	Connect(worldIP, worldPort, eSimulatedClientState::CONNECTING_TO_WORLD);
+}
+
+void SimulatedClient::HandleCharacterList(Packet* packet) {
+	if (packet->length < 10) return;
+
+	SetState(eSimulatedClientState::SELECTING_CHARACTER);
+
+	const auto characterCount = packet->data[8];
+	if (characterCount == 0) {
+		SendCharacterCreateRequest();
+		return;
+	}
+
+	m_CharacterID = PacketUtils::ReadPacketS64(10, packet);
+	SendCharacterLoginRequest();
+}
+
+void SimulatedClient::HandleCharacterCreateResponse(Packet* packet) {
+	if (packet->length < 9) return;
+
+	const auto responseCode = packet->data[8];
+
+	// The server sends the new character list on success
+	if (responseCode == CREATION_RESPONSE_SUCCESS) return;
+
+	if (responseCode == CREATION_RESPONSE_PREDEFINED_NAME_IN_USE && m_CreateAttempts < maxCreateAttempts) {
+		SendCharacterCreateRequest();
+		return;
+	}
+
+	Fail("Character creation refused with code " + std::to_string(responseCode));
+}
+
+void SimulatedClient::HandleTransferToWorld(Packet* packet) {
+	if (packet->length < 43) return;
+
+	const auto worldIP = PacketUtils::ReadString(8, packet, false);
+	const auto worldPort = PacketUtils::ReadPacketU16(41, packet);
+
+	m_ZoneLoadStart = std::chrono::steady_clock::now();
+	Connect(worldIP, worldPort, eSimulatedClientState::CONNECTING_TO_WORLD);
+}
+
+void SimulatedClient::HandleLoadStaticZone(Packet* packet) {
+	CINSTREAM;
+	inStream.IgnoreBytes(8);
+
+	uint16_t zoneID = 0;
+	inStream.Read(zoneID);
+	inStream.IgnoreBytes(12);
+	inStream.Read(m_SpawnPosition.x);
+	inStream.Read(m_SpawnPosition.y);
+	inStream.Read(m_SpawnPosition.z);
+
+	m_ZoneID = zoneID;
+
+	SetState(eSimulatedClientState::LOADING_ZONE);
+	SendLevelLoadComplete();
+}
+
+void SimulatedClient::HandleCharacterData() {
+	const auto zoneLoadTime = SecondsSince(m_ZoneLoadStart);
+	m_Report.zoneLoads++;
+	m_Report.zoneLoadTotal += zoneLoadTime;
+	m_Report.zoneLoadMax = std::max(m_Report.zoneLoadMax, zoneLoadTime);
+
+	SendPlayerLoaded();
+	SetState(eSimulatedClientState::IN_WORLD);
+}
+
+void SimulatedClient::HandleChatModerationResponse(Packet* packet) {
+	if (packet->length < 12) return;
+
+	const auto requestID = packet->data[11];
+	const auto request = m_PendingChatRequests.find(requestID);
+	if (request == m_PendingChatRequests.end()) return;
+
+	// The server answers the string check right away, so it doubles as a round trip measurement
+	const auto roundTrip = SecondsSince(request->second);
+	m_PendingChatRequests.erase(request);
+
+	auto& server = m_Report.servers[m_ServerName];
+	server.roundTripTotal += roundTrip;
+	server.roundTripMax = std::max(server.roundTripMax, roundTrip);
+	server.roundTripSamples++;
+
+	const auto approved = packet->data[8] != 0;
+	if (approved) SendChatMessage();
+}
+
+void SimulatedClient::HandleGameMessage(Packet* packet) {
+	if (!m_Settings.pickupLoot || packet->length < 18) return;
+
+	CINSTREAM;
+	inStream.IgnoreBytes(8);
+
+	LWOOBJID objectID;
+	uint16_t messageID;
+	inStream.Read(objectID);
+	inStream.Read(messageID);
+
+	if (objectID != m_CharacterID || messageID != GAME_MSG_DROP_CLIENT_LOOT) return;
+
+	bool usePosition;
+	bool hasFinalPosition;
+	inStream.Read(usePosition);
+	inStream.Read(hasFinalPosition);
+	if (hasFinalPosition) inStream.IgnoreBytes(sizeof(NiPoint3));
+
+	int32_t currency = 0;
+	LOT item = LOT_NULL;
+	LWOOBJID lootID = LWOOBJID_EMPTY;
+	inStream.Read(currency);
+	inStream.Read(item);
+	inStream.Read(lootID);
+
+	if (currency != 0) SendPickupCurrency(currency);
+	if (lootID != LWOOBJID_EMPTY) SendPickupItem(lootID);
+}
+
+void SimulatedClient::SendHandshake() {
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, SERVER, MSG_SERVER_VERSION_CONFIRM);
+	bitStream.Write<uint32_t>(NET_VERSION);
+	bitStream.Write<uint32_t>(0x93);
+	bitStream.Write<uint32_t>(4); // Connection type: client
+	bitStream.Write<uint32_t>(clientProcessID);
+	bitStream.Write<uint16_t>(clientPort);
+	Send(bitStream);
+}
+
+void SimulatedClient::SendLoginRequest() {
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, AUTH, MSG_AUTH_LOGIN_REQUEST);
+	PacketUtils::WriteWString(bitStream, m_Username, 33);
+	PacketUtils::WriteWString(bitStream, m_Settings.password, 41);
+	Send(bitStream);
+}
+
+void SimulatedClient::SendSessionValidation() {
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_VALIDATION);
+	PacketUtils::WriteWString(bitStream, m_Username, 33);
+	PacketUtils::WriteWString(bitStream, m_SessionKey, 33);
+
+	// The fdb checksum, servers with check_fdb enabled will refuse the client
+	PacketUtils::WriteString(bitStream, "", 33);
+	Send(bitStream);
+}
+
+void SimulatedClient::SendCharacterCreateRequest() {
+	m_CreateAttempts++;
+
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_CHARACTER_CREATE_REQUEST);
+
+	// The custom name awaits approval, the character plays under the predefined name until then
+	PacketUtils::WriteWString(bitStream, m_Username, 33);
+	bitStream.Write(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 50));
+	bitStream.Write(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 50));
+	bitStream.Write(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 50));
+	PacketUtils::WriteString(bitStream, "", 9);
+
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 15)); // Shirt color
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 34)); // Shirt style
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 15)); // Pants color
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 10)); // Hair style
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 10)); // Hair color
+	bitStream.Write<uint32_t>(0); // Left hand
+	bitStream.Write<uint32_t>(0); // Right hand
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 20)); // Eyebrows
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 20)); // Eyes
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 20)); // Mouth
+	Send(bitStream);
+}
+
+void SimulatedClient::SendCharacterLoginRequest() {
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_LOGIN_REQUEST);
+	bitStream.Write(m_CharacterID);
+	Send(bitStream);
+
+	m_ZoneLoadStart = std::chrono::steady_clock::now();
+}
+
+void SimulatedClient::SendLevelLoadComplete() {
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_LEVEL_LOAD_COMPLETE);
+	bitStream.Write<uint16_t>(m_ZoneID);
+	bitStream.Write<uint16_t>(0);
+	bitStream.Write<uint32_t>(0);
+	Send(bitStream);
+}
+
+void SimulatedClient::SendGameMessage(RakNet::BitStream& payload) {
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_GAME_MSG);
+	bitStream.Write(m_CharacterID);
+	bitStream.Write(payload);
+	Send(bitStream);
+}
+
+void SimulatedClient::SendPlayerLoaded() {
+	RakNet::BitStream payload;
+	payload.Write<uint16_t>(GAME_MSG_PLAYER_LOADED);
+	payload.Write(m_CharacterID);
+	SendGameMessage(payload);
+}
+
+void SimulatedClient::SendPositionUpdate() {
+	const auto x = m_SpawnPosition.x + std::cos(m_MoveAngle) * m_Settings.moveRadius;
+	const auto z = m_SpawnPosition.z + std::sin(m_MoveAngle) * m_Settings.moveRadius;
+
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_POSITION_UPDATE);
+	bitStream.Write(x);
+	bitStream.Write(m_SpawnPosition.y);
+	bitStream.Write(z);
+
+	// Face the direction we are walking in
+	const auto heading = -m_MoveAngle / 2.0f;
+	bitStream.Write(0.0f);
+	bitStream.Write(std::sin(heading));
+	bitStream.Write(0.0f);
+	bitStream.Write(std::cos(heading));
+
+	bitStream.Write(true); // On ground
+	bitStream.Write(false); // On rail
+
+	bitStream.Write(true);
+	bitStream.Write(-std::sin(m_MoveAngle) * m_Settings.moveSpeed);
+	bitStream.Write(0.0f);
+	bitStream.Write(std::cos(m_MoveAngle) * m_Settings.moveSpeed);
+
+	bitStream.Write(false); // Angular velocity
+	Send(bitStream);
+}
+
+void SimulatedClient::SendChatRequest() {
+	const auto requestID = m_NextChatRequestID++;
+	m_PendingChatRequests[requestID] = std::chrono::steady_clock::now();
+
+	const std::u16string message = u"hello from " + GeneralUtils::ASCIIToUTF16(m_Username);
+
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_STRING_CHECK);
+	bitStream.Write<uint8_t>(0); // Chat level
+	bitStream.Write<uint8_t>(requestID);
+	PacketUtils::WriteWString(bitStream, u"", 42); // Receiver, none for public chat
+	bitStream.Write<uint16_t>(message.size());
+	for (const auto character : message) bitStream.Write<uint16_t>(character);
+	Send(bitStream);
+}
+
+void SimulatedClient::SendChatMessage() {
+	const std::u16string message = u"hello from " + GeneralUtils::ASCIIToUTF16(m_Username);
+
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, WORLD, MSG_WORLD_CLIENT_GENERAL_CHAT_MESSAGE);
+	bitStream.Write<uint8_t>(4); // Public channel
+	bitStream.Write<uint16_t>(0);
+	bitStream.Write<uint32_t>(message.size() + 1);
+	for (const auto character : message) bitStream.Write<uint16_t>(character);
+	bitStream.Write<uint16_t>(0);
+	Send(bitStream);
+}
+
+void SimulatedClient::SendStartSkill() {
+	RakNet::BitStream payload;
+	WriteStartSkill(payload, m_CharacterID, m_Settings.skillID, m_NextSkillHandle++);
+	SendGameMessage(payload);
+}
+
+void SimulatedClient::WriteStartSkill(RakNet::BitStream& payload, const LWOOBJID characterID, const uint32_t skillID, const uint32_t skillHandle) {
+	payload.Write<uint16_t>(GAME_MSG_START_SKILL);
+	payload.Write(false); // Used mouse
+	payload.Write(false); // Consumable item
+	payload.Write(false); // Caster latency
+	payload.Write(false); // Cast type
+	payload.Write(false); // Last clicked position
+	payload.Write(characterID);
+	payload.Write(false); // Target
+	payload.Write(false); // Originator rotation
+	payload.Write<uint32_t>(0); // Behavior bitstream, the server falls back to its defaults
+	payload.Write(skillID);
+	payload.Write(true);
+	payload.Write(skillHandle);
+}
+
+void SimulatedClient::SendPickupItem(const LWOOBJID lootID) {
+	RakNet::BitStream payload;
+	payload.Write<uint16_t>(GAME_MSG_PICKUP_ITEM);
+	payload.Write(lootID);
+	payload.Write(m_CharacterID);
+	SendGameMessage(payload);
+}
+
+void SimulatedClient::SendPickupCurrency(const int32_t currency) {
+	RakNet::BitStream payload;
+	payload.Write<uint16_t>(GAME_MSG_PICKUP_CURRENCY);
+	payload.Write<uint32_t>(currency);
+	SendGameMessage(payload);
+}
+
+void SimulatedClient::SendTransferRequest() {
+	// Pick a zone other than the one we are in
+	auto zoneID = m_Settings.transferZones[GeneralUtils::GenerateRandomNumber<size_t>(0, m_Settings.transferZones.size() - 1)];
+	if (zoneID == m_ZoneID) return;
+
+	const auto command = u"/testmap " + GeneralUtils::to_u16string(zoneID);
+
+	RakNet::BitStream payload;
+	payload.Write<uint16_t>(GAME_MSG_PARSE_CHAT_MESSAGE);
+	payload.Write<int32_t>(0); // Client state
+	payload.Write<uint32_t>(command.size());
+	for (const auto character : command) payload.Write<uint16_t>(character);
+	SendGameMessage(payload);
+}
+
+void SimulatedClient::Connect(const std::string& ip, const uint16_t port, const eSimulatedClientState state) {
+	Disconnect();
+
+	m_ConnectedToAuth = state == eSimulatedClientState::CONNECTING_TO_AUTH;
+	m_ServerName = ip + ":" + std::to_string(port);
+	SetState(state);
+
+	if (!m_Peer->Connect(ip.c_str(), port, clientPassword, clientPasswordLength)) {
+		Fail("Unable to connect to " + m_ServerName);
+	}
+}
+
+void SimulatedClient::Disconnect() {
+	if (m_ServerAddress == UNASSIGNED_SYSTEM_ADDRESS) return;
+
+	CollectConnectionStatistics();
+	m_Peer->CloseConnection(m_ServerAddress, true);
+	m_ServerAddress = UNASSIGNED_SYSTEM_ADDRESS;
+}
+
+void SimulatedClient::Send(RakNet::BitStream& bitStream) {
+	if (m_ServerAddress == UNASSIGNED_SYSTEM_ADDRESS) return;
+
+	m_Peer->Send(&bitStream, SYSTEM_PRIORITY, RELIABLE_ORDERED, 0, m_ServerAddress, false);
+	m_Report.packetsSent++;
+}
+
+void SimulatedClient::Fail(const std::string& reason) {
+	Game::logger->Log("SimulatedClient", "%s: %s", m_Username.c_str(), reason.c_str());
+
+	Disconnect();
+	m_Report.failures++;
+	SetState(eSimulatedClientState::FAILED);
+}
+
+void SimulatedClient::SetState(const eSimulatedClientState state) {
+	m_State = state;
+	m_StateTime = 0.0f;
+}
+
+void SimulatedClient::CollectConnectionStatistics() {
+	if (m_ServerAddress == UNASSIGNED_SYSTEM_ADDRESS) return;
+
+	auto* statistics = m_Peer->GetStatistics(m_ServerAddress);
+	if (statistics == nullptr) return;
+
+	auto& server = m_Report.servers[m_ServerName];
+	server.bytesSent += (statistics->totalBitsSent - m_CollectedBitsSent) / 8;
+	server.bytesReceived += (statistics->bitsReceived - m_CollectedBitsReceived) / 8;
+
+	m_CollectedBitsSent = statistics->totalBitsSent;
+	m_CollectedBitsReceived = statistics->bitsReceived;
+}
+
+double SimulatedClient::SecondsSince(const std::chrono::steady_clock::time_point& start) const {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
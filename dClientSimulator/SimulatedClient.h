@@ -0,0 +1,244 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "dCommonVars.h"
+#include "NiPoint3.h"
+#include "RakNetTypes.h"
+#include "BitStream.h"
+
+class RakPeerInterface;
+
+/**
+ * The settings every simulated client shares, read from simulatorconfig.ini
+ */
+struct SimulatedClientSettings {
+	std::string authIP = "localhost";
+	uint16_t authPort = 1001;
+	std::string password;
+
+	/**
+	 * Seconds a client may wait on a server before the attempt is counted as failed and retried
+	 */
+	float timeout = 30.0f;
+
+	float retryDelay = 10.0f;
+
+	float moveInterval = 0.2f;
+	float moveRadius = 10.0f;
+	float moveSpeed = 6.0f;
+
+	/**
+	 * Seconds between actions, 0 disables the action
+	 */
+	float chatInterval = 30.0f;
+	float skillInterval = 0.0f;
+	float transferInterval = 0.0f;
+
+	/**
+	 * The skill cast every skill interval
+	 */
+	uint32_t skillID = 0;
+
+	bool pickupLoot = true;
+
+	/**
+	 * Zones clients move between using /testmap, this needs accounts of at least forum moderator level
+	 */
+	std::vector<LWOMAPID> transferZones;
+};
+
+/**
+ * The traffic and latency one server saw from the simulated clients since the last report
+ */
+struct SimulatedServerReport {
+	uint32_t clients = 0;
+	uint64_t bytesSent = 0;
+	uint64_t bytesReceived = 0;
+	int64_t pingTotal = 0;
+	uint32_t pingSamples = 0;
+	double roundTripTotal = 0.0;
+	double roundTripMax = 0.0;
+	uint32_t roundTripSamples = 0;
+};
+
+/**
+ * Everything collected from the simulated clients since the last report
+ */
+struct SimulatorReport {
+	/**
+	 * Keyed by the ip:port of the server
+	 */
+	std::map<std::string, SimulatedServerReport> servers;
+
+	uint32_t clientsInWorld = 0;
+	uint32_t clientsLoading = 0;
+	uint32_t clientsFailed = 0;
+
+	uint32_t logins = 0;
+	double loginTotal = 0.0;
+	double loginMax = 0.0;
+
+	uint32_t zoneLoads = 0;
+	double zoneLoadTotal = 0.0;
+	double zoneLoadMax = 0.0;
+
+	uint32_t failures = 0;
+	uint32_t packetsSent = 0;
+	uint32_t packetsReceived = 0;
+};
+
+enum class eSimulatedClientState : uint8_t {
+	IDLE,
+	CONNECTING_TO_AUTH,
+	LOGGING_IN,
+	CONNECTING_TO_WORLD,
+	SELECTING_CHARACTER,
+	LOADING_ZONE,
+	IN_WORLD,
+	FAILED
+};
+
+/**
+ * A headless client which logs in through the auth server, selects or creates a character, loads into a zone and
+ * then produces the traffic a player would: movement, chat, skill casts, loot pickups and zone transfers.
+ */
+class SimulatedClient {
+public:
+	SimulatedClient(const std::string& username, const SimulatedClientSettings& settings);
+	~SimulatedClient();
+
+	/**
+	 * Starts logging in through the auth server
+	 */
+	void Start();
+
+	/**
+	 * Handles received packets and produces the traffic that is due
+	 * @param deltaTime seconds since the last update
+	 */
+	void Update(float deltaTime);
+
+	/**
+	 * Adds everything collected since the last call to the report and starts collecting anew
+	 * @param report the report to add to
+	 */
+	void CollectReport(SimulatorReport& report);
+
+	/**
+	 * Disconnects from the server the client is connected to
+	 */
+	void Stop();
+
+	eSimulatedClientState GetState() const { return m_State; }
+
+	const std::string& GetUsername() const { return m_Username; }
+
+	/**
+	 * Writes the start skill game message a client sends to cast a skill, without a behavior bitstream
+	 * @param payload the stream to write the message to
+	 * @param characterID the character casting the skill
+	 * @param skillID the skill to cast
+	 * @param skillHandle the handle of the cast
+	 */
+	static void WriteStartSkill(RakNet::BitStream& payload, LWOOBJID characterID, uint32_t skillID, uint32_t skillHandle);
+
+private:
+	void HandlePacket(Packet* packet);
+	void HandleConnected(Packet* packet);
+	void HandleServerHandshake();
+	void HandleLoginResponse(Packet* packet);
+	void HandleCharacterList(Packet* packet);
+	void HandleCharacterCreateResponse(Packet* packet);
+	void HandleTransferToWorld(Packet* packet);
+	void HandleLoadStaticZone(Packet* packet);
+	void HandleCharacterData();
+	void HandleChatModerationResponse(Packet* packet);
+	void HandleGameMessage(Packet* packet);
+
+	void SendHandshake();
+	void SendLoginRequest();
+	void SendSessionValidation();
+	void SendCharacterCreateRequest();
+	void SendCharacterLoginRequest();
+	void SendLevelLoadComplete();
+	void SendGameMessage(RakNet::BitStream& payload);
+	void SendPlayerLoaded();
+	void SendPositionUpdate();
+	void SendChatRequest();
+	void SendChatMessage();
+	void SendStartSkill();
+	void SendPickupItem(LWOOBJID lootID);
+	void SendPickupCurrency(int32_t currency);
+	void SendTransferRequest();
+
+	/**
+	 * Connects to a server, disconnecting from the current one first
+	 */
+	void Connect(const std::string& ip, uint16_t port, eSimulatedClientState state);
+	void Disconnect();
+	void Send(RakNet::BitStream& bitStream);
+
+	/**
+	 * Gives up on the current attempt, the client starts over from the auth server after the retry delay
+	 */
+	void Fail(const std::string& reason);
+
+	void SetState(eSimulatedClientState state);
+
+	/**
+	 * Moves the traffic counters of the current connection into the report of its server
+	 */
+	void CollectConnectionStatistics();
+
+	double SecondsSince(const std::chrono::steady_clock::time_point& start) const;
+
+	std::string m_Username;
+	const SimulatedClientSettings& m_Settings;
+
+	RakPeerInterface* m_Peer = nullptr;
+	SystemAddress m_ServerAddress = UNASSIGNED_SYSTEM_ADDRESS;
+	std::string m_ServerName;
+	bool m_ConnectedToAuth = false;
+
+	eSimulatedClientState m_State = eSimulatedClientState::IDLE;
+
+	/**
+	 * Seconds spent in the current state
+	 */
+	float m_StateTime = 0.0f;
+
+	std::string m_SessionKey;
+	LWOOBJID m_CharacterID = LWOOBJID_EMPTY;
+	uint32_t m_CreateAttempts = 0;
+	LWOMAPID m_ZoneID = LWOMAPID_INVALID;
+
+	std::chrono::steady_clock::time_point m_LoginStart;
+	std::chrono::steady_clock::time_point m_ZoneLoadStart;
+
+	NiPoint3 m_SpawnPosition = NiPoint3::ZERO;
+	float m_MoveAngle = 0.0f;
+
+	float m_MoveTimer = 0.0f;
+	float m_ChatTimer = 0.0f;
+	float m_SkillTimer = 0.0f;
+	float m_TransferTimer = 0.0f;
+
+	uint8_t m_NextChatRequestID = 0;
+	std::map<uint8_t, std::chrono::steady_clock::time_point> m_PendingChatRequests;
+	uint32_t m_NextSkillHandle = 1;
+
+	/**
+	 * What was collected since the last report
+	 */
+	SimulatorReport m_Report;
+
+	/**
+	 * The traffic counters of the current connection when they were last collected
+	 */
+	uint64_t m_CollectedBitsSent = 0;
+	uint64_t m_CollectedBitsReceived = 0;
+};
@@ -1,21 +1,89 @@
 #include "BrickByBrickFix.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "tinyxml2.h"
 
 #include "Database.h"
 #include "Game.h"
+#include "Sd0.h"
 #include "ZCompression.h"
 #include "dLogger.h"
 
 //! Forward declarations
 
-std::unique_ptr<sql::ResultSet> GetModelsFromDatabase();
-void WriteSd0Magic(char* input, uint32_t chunkSize);
-bool CheckSd0Magic(sql::Blob* streamToCheck);
+std::unique_ptr<sql::ResultSet> GetModelsFromDatabase(const std::string& condition = "");
+std::string ReadBlob(sql::Blob* blob);
+
+/**
+ * @brief A model read from the ugc table, along with the result of validating it
+ */
+struct UgcModelValidation {
+	uint64_t modelId{};
+	std::string sd0{};
+	bool isBroken = false;
+	bool failedToInflate = false;
+	int32_t inflateError{};
+};
+
+/**
+ * @brief Number of models that are read into memory and validated in parallel at once
+ */
+constexpr uint32_t VALIDATION_BATCH_SIZE = 256;
+
+/**
+ * @brief Checks whether a single model is an sd0 file with valid xml, or at least an untruncated LXFML document.
+ *
+ * @param model The model to validate
+ */
+void ValidateModel(UgcModelValidation& model) {
+	std::istringstream modelAsSd0(model.sd0);
+
+	// Check that header is sd0 by checking for the sd0 magic.
+	if (!Sd0::CheckMagic(modelAsSd0)) {
+		model.isBroken = true;
+		return;
+	}
+
+	std::string completeUncompressedModel{};
+	model.failedToInflate = !Sd0::Decompress(modelAsSd0, completeUncompressedModel, model.inflateError);
+
+	tinyxml2::XMLDocument document;
+	if (document.Parse(completeUncompressedModel.c_str(), completeUncompressedModel.size()) == tinyxml2::XML_SUCCESS) return;
+
+	model.isBroken = completeUncompressedModel.find(
+		"</LXFML>",
+		completeUncompressedModel.length() >= 15 ? completeUncompressedModel.length() - 15 : 0) == std::string::npos;
+}
+
+/**
+ * @brief Validates a batch of models, spreading the inflating and xml parsing over every core.
+ *
+ * @param models The models to validate
+ */
+void ValidateModels(std::vector<UgcModelValidation>& models) {
+	const auto workerCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1U), models.size());
+	std::atomic<size_t> nextModel{ 0 };
+
+	std::vector<std::thread> workers;
+	workers.reserve(workerCount);
+
+	for (size_t i = 0; i < workerCount; i++) {
+		workers.emplace_back([&models, &nextModel]() {
+			for (auto index = nextModel++; index < models.size(); index = nextModel++) {
+				ValidateModel(models[index]);
+			}
+			});
+	}
+
+	for (auto& worker : workers) worker.join();
+}
 
 /**
  * @brief Truncates all models with broken data from the database.
@@ -27,74 +95,48 @@ uint32_t BrickByBrickFix::TruncateBrokenBrickByBrickXml() {
 	auto modelsToTruncate = GetModelsFromDatabase();
 	bool previousCommitValue = Database::GetAutoCommit();
 	Database::SetAutoCommit(false);
-	while (modelsToTruncate->next()) {
-		std::unique_ptr<sql::PreparedStatement> ugcModelToDelete(Database::CreatePreppedStmt("DELETE FROM ugc WHERE ugc.id = ?;"));
-		std::unique_ptr<sql::PreparedStatement> pcModelToDelete(Database::CreatePreppedStmt("DELETE FROM properties_contents WHERE ugc_id = ?;"));
-		std::string completeUncompressedModel{};
-		uint32_t chunkCount{};
-		uint64_t modelId = modelsToTruncate->getInt(1);
-		std::unique_ptr<sql::Blob> modelAsSd0(modelsToTruncate->getBlob(2));
-		// Check that header is sd0 by checking for the sd0 magic.
-		if (CheckSd0Magic(modelAsSd0.get())) {
-			while (true) {
-				uint32_t chunkSize{};
-				modelAsSd0->read(reinterpret_cast<char*>(&chunkSize), sizeof(uint32_t)); // Extract chunk size from istream
-
-				// Check if good here since if at the end of an sd0 file, this will have eof flagged.
-				if (!modelAsSd0->good()) break;
-
-				std::unique_ptr<uint8_t[]> compressedChunk(new uint8_t[chunkSize]);
-				for (uint32_t i = 0; i < chunkSize; i++) {
-					compressedChunk[i] = modelAsSd0->get();
-				}
-
-				// Ignore the valgrind warning about uninitialized values.  These are discarded later when we know the actual uncompressed size.
-				std::unique_ptr<uint8_t[]> uncompressedChunk(new uint8_t[ZCompression::MAX_SD0_CHUNK_SIZE]);
-				int32_t err{};
-				int32_t actualUncompressedSize = ZCompression::Decompress(
-					compressedChunk.get(), chunkSize, uncompressedChunk.get(), ZCompression::MAX_SD0_CHUNK_SIZE, err);
-
-				if (actualUncompressedSize != -1) {
-					uint32_t previousSize = completeUncompressedModel.size();
-					completeUncompressedModel.append((char*)uncompressedChunk.get());
-					completeUncompressedModel.resize(previousSize + actualUncompressedSize);
-				} else {
-					Game::logger->Log("BrickByBrickFix", "Failed to inflate chunk %i for model %llu.  Error: %i", chunkCount, modelId, err);
-					break;
-				}
-				chunkCount++;
-			}
-			std::unique_ptr<tinyxml2::XMLDocument> document = std::make_unique<tinyxml2::XMLDocument>();
-			if (!document) {
-				Game::logger->Log("BrickByBrickFix", "Failed to initialize tinyxml document.  Aborting.");
-				return 0;
-			}
 
-			if (!(document->Parse(completeUncompressedModel.c_str(), completeUncompressedModel.size()) == tinyxml2::XML_SUCCESS)) {
-				if (completeUncompressedModel.find(
-					"</LXFML>",
-					completeUncompressedModel.length() >= 15 ? completeUncompressedModel.length() - 15 : 0) == std::string::npos
-					) {
-					Game::logger->Log("BrickByBrickFix",
-						"Brick-by-brick model %llu will be deleted!", modelId);
-					ugcModelToDelete->setInt64(1, modelsToTruncate->getInt64(1));
-					pcModelToDelete->setInt64(1, modelsToTruncate->getInt64(1));
-					ugcModelToDelete->execute();
-					pcModelToDelete->execute();
-					modelsTruncated++;
-				}
+	std::unique_ptr<sql::PreparedStatement> ugcModelToDelete(Database::CreatePreppedStmt("DELETE FROM ugc WHERE ugc.id = ?;"));
+	std::unique_ptr<sql::PreparedStatement> pcModelToDelete(Database::CreatePreppedStmt("DELETE FROM properties_contents WHERE ugc_id = ?;"));
+
+	std::vector<UgcModelValidation> batch{};
+	batch.reserve(VALIDATION_BATCH_SIZE);
+
+	// The database is only touched from this thread, the workers just inflate and parse what was read.
+	const auto truncateBrokenModels = [&]() {
+		ValidateModels(batch);
+
+		for (const auto& model : batch) {
+			if (model.failedToInflate) {
+				Game::logger->Log("BrickByBrickFix", "Failed to inflate model %llu.  Error: %i", model.modelId, model.inflateError);
 			}
-		} else {
-			Game::logger->Log("BrickByBrickFix",
-				"Brick-by-brick model %llu will be deleted!", modelId);
-			ugcModelToDelete->setInt64(1, modelsToTruncate->getInt64(1));
-			pcModelToDelete->setInt64(1, modelsToTruncate->getInt64(1));
+
+			if (!model.isBroken) continue;
+
+			Game::logger->Log("BrickByBrickFix", "Brick-by-brick model %llu will be deleted!", model.modelId);
+			ugcModelToDelete->setInt64(1, model.modelId);
+			pcModelToDelete->setInt64(1, model.modelId);
 			ugcModelToDelete->execute();
 			pcModelToDelete->execute();
 			modelsTruncated++;
 		}
+
+		batch.clear();
+	};
+
+	while (modelsToTruncate->next()) {
+		std::unique_ptr<sql::Blob> modelAsSd0(modelsToTruncate->getBlob(2));
+
+		UgcModelValidation model{};
+		model.modelId = modelsToTruncate->getInt64(1);
+		model.sd0 = ReadBlob(modelAsSd0.get());
+		batch.push_back(std::move(model));
+
+		if (batch.size() >= VALIDATION_BATCH_SIZE) truncateBrokenModels();
 	}
 
+	if (!batch.empty()) truncateBrokenModels();
+
 	Database::Commit();
 	Database::SetAutoCommit(previousCommitValue);
 	return modelsTruncated;
@@ -114,40 +156,33 @@ uint32_t BrickByBrickFix::UpdateBrickByBrickModelsToSd0() {
 	std::unique_ptr<sql::PreparedStatement> insertionStatement(Database::CreatePreppedStmt("UPDATE ugc SET lxfml = ? WHERE id = ?;"));
 	while (modelsToUpdate->next()) {
 		int64_t modelId = modelsToUpdate->getInt64(1);
-		std::unique_ptr<sql::Blob> oldLxfml(modelsToUpdate->getBlob(2));
+		std::unique_ptr<sql::Blob> oldLxfmlBlob(modelsToUpdate->getBlob(2));
+		const auto oldLxfml = ReadBlob(oldLxfmlBlob.get());
+
 		// Check if the stored blob starts with zlib magic (0x78 0xDA - best compression of zlib)
 		// If it does, convert it to sd0.
-		if (oldLxfml->get() == 0x78 && oldLxfml->get() == 0xDA) {
-
-			// Get and save size of zlib compressed chunk.
-			oldLxfml->seekg(0, std::ios::end);
-			uint32_t oldLxfmlSize = static_cast<uint32_t>(oldLxfml->tellg());
-			oldLxfml->seekg(0);
-
-			// Allocate 9 extra bytes.  5 for sd0 magic, 4 for the only zlib compressed size.
-			uint32_t oldLxfmlSizeWithHeader = oldLxfmlSize + 9;
-			std::unique_ptr<char[]> sd0ConvertedModel(new char[oldLxfmlSizeWithHeader]);
-
-			WriteSd0Magic(sd0ConvertedModel.get(), oldLxfmlSize);
-			for (uint32_t i = 9; i < oldLxfmlSizeWithHeader; i++) {
-				sd0ConvertedModel.get()[i] = oldLxfml->get();
-			}
-
-			std::string outputString(sd0ConvertedModel.get(), oldLxfmlSizeWithHeader);
-			std::istringstream outputStringStream(outputString);
-
-			insertionStatement->setBlob(1, static_cast<std::istream*>(&outputStringStream));
-			insertionStatement->setInt64(2, modelId);
-			try {
-				insertionStatement->executeUpdate();
-				Game::logger->Log("BrickByBrickFix", "Updated model %i to sd0", modelId);
-				updatedModels++;
-			} catch (sql::SQLException exception) {
-				Game::logger->Log(
-					"BrickByBrickFix",
-					"Failed to update model %i.  This model should be inspected manually to see why."
-					"The database error is %s", modelId, exception.what());
-			}
+		if (oldLxfml.size() < 2 || static_cast<uint8_t>(oldLxfml[0]) != 0x78 || static_cast<uint8_t>(oldLxfml[1]) != 0xDA) continue;
+
+		// The whole zlib stream becomes the only chunk of the sd0 file, prefixed by its size.
+		const auto oldLxfmlSize = static_cast<uint32_t>(oldLxfml.size());
+		std::string outputString(Sd0::MAGIC_SIZE, '\0');
+		Sd0::WriteMagic(outputString.data());
+		outputString.append(reinterpret_cast<const char*>(&oldLxfmlSize), sizeof(uint32_t));
+		outputString.append(oldLxfml);
+
+		std::istringstream outputStringStream(outputString);
+
+		insertionStatement->setBlob(1, static_cast<std::istream*>(&outputStringStream));
+		insertionStatement->setInt64(2, modelId);
+		try {
+			insertionStatement->executeUpdate();
+			Game::logger->Log("BrickByBrickFix", "Updated model %i to sd0", modelId);
+			updatedModels++;
+		} catch (sql::SQLException exception) {
+			Game::logger->Log(
+				"BrickByBrickFix",
+				"Failed to update model %i.  This model should be inspected manually to see why."
+				"The database error is %s", modelId, exception.what());
 		}
 	}
 	Database::Commit();
@@ -155,26 +190,50 @@ uint32_t BrickByBrickFix::UpdateBrickByBrickModelsToSd0() {
 	return updatedModels;
 }
 
-std::unique_ptr<sql::ResultSet> GetModelsFromDatabase() {
-	std::unique_ptr<sql::PreparedStatement> modelsRawDataQuery(Database::CreatePreppedStmt("SELECT id, lxfml FROM ugc;"));
+/**
+ * @brief Fills in the content hash of every model that doesn't have one yet,
+ * so new uploads of an identical model can reuse the existing row.
+ *
+ * @return The number of models that were hashed
+ */
+uint32_t BrickByBrickFix::UpdateBrickByBrickModelHashes() {
+	uint32_t hashedModels = 0;
+	auto modelsToHash = GetModelsFromDatabase("WHERE content_hash IS NULL");
+	auto previousAutoCommitState = Database::GetAutoCommit();
+	Database::SetAutoCommit(false);
+	std::unique_ptr<sql::PreparedStatement> updateStatement(Database::CreatePreppedStmt("UPDATE ugc SET content_hash = ? WHERE id = ?;"));
+	while (modelsToHash->next()) {
+		std::unique_ptr<sql::Blob> modelAsSd0(modelsToHash->getBlob(2));
+		const auto model = ReadBlob(modelAsSd0.get());
+
+		updateStatement->setString(1, Sd0::ContentHash(model.data(), model.size()).c_str());
+		updateStatement->setInt64(2, modelsToHash->getInt64(1));
+		updateStatement->executeUpdate();
+		hashedModels++;
+	}
+	Database::Commit();
+	Database::SetAutoCommit(previousAutoCommitState);
+	return hashedModels;
+}
+
+std::unique_ptr<sql::ResultSet> GetModelsFromDatabase(const std::string& condition) {
+	std::unique_ptr<sql::PreparedStatement> modelsRawDataQuery(Database::CreatePreppedStmt("SELECT id, lxfml FROM ugc " + condition + ";"));
 	return std::unique_ptr<sql::ResultSet>(modelsRawDataQuery->executeQuery());
 }
 
 /**
- * @brief Writes sd0 magic at the front of a char*
+ * @brief Reads a whole blob in a single read
  *
- * @param input the char* to write at the front of
- * @param chunkSize The size of the first chunk to write the size of
+ * @param blob The blob to read
+ * @return The contents of the blob
  */
-void WriteSd0Magic(char* input, uint32_t chunkSize) {
-	input[0] = 's';
-	input[1] = 'd';
-	input[2] = '0';
-	input[3] = 0x01;
-	input[4] = 0xFF;
-	*reinterpret_cast<uint32_t*>(input + 5) = chunkSize; // Write the integer to the character array
-}
+std::string ReadBlob(sql::Blob* blob) {
+	blob->seekg(0, std::ios::end);
+	const auto size = static_cast<size_t>(blob->tellg());
+	blob->seekg(0);
+
+	std::string contents(size, '\0');
+	blob->read(contents.data(), size);
 
-bool CheckSd0Magic(sql::Blob* streamToCheck) {
-	return streamToCheck->get() == 's' && streamToCheck->get() == 'd' && streamToCheck->get() == '0' && streamToCheck->get() == 0x01 && streamToCheck->get() == 0xFF;
+	return contents;
 }
@@ -17,4 +17,12 @@ namespace BrickByBrickFix {
 	 * @return The number of BrickByBrick models that were updated
 	 */
 	uint32_t UpdateBrickByBrickModelsToSd0();
+
+	/**
+	 * @brief Computes the content hash of every BrickByBrick model
+	 * in the database that does not have one yet.
+	 *
+	 * @return The number of BrickByBrick models that were hashed
+	 */
+	uint32_t UpdateBrickByBrickModelHashes();
 };
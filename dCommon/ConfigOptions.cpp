@@ -0,0 +1,23 @@
+#include "ConfigOptions.h"
+
+namespace ConfigOptions {
+	ConfigOption<bool> classicSurvivalScoring("classic_survival_scoring", false);
+	ConfigOption<bool> petsTakeImagination("pets_take_imagination", false);
+	ConfigOption<bool> soloRacing("solo_racing", false);
+	ConfigOption<bool> disableExtraBackpack("disable_extra_backpack", false);
+	ConfigOption<bool> disableAntiSpeedhack("disable_anti_speedhack", false);
+
+	ConfigOption<uint32_t> maxRespawnsPerFrame("max_respawns_per_frame", 0);
+
+	ConfigOption<uint32_t> maxConstructionsPerFrame("max_constructions_per_frame", 0);
+
+	ConfigOption<float> metricsLogInterval("metrics_log_interval", 0.0f, [](float value) { return value >= 0.0f; });
+
+	ConfigOption<float> configReloadInterval("config_reload_interval", 0.0f, [](float value) { return value >= 0.0f; });
+
+	ConfigOption<uint32_t> propertyListingRefreshInterval("property_listing_refresh_interval", 60);
+
+	ConfigOption<uint32_t> maxModelBehaviorActionsPerFrame("max_model_behavior_actions_per_frame", 256);
+
+	ConfigOption<uint32_t> persistentIdLeaseSize("persistent_id_lease_size", 64, [](uint32_t value) { return value > 0; });
+};
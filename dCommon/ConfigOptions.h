@@ -0,0 +1,50 @@
+#pragma once
+
+#include "dConfig.h"
+
+/**
+ * The config options read on hot paths, or that can be changed while the server runs. Each is declared once here
+ * with its type and default, the defaults match what an empty config did before.
+ */
+namespace ConfigOptions {
+	extern ConfigOption<bool> classicSurvivalScoring;
+	extern ConfigOption<bool> petsTakeImagination;
+	extern ConfigOption<bool> soloRacing;
+	extern ConfigOption<bool> disableExtraBackpack;
+	extern ConfigOption<bool> disableAntiSpeedhack;
+
+	/**
+	 * The most spawners that respawn in a frame, 0 for no limit
+	 */
+	extern ConfigOption<uint32_t> maxRespawnsPerFrame;
+
+	/**
+	 * The most entities constructed per frame for players joining the zone, 0 for no limit
+	 */
+	extern ConfigOption<uint32_t> maxConstructionsPerFrame;
+
+	/**
+	 * Seconds between writing the frame time metrics to the log, 0 disables it
+	 */
+	extern ConfigOption<float> metricsLogInterval;
+
+	/**
+	 * Seconds between checking whether the config files changed, 0 disables it
+	 */
+	extern ConfigOption<float> configReloadInterval;
+
+	/**
+	 * Seconds the property launcher listings are served before they are read from the database again
+	 */
+	extern ConfigOption<uint32_t> propertyListingRefreshInterval;
+
+	/**
+	 * The most property model behavior actions run in a frame, 0 for no limit
+	 */
+	extern ConfigOption<uint32_t> maxModelBehaviorActionsPerFrame;
+
+	/**
+	 * The number of persistent object IDs a world leases from master at a time
+	 */
+	extern ConfigOption<uint32_t> persistentIdLeaseSize;
+};
@@ -3,10 +3,16 @@
 // C++
 #include <cstdint>
 #include <cassert>
+#include <cstring>
 #include <algorithm>
 #include <filesystem>
 #include <map>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GENERALUTILS_SSE2
+#endif
+
 template <typename T>
 inline size_t MinSize(size_t size, const std::basic_string_view<T>& string) {
 	if (size == size_t(-1) || size > string.size()) {
@@ -24,24 +30,102 @@ inline bool IsTrailSurrogate(char16_t c) {
 	return (0xDC00 <= c) && (c <= 0xDFFF);
 }
 
-inline void PushUTF8CodePoint(std::string& ret, char32_t cp) {
+inline size_t UTF8Length(char32_t cp) {
+	if (cp <= 0x007F) return 1;
+	if (cp <= 0x07FF) return 2;
+	if (cp <= 0xFFFF) return 3;
+	return 4;
+}
+
+inline char* WriteUTF8CodePoint(char* out, char32_t cp) {
 	if (cp <= 0x007F) {
-		ret.push_back(static_cast<uint8_t>(cp));
+		*out++ = static_cast<char>(cp);
 	} else if (cp <= 0x07FF) {
-		ret.push_back(0xC0 | (cp >> 6));
-		ret.push_back(0x80 | (cp & 0x3F));
+		*out++ = static_cast<char>(0xC0 | (cp >> 6));
+		*out++ = static_cast<char>(0x80 | (cp & 0x3F));
 	} else if (cp <= 0xFFFF) {
-		ret.push_back(0xE0 | (cp >> 12));
-		ret.push_back(0x80 | ((cp >> 6) & 0x3F));
-		ret.push_back(0x80 | (cp & 0x3F));
+		*out++ = static_cast<char>(0xE0 | (cp >> 12));
+		*out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+		*out++ = static_cast<char>(0x80 | (cp & 0x3F));
 	} else if (cp <= 0x10FFFF) {
-		ret.push_back(0xF0 | (cp >> 18));
-		ret.push_back(0x80 | ((cp >> 12) & 0x3F));
-		ret.push_back(0x80 | ((cp >> 6) & 0x3F));
-		ret.push_back(0x80 | (cp & 0x3F));
+		*out++ = static_cast<char>(0xF0 | (cp >> 18));
+		*out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+		*out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+		*out++ = static_cast<char>(0x80 | (cp & 0x3F));
 	} else {
 		assert(false);
 	}
+	return out;
+}
+
+//! Reads the code point at i from a (potentially-ill-formed) UTF-16 string, unpaired surrogates are returned as is
+inline char32_t NextUTF16CodePoint(const std::u16string_view& string, size_t size, size_t& i) {
+	const char16_t u = string[i++];
+	if (IsLeadSurrogate(u) && i < size && IsTrailSurrogate(string[i])) {
+		return 0x10000
+			+ ((static_cast<char32_t>(u) - 0xD800) << 10)
+			+ (static_cast<char32_t>(string[i++]) - 0xDC00);
+	}
+	return u;
+}
+
+//! Widens the leading 7-bit ASCII characters of a string to UTF-16, a block at a time, and returns how many it widened.
+//! NUL only counts as ASCII if allowNul is set.
+template <bool allowNul>
+size_t WidenASCII(const char* in, char16_t* out, size_t count) {
+	size_t i = 0;
+#ifdef GENERALUTILS_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= count; i += 16) {
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+		int invalid = _mm_movemask_epi8(bytes);
+		if (!allowNul) invalid |= _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero));
+		if (invalid != 0) break;
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi8(bytes, zero));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpackhi_epi8(bytes, zero));
+	}
+#else
+	for (; i + 8 <= count; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, in + i, sizeof(word));
+		uint64_t invalid = word & 0x8080808080808080ULL;
+		if (!allowNul) invalid |= (word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL;
+		if (invalid != 0) break;
+		for (size_t j = 0; j < 8; j++) out[i + j] = static_cast<char16_t>(in[i + j]);
+	}
+#endif
+	for (; i < count; i++) {
+		const auto c = static_cast<uint8_t>(in[i]);
+		if (c > 0x7F || (!allowNul && c == 0)) break;
+		out[i] = static_cast<char16_t>(c);
+	}
+	return i;
+}
+
+//! Narrows the leading 7-bit ASCII code units of a UTF-16 string to UTF-8, a block at a time, and returns how many it
+//! narrowed.
+size_t NarrowASCII(const char16_t* in, char* out, size_t count) {
+	size_t i = 0;
+#ifdef GENERALUTILS_SSE2
+	const __m128i nonASCII = _mm_set1_epi16(static_cast<short>(0xFF80));
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= count; i += 16) {
+		const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+		const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+		const __m128i outside = _mm_and_si128(_mm_or_si128(low, high), nonASCII);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(outside, zero)) != 0xFFFF) break;
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+	}
+#else
+	for (; i + 4 <= count; i += 4) {
+		uint64_t word;
+		std::memcpy(&word, in + i, sizeof(word));
+		if ((word & 0xFF80FF80FF80FF80ULL) != 0) break;
+		for (size_t j = 0; j < 4; j++) out[i + j] = static_cast<char>(in[i + j]);
+	}
+#endif
+	for (; i < count && in[i] <= 0x7F; i++) out[i] = static_cast<char>(in[i]);
+	return i;
 }
 
 constexpr const char16_t REPLACEMENT_CHARACTER = 0xFFFD;
@@ -107,16 +191,16 @@ bool GeneralUtils::_NextUTF8Char(std::string_view& slice, uint32_t& out) {
 }
 
 /// See <https://www.ietf.org/rfc/rfc2781.html#section-2.1>
-bool PushUTF16CodePoint(std::u16string& output, uint32_t U, size_t size) {
-	if (output.length() >= size) return false;
+bool PushUTF16CodePoint(char16_t* output, size_t& written, size_t size, uint32_t U) {
+	if (written >= size) return false;
 	if (U < 0x10000) {
 		// If U < 0x10000, encode U as a 16-bit unsigned integer and terminate.
-		output.push_back(static_cast<uint16_t>(U));
+		output[written++] = static_cast<uint16_t>(U);
 		return true;
 	} else if (U > 0x10FFFF) {
-		output.push_back(REPLACEMENT_CHARACTER);
+		output[written++] = REPLACEMENT_CHARACTER;
 		return true;
-	} else if (output.length() + 1 < size) {
+	} else if (written + 1 < size) {
 		// Let U' = U - 0x10000. Because U is less than or equal to 0x10FFFF,
 		// U' must be less than or equal to 0xFFFFF. That is, U' can be
 		// represented in 20 bits.
@@ -131,37 +215,47 @@ bool PushUTF16CodePoint(std::u16string& output, uint32_t U, size_t size) {
 		// Assign the 10 high-order bits of the 20-bit U' to the 10 low-order
 		// bits of W1 and the 10 low-order bits of U' to the 10 low-order
 		// bits of W2.
-		W1 += static_cast<uint16_t>((Ut & 0x3FC00) >> 10);
+		W1 += static_cast<uint16_t>((Ut & 0xFFC00) >> 10);
 		W2 += static_cast<uint16_t>((Ut & 0x3FF) >> 0);
 
 		// Terminate.
-		output.push_back(W1); // high surrogate
-		output.push_back(W2); // low surrogate
+		output[written++] = W1; // high surrogate
+		output[written++] = W2; // low surrogate
 		return true;
 	} else return false;
 }
 
 std::u16string GeneralUtils::UTF8ToUTF16(const std::string_view& string, size_t size) {
+	// A UTF-8 sequence never becomes more UTF-16 code units than it has bytes
 	size_t newSize = MinSize(size, string);
-	std::u16string output;
-	output.reserve(newSize);
+	std::u16string output(newSize, u'\0');
 	std::string_view iterator = string;
+	size_t written = 0;
 
 	uint32_t c;
-	while (_NextUTF8Char(iterator, c) && PushUTF16CodePoint(output, c, size)) {}
+	while (written < newSize) {
+		const size_t ascii = WidenASCII<true>(iterator.data(), output.data() + written, std::min(iterator.size(), newSize - written));
+		written += ascii;
+		iterator.remove_prefix(ascii);
+
+		if (!_NextUTF8Char(iterator, c) || !PushUTF16CodePoint(output.data(), written, newSize, c)) break;
+	}
+
+	output.resize(written);
 	return output;
 }
 
 //! Converts an std::string (ASCII) to UCS-2 / UTF-16
 std::u16string GeneralUtils::ASCIIToUTF16(const std::string_view& string, size_t size) {
 	size_t newSize = MinSize(size, string);
-	std::u16string ret;
-	ret.reserve(newSize);
+	std::u16string ret(newSize, u'\0');
+
+	size_t i = 0;
+	while (i < newSize) {
+		i += WidenASCII<false>(string.data() + i, ret.data() + i, newSize - i);
 
-	for (size_t i = 0; i < newSize; i++) {
-		char c = string[i];
 		// Note: both 7-bit ascii characters and REPLACEMENT_CHARACTER fit in one char16_t
-		ret.push_back((c > 0 && c <= 127) ? static_cast<char16_t>(c) : REPLACEMENT_CHARACTER);
+		if (i < newSize) ret[i++] = REPLACEMENT_CHARACTER;
 	}
 
 	return ret;
@@ -171,25 +265,24 @@ std::u16string GeneralUtils::ASCIIToUTF16(const std::string_view& string, size_t
 //! See: <http://simonsapin.github.io/wtf-8/#decoding-ill-formed-utf-16>
 std::string GeneralUtils::UTF16ToWTF8(const std::u16string_view& string, size_t size) {
 	size_t newSize = MinSize(size, string);
-	std::string ret;
-	ret.reserve(newSize);
-
-	for (size_t i = 0; i < newSize; i++) {
-		char16_t u = string[i];
-		if (IsLeadSurrogate(u) && (i + 1) < newSize) {
-			char16_t next = string[i + 1];
-			if (IsTrailSurrogate(next)) {
-				i += 1;
-				char32_t cp = 0x10000
-					+ ((static_cast<char32_t>(u) - 0xD800) << 10)
-					+ (static_cast<char32_t>(next) - 0xDC00);
-				PushUTF8CodePoint(ret, cp);
-			} else {
-				PushUTF8CodePoint(ret, u);
-			}
-		} else {
-			PushUTF8CodePoint(ret, u);
-		}
+
+	// Most strings are plain ASCII and are done in this one pass
+	std::string ret(newSize, '\0');
+	size_t i = NarrowASCII(string.data(), ret.data(), newSize);
+	if (i == newSize) return ret;
+
+	// Otherwise the rest is measured first, so the string is only sized once
+	size_t length = i;
+	for (size_t j = i; j < newSize;) length += UTF8Length(NextUTF16CodePoint(string, newSize, j));
+	ret.resize(length);
+
+	char* out = ret.data() + i;
+	while (i < newSize) {
+		const size_t ascii = NarrowASCII(string.data() + i, out, newSize - i);
+		i += ascii;
+		out += ascii;
+
+		if (i < newSize) out = WriteUTF8CodePoint(out, NextUTF16CodePoint(string, newSize, i));
 	}
 
 	return ret;
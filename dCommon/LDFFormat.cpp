@@ -4,121 +4,160 @@
 #include "GeneralUtils.h"
 
 // C++
-#include <sstream>
-#include <vector>
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <string_view>
+
+namespace {
+	//! Parses an integer the way stoll and stoull do, negative values wrap around for unsigned types
+	template<typename T>
+	bool ParseInteger(std::string_view value, T& out) {
+		while (!value.empty() && (value.front() == ' ' || value.front() == '+')) value.remove_prefix(1);
+
+		if (!value.empty() && value.front() == '-') {
+			int64_t parsed = 0;
+			if (std::from_chars(value.data(), value.data() + value.size(), parsed).ec != std::errc()) return false;
+			out = static_cast<T>(parsed);
+		} else {
+			uint64_t parsed = 0;
+			if (std::from_chars(value.data(), value.data() + value.size(), parsed).ec != std::errc()) return false;
+			out = static_cast<T>(parsed);
+		}
+
+		return true;
+	}
+
+	//! Parses a floating point value, the view isn't null terminated so it is copied to the stack first
+	bool ParseDouble(const std::string_view& value, double& out) {
+		char buffer[64];
+		const auto length = std::min(value.size(), sizeof(buffer) - 1);
+
+		value.copy(buffer, length);
+		buffer[length] = '\0';
+
+		char* end = nullptr;
+		out = std::strtod(buffer, &end);
+
+		return end != buffer;
+	}
+}
 
 //! Returns a pointer to a LDFData value based on string format
-LDFBaseData* LDFBaseData::DataFromString(const std::string& format) {
+LDFBaseData* LDFBaseData::DataFromString(const std::string_view& format) {
+	// The format is key=type:value, the value may contain colons of its own
+	const auto keyEnd = format.find('=');
+	if (keyEnd == std::string_view::npos || format.find('=', keyEnd + 1) != std::string_view::npos) return nullptr;
+
+	const auto key = format.substr(0, keyEnd);
+	auto data = format.substr(keyEnd + 1);
 
-	// First, check the format
-	std::istringstream ssFormat(format);
-	std::string token;
+	const auto typeEnd = data.find(':');
+	const auto typeString = data.substr(0, typeEnd);
+	const auto value = typeEnd == std::string_view::npos ? std::string_view() : data.substr(typeEnd + 1);
 
-	std::vector<std::string> keyValueArray;
-	while (std::getline(ssFormat, token, '=')) {
-		keyValueArray.push_back(token);
+	int32_t typeId = 0;
+	if (!ParseInteger(typeString, typeId)) return nullptr;
+
+	const auto type = static_cast<eLDFType>(typeId);
+
+	// Only strings may leave out their value
+	if (typeEnd == std::string_view::npos && type != LDF_TYPE_UTF_16 && type != LDF_TYPE_UTF_8) return nullptr;
+
+	switch (type) {
+	case LDF_TYPE_UTF_16: {
+		return new LDFData<std::u16string>(GeneralUtils::ASCIIToUTF16(key), GeneralUtils::UTF8ToUTF16(value));
 	}
 
-	if (keyValueArray.size() == 2) {
-		std::u16string key = GeneralUtils::ASCIIToUTF16(keyValueArray[0]);
+	case LDF_TYPE_S32: {
+		int32_t data;
+		if (!ParseInteger(value, data)) return nullptr;
+		return new LDFData<int32_t>(GeneralUtils::ASCIIToUTF16(key), data);
+	}
 
-		std::vector<std::string> dataArray;
-		std::istringstream ssData(keyValueArray[1]);
-		while (std::getline(ssData, token, ':')) {
-			dataArray.push_back(token);
-		}
+	case LDF_TYPE_FLOAT: {
+		double data;
+		if (!ParseDouble(value, data)) return nullptr;
+		return new LDFData<float>(GeneralUtils::ASCIIToUTF16(key), static_cast<float>(data));
+	}
 
-		if (dataArray.size() > 2) { // hacky fix for strings with colons in them
-			std::vector<std::string> newDataArray;
-			newDataArray.push_back(dataArray[0]);
-			std::string value = "";
-			for (size_t i = 1; i < dataArray.size(); ++i) {
-				value += dataArray[i] + ':';
-			}
-			value.pop_back(); // remove last colon
-			newDataArray.push_back(value);
-			dataArray = newDataArray;
-		}
+	case LDF_TYPE_DOUBLE: {
+		double data;
+		if (!ParseDouble(value, data)) return nullptr;
+		return new LDFData<double>(GeneralUtils::ASCIIToUTF16(key), data);
+	}
+
+	case LDF_TYPE_U32:
+	{
+		uint32_t data;
 
-		if ((dataArray[0] == "0" || dataArray[0] == "13") && dataArray.size() == 1) {
-			dataArray.push_back("");
+		if (value == "true") {
+			data = 1;
+		} else if (value == "false") {
+			data = 0;
+		} else if (!ParseInteger(value, data)) {
+			return nullptr;
 		}
 
-		if (dataArray.size() == 2) {
-			eLDFType type = static_cast<eLDFType>(stoi(dataArray[0]));
-
-			switch (type) {
-			case LDF_TYPE_UTF_16: {
-				std::u16string data = GeneralUtils::UTF8ToUTF16(dataArray[1]);
-				return new LDFData<std::u16string>(key, data);
-			}
-
-			case LDF_TYPE_S32: {
-				int32_t data = static_cast<int32_t>(stoull(dataArray[1]));
-				return new LDFData<int32_t>(key, data);
-			}
-
-			case LDF_TYPE_FLOAT: {
-				float data = static_cast<float>(stof(dataArray[1]));
-				return new LDFData<float>(key, data);
-			}
-
-			case LDF_TYPE_DOUBLE: {
-				double data = static_cast<float>(stod(dataArray[1]));
-				return new LDFData<double>(key, data);
-			}
-
-			case LDF_TYPE_U32:
-			{
-				uint32_t data;
-
-				if (dataArray[1] == "true") {
-					data = 1;
-				} else if (dataArray[1] == "false") {
-					data = 0;
-				} else {
-					data = static_cast<uint32_t>(stoul(dataArray[1]));
-				}
-
-				return new LDFData<uint32_t>(key, data);
-			}
-
-			case LDF_TYPE_BOOLEAN: {
-				bool data;
-
-				if (dataArray[1] == "true") {
-					data = true;
-				} else if (dataArray[1] == "false") {
-					data = false;
-				} else {
-					data = static_cast<bool>(stoi(dataArray[1]));
-				}
-
-				return new LDFData<bool>(key, data);
-			}
-
-			case LDF_TYPE_U64: {
-				uint64_t data = static_cast<uint64_t>(stoull(dataArray[1]));
-				return new LDFData<uint64_t>(key, data);
-			}
-
-			case LDF_TYPE_OBJID: {
-				LWOOBJID data = static_cast<LWOOBJID>(stoll(dataArray[1]));
-				return new LDFData<LWOOBJID>(key, data);
-			}
-
-			case LDF_TYPE_UTF_8: {
-				std::string data = dataArray[1];
-				return new LDFData<std::string>(key, data);
-			}
-
-			case LDF_TYPE_UNKNOWN: {
-				return nullptr;
-			}
-			}
+		return new LDFData<uint32_t>(GeneralUtils::ASCIIToUTF16(key), data);
+	}
+
+	case LDF_TYPE_BOOLEAN: {
+		bool data;
+
+		if (value == "true") {
+			data = true;
+		} else if (value == "false") {
+			data = false;
+		} else {
+			int32_t parsed;
+			if (!ParseInteger(value, parsed)) return nullptr;
+			data = static_cast<bool>(parsed);
 		}
+
+		return new LDFData<bool>(GeneralUtils::ASCIIToUTF16(key), data);
+	}
+
+	case LDF_TYPE_U64: {
+		uint64_t data;
+		if (!ParseInteger(value, data)) return nullptr;
+		return new LDFData<uint64_t>(GeneralUtils::ASCIIToUTF16(key), data);
+	}
+
+	case LDF_TYPE_OBJID: {
+		LWOOBJID data;
+		if (!ParseInteger(value, data)) return nullptr;
+		return new LDFData<LWOOBJID>(GeneralUtils::ASCIIToUTF16(key), data);
+	}
+
+	case LDF_TYPE_UTF_8: {
+		return new LDFData<std::string>(GeneralUtils::ASCIIToUTF16(key), std::string(value));
 	}
 
-	return nullptr;
+	case LDF_TYPE_UNKNOWN:
+	default: {
+		return nullptr;
+	}
+	}
+}
+
+void LDFBaseData::WriteListToPacket(RakNet::BitStream* packet, const std::vector<LDFBaseData*>& data) {
+	// The size is known up front, so the data is written straight into the packet
+	uint32_t count = 0;
+	uint32_t size = sizeof(uint8_t) + sizeof(uint32_t);
+
+	for (auto* entry : data) {
+		if (entry == nullptr) continue;
 
+		count++;
+		size += entry->GetPacketSize();
+	}
+
+	packet->Write<uint32_t>(size);
+	packet->Write<uint8_t>(0); // No compression used
+	packet->Write<uint32_t>(count);
+
+	for (auto* entry : data) {
+		if (entry != nullptr) entry->WriteToPacket(packet);
+	}
 }
@@ -6,7 +6,9 @@
 
 // C++
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <vector>
 
 // RakNet
 
@@ -44,6 +46,12 @@ public:
 	 */
 	virtual void WriteToPacket(RakNet::BitStream* packet) = 0;
 
+	//! Gets the number of bytes WriteToPacket writes
+	/*!
+	  \return The number of bytes, so the size of a list of LDF data can be written before the data itself
+	 */
+	virtual uint32_t GetPacketSize(void) = 0;
+
 	//! Gets the key
 	/*!
 	  \return The key
@@ -72,9 +80,17 @@ public:
 
 	//! Returns a pointer to a LDFData value based on string format
 	/*!
-	  \param format The format
+	  \param format The format, key=type:value
+	  \return The data, or nullptr if the format couldn't be parsed
 	 */
-	static LDFBaseData* DataFromString(const std::string& format);
+	static LDFBaseData* DataFromString(const std::string_view& format);
+
+	//! Writes a list of LDF data to a packet as objects send it, its size followed by the uncompressed data
+	/*!
+	  \param packet The packet
+	  \param data The data to write, null entries are skipped
+	 */
+	static void WriteListToPacket(RakNet::BitStream* packet, const std::vector<LDFBaseData*>& data);
 
 };
 
@@ -88,9 +104,7 @@ private:
 	//! Writes the key to the packet
 	void WriteKey(RakNet::BitStream* packet) {
 		packet->Write(static_cast<uint8_t>(this->key.length() * sizeof(uint16_t)));
-		for (uint32_t i = 0; i < this->key.length(); ++i) {
-			packet->Write(static_cast<uint16_t>(this->key[i]));
-		}
+		packet->Write(reinterpret_cast<const char*>(this->key.data()), this->key.length() * sizeof(uint16_t));
 	}
 
 	//! Writes the value to the packet
@@ -99,6 +113,11 @@ private:
 		packet->Write(this->value);
 	}
 
+	//! Gets the number of bytes WriteValue writes
+	uint32_t GetValueSize(void) {
+		return sizeof(uint8_t) + sizeof(T);
+	}
+
 public:
 
 	//! Initializer
@@ -137,6 +156,14 @@ public:
 		this->WriteValue(packet);
 	}
 
+	//! Gets the number of bytes WriteToPacket writes
+	/*!
+	  \return The number of bytes
+	 */
+	uint32_t GetPacketSize(void) override {
+		return sizeof(uint8_t) + this->key.length() * sizeof(uint16_t) + this->GetValueSize();
+	}
+
 	//! Gets the key
 	/*!
 	 \return The key
@@ -210,9 +237,7 @@ inline void LDFData<std::u16string>::WriteValue(RakNet::BitStream* packet) {
 	packet->Write(static_cast<uint8_t>(this->GetValueType()));
 
 	packet->Write(static_cast<uint32_t>(this->value.length()));
-	for (uint32_t i = 0; i < this->value.length(); ++i) {
-		packet->Write(static_cast<uint16_t>(this->value[i]));
-	}
+	packet->Write(reinterpret_cast<const char*>(this->value.data()), this->value.length() * sizeof(uint16_t));
 }
 
 // The specialized version for bool
@@ -229,9 +254,18 @@ inline void LDFData<std::string>::WriteValue(RakNet::BitStream* packet) {
 	packet->Write(static_cast<uint8_t>(this->GetValueType()));
 
 	packet->Write(static_cast<uint32_t>(this->value.length()));
-	for (uint32_t i = 0; i < this->value.length(); ++i) {
-		packet->Write(static_cast<uint8_t>(this->value[i]));
-	}
+	packet->Write(this->value.data(), this->value.length());
+}
+
+// MARK: Value Sizes
+template<> inline uint32_t LDFData<std::u16string>::GetValueSize(void) {
+	return sizeof(uint8_t) + sizeof(uint32_t) + this->value.length() * sizeof(uint16_t);
+}
+
+template<> inline uint32_t LDFData<bool>::GetValueSize(void) { return sizeof(uint8_t) + sizeof(uint8_t); }
+
+template<> inline uint32_t LDFData<std::string>::GetValueSize(void) {
+	return sizeof(uint8_t) + sizeof(uint32_t) + this->value.length();
 }
 
 // MARK: String Data
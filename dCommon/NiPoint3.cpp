@@ -190,6 +190,31 @@ NiPoint3 NiPoint3::ClosestPointOnLine(const NiPoint3& a, const NiPoint3& b, cons
 	return a + ab * t;
 }
 
+bool NiPoint3::SweepSphere(const NiPoint3& a, const NiPoint3& b, const NiPoint3& center, const float radius, float& fraction) {
+	const auto offset = a - center;
+	const auto c = offset.SquaredLength() - radius * radius;
+
+	if (c <= 0.0f) {
+		fraction = 0.0f;
+		return true;
+	}
+
+	// Solve |a + ab * t - center| = radius for the first t
+	const auto ab = b - a;
+	const auto qa = ab.SquaredLength();
+	if (qa == 0.0f) return false;
+
+	const auto qb = offset.DotProduct(ab);
+	const auto discriminant = qb * qb - qa * c;
+	if (discriminant < 0.0f) return false;
+
+	const auto t = (-qb - sqrt(discriminant)) / qa;
+	if (t < 0.0f || t > 1.0f) return false;
+
+	fraction = t;
+	return true;
+}
+
 float NiPoint3::Angle(const NiPoint3& a, const NiPoint3& b) {
 	const auto dot = a.DotProduct(b);
 	const auto lenA = a.SquaredLength();
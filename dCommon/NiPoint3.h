@@ -176,6 +176,17 @@ public:
 	*/
 	static NiPoint3 ClosestPointOnLine(const NiPoint3& a, const NiPoint3& b, const NiPoint3& p);
 
+	//! Sweeps a point from a to b against a sphere
+	/*!
+	  \param a Start of the sweep
+	  \param b End of the sweep
+	  \param center The center of the sphere
+	  \param radius The radius of the sphere
+	  \param fraction Set to how far along the sweep the point first touches the sphere, 0 if it starts inside
+	  \return Whether the point touches the sphere during the sweep
+	*/
+	static bool SweepSphere(const NiPoint3& a, const NiPoint3& b, const NiPoint3& center, float radius, float& fraction);
+
 	static float Angle(const NiPoint3& a, const NiPoint3& b);
 
 	static float Distance(const NiPoint3& a, const NiPoint3& b);
@@ -0,0 +1,88 @@
+#include "Sd0.h"
+
+#include <algorithm>
+#include <istream>
+#include <memory>
+
+#include "MD5.h"
+#include "ZCompression.h"
+
+bool Sd0::CheckMagic(std::istream& stream) {
+	char magic[MAGIC_SIZE]{};
+	stream.read(magic, MAGIC_SIZE);
+
+	return stream.good() && magic[0] == 's' && magic[1] == 'd' && magic[2] == '0' && magic[3] == 0x01 && static_cast<uint8_t>(magic[4]) == 0xFF;
+}
+
+void Sd0::WriteMagic(char* output) {
+	output[0] = 's';
+	output[1] = 'd';
+	output[2] = '0';
+	output[3] = 0x01;
+	output[4] = static_cast<char>(0xFF);
+}
+
+bool Sd0::Decompress(std::istream& stream, std::string& output, int32_t& error) {
+	// Both buffers are reused for every chunk, the compressed one only grows when a bigger chunk shows up.
+	std::unique_ptr<uint8_t[]> compressedChunk;
+	uint32_t compressedCapacity = 0;
+	std::unique_ptr<uint8_t[]> uncompressedChunk(new uint8_t[ZCompression::MAX_SD0_CHUNK_SIZE]);
+
+	error = 0;
+
+	while (true) {
+		uint32_t chunkSize{};
+		stream.read(reinterpret_cast<char*>(&chunkSize), sizeof(uint32_t));
+
+		// Check if good here since if at the end of an sd0 file, this will have eof flagged.
+		if (!stream.good()) break;
+
+		if (chunkSize > compressedCapacity) {
+			compressedChunk.reset(new uint8_t[chunkSize]);
+			compressedCapacity = chunkSize;
+		}
+
+		stream.read(reinterpret_cast<char*>(compressedChunk.get()), chunkSize);
+		if (static_cast<uint32_t>(stream.gcount()) != chunkSize) return false;
+
+		const auto actualUncompressedSize = ZCompression::Decompress(
+			compressedChunk.get(), chunkSize, uncompressedChunk.get(), ZCompression::MAX_SD0_CHUNK_SIZE, error);
+
+		if (actualUncompressedSize == -1) return false;
+
+		output.append(reinterpret_cast<char*>(uncompressedChunk.get()), actualUncompressedSize);
+	}
+
+	return true;
+}
+
+std::string Sd0::Compress(const char* data, uint32_t size) {
+	const auto maxCompressedChunkSize = ZCompression::GetMaxCompressedLength(ZCompression::MAX_SD0_CHUNK_SIZE);
+	std::unique_ptr<uint8_t[]> compressedChunk(new uint8_t[maxCompressedChunkSize]);
+
+	std::string output(MAGIC_SIZE, '\0');
+	WriteMagic(output.data());
+
+	for (uint32_t offset = 0; offset < size; offset += ZCompression::MAX_SD0_CHUNK_SIZE) {
+		const auto chunkSize = std::min(size - offset, ZCompression::MAX_SD0_CHUNK_SIZE);
+
+		const auto compressedSize = ZCompression::Compress(
+			reinterpret_cast<const uint8_t*>(data + offset), chunkSize, compressedChunk.get(), maxCompressedChunkSize);
+
+		if (compressedSize == -1) return "";
+
+		const auto chunkHeader = static_cast<uint32_t>(compressedSize);
+		output.append(reinterpret_cast<const char*>(&chunkHeader), sizeof(uint32_t));
+		output.append(reinterpret_cast<char*>(compressedChunk.get()), compressedSize);
+	}
+
+	return output;
+}
+
+std::string Sd0::ContentHash(const char* data, uint32_t size) {
+	MD5 hash;
+	hash.update(data, size);
+	hash.finalize();
+
+	return hash.hexdigest();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/**
+ * Segmented Data 0 (sd0) is the container the client uses for brick-by-brick models.
+ * It starts with a 5 byte magic, followed by any number of zlib compressed chunks
+ * which are each prefixed by their compressed size.
+ */
+namespace Sd0 {
+	/**
+	 * @brief Size of the sd0 magic at the start of every sd0 file
+	 */
+	constexpr uint32_t MAGIC_SIZE = 5;
+
+	/**
+	 * @brief Reads the sd0 magic from the current position of a stream
+	 *
+	 * @param stream The stream to check.  The magic is consumed on success.
+	 * @return Whether or not the stream starts with the sd0 magic
+	 */
+	bool CheckMagic(std::istream& stream);
+
+	/**
+	 * @brief Writes the sd0 magic to the front of a buffer with at least MAGIC_SIZE bytes
+	 *
+	 * @param output The buffer to write to
+	 */
+	void WriteMagic(char* output);
+
+	/**
+	 * @brief Inflates every chunk of an sd0 stream, reading each chunk in one go
+	 *
+	 * @param stream The stream to read from, positioned right after the sd0 magic
+	 * @param output The string to append the inflated data to
+	 * @param error Set to the zlib error of the first chunk that failed to inflate
+	 * @return Whether or not every chunk was inflated
+	 */
+	bool Decompress(std::istream& stream, std::string& output, int32_t& error);
+
+	/**
+	 * @brief Compresses data into an sd0 file, splitting it into chunks of at most ZCompression::MAX_SD0_CHUNK_SIZE bytes
+	 *
+	 * @param data The data to compress
+	 * @param size The size of the data
+	 * @return The sd0 file, or an empty string if compression failed
+	 */
+	std::string Compress(const char* data, uint32_t size);
+
+	/**
+	 * @brief Hashes an sd0 file so identical models can be stored once
+	 *
+	 * @param data The sd0 file
+	 * @param size The size of the sd0 file
+	 * @return The hex encoded MD5 hash of the file
+	 */
+	std::string ContentHash(const char* data, uint32_t size);
+};
@@ -1,31 +1,45 @@
 #include "dConfig.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "BinaryPathFinder.h"
 #include "GeneralUtils.h"
 
+namespace {
+	std::vector<ConfigOptionBase*>& GetRegisteredOptions() {
+		// Function local so options at namespace scope in any translation unit can register themselves
+		static std::vector<ConfigOptionBase*> options;
+		return options;
+	}
+};
+
 dConfig::dConfig(const std::string& filepath) {
 	m_ConfigFilePath = filepath;
 	LoadConfig();
 }
 
 void dConfig::LoadConfig() {
-	std::ifstream in(BinaryPathFinder::GetBinaryDir() / m_ConfigFilePath);
-	if (!in.good()) return;
+	m_LastWriteTime = GetLastWriteTime();
 
-	std::string line{};
-	while (std::getline(in, line)) {
-		if (!line.empty() && line.front() != '#') ProcessLine(line);
+	std::ifstream in(BinaryPathFinder::GetBinaryDir() / m_ConfigFilePath);
+	const bool found = in.good();
+	if (found) {
+		std::string line{};
+		while (std::getline(in, line)) {
+			if (!line.empty() && line.front() != '#') ProcessLine(line);
+		}
 	}
 
 	std::ifstream sharedConfig(BinaryPathFinder::GetBinaryDir() / "sharedconfig.ini", std::ios::in);
-	if (!sharedConfig.good()) return;
-
-	line.clear();
-	while (std::getline(sharedConfig, line)) {
-		if (!line.empty() && line.front() != '#') ProcessLine(line);
+	if (found && sharedConfig.good()) {
+		std::string line{};
+		while (std::getline(sharedConfig, line)) {
+			if (!line.empty() && line.front() != '#') ProcessLine(line);
+		}
 	}
+
+	LoadOptions();
 }
 
 void dConfig::ReloadConfig() {
@@ -33,8 +47,16 @@ void dConfig::ReloadConfig() {
 	LoadConfig();
 }
 
-const std::string& dConfig::GetValue(std::string key) {
-	return this->m_ConfigValues[key];
+bool dConfig::ReloadIfChanged() {
+	if (GetLastWriteTime() == m_LastWriteTime) return false;
+
+	ReloadConfig();
+	return true;
+}
+
+const std::string& dConfig::GetValue(const std::string& key) {
+	const auto it = this->m_ConfigValues.find(key);
+	return it != this->m_ConfigValues.end() ? it->second : m_EmptyString;
 }
 
 void dConfig::ProcessLine(const std::string& line) {
@@ -51,3 +73,38 @@ void dConfig::ProcessLine(const std::string& line) {
 
 	this->m_ConfigValues.insert(std::make_pair(key, value));
 }
+
+void dConfig::LoadOptions() {
+	for (auto* option : GetRegisteredOptions()) {
+		const auto& value = GetValue(option->GetKey());
+
+		if (!option->Load(value) && Game::logger) {
+			Game::logger->Log("dConfig", "Invalid value (%s) for %s, using the default", value.c_str(), option->GetKey().c_str());
+		}
+	}
+}
+
+std::filesystem::file_time_type dConfig::GetLastWriteTime() const {
+	std::error_code error;
+
+	const auto configTime = std::filesystem::last_write_time(BinaryPathFinder::GetBinaryDir() / m_ConfigFilePath, error);
+	if (error) return {};
+
+	const auto sharedTime = std::filesystem::last_write_time(BinaryPathFinder::GetBinaryDir() / "sharedconfig.ini", error);
+	if (error) return configTime;
+
+	return std::max(configTime, sharedTime);
+}
+
+ConfigOptionBase::ConfigOptionBase(const std::string& key) : m_Key(key) {
+	GetRegisteredOptions().push_back(this);
+}
+
+ConfigOptionBase::~ConfigOptionBase() {
+	auto& options = GetRegisteredOptions();
+	options.erase(std::remove(options.begin(), options.end(), this), options.end());
+}
+
+const std::vector<ConfigOptionBase*>& ConfigOptionBase::GetOptions() {
+	return GetRegisteredOptions();
+}
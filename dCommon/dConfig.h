@@ -1,7 +1,13 @@
 #pragma once
+#include <atomic>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <string>
+#include <vector>
+
+#include "GeneralUtils.h"
 
 class dConfig {
 public:
@@ -13,7 +19,7 @@ public:
 	 * @param key Key to find
 	 * @return The keys value in the config
 	 */
-	const std::string& GetValue(std::string key);
+	const std::string& GetValue(const std::string& key);
 
 	/**
 	 * Loads the config from a file
@@ -25,10 +31,102 @@ public:
 	 */
 	void ReloadConfig();
 
+	/**
+	 * Reloads the config if the config file or the shared config were written to since they were last loaded
+	 *
+	 * @return Whether the config was reloaded
+	 */
+	bool ReloadIfChanged();
+
 private:
 	void ProcessLine(const std::string& line);
 
+	/**
+	 * Parses every config option from the loaded values
+	 */
+	void LoadOptions();
+
+	std::filesystem::file_time_type GetLastWriteTime() const;
+
 private:
 	std::map<std::string, std::string> m_ConfigValues;
 	std::string m_ConfigFilePath;
+	std::filesystem::file_time_type m_LastWriteTime{};
+	std::string m_EmptyString{};
+};
+
+/**
+ * An option of the server config that is parsed whenever the config is loaded. Options register themselves, so they
+ * have to be declared at namespace scope, see ConfigOptions.h.
+ */
+class ConfigOptionBase {
+public:
+	ConfigOptionBase(const std::string& key);
+
+	virtual ~ConfigOptionBase();
+
+	ConfigOptionBase(const ConfigOptionBase&) = delete;
+	ConfigOptionBase& operator=(const ConfigOptionBase&) = delete;
+
+	/**
+	 * Parses the value of the option, the default is used if it is missing or invalid
+	 *
+	 * @param value The value of the key in the config
+	 * @return Whether the value was valid, a missing value is valid
+	 */
+	virtual bool Load(const std::string& value) = 0;
+
+	const std::string& GetKey() const { return m_Key; }
+
+	/**
+	 * Returns every declared option
+	 */
+	static const std::vector<ConfigOptionBase*>& GetOptions();
+
+private:
+	std::string m_Key;
+};
+
+/**
+ * A config option with a type, a default and the values it accepts. Reading it is a single atomic load, so it can be
+ * used on hot paths, and it follows the config when it is reloaded.
+ */
+template <typename T>
+class ConfigOption final : public ConfigOptionBase {
+public:
+	/**
+	 * @param key The key of the option in the config
+	 * @param defaultValue The value used if the config doesn't set the option, or sets it to something invalid
+	 * @param validate Returns whether a parsed value is accepted, all values are accepted if it is empty
+	 */
+	ConfigOption(const std::string& key, T defaultValue, std::function<bool(T)> validate = nullptr)
+		: ConfigOptionBase(key), m_Value(defaultValue), m_Default(defaultValue), m_Validate(std::move(validate)) {}
+
+	T Get() const { return m_Value.load(std::memory_order_relaxed); }
+
+	T GetDefault() const { return m_Default; }
+
+	bool Load(const std::string& value) override {
+		T parsed = m_Default;
+		bool valid = true;
+
+		if (!value.empty()) {
+			if constexpr (std::is_same_v<T, bool>) {
+				valid = value == "0" || value == "1";
+				parsed = value == "1";
+			} else {
+				valid = GeneralUtils::TryParse(value, parsed) && (!m_Validate || m_Validate(parsed));
+			}
+
+			if (!valid) parsed = m_Default;
+		}
+
+		m_Value.store(parsed, std::memory_order_relaxed);
+		return valid;
+	}
+
+private:
+	std::atomic<T> m_Value;
+	T m_Default;
+	std::function<bool(T)> m_Validate;
 };
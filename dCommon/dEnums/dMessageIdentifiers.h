@@ -268,7 +268,9 @@ enum MASTER {
 
 	MSG_MASTER_GET_INSTANCES,
 
-	MSG_MASTER_RESPOND_INSTANCES
+	MSG_MASTER_RESPOND_INSTANCES,
+
+	MSG_MASTER_PROPERTY_LISTING_CHANGED
 };
 
 //! The Game messages
@@ -44,4 +44,5 @@ void CDClientManager::Initialize(void) {
 	tables.insert(std::make_pair("FeatureGating", new CDFeatureGatingTable()));
 	tables.insert(std::make_pair("RailActivatorComponent", new CDRailActivatorComponentTable()));
     tables.insert(std::make_pair("FaceItemComponent", new CDFaceItemComponentTable()));
+	tables.insert(std::make_pair("Factions", new CDFactionsTable()));
 }
@@ -43,6 +43,7 @@
 #include "CDFeatureGatingTable.h"
 #include "CDRailActivatorComponent.h"
 #include "CDFaceItemComponentTable.h"
+#include "CDFactionsTable.h"
 // C++
 #include <type_traits>
 #include <unordered_map>
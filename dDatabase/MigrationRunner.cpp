@@ -38,6 +38,7 @@ void MigrationRunner::RunMigrations() {
 
 	sql::SQLString finalSQL = "";
 	bool runSd0Migrations = false;
+	bool runHashMigrations = false;
 	for (const auto& entry : GeneralUtils::GetSqlFileNamesFromFolder((BinaryPathFinder::GetBinaryDir() / "./migrations/dlu/").string())) {
 		auto migration = LoadMigration("dlu/" + entry);
 
@@ -57,6 +58,7 @@ void MigrationRunner::RunMigrations() {
 		if (migration.name == "5_brick_model_sd0.sql") {
 			runSd0Migrations = true;
 		} else {
+			if (migration.name == "8_ugc_content_hash.sql") runHashMigrations = true;
 			finalSQL.append(migration.data.c_str());
 		}
 
@@ -91,6 +93,12 @@ void MigrationRunner::RunMigrations() {
 		uint32_t numberOfTruncatedModels = BrickByBrickFix::TruncateBrokenBrickByBrickXml();
 		Game::logger->Log("MasterServer", "%i models were truncated from the database.", numberOfTruncatedModels);
 	}
+
+	// Hash after the sd0 migration so the hashes match the format models are stored in.
+	if (runHashMigrations) {
+		uint32_t numberOfHashedModels = BrickByBrickFix::UpdateBrickByBrickModelHashes();
+		Game::logger->Log("MasterServer", "%i models were hashed.", numberOfHashedModels);
+	}
 }
 
 void MigrationRunner::RunSQLiteMigrations() {
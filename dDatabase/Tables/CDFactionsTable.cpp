@@ -0,0 +1,52 @@
+#include "CDFactionsTable.h"
+
+#include "GeneralUtils.h"
+
+//! Constructor
+CDFactionsTable::CDFactionsTable(void) {
+
+	// First, get the size of the table
+	unsigned int size = 0;
+	auto tableSize = CDClientDatabase::ExecuteQuery("SELECT COUNT(*) FROM Factions");
+	while (!tableSize.eof()) {
+		size = tableSize.getIntField(0, 0);
+
+		tableSize.nextRow();
+	}
+
+	tableSize.finalize();
+
+	// Reserve the size
+	this->entries.reserve(size);
+
+	// Now get the data
+	auto tableData = CDClientDatabase::ExecuteQuery("SELECT faction, enemyList FROM Factions");
+	while (!tableData.eof()) {
+		CDFactions entry;
+		entry.faction = tableData.getIntField(0, -1);
+
+		// The enemy list is a comma separated list of faction IDs
+		for (const auto& token : GeneralUtils::SplitString(tableData.getStringField(1, ""), ',')) {
+			int32_t enemy;
+			if (GeneralUtils::TryParse(token, enemy)) entry.enemyList.push_back(enemy);
+		}
+
+		this->entries.push_back(entry);
+		tableData.nextRow();
+	}
+
+	tableData.finalize();
+}
+
+//! Destructor
+CDFactionsTable::~CDFactionsTable(void) {}
+
+//! Returns the table's name
+std::string CDFactionsTable::GetName(void) const {
+	return "Factions";
+}
+
+//! Gets all the entries in the table
+const std::vector<CDFactions>& CDFactionsTable::GetEntries(void) const {
+	return this->entries;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Custom Classes
+#include "CDTable.h"
+
+/*!
+ \file CDFactionsTable.hpp
+ \brief Contains data for the Factions table
+ */
+
+ //! Factions Entry Struct
+struct CDFactions {
+	int32_t faction;                   //!< The faction ID
+	std::vector<int32_t> enemyList;    //!< The factions this faction is hostile to
+};
+
+//! Factions table
+class CDFactionsTable : public CDTable {
+private:
+	std::vector<CDFactions> entries;
+
+public:
+
+	//! Constructor
+	CDFactionsTable(void);
+
+	//! Destructor
+	~CDFactionsTable(void);
+
+	//! Returns the table's name
+	/*!
+	  \return The table name
+	 */
+	std::string GetName(void) const override;
+
+	//! Gets all the entries in the table
+	/*!
+	  \return The entries
+	 */
+	const std::vector<CDFactions>& GetEntries(void) const;
+
+};
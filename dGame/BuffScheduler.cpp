@@ -0,0 +1,82 @@
+#include "BuffScheduler.h"
+
+#include "BuffComponent.h"
+#include "EntityManager.h"
+#include "SkillComponent.h"
+
+BuffScheduler* BuffScheduler::m_Address = nullptr; //For singleton method
+
+void BuffScheduler::ScheduleExpiry(const LWOOBJID entityId, const int32_t buffId, const uint32_t generation, const float delay) {
+	Push(entityId, buffId, generation, delay, eBuffEventType::EXPIRY);
+}
+
+void BuffScheduler::ScheduleTick(const LWOOBJID entityId, const int32_t buffId, const uint32_t generation, const float delay) {
+	Push(entityId, buffId, generation, delay, eBuffEventType::TICK);
+}
+
+void BuffScheduler::Update(const float deltaTime) {
+	m_Time += deltaTime;
+
+	m_TickGroupCount = 0;
+
+	// Everything that came due during the frame is handled, not just the first expiration
+	while (!m_Queue.empty() && m_Queue.top().dueTime <= m_Time) {
+		// Pop before notifying, the buff may schedule its next tick.
+		const auto event = m_Queue.top();
+		m_Queue.pop();
+
+		// The entity may have been removed since this was scheduled.
+		auto* entity = EntityManager::Instance()->GetEntity(event.entityId);
+
+		if (entity == nullptr) continue;
+
+		auto* buffComponent = entity->GetComponent<BuffComponent>();
+
+		if (buffComponent == nullptr) continue;
+
+		if (event.type == eBuffEventType::EXPIRY) {
+			buffComponent->OnExpiryDue(event.buffId, event.generation);
+
+			continue;
+		}
+
+		uint32_t behaviorId = 0;
+		LWOOBJID source = LWOOBJID_EMPTY;
+
+		if (buffComponent->OnTickDue(event.buffId, event.generation, behaviorId, source)) {
+			AddTick(behaviorId, source, event.entityId);
+		}
+	}
+
+	for (size_t i = 0; i < m_TickGroupCount; i++) {
+		const auto& group = m_TickGroups[i];
+
+		SkillComponent::HandleUnmanaged(group.behaviorId, group.targets, group.source);
+	}
+}
+
+void BuffScheduler::Push(const LWOOBJID entityId, const int32_t buffId, const uint32_t generation, const float delay, const eBuffEventType type) {
+	m_Queue.push({ m_Time + delay, m_NextSequence++, entityId, buffId, generation, type });
+}
+
+void BuffScheduler::AddTick(const uint32_t behaviorId, const LWOOBJID source, const LWOOBJID target) {
+	for (size_t i = 0; i < m_TickGroupCount; i++) {
+		auto& group = m_TickGroups[i];
+
+		if (group.behaviorId == behaviorId && group.source == source) {
+			group.targets.push_back(target);
+
+			return;
+		}
+	}
+
+	if (m_TickGroupCount == m_TickGroups.size()) {
+		m_TickGroups.emplace_back();
+	}
+
+	auto& group = m_TickGroups[m_TickGroupCount++];
+	group.behaviorId = behaviorId;
+	group.source = source;
+	group.targets.clear();
+	group.targets.push_back(target);
+}
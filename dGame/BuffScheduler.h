@@ -0,0 +1,129 @@
+#pragma once
+
+#include <queue>
+#include <vector>
+
+#include "dCommonVars.h"
+
+/**
+ * Keeps the damage over time ticks and expirations of every buff in the zone ordered by the time they are due,
+ * so buffed entities are only touched when something actually happens to one of their buffs.
+ */
+class BuffScheduler {
+public:
+	static BuffScheduler* Instance() {
+		if (!m_Address) {
+			m_Address = new BuffScheduler();
+		}
+
+		return m_Address;
+	}
+
+	/**
+	 * Schedules a buff to expire
+	 * @param entityId the ID of the entity the buff is applied to
+	 * @param buffId the ID of the buff
+	 * @param generation the generation of the buff this expiration belongs to
+	 * @param delay the number of seconds from now the buff expires
+	 */
+	void ScheduleExpiry(LWOOBJID entityId, int32_t buffId, uint32_t generation, float delay);
+
+	/**
+	 * Schedules the next damage over time tick of a buff
+	 * @param entityId the ID of the entity the buff is applied to
+	 * @param buffId the ID of the buff
+	 * @param generation the generation of the buff this tick belongs to
+	 * @param delay the number of seconds from now the tick is due
+	 */
+	void ScheduleTick(LWOOBJID entityId, int32_t buffId, uint32_t generation, float delay);
+
+	/**
+	 * Advances the clock, handles every tick and expiration that is due and then applies the ticks,
+	 * grouped by the behavior and source they were applied with.
+	 * @param deltaTime the time since the last update
+	 */
+	void Update(float deltaTime);
+
+	/**
+	 * Returns a generation number that has never been handed out before. Every applied buff takes a new
+	 * generation, so the ticks and expirations of a buff which has since been removed are ignored.
+	 * @return a new generation number
+	 */
+	uint32_t NextGeneration() { return ++m_LastGeneration; }
+
+	/**
+	 * Returns the number of events that are still queued, including ones for removed buffs that haven't been popped yet
+	 * @return the number of events that are still queued
+	 */
+	size_t GetQueuedCount() const { return m_Queue.size(); }
+
+	/**
+	 * Returns the time on the scheduler's clock
+	 * @return seconds since the scheduler was created
+	 */
+	double GetTime() const { return m_Time; }
+
+private:
+	enum class eBuffEventType : uint8_t {
+		TICK,
+		EXPIRY
+	};
+
+	struct BuffEvent {
+		double dueTime;
+		uint64_t sequence;
+		LWOOBJID entityId;
+		int32_t buffId;
+		uint32_t generation;
+		eBuffEventType type;
+	};
+
+	/**
+	 * Orders the queue by due time, events due at the same time are handled in the order they were scheduled
+	 */
+	struct DueLater {
+		bool operator()(const BuffEvent& a, const BuffEvent& b) const {
+			if (a.dueTime != b.dueTime) return a.dueTime > b.dueTime;
+			return a.sequence > b.sequence;
+		}
+	};
+
+	/**
+	 * Damage over time ticks due this frame which share a behavior and source
+	 */
+	struct TickGroup {
+		uint32_t behaviorId;
+		LWOOBJID source;
+		std::vector<LWOOBJID> targets;
+	};
+
+	void Push(LWOOBJID entityId, int32_t buffId, uint32_t generation, float delay, eBuffEventType type);
+
+	/**
+	 * Adds a tick to the group with the same behavior and source, or starts a new group
+	 */
+	void AddTick(uint32_t behaviorId, LWOOBJID source, LWOOBJID target);
+
+	static BuffScheduler* m_Address; //For singleton method
+
+	std::priority_queue<BuffEvent, std::vector<BuffEvent>, DueLater> m_Queue;
+
+	/**
+	 * Reused between frames to avoid allocating new groups every frame
+	 */
+	std::vector<TickGroup> m_TickGroups;
+
+	/**
+	 * The number of groups in m_TickGroups in use this frame
+	 */
+	size_t m_TickGroupCount = 0;
+
+	/**
+	 * Seconds since the scheduler was created
+	 */
+	double m_Time = 0.0;
+
+	uint64_t m_NextSequence = 0;
+
+	uint32_t m_LastGeneration = 0;
+};
@@ -844,6 +844,7 @@ void Entity::SetProximityRadius(dpEntity* entity, std::string name) {
 
 void Entity::SetGMLevel(uint8_t value) {
 	m_GMLevel = value;
+	MarkReplicaChanged();
 	if (GetParentUser()) {
 		Character* character = GetParentUser()->GetLastUsedChar();
 
@@ -887,18 +888,7 @@ void Entity::WriteBaseReplicaData(RakNet::BitStream* outBitStream, eReplicaPacke
 		if (m_Settings.size() > 0 && (GetComponent<ModelComponent>() && !GetComponent<PetComponent>())) {
 			outBitStream->Write1(); //ldf data
 
-			RakNet::BitStream settingStream;
-			settingStream.Write<uint32_t>(m_Settings.size());
-
-			for (LDFBaseData* data : m_Settings) {
-				if (data) {
-					data->WriteToPacket(&settingStream);
-				}
-			}
-
-			outBitStream->Write(settingStream.GetNumberOfBytesUsed() + 1);
-			outBitStream->Write<uint8_t>(0); //no compression used
-			outBitStream->Write(settingStream);
+			LDFBaseData::WriteListToPacket(outBitStream, m_Settings);
 		} else if (!syncLDF.empty()) {
 			std::vector<LDFBaseData*> ldfData;
 
@@ -908,18 +898,7 @@ void Entity::WriteBaseReplicaData(RakNet::BitStream* outBitStream, eReplicaPacke
 
 			outBitStream->Write1(); //ldf data
 
-			RakNet::BitStream settingStream;
-			settingStream.Write<uint32_t>(ldfData.size());
-
-			for (LDFBaseData* data : ldfData) {
-				if (data) {
-					data->WriteToPacket(&settingStream);
-				}
-			}
-
-			outBitStream->Write(settingStream.GetNumberOfBytesUsed() + 1);
-			outBitStream->Write<uint8_t>(0); //no compression used
-			outBitStream->Write(settingStream);
+			LDFBaseData::WriteListToPacket(outBitStream, ldfData);
 		} else {
 			outBitStream->Write0(); //No ldf data
 		}
@@ -1395,6 +1374,12 @@ void Entity::OnHit(Entity* attacker) {
 	for (CppScripts::Script* script : CppScripts::GetEntityScripts(this)) {
 		script->OnHit(this, attacker);
 	}
+
+	auto* modelComponent = GetComponent<ModelComponent>();
+
+	if (modelComponent != nullptr) {
+		modelComponent->OnBehaviorTrigger(eBehaviorTrigger::ATTACK);
+	}
 }
 
 void Entity::OnZonePropertyEditBegin() {
@@ -1627,6 +1612,7 @@ void Entity::RegisterCoinDrop(uint64_t count) {
 
 void Entity::AddChild(Entity* child) {
 	m_IsParentChildDirty = true;
+	MarkReplicaChanged();
 	m_ChildEntities.push_back(child);
 }
 
@@ -1636,6 +1622,7 @@ void Entity::RemoveChild(Entity* child) {
 	while (entityPosition < m_ChildEntities.size()) {
 		if (!m_ChildEntities[entityPosition] || (m_ChildEntities[entityPosition])->GetObjectID() == child->GetObjectID()) {
 			m_IsParentChildDirty = true;
+			MarkReplicaChanged();
 			m_ChildEntities.erase(m_ChildEntities.begin() + entityPosition);
 		} else {
 			entityPosition++;
@@ -1645,6 +1632,7 @@ void Entity::RemoveChild(Entity* child) {
 
 void Entity::RemoveParent() {
 	this->m_ParentEntity = nullptr;
+	MarkReplicaChanged();
 }
 
 void Entity::AddTimer(std::string name, float time) {
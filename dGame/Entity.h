@@ -79,6 +79,18 @@ public:
 
 	uint16_t GetNetworkId() const;
 
+	/**
+	 * Returns a counter that changes whenever something written in the construction of the entity may have changed,
+	 * so a construction written earlier can be reused while it stays the same
+	 */
+	uint32_t GetReplicaGeneration() const { return m_ReplicaGeneration; }
+
+	/**
+	 * Marks the construction of the entity as changed. Serializing the entity does this, components also have to
+	 * when they change something only written on construction, or don't serialize right after a change.
+	 */
+	void MarkReplicaChanged() { m_ReplicaGeneration++; }
+
 	Entity* GetOwner() const;
 
 	const NiPoint3& GetDefaultPosition() const;
@@ -327,6 +339,8 @@ protected:
 
 	bool m_IsParentChildDirty = true;
 
+	uint32_t m_ReplicaGeneration = 0;
+
 	/*
 	 * Collision
 	 */
@@ -390,6 +404,8 @@ T Entity::GetVarAs(const std::u16string& name) const {
 
 template<typename T>
 void Entity::SetVar(const std::u16string& name, T value) {
+	MarkReplicaChanged();
+
 	auto* data = GetVarData(name);
 
 	if (data == nullptr) {
@@ -411,6 +427,9 @@ void Entity::SetVar(const std::u16string& name, T value) {
 
 template<typename T>
 void Entity::SetNetworkVar(const std::u16string& name, T value, const SystemAddress& sysAddr) {
+	// Network vars are written in the construction of the script component
+	MarkReplicaChanged();
+
 	LDFData<T>* newData = nullptr;
 
 	for (auto* data : m_NetworkSettings) {
@@ -440,6 +459,8 @@ void Entity::SetNetworkVar(const std::u16string& name, T value, const SystemAddr
 
 template<typename T>
 void Entity::SetNetworkVar(const std::u16string& name, std::vector<T> values, const SystemAddress& sysAddr) {
+	MarkReplicaChanged();
+
 	std::stringstream updates;
 	auto index = 1;
 
@@ -17,6 +17,10 @@
 #include "MissionComponent.h"
 #include "Game.h"
 #include "dLogger.h"
+#include "BuffScheduler.h"
+#include "ModelBehaviorScheduler.h"
+#include "ConfigOptions.h"
+#include "SpatialIndex.h"
 
 EntityManager* EntityManager::m_Address = nullptr;
 
@@ -120,6 +124,8 @@ Entity* EntityManager::CreateEntity(EntityInfo info, User* user, Entity* parentE
 	// Add the entity to the entity map
 	m_Entities.insert_or_assign(id, entity);
 
+	SpatialIndex::Instance()->Add(entity);
+
 	// Set the zone control entity if the entity is a zone control object, this should only happen once
 	if (controller) {
 		m_ZoneControlEntity = entity;
@@ -160,10 +166,18 @@ void EntityManager::DestroyEntity(Entity* entity) {
 }
 
 void EntityManager::UpdateEntities(const float deltaTime) {
+	m_ZoneTime += deltaTime;
+
 	for (const auto& e : m_Entities) {
 		e.second->Update(deltaTime);
 	}
 
+	BuffScheduler::Instance()->Update(deltaTime);
+
+	ModelBehaviorScheduler::Instance()->Update(deltaTime);
+
+	UpdateConstructionQueues();
+
 	for (auto entry = m_EntitiesToSerialize.begin(); entry != m_EntitiesToSerialize.end(); entry++) {
 		auto* entity = GetEntity(*entry);
 
@@ -210,6 +224,9 @@ void EntityManager::UpdateEntities(const float deltaTime) {
 		auto networkIdToErase = entityToDelete->GetNetworkId();
 		const auto& ghostingToDelete = std::find(m_EntitiesToGhost.begin(), m_EntitiesToGhost.end(), entityToDelete);
 
+		// Queries made while the entity is destroyed must not find it
+		SpatialIndex::Instance()->Remove(*entry);
+
 		if (entityToDelete) {
 			// If we are a player run through the player destructor.
 			if (entityToDelete->IsPlayer()) {
@@ -223,6 +240,7 @@ void EntityManager::UpdateEntities(const float deltaTime) {
 
 		if (ghostingToDelete != m_EntitiesToGhost.end()) m_EntitiesToGhost.erase(ghostingToDelete);
 
+		m_ConstructionCache.erase(*entry);
 		m_Entities.erase(*entry);
 	}
 	m_EntitiesToDelete.clear();
@@ -322,31 +340,22 @@ void EntityManager::ConstructEntity(Entity* entity, const SystemAddress& sysAddr
 		return;
 	}
 
-	m_SerializationCounter++;
-
-	RakNet::BitStream stream;
-
-	stream.Write(static_cast<char>(ID_REPLICA_MANAGER_CONSTRUCTION));
-	stream.Write(true);
-	stream.Write(static_cast<unsigned short>(entity->GetNetworkId()));
-
-	entity->WriteBaseReplicaData(&stream, PACKET_TYPE_CONSTRUCTION);
-	entity->WriteComponents(&stream, PACKET_TYPE_CONSTRUCTION);
+	const auto stream = GetConstruction(entity);
 
 	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) {
 		if (skipChecks) {
-			Game::server->Send(&stream, UNASSIGNED_SYSTEM_ADDRESS, true);
+			Game::server->Send(stream.get(), UNASSIGNED_SYSTEM_ADDRESS, true);
 		} else {
 			for (auto* player : Player::GetAllPlayers()) {
 				if (player->GetPlayerReadyForUpdates()) {
-					Game::server->Send(&stream, player->GetSystemAddress(), false);
+					Game::server->Send(stream.get(), player->GetSystemAddress(), false);
 				} else {
 					player->AddLimboConstruction(entity->GetObjectID());
 				}
 			}
 		}
 	} else {
-		Game::server->Send(&stream, sysAddr, false);
+		Game::server->Send(stream.get(), sysAddr, false);
 	}
 
 	// PacketUtils::SavePacket("[24]_"+std::to_string(entity->GetObjectID()) + "_" + std::to_string(m_SerializationCounter) + ".bin", (char*)stream.GetData(), stream.GetNumberOfBytesUsed());
@@ -358,17 +367,195 @@ void EntityManager::ConstructEntity(Entity* entity, const SystemAddress& sysAddr
 	}
 }
 
-void EntityManager::ConstructAllEntities(const SystemAddress& sysAddr) {
+std::shared_ptr<RakNet::BitStream> EntityManager::GetConstruction(Entity* entity) {
+	const auto cacheable = IsConstructionCacheable(entity);
+
+	if (cacheable) {
+		const auto cached = m_ConstructionCache.find(entity->GetObjectID());
+
+		if (cached != m_ConstructionCache.end() && cached->second.generation == entity->GetReplicaGeneration()) {
+			return cached->second.stream;
+		}
+	}
+
+	m_SerializationCounter++;
+
+	auto stream = std::make_shared<RakNet::BitStream>();
+
+	stream->Write(static_cast<char>(ID_REPLICA_MANAGER_CONSTRUCTION));
+	stream->Write(true);
+	stream->Write(static_cast<unsigned short>(entity->GetNetworkId()));
+
+	entity->WriteBaseReplicaData(stream.get(), PACKET_TYPE_CONSTRUCTION);
+	entity->WriteComponents(stream.get(), PACKET_TYPE_CONSTRUCTION);
+
+	if (cacheable) {
+		m_ConstructionCache.insert_or_assign(entity->GetObjectID(), CachedConstruction{ entity->GetReplicaGeneration(), stream });
+	}
+
+	return stream;
+}
+
+bool EntityManager::IsConstructionCacheable(Entity* entity) {
+	return !entity->IsPlayer() &&
+		!entity->HasComponent(COMPONENT_TYPE_MOVING_PLATFORM) &&
+		!entity->HasComponent(COMPONENT_TYPE_REBUILD) &&
+		!entity->HasComponent(COMPONENT_TYPE_VEHICLE_PHYSICS);
+}
+
+void EntityManager::ConstructAllEntities(const SystemAddress& sysAddr, std::function<void()> onConstructed) {
 	//ZoneControl is special:
 	ConstructEntity(m_ZoneControlEntity, sysAddr);
 
+	auto* player = Player::GetPlayer(sysAddr);
+
+	if (player == nullptr) {
+		return;
+	}
+
+	auto* missionComponent = player->GetComponent<MissionComponent>();
+
+	const auto& referencePoint = player->GetGhostReferencePoint();
+
+	struct QueuedEntity {
+		bool ghosted;
+		float distance;
+		LWOOBJID id;
+	};
+
+	std::vector<QueuedEntity> queued;
+
 	for (const auto& e : m_Entities) {
-		if (e.second && (e.second->GetSpawnerID() != 0 || e.second->GetLOT() == 1) && !e.second->GetIsGhostingCandidate()) {
-			ConstructEntity(e.second, sysAddr);
+		auto* entity = e.second;
+
+		if (entity == nullptr || entity == m_ZoneControlEntity) continue;
+
+		const auto distance = NiPoint3::DistanceSquared(referencePoint, entity->GetPosition());
+
+		if (!entity->GetIsGhostingCandidate()) {
+			if (entity->GetSpawnerID() != 0 || entity->GetLOT() == 1) {
+				queued.push_back({ false, distance, entity->GetObjectID() });
+			}
+
+			continue;
+		}
+
+		// The ghosted entities the player starts close enough to, like the first ghosting update would
+		if (player->IsObserved(entity->GetObjectID()) || distance >= m_GhostDistanceMinSqaured) continue;
+
+		if (missionComponent == nullptr || IsCollected(missionComponent, entity)) continue;
+
+		queued.push_back({ true, distance, entity->GetObjectID() });
+	}
+
+	std::sort(queued.begin(), queued.end(), [](const QueuedEntity& a, const QueuedEntity& b) {
+		if (a.ghosted != b.ghosted) return !a.ghosted;
+		return a.distance < b.distance;
+	});
+
+	// Joining again before the last queue finished starts over
+	m_ConstructionQueues.erase(
+		std::remove_if(m_ConstructionQueues.begin(), m_ConstructionQueues.end(), [&sysAddr](const ConstructionQueue& queue) {
+			return queue.sysAddr == sysAddr;
+			}),
+		m_ConstructionQueues.end()
+	);
+
+	ConstructionQueue queue{};
+	queue.playerID = player->GetObjectID();
+	queue.sysAddr = sysAddr;
+	queue.onConstructed = std::move(onConstructed);
+	queue.entities.reserve(queued.size());
+
+	for (const auto& entry : queued) {
+		queue.entities.push_back(entry.id);
+	}
+
+	m_ConstructionQueues.push_back(std::move(queue));
+}
+
+void EntityManager::UpdateConstructionQueues() {
+	if (m_ConstructionQueues.empty()) return;
+
+	const auto budget = ConfigOptions::maxConstructionsPerFrame.Get();
+	uint32_t constructed = 0;
+
+	// 0 means there is no limit
+	const auto budgetReached = [budget, &constructed]() { return budget != 0 && constructed >= budget; };
+
+	// Take turns between the joining players, so one joining a busy zone doesn't hold up the others
+	auto progressed = true;
+	while (progressed && !budgetReached()) {
+		progressed = false;
+
+		for (auto& queue : m_ConstructionQueues) {
+			if (budgetReached()) break;
+
+			if (ConstructNext(queue)) {
+				constructed++;
+				progressed = true;
+			}
 		}
 	}
 
-	UpdateGhosting(Player::GetPlayer(sysAddr));
+	std::vector<std::function<void()>> finished;
+
+	m_ConstructionQueues.erase(
+		std::remove_if(m_ConstructionQueues.begin(), m_ConstructionQueues.end(), [&finished](ConstructionQueue& queue) {
+			if (queue.next < queue.entities.size()) return false;
+
+			if (queue.onConstructed && Player::GetPlayer(queue.playerID) != nullptr) {
+				finished.push_back(std::move(queue.onConstructed));
+			}
+
+			return true;
+			}),
+		m_ConstructionQueues.end()
+	);
+
+	for (const auto& onConstructed : finished) {
+		onConstructed();
+	}
+}
+
+bool EntityManager::ConstructNext(ConstructionQueue& queue) {
+	auto* player = Player::GetPlayer(queue.playerID);
+
+	if (player == nullptr) {
+		queue.next = queue.entities.size();
+
+		return false;
+	}
+
+	while (queue.next < queue.entities.size()) {
+		const auto objectID = queue.entities[queue.next++];
+
+		auto* entity = GetEntity(objectID);
+
+		// The entity may have been destroyed since it was queued
+		if (entity == nullptr || std::find(m_EntitiesToDelete.begin(), m_EntitiesToDelete.end(), objectID) != m_EntitiesToDelete.end()) {
+			continue;
+		}
+
+		if (entity->GetIsGhostingCandidate()) {
+			const int32_t id = objectID;
+
+			// Or ghosting already constructed it for the player
+			if (player->IsObserved(id)) continue;
+
+			player->ObserveEntity(id);
+
+			ConstructEntity(entity, queue.sysAddr);
+
+			entity->SetObservers(entity->GetObservers() + 1);
+		} else {
+			ConstructEntity(entity, queue.sysAddr);
+		}
+
+		return true;
+	}
+
+	return false;
 }
 
 void EntityManager::DestructEntity(Entity* entity, const SystemAddress& sysAddr) {
@@ -391,6 +578,8 @@ void EntityManager::DestructEntity(Entity* entity, const SystemAddress& sysAddr)
 }
 
 void EntityManager::SerializeEntity(Entity* entity) {
+	entity->MarkReplicaChanged();
+
 	if (entity->GetNetworkId() == 0) {
 		return;
 	}
@@ -486,14 +675,8 @@ void EntityManager::UpdateGhosting(Player* player) {
 			entity->SetObservers(entity->GetObservers() - 1);
 		} else if (!observed && ghostingDistanceMin > distance) {
 			// Check collectables, don't construct if it has been collected
-			uint32_t collectionId = entity->GetCollectibleID();
-
-			if (collectionId != 0) {
-				collectionId = static_cast<uint32_t>(collectionId) + static_cast<uint32_t>(Game::server->GetZoneID() << 8);
-
-				if (missionComponent->HasCollectible(collectionId)) {
-					continue;
-				}
+			if (IsCollected(missionComponent, entity)) {
+				continue;
 			}
 
 			player->ObserveEntity(id);
@@ -505,6 +688,18 @@ void EntityManager::UpdateGhosting(Player* player) {
 	}
 }
 
+bool EntityManager::IsCollected(MissionComponent* missionComponent, Entity* entity) {
+	uint32_t collectionId = entity->GetCollectibleID();
+
+	if (collectionId == 0) {
+		return false;
+	}
+
+	collectionId = static_cast<uint32_t>(collectionId) + static_cast<uint32_t>(Game::server->GetZoneID() << 8);
+
+	return missionComponent->HasCollectible(collectionId);
+}
+
 void EntityManager::CheckGhosting(Entity* entity) {
 	if (entity == nullptr) {
 		return;
@@ -3,7 +3,9 @@
 
 #include "dCommonVars.h"
 #include "../thirdparty/raknet/Source/Replica.h"
+#include <functional>
 #include <map>
+#include <memory>
 #include <stack>
 
 #include "Entity.h"
@@ -11,6 +13,7 @@
 
 struct SystemAddress;
 class User;
+class MissionComponent;
 
 class EntityManager {
 public:
@@ -28,6 +31,11 @@ public:
 	~EntityManager();
 
 	void UpdateEntities(float deltaTime);
+
+	/**
+	 * Returns the seconds the zone has been updating for, the clock everything timed in the zone can share
+	 */
+	double GetZoneTime() const { return m_ZoneTime; }
 	Entity* CreateEntity(EntityInfo info, User* user = nullptr, Entity* parentEntity = nullptr, bool controller = false, LWOOBJID explicitId = LWOOBJID_EMPTY);
 	void DestroyEntity(const LWOOBJID& objectID);
 	void DestroyEntity(Entity* entity);
@@ -52,7 +60,15 @@ public:
 	void DestructEntity(Entity* entity, const SystemAddress& sysAddr = UNASSIGNED_SYSTEM_ADDRESS);
 	void SerializeEntity(Entity* entity);
 
-	void ConstructAllEntities(const SystemAddress& sysAddr);
+	/**
+	 * Constructs the entities of the zone for a player joining it. The zone control entity is constructed right away,
+	 * the rest is queued and streamed from the next update on, the entities the whole zone relies on first and then
+	 * the ones around the player, each nearest first. At most max_constructions_per_frame are constructed per frame,
+	 * shared between every player that is joining.
+	 * @param sysAddr the address of the joining player
+	 * @param onConstructed called once every queued entity was constructed, not called if the player left before
+	 */
+	void ConstructAllEntities(const SystemAddress& sysAddr, std::function<void()> onConstructed = nullptr);
 	void DestructAllEntities(const SystemAddress& sysAddr);
 
 	void SetGhostDistanceMax(float value);
@@ -77,6 +93,52 @@ public:
 	static bool IsExcludedFromGhosting(LOT lot);
 
 private:
+	/**
+	 * The entities still to be constructed for a player joining the zone, in the order they are sent
+	 */
+	struct ConstructionQueue {
+		LWOOBJID playerID;
+		SystemAddress sysAddr;
+		std::vector<LWOOBJID> entities;
+		size_t next = 0;
+		std::function<void()> onConstructed;
+	};
+
+	/**
+	 * A construction that was written before, sent again until the entity changes
+	 */
+	struct CachedConstruction {
+		uint32_t generation;
+		std::shared_ptr<RakNet::BitStream> stream;
+	};
+
+	/**
+	 * Constructs the queued entities of joining players, up to the construction budget
+	 */
+	void UpdateConstructionQueues();
+
+	/**
+	 * Constructs the next entity in a queue that still needs it
+	 * @return false if the queue ran out, or its player left
+	 */
+	bool ConstructNext(ConstructionQueue& queue);
+
+	/**
+	 * Returns the construction packet of an entity, reusing the last one written if the entity didn't change since
+	 */
+	std::shared_ptr<RakNet::BitStream> GetConstruction(Entity* entity);
+
+	/**
+	 * Returns whether the construction of an entity can be reused. Players and entities whose construction depends
+	 * on the time it is written, such as moving platforms and quickbuilds, are always written again.
+	 */
+	static bool IsConstructionCacheable(Entity* entity);
+
+	/**
+	 * Returns whether a player collected the collectible an entity is, in which case it isn't constructed for them
+	 */
+	static bool IsCollected(MissionComponent* missionComponent, Entity* entity);
+
 	static EntityManager* m_Address; //For singleton method
 	static std::vector<LWOMAPID> m_GhostingExcludedZones;
 	static std::vector<LOT> m_GhostingExcludedLOTs;
@@ -87,11 +149,15 @@ private:
 	std::vector<LWOOBJID> m_EntitiesToSerialize;
 	std::vector<Entity*> m_EntitiesToGhost;
 	std::vector<LWOOBJID> m_PlayersToUpdateGhosting;
+	std::vector<ConstructionQueue> m_ConstructionQueues;
+	std::unordered_map<LWOOBJID, CachedConstruction> m_ConstructionCache;
 	Entity* m_ZoneControlEntity;
 
 	uint16_t m_NetworkIdCounter;
 	uint64_t m_SerializationCounter = 0;
 
+	double m_ZoneTime = 0.0;
+
 	float m_GhostDistanceMinSqaured = 100 * 100;
 	float m_GhostDistanceMaxSquared = 150 * 150;
 	bool m_GhostingEnabled = true;
@@ -6,7 +6,7 @@
 #include "Game.h"
 #include "GameMessages.h"
 #include "dLogger.h"
-#include "dConfig.h"
+#include "ConfigOptions.h"
 
 Leaderboard::Leaderboard(uint32_t gameID, uint32_t infoType, bool weekly, std::vector<LeaderboardEntry> entries,
 	LWOOBJID relatedPlayer, LeaderboardType leaderboardType) {
@@ -92,7 +92,7 @@ void LeaderboardManager::SaveScore(LWOOBJID playerID, uint32_t gameID, uint32_t
 		const auto storedTime = result->getInt(1);
 		const auto storedScore = result->getInt(2);
 		auto highscore = true;
-		bool classicSurvivalScoring = Game::config->GetValue("classic_survival_scoring") == "1";
+		bool classicSurvivalScoring = ConfigOptions::classicSurvivalScoring.Get();
 
 		switch (leaderboardType) {
 		case ShootingGallery:
@@ -165,7 +165,7 @@ Leaderboard* LeaderboardManager::GetLeaderboard(uint32_t gameID, InfoType infoTy
 	auto leaderboardType = GetLeaderboardType(gameID);
 
 	std::string query;
-	bool classicSurvivalScoring = Game::config->GetValue("classic_survival_scoring") == "1";
+	bool classicSurvivalScoring = ConfigOptions::classicSurvivalScoring.Get();
 	switch (infoType) {
 	case InfoType::Standings:
 		switch (leaderboardType) {
@@ -14,6 +14,8 @@
 #include "CharacterComponent.h"
 #include "Mail.h"
 #include "CppScripts.h"
+#include "ScriptedActivityComponent.h"
+#include "PropertyListingManager.h"
 
 std::vector<Player*> Player::m_Players = {};
 
@@ -282,6 +284,8 @@ Player::~Player() {
 	}
 
 	if (IsPlayer()) {
+		if (m_Character != nullptr) PropertyListingManager::Instance()->ForgetViewer(m_Character->GetID());
+
 		Entity* zoneControl = EntityManager::Instance()->GetZoneControlEntity();
 		for (CppScripts::Script* script : CppScripts::GetEntityScripts(zoneControl)) {
 			script->OnPlayerExit(zoneControl, this);
@@ -289,6 +293,10 @@ Player::~Player() {
 
 		std::vector<Entity*> scriptedActs = EntityManager::Instance()->GetEntitiesByComponent(COMPONENT_TYPE_SCRIPTED_ACTIVITY);
 		for (Entity* scriptEntity : scriptedActs) {
+			// Lobbies only find out about players leaving the world from here
+			auto* scriptedActivityComponent = scriptEntity->GetComponent<ScriptedActivityComponent>();
+			if (scriptedActivityComponent != nullptr) scriptedActivityComponent->PlayerLeave(GetObjectID());
+
 			if (scriptEntity->GetObjectID() != zoneControl->GetObjectID()) { // Don't want to trigger twice on instance worlds
 				for (CppScripts::Script* script : CppScripts::GetEntityScripts(scriptEntity)) {
 					script->OnPlayerExit(scriptEntity, this);
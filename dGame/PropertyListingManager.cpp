@@ -0,0 +1,190 @@
+#include "PropertyListingManager.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "Database.h"
+#include "ConfigOptions.h"
+#include "dServer.h"
+#include "dLogger.h"
+#include "Game.h"
+#include "dMessageIdentifiers.h"
+#include "PacketUtils.h"
+#include "PropertyManagementComponent.h"
+
+PropertyListingManager* PropertyListingManager::m_Address = nullptr; //For singleton method
+
+namespace {
+	std::string ToLower(std::string value) {
+		std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::tolower(c); });
+		return value;
+	}
+}
+
+PropertyListingManager::PropertyListingManager() {
+}
+
+std::chrono::seconds PropertyListingManager::GetRefreshInterval() const {
+	return std::chrono::seconds(ConfigOptions::propertyListingRefreshInterval.Get());
+}
+
+PropertyListingManager::MapIndex& PropertyListingManager::GetIndex(LWOMAPID mapId) {
+	auto& index = m_Indices[mapId];
+
+	if (!index.valid || std::chrono::steady_clock::now() - index.builtAt >= GetRefreshInterval()) {
+		Rebuild(mapId, index);
+	}
+
+	return index;
+}
+
+void PropertyListingManager::Rebuild(LWOMAPID mapId, MapIndex& index) {
+	index.listings.clear();
+	index.byOwner.clear();
+
+	std::unique_ptr<sql::PreparedStatement> lookup(Database::CreatePreppedStmt(
+		"SELECT p.id, p.owner_id, p.clone_id, p.name, p.description, p.privacy_option, p.mod_approved, p.last_updated, p.reputation, p.performance_cost, ci.name, ci.account_id "
+		"FROM properties AS p JOIN charinfo AS ci ON ci.prop_clone_id = p.clone_id WHERE p.zone_id = ?;"));
+
+	lookup->setUInt(1, mapId);
+
+	std::unique_ptr<sql::ResultSet> result(lookup->executeQuery());
+
+	while (result->next()) {
+		PropertyListing listing{};
+		listing.propertyId = result->getUInt64(1);
+		listing.ownerId = result->getUInt(2);
+		listing.cloneId = result->getUInt64(3);
+		listing.name = std::string(result->getString(4).c_str());
+		listing.description = std::string(result->getString(5).c_str());
+		listing.privacyOption = result->getInt(6);
+		listing.modApproved = result->getBoolean(7);
+		listing.lastUpdated = result->getInt64(8);
+		listing.reputation = result->getUInt(9);
+		listing.performanceCost = static_cast<float>(result->getDouble(10));
+		listing.ownerName = std::string(result->getString(11).c_str());
+		listing.ownerAccountId = result->getUInt(12);
+		listing.searchText = ToLower(listing.name + '\n' + listing.description + '\n' + listing.ownerName);
+		listing.sortName = ToLower(listing.ownerName);
+
+		index.byOwner[listing.ownerId] = index.listings.size();
+		index.listings.push_back(std::move(listing));
+	}
+
+	const auto& listings = index.listings;
+
+	index.byRecent.resize(listings.size());
+	for (size_t i = 0; i < listings.size(); i++) index.byRecent[i] = i;
+	index.byReputation = index.byRecent;
+	index.byOwnerName = index.byRecent;
+
+	std::stable_sort(index.byRecent.begin(), index.byRecent.end(), [&listings](size_t a, size_t b) {
+		return listings[a].lastUpdated > listings[b].lastUpdated;
+		});
+
+	std::stable_sort(index.byReputation.begin(), index.byReputation.end(), [&listings](size_t a, size_t b) {
+		if (listings[a].reputation != listings[b].reputation) return listings[a].reputation > listings[b].reputation;
+		return listings[a].lastUpdated > listings[b].lastUpdated;
+		});
+
+	std::stable_sort(index.byOwnerName.begin(), index.byOwnerName.end(), [&listings](size_t a, size_t b) {
+		return listings[a].sortName < listings[b].sortName;
+		});
+
+	index.builtAt = std::chrono::steady_clock::now();
+	index.valid = true;
+
+	Game::logger->LogDebug("PropertyListingManager", "Indexed %i properties for map %i", static_cast<int32_t>(listings.size()), mapId);
+}
+
+const PropertyViewerRelations& PropertyListingManager::GetRelations(uint32_t viewerId, uint32_t viewerAccountId) {
+	const auto cached = m_Relations.find(viewerId);
+
+	if (cached != m_Relations.end() && std::chrono::steady_clock::now() - cached->second.fetchedAt < GetRefreshInterval()) {
+		return cached->second;
+	}
+
+	auto& relations = m_Relations[viewerId];
+	relations.accountId = viewerAccountId;
+	relations.friends.clear();
+
+	std::unique_ptr<sql::PreparedStatement> friendsLookup(Database::CreatePreppedStmt(
+		"SELECT CASE WHEN player_id = ? THEN friend_id ELSE player_id END, best_friend FROM friends WHERE player_id = ? OR friend_id = ?;"));
+
+	friendsLookup->setUInt(1, viewerId);
+	friendsLookup->setUInt(2, viewerId);
+	friendsLookup->setUInt(3, viewerId);
+
+	std::unique_ptr<sql::ResultSet> result(friendsLookup->executeQuery());
+
+	while (result->next()) {
+		relations.friends[result->getUInt(1)] = result->getInt(2) == 3;
+	}
+
+	relations.fetchedAt = std::chrono::steady_clock::now();
+
+	return relations;
+}
+
+PropertyListingPage PropertyListingManager::Query(LWOMAPID mapId, uint32_t viewerId, uint32_t viewerAccountId, int32_t sortMethod, const std::string& filterText, int32_t startIndex, int32_t numResults) {
+	PropertyListingPage page{};
+
+	const auto& index = GetIndex(mapId);
+
+	const auto friendsOnly = sortMethod == SORT_TYPE_FEATURED || sortMethod == SORT_TYPE_FRIENDS;
+	const auto minimumPrivacy = static_cast<uint32_t>(friendsOnly ? PropertyPrivacyOption::Friends : PropertyPrivacyOption::Public);
+	const auto filter = ToLower(filterText);
+
+	const PropertyViewerRelations* relations = friendsOnly ? &GetRelations(viewerId, viewerAccountId) : nullptr;
+
+	const std::vector<size_t>* order;
+	if (friendsOnly) order = &index.byOwnerName;
+	else if (sortMethod == SORT_TYPE_REPUTATION) order = &index.byReputation;
+	else order = &index.byRecent;
+
+	const auto first = static_cast<uint32_t>(std::max(startIndex, 0));
+	const auto last = first + static_cast<uint32_t>(std::max(numResults, 0));
+
+	for (const auto i : *order) {
+		const auto& listing = index.listings[i];
+
+		if (listing.privacyOption < minimumPrivacy) continue;
+		if (relations && relations->friends.find(listing.ownerId) == relations->friends.end()) continue;
+		if (!filter.empty() && listing.searchText.find(filter) == std::string::npos) continue;
+
+		if (page.totalMatches >= first && page.totalMatches < last) {
+			page.listings.push_back(&listing);
+		}
+
+		page.totalMatches++;
+	}
+
+	return page;
+}
+
+const PropertyListing* PropertyListingManager::GetOwnedProperty(LWOMAPID mapId, uint32_t ownerId) {
+	const auto& index = GetIndex(mapId);
+
+	const auto owned = index.byOwner.find(ownerId);
+
+	return owned != index.byOwner.end() ? &index.listings[owned->second] : nullptr;
+}
+
+void PropertyListingManager::Invalidate(LWOMAPID mapId) {
+	const auto index = m_Indices.find(mapId);
+
+	if (index != m_Indices.end()) index->second.valid = false;
+}
+
+void PropertyListingManager::NotifyChanged(LWOMAPID mapId) {
+	Invalidate(mapId);
+
+	CBITSTREAM;
+	PacketUtils::WriteHeader(bitStream, MASTER, MSG_MASTER_PROPERTY_LISTING_CHANGED);
+	bitStream.Write(mapId);
+	Game::server->SendToMaster(&bitStream);
+}
+
+void PropertyListingManager::ForgetViewer(uint32_t viewerId) {
+	m_Relations.erase(viewerId);
+}
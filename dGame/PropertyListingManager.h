@@ -0,0 +1,149 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dCommonVars.h"
+
+/**
+ * A single property as it is stored in the listing index, independent of who is viewing it
+ */
+struct PropertyListing {
+	LWOOBJID propertyId = LWOOBJID_EMPTY;
+	uint32_t ownerId = 0;
+	uint32_t ownerAccountId = 0;
+	LWOCLONEID cloneId = LWOCLONEID_INVALID;
+	std::string ownerName = "";
+	std::string name = "";
+	std::string description = "";
+	uint32_t privacyOption = 0;
+	bool modApproved = false;
+	uint32_t lastUpdated = 0;
+	uint32_t reputation = 0;
+	float performanceCost = 0.0f;
+
+	// Lower case copy of the name, description and owner name used for filtering
+	std::string searchText = "";
+
+	// Lower case copy of the owner name used for sorting
+	std::string sortName = "";
+};
+
+/**
+ * The relations a viewer has with other characters, fetched in a single batch
+ */
+struct PropertyViewerRelations {
+	uint32_t accountId = 0;
+	std::unordered_map<uint32_t, bool> friends{}; // Friend character ID -> is best friend
+	std::chrono::steady_clock::time_point fetchedAt{};
+};
+
+/**
+ * The result of a filtered and paginated listing query
+ */
+struct PropertyListingPage {
+	std::vector<const PropertyListing*> listings{};
+	uint32_t totalMatches = 0;
+};
+
+enum ePropertySortType : int32_t {
+	SORT_TYPE_FRIENDS = 0,
+	SORT_TYPE_REPUTATION = 1,
+	SORT_TYPE_RECENT = 3,
+	SORT_TYPE_FEATURED = 5
+};
+
+/**
+ * Keeps an in-memory index of all properties per map so the property launcher can be browsed without
+ * running queries per listed property.  The index is rebuilt with a single query once it is older than
+ * the configured refresh interval.
+ */
+class PropertyListingManager {
+public:
+	static PropertyListingManager* Instance() {
+		if (!m_Address) {
+			m_Address = new PropertyListingManager();
+		}
+
+		return m_Address;
+	}
+
+	/**
+	 * Returns a page of listings for the given map, filtered and sorted for a viewer
+	 * @param mapId the map to list properties for
+	 * @param viewerId the character ID of the viewer
+	 * @param viewerAccountId the account ID of the viewer
+	 * @param sortMethod how to sort the properties, see ePropertySortType
+	 * @param filterText text the property name, description or owner name must contain
+	 * @param startIndex the index of the first result to return
+	 * @param numResults the maximum number of results to return
+	 * @return the requested page and the total number of matching properties
+	 */
+	PropertyListingPage Query(LWOMAPID mapId, uint32_t viewerId, uint32_t viewerAccountId, int32_t sortMethod, const std::string& filterText, int32_t startIndex, int32_t numResults);
+
+	/**
+	 * Returns the listing of the property a character owns on the given map
+	 * @param mapId the map to look on
+	 * @param ownerId the character ID of the owner
+	 * @return the listing, or nullptr if the character has no property on this map
+	 */
+	const PropertyListing* GetOwnedProperty(LWOMAPID mapId, uint32_t ownerId);
+
+	/**
+	 * Returns the friend relations of a viewer, fetching them in one batch if they are not cached
+	 * @param viewerId the character ID of the viewer
+	 * @param viewerAccountId the account ID of the viewer
+	 * @return the relations of the viewer
+	 */
+	const PropertyViewerRelations& GetRelations(uint32_t viewerId, uint32_t viewerAccountId);
+
+	/**
+	 * Marks the index of a map as stale so it gets rebuilt on the next query
+	 * @param mapId the map to invalidate
+	 */
+	void Invalidate(LWOMAPID mapId);
+
+	/**
+	 * Invalidates the index of a map in this world, and through the master server in every other world, as the
+	 * property launchers listing the map run in other worlds than the properties
+	 * @param mapId the map a property changed on
+	 */
+	void NotifyChanged(LWOMAPID mapId);
+
+	/**
+	 * Drops the cached relations of a viewer, for example when they leave the zone
+	 * @param viewerId the character ID of the viewer
+	 */
+	void ForgetViewer(uint32_t viewerId);
+
+private:
+	struct MapIndex {
+		std::vector<PropertyListing> listings{};
+		std::unordered_map<uint32_t, size_t> byOwner{};
+
+		// Listing indices presorted for the sort methods that don't depend on the viewer
+		std::vector<size_t> byRecent{};
+		std::vector<size_t> byReputation{};
+		std::vector<size_t> byOwnerName{};
+
+		std::chrono::steady_clock::time_point builtAt{};
+		bool valid = false;
+	};
+
+	PropertyListingManager();
+
+	/**
+	 * How long an index or set of viewer relations may be served before it is fetched again
+	 */
+	std::chrono::seconds GetRefreshInterval() const;
+
+	MapIndex& GetIndex(LWOMAPID mapId);
+	void Rebuild(LWOMAPID mapId, MapIndex& index);
+
+	static PropertyListingManager* m_Address; //For singleton method
+
+	std::unordered_map<LWOMAPID, MapIndex> m_Indices{};
+	std::unordered_map<uint32_t, PropertyViewerRelations> m_Relations{};
+};
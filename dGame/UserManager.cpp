@@ -441,7 +441,10 @@ void UserManager::DeleteCharacter(const SystemAddress& sysAddr, Packet* packet)
 			delete stmt;
 		}
 		{
-			sql::PreparedStatement* stmt = Database::CreatePreppedStmt("DELETE FROM ugc WHERE character_id=?;");
+			// Identical models share a ugc row, so keep the ones models of other characters still use
+			sql::PreparedStatement* stmt = Database::CreatePreppedStmt(
+				"DELETE FROM ugc WHERE character_id=? AND id NOT IN (SELECT ugc_id FROM properties_contents WHERE ugc_id IS NOT NULL);"
+			);
 			stmt->setUInt64(1, charID);
 			stmt->execute();
 			delete stmt;
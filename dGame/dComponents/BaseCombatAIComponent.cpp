@@ -571,17 +571,7 @@ bool BaseCombatAIComponent::IsEnemy(LWOOBJID target) const {
 		}
 	}
 
-	auto enemyList = referenceDestroyable->GetEnemyFactionsIDs();
-
-	auto candidateList = destroyable->GetFactionIDs();
-
-	for (auto value : candidateList) {
-		if (std::find(enemyList.begin(), enemyList.end(), value) != enemyList.end()) {
-			return true;
-		}
-	}
-
-	return false;
+	return referenceDestroyable->IsEnemy(destroyable);
 }
 
 void BaseCombatAIComponent::SetTarget(const LWOOBJID target) {
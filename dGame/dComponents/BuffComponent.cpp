@@ -2,6 +2,7 @@
 #include <BitStream.h>
 #include "CDClientDatabase.h"
 #include <stdexcept>
+#include <algorithm>
 #include "DestroyableComponent.h"
 #include "Game.h"
 #include "dLogger.h"
@@ -9,6 +10,7 @@
 #include "SkillComponent.h"
 #include "ControllablePhysicsComponent.h"
 #include "EntityManager.h"
+#include "BuffScheduler.h"
 
 std::unordered_map<int32_t, std::vector<BuffParameter>> BuffComponent::m_Cache{};
 
@@ -48,36 +50,49 @@ void BuffComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUp
 	outBitStream->Write0();
 }
 
-void BuffComponent::Update(float deltaTime) {
-	/**
-	 * Loop through all buffs and apply deltaTime to ther time.
-	 * If they have expired, remove the buff and break.
-	 */
-	for (auto& buff : m_Buffs) {
-		// For damage buffs
-		if (buff.second.tick != 0.0f && buff.second.stacks > 0) {
-			buff.second.tickTime -= deltaTime;
-
-			if (buff.second.tickTime <= 0.0f) {
-				buff.second.tickTime = buff.second.tick;
-				buff.second.stacks--;
-
-				SkillComponent::HandleUnmanaged(buff.second.behaviorID, m_Parent->GetObjectID(), buff.second.source);
-			}
-		}
+bool BuffComponent::OnTickDue(const int32_t id, const uint32_t generation, uint32_t& behaviorId, LWOOBJID& source) {
+	const auto& iter = m_Buffs.find(id);
 
-		// These are indefinate buffs, don't update them.
-		if (buff.second.time == 0.0f) {
-			continue;
-		}
+	if (iter == m_Buffs.end() || iter->second.generation != generation) return false;
 
-		buff.second.time -= deltaTime;
+	auto& buff = iter->second;
 
-		if (buff.second.time <= 0.0f) {
-			RemoveBuff(buff.first);
+	if (buff.stacks <= 0) return false;
 
-			break;
-		}
+	buff.stacks--;
+
+	if (buff.stacks > 0) {
+		BuffScheduler::Instance()->ScheduleTick(m_Parent->GetObjectID(), id, generation, buff.tick);
+	}
+
+	behaviorId = buff.behaviorID;
+	source = buff.source;
+
+	return true;
+}
+
+void BuffComponent::OnExpiryDue(const int32_t id, const uint32_t generation) {
+	const auto& iter = m_Buffs.find(id);
+
+	if (iter == m_Buffs.end() || iter->second.generation != generation) return;
+
+	RemoveBuff(id);
+}
+
+void BuffComponent::Schedule(Buff& buff) {
+	auto* scheduler = BuffScheduler::Instance();
+
+	buff.generation = scheduler->NextGeneration();
+
+	// Buffs without a duration are indefinite and never expire on their own
+	if (buff.time != 0.0f) {
+		buff.expiresAt = scheduler->GetTime() + buff.time;
+
+		scheduler->ScheduleExpiry(m_Parent->GetObjectID(), buff.id, buff.generation, buff.time);
+	}
+
+	if (buff.tick != 0.0f && buff.stacks > 0) {
+		scheduler->ScheduleTick(m_Parent->GetObjectID(), buff.id, buff.generation, buff.tick);
 	}
 }
 
@@ -115,12 +130,14 @@ void BuffComponent::ApplyBuff(const int32_t id, const float duration, const LWOO
 	buff.id = id;
 	buff.time = duration;
 	buff.tick = tick;
-	buff.tickTime = tick;
 	buff.stacks = stacks;
 	buff.source = source;
 	buff.behaviorID = behaviorID;
 
-	m_Buffs.emplace(id, buff);
+	Schedule(m_Buffs.emplace(id, buff).first->second);
+
+	// Buffs are only written on construction, so the cached construction is out of date now
+	m_Parent->MarkReplicaChanged();
 }
 
 void BuffComponent::RemoveBuff(int32_t id, bool fromUnEquip, bool removeImmunity) {
@@ -134,6 +151,8 @@ void BuffComponent::RemoveBuff(int32_t id, bool fromUnEquip, bool removeImmunity
 
 	m_Buffs.erase(iter);
 
+	m_Parent->MarkReplicaChanged();
+
 	RemoveBuffEffect(id);
 }
 
@@ -233,6 +252,8 @@ void BuffComponent::RemoveAllBuffs() {
 	}
 
 	m_Buffs.clear();
+
+	m_Parent->MarkReplicaChanged();
 }
 
 void BuffComponent::Reset() {
@@ -279,7 +300,9 @@ void BuffComponent::LoadFromXml(tinyxml2::XMLDocument* doc) {
 		buff.source = sr;
 		buff.behaviorID = b;
 
-		m_Buffs.emplace(id, buff);
+		const auto& inserted = m_Buffs.emplace(id, buff);
+
+		if (inserted.second) Schedule(inserted.first->second);
 
 		buffEntry = buffEntry->NextSiblingElement("b");
 	}
@@ -300,11 +323,17 @@ void BuffComponent::UpdateXml(tinyxml2::XMLDocument* doc) {
 		buffElement->DeleteChildren();
 	}
 
+	const auto now = BuffScheduler::Instance()->GetTime();
+
 	for (const auto& buff : m_Buffs) {
 		auto* buffEntry = doc->NewElement("b");
 
+		// Save the time the buff has left, a buff that is about to expire must not be saved as a buff without a duration
+		auto time = buff.second.time;
+		if (time != 0.0f) time = std::max(static_cast<float>(buff.second.expiresAt - now), 0.001f);
+
 		buffEntry->SetAttribute("id", buff.first);
-		buffEntry->SetAttribute("t", buff.second.time);
+		buffEntry->SetAttribute("t", time);
 		buffEntry->SetAttribute("tk", buff.second.tick);
 		buffEntry->SetAttribute("s", buff.second.stacks);
 		buffEntry->SetAttribute("sr", buff.second.source);
@@ -30,10 +30,19 @@ struct Buff
 	int32_t id = 0;
 	float time = 0;
 	float tick = 0;
-	float tickTime = 0;
 	int32_t stacks = 0;
 	LWOOBJID source = 0;
 	int32_t behaviorID = 0;
+
+	/**
+	 * Time on the BuffScheduler's clock the buff expires at, unused for buffs without a duration
+	 */
+	double expiresAt = 0;
+
+	/**
+	 * Identifies this application of the buff to the BuffScheduler
+	 */
+	uint32_t generation = 0;
 };
 
 /**
@@ -55,7 +64,23 @@ public:
 
 	void Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags);
 
-	void Update(float deltaTime) override;
+	/**
+	 * Called by the BuffScheduler when a damage over time tick of a buff is due, takes a stack off the buff
+	 * and schedules the next tick
+	 * @param id the id of the buff
+	 * @param generation the generation of the buff the tick was scheduled for
+	 * @param behaviorId set to the behavior to handle for the tick
+	 * @param source set to the entity that applied the buff
+	 * @return whether the tick should be handled, false if the buff has been removed since
+	 */
+	bool OnTickDue(int32_t id, uint32_t generation, uint32_t& behaviorId, LWOOBJID& source);
+
+	/**
+	 * Called by the BuffScheduler when a buff expires, removes the buff
+	 * @param id the id of the buff
+	 * @param generation the generation of the buff the expiration was scheduled for
+	 */
+	void OnExpiryDue(int32_t id, uint32_t generation);
 
 	/**
 	 * Applies a buff to the parent entity
@@ -124,6 +149,12 @@ public:
 	const std::vector<BuffParameter>& GetBuffParameters(int32_t buffId);
 
 private:
+	/**
+	 * Schedules the first tick and the expiration of a buff which was just added
+	 * @param buff the buff to schedule
+	 */
+	void Schedule(Buff& buff);
+
 	/**
 	 * The currently active buffs
 	 */
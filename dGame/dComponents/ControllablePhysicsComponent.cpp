@@ -12,6 +12,7 @@
 #include "EntityManager.h"
 #include "Character.h"
 #include "dZoneManager.h"
+#include "SpatialIndex.h"
 
 ControllablePhysicsComponent::ControllablePhysicsComponent(Entity* entity) : Component(entity) {
 	m_Position = {};
@@ -192,6 +193,11 @@ void ControllablePhysicsComponent::SetPosition(const NiPoint3& pos) {
 	m_DirtyPosition = true;
 
 	if (m_dpEntity) m_dpEntity->SetPosition(pos);
+
+	// Moves aren't always serialized right away, the cached construction has to have the new position
+	m_Parent->MarkReplicaChanged();
+
+	SpatialIndex::Instance()->Move(m_Parent);
 }
 
 void ControllablePhysicsComponent::SetRotation(const NiQuaternion& rot) {
@@ -203,6 +209,8 @@ void ControllablePhysicsComponent::SetRotation(const NiQuaternion& rot) {
 	m_DirtyPosition = true;
 
 	if (m_dpEntity) m_dpEntity->SetRotation(rot);
+
+	m_Parent->MarkReplicaChanged();
 }
 
 void ControllablePhysicsComponent::SetVelocity(const NiPoint3& vel) {
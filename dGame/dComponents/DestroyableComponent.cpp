@@ -353,30 +353,13 @@ void DestroyableComponent::AddFaction(const int32_t factionID, const bool ignore
 		return;
 	}
 
-	m_FactionIDs.push_back(factionID);
+	AddFactionNoLookup(factionID);
 	m_DirtyHealth = true;
 
-	auto query = CDClientDatabase::CreatePreppedStmt(
-		"SELECT enemyList FROM Factions WHERE faction = ?;");
-	query.bind(1, (int)factionID);
+	auto* factionMatrix = FactionMatrix::Instance();
 
-	auto result = query.execQuery();
-
-	if (result.eof()) return;
-
-	if (result.fieldIsNull(0)) return;
-
-	const auto* list_string = result.getStringField(0);
-
-	std::stringstream ss(list_string);
-	std::string token;
-
-	while (std::getline(ss, token, ',')) {
-		if (token.empty()) continue;
-
-		auto id = std::stoi(token);
-
-		auto exclude = std::find(m_FactionIDs.begin(), m_FactionIDs.end(), id) != m_FactionIDs.end();
+	for (const auto id : factionMatrix->GetEnemyList(factionID)) {
+		auto exclude = HasFaction(id);
 
 		if (!exclude) {
 			exclude = std::find(m_EnemyFactionIDs.begin(), m_EnemyFactionIDs.end(), id) != m_EnemyFactionIDs.end();
@@ -386,20 +369,34 @@ void DestroyableComponent::AddFaction(const int32_t factionID, const bool ignore
 			continue;
 		}
 
-		AddEnemyFaction(id);
+		m_EnemyFactionIDs.push_back(id);
 	}
 
-	result.finalize();
+	// Same as the list, enemies that are already friendly are left out
+	m_EnemyFactionMask |= factionMatrix->GetEnemyMask(factionID) & ~m_FactionMask;
+	if (!factionMatrix->IsEnemyMaskComplete(factionID)) m_FactionsMasked = false;
+}
+
+void DestroyableComponent::AddFactionNoLookup(const int32_t faction) {
+	m_FactionIDs.push_back(faction);
+	if (!FactionMatrix::Instance()->AddToMask(m_FactionMask, faction)) m_FactionsMasked = false;
 }
 
 bool DestroyableComponent::IsEnemy(const Entity* other) const {
-	const auto* otherDestroyableComponent = other->GetComponent<DestroyableComponent>();
-	if (otherDestroyableComponent != nullptr) {
-		for (const auto enemyFaction : m_EnemyFactionIDs) {
-			for (const auto otherFaction : otherDestroyableComponent->GetFactionIDs()) {
-				if (enemyFaction == otherFaction)
-					return true;
-			}
+	return IsEnemy(other->GetComponent<DestroyableComponent>());
+}
+
+bool DestroyableComponent::IsEnemy(const DestroyableComponent* other) const {
+	if (other == nullptr) return false;
+
+	if (m_FactionsMasked && other->m_FactionsMasked) {
+		return (m_EnemyFactionMask & other->m_FactionMask).any();
+	}
+
+	for (const auto enemyFaction : m_EnemyFactionIDs) {
+		for (const auto otherFaction : other->GetFactionIDs()) {
+			if (enemyFaction == otherFaction)
+				return true;
 		}
 	}
 
@@ -409,14 +406,7 @@ bool DestroyableComponent::IsEnemy(const Entity* other) const {
 bool DestroyableComponent::IsFriend(const Entity* other) const {
 	const auto* otherDestroyableComponent = other->GetComponent<DestroyableComponent>();
 	if (otherDestroyableComponent != nullptr) {
-		for (const auto enemyFaction : m_EnemyFactionIDs) {
-			for (const auto otherFaction : otherDestroyableComponent->GetFactionIDs()) {
-				if (enemyFaction == otherFaction)
-					return false;
-			}
-		}
-
-		return true;
+		return !IsEnemy(otherDestroyableComponent);
 	}
 
 	return false;
@@ -424,6 +414,7 @@ bool DestroyableComponent::IsFriend(const Entity* other) const {
 
 void DestroyableComponent::AddEnemyFaction(int32_t factionID) {
 	m_EnemyFactionIDs.push_back(factionID);
+	if (!FactionMatrix::Instance()->AddToMask(m_EnemyFactionMask, factionID)) m_FactionsMasked = false;
 }
 
 
@@ -499,9 +490,9 @@ bool DestroyableComponent::CheckValidity(const LWOOBJID target, const bool ignor
 		return true;
 	}
 
-	// Get if the target entity is an enemy and friend
-	bool isEnemy = IsEnemy(targetEntity);
-	bool isFriend = IsFriend(targetEntity);
+	// Get if the target entity is an enemy and friend, anything with a destroyable component that isn't an enemy is a friend
+	bool isEnemy = IsEnemy(targetDestroyable);
+	bool isFriend = !isEnemy;
 
 	// Return true if the target type matches what we are targeting
 	return (isEnemy && targetEnemy) || (isFriend && targetFriend);
@@ -779,6 +770,9 @@ void DestroyableComponent::Smash(const LWOOBJID source, const eKillType killType
 void DestroyableComponent::SetFaction(int32_t factionID, bool ignoreChecks) {
 	m_FactionIDs.clear();
 	m_EnemyFactionIDs.clear();
+	m_FactionMask.reset();
+	m_EnemyFactionMask.reset();
+	m_FactionsMasked = true;
 
 	AddFaction(factionID, ignoreChecks);
 }
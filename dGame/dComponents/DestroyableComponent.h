@@ -6,6 +6,7 @@
 #include "tinyxml2.h"
 #include "Entity.h"
 #include "Component.h"
+#include "FactionMatrix.h"
 
 /**
  * Represents the stats of an entity, for example its health, imagination and armor. Also handles factions, which
@@ -185,8 +186,8 @@ public:
 	bool GetIsShielded() const { return m_IsShielded; }
 
 	/**
-	 * Adds a faction to the faction list of this entity, potentially making more factions friendly. Fetches the info
-	 * from the CDClient.
+	 * Adds a faction to the faction list of this entity, potentially making more factions hostile. The enemies of
+	 * the faction come from the FactionMatrix.
 	 * @param factionID the faction ID to add
 	 * @param ignoreChecks whether or not to allow factionID -1
 	 */
@@ -291,6 +292,13 @@ public:
 	 */
 	bool IsEnemy(const Entity* other) const;
 
+	/**
+	 * Returns whether or not the entity of the provided component is an enemy of this entity
+	 * @param other the destroyable component of the entity to check
+	 * @return whether the entity is an enemy of this entity or not
+	 */
+	bool IsEnemy(const DestroyableComponent* other) const;
+
 	/**
 	 * Returns whether or not the provided entity is a friend of this entity
 	 * @param other the entity to check
@@ -420,7 +428,7 @@ public:
 	 *
 	 * This method should only be used for testing.  Use AddFaction(int32_t, bool) for adding a faction properly.
 	 */
-	void AddFactionNoLookup(int32_t faction) { m_FactionIDs.push_back(faction); };
+	void AddFactionNoLookup(int32_t faction);
 
 private:
 	/**
@@ -498,6 +506,21 @@ private:
 	 */
 	std::vector<int32_t> m_EnemyFactionIDs;
 
+	/**
+	 * The faction IDs this entity considers friendly, as a mask
+	 */
+	FactionMask m_FactionMask;
+
+	/**
+	 * The faction IDs this entity considers hostile, as a mask
+	 */
+	FactionMask m_EnemyFactionMask;
+
+	/**
+	 * Whether all the factions of this entity are in the masks, if not the faction lists are compared instead
+	 */
+	bool m_FactionsMasked = true;
+
 	/**
 	 * Whether this entity is smasahble, mostly unused
 	 */
@@ -24,10 +24,12 @@
 #include "dZoneManager.h"
 #include "PropertyManagementComponent.h"
 #include "DestroyableComponent.h"
-#include "dConfig.h"
+#include "ConfigOptions.h"
 #include "eItemType.h"
 #include "eUnequippableActiveType.h"
 
+std::unordered_map<LOT, InventoryComponent::ItemSkills> InventoryComponent::m_ItemSkills{};
+
 InventoryComponent::InventoryComponent(Entity* parent, tinyxml2::XMLDocument* document) : Component(parent) {
 	this->m_Dirty = true;
 	this->m_Equipped = {};
@@ -728,22 +730,19 @@ void InventoryComponent::Serialize(RakNet::BitStream* outBitStream, const bool b
 			bool flag = !item.config.empty();
 			outBitStream->Write(flag);
 			if (flag) {
-				RakNet::BitStream ldfStream;
-				ldfStream.Write<int32_t>(item.config.size()); // Key count
-				for (LDFBaseData* data : item.config) {
+				std::vector<LDFBaseData*> config = item.config;
+				LDFData<std::u16string> assemblyPartLOTs(u"assemblyPartLOTs", u"");
+
+				for (auto& data : config) {
 					if (data->GetKey() == u"assemblyPartLOTs") {
 						std::string newRocketStr = data->GetValueAsString() + ";";
 						GeneralUtils::ReplaceInString(newRocketStr, "+", ";");
-						LDFData<std::u16string>* ldf_data = new LDFData<std::u16string>(u"assemblyPartLOTs", GeneralUtils::ASCIIToUTF16(newRocketStr));
-						ldf_data->WriteToPacket(&ldfStream);
-						delete ldf_data;
-					} else {
-						data->WriteToPacket(&ldfStream);
+						assemblyPartLOTs.SetValue(GeneralUtils::ASCIIToUTF16(newRocketStr));
+						data = &assemblyPartLOTs;
 					}
 				}
-				outBitStream->Write(ldfStream.GetNumberOfBytesUsed() + 1);
-				outBitStream->Write<uint8_t>(0); // Don't compress
-				outBitStream->Write(ldfStream);
+
+				LDFBaseData::WriteListToPacket(outBitStream, config);
 			}
 
 			outBitStream->Write1();
@@ -768,11 +767,19 @@ void InventoryComponent::Update(float deltaTime) {
 }
 
 void InventoryComponent::UpdateSlot(const std::string& location, EquippedItem item, bool keepCurrent) {
-	const auto index = m_Equipped.find(location);
+	auto index = m_Equipped.find(location);
 
 	if (index != m_Equipped.end()) {
 		if (keepCurrent) {
-			m_Equipped.insert_or_assign(location + std::to_string(m_Equipped.size()), item);
+			const auto extraLocation = location + std::to_string(m_Equipped.size());
+
+			const auto extra = m_Equipped.find(extraLocation);
+
+			if (extra != m_Equipped.end()) IndexEquippedLot(extra->second.lot, false);
+
+			m_Equipped.insert_or_assign(extraLocation, item);
+
+			IndexEquippedLot(item.lot, true);
 
 			m_Dirty = true;
 
@@ -784,23 +791,48 @@ void InventoryComponent::UpdateSlot(const std::string& location, EquippedItem it
 		if (old != nullptr) {
 			UnEquipItem(old);
 		}
+
+		// Unequipping frees the slot, unless the item in it wasn't in the inventory
+		index = m_Equipped.find(location);
+
+		if (index != m_Equipped.end()) IndexEquippedLot(index->second.lot, false);
 	}
 
 	m_Equipped.insert_or_assign(location, item);
 
+	IndexEquippedLot(item.lot, true);
+
 	m_Dirty = true;
 }
 
 void InventoryComponent::RemoveSlot(const std::string& location) {
-	if (m_Equipped.find(location) == m_Equipped.end()) {
+	const auto index = m_Equipped.find(location);
+
+	if (index == m_Equipped.end()) {
 		return;
 	}
 
-	m_Equipped.erase(location);
+	IndexEquippedLot(index->second.lot, false);
+
+	m_Equipped.erase(index);
 
 	m_Dirty = true;
 }
 
+void InventoryComponent::IndexEquippedLot(const LOT lot, const bool equipped) {
+	if (equipped) {
+		m_EquippedLots[lot]++;
+
+		return;
+	}
+
+	const auto index = m_EquippedLots.find(lot);
+
+	if (index == m_EquippedLots.end()) return;
+
+	if (--index->second == 0) m_EquippedLots.erase(index);
+}
+
 void InventoryComponent::EquipItem(Item* item, const bool skipChecks) {
 	if (!Inventory::IsValidItem(item->GetLot())) return;
 
@@ -853,7 +885,7 @@ void InventoryComponent::EquipItem(Item* item, const bool skipChecks) {
 
 	CheckItemSet(lot);
 
-	for (auto* set : m_Itemsets) {
+	for (auto* set : m_ItemSetsByLot[lot]) {
 		set->OnEquip(lot);
 	}
 
@@ -883,7 +915,7 @@ void InventoryComponent::UnEquipItem(Item* item) {
 
 	CheckItemSet(lot);
 
-	for (auto* set : m_Itemsets) {
+	for (auto* set : m_ItemSetsByLot[lot]) {
 		set->OnUnEquip(lot);
 	}
 
@@ -1046,54 +1078,36 @@ void InventoryComponent::PopEquippedItems() {
 
 
 bool InventoryComponent::IsEquipped(const LOT lot) const {
-	for (const auto& pair : m_Equipped) {
-		if (pair.second.lot == lot) {
-			return true;
-		}
-	}
-
-	return false;
+	return m_EquippedLots.find(lot) != m_EquippedLots.end();
 }
 
 void InventoryComponent::CheckItemSet(const LOT lot) {
 	// Check if the lot is in the item set cache
-	if (std::find(m_ItemSetsChecked.begin(), m_ItemSetsChecked.end(), lot) != m_ItemSetsChecked.end()) {
+	if (m_ItemSetsByLot.find(lot) != m_ItemSetsByLot.end()) {
 		return;
 	}
 
-	const std::string lot_query = "%" + std::to_string(lot) + "%";
-
-	auto query = CDClientDatabase::CreatePreppedStmt(
-		"SELECT setID FROM ItemSets WHERE itemIDs LIKE ?;");
-	query.bind(1, lot_query.c_str());
-
-	auto result = query.execQuery();
-
-	while (!result.eof()) {
-		const auto id = result.getIntField(0);
+	auto& sets = m_ItemSetsByLot[lot];
 
-		bool found = false;
+	for (const auto id : ItemSet::FindItemSets(lot)) {
+		ItemSet* set = nullptr;
 
 		// Check if we have the set already
 		for (auto* itemset : m_Itemsets) {
 			if (itemset->GetID() == id) {
-				found = true;
+				set = itemset;
 				break;
 			}
 		}
 
-		if (!found) {
-			auto* set = new ItemSet(id, this);
+		if (set == nullptr) {
+			set = new ItemSet(id, this);
 
 			m_Itemsets.push_back(set);
 		}
 
-		result.nextRow();
+		sets.push_back(set);
 	}
-
-	m_ItemSetsChecked.push_back(lot);
-
-	result.finalize();
 }
 
 void InventoryComponent::SetConsumable(LOT lot) {
@@ -1115,7 +1129,7 @@ void InventoryComponent::AddItemSkills(const LOT lot) {
 
 	const auto index = m_Skills.find(slot);
 
-	const auto skill = FindSkill(lot);
+	const auto skill = FindItemSkills(lot).skill;
 
 	if (skill == 0) {
 		return;
@@ -1203,7 +1217,7 @@ void InventoryComponent::SpawnPet(Item* item) {
 	// First check if we can summon the pet.  You need 1 imagination to do so.
 	auto destroyableComponent = m_Parent->GetComponent<DestroyableComponent>();
 
-	if (Game::config->GetValue("pets_take_imagination") == "1" && destroyableComponent && destroyableComponent->GetImagination() <= 0) {
+	if (ConfigOptions::petsTakeImagination.Get() && destroyableComponent && destroyableComponent->GetImagination() <= 0) {
 		GameMessages::SendUseItemRequirementsResponse(m_Parent->GetObjectID(), m_Parent->GetSystemAddress(), UseItemResponse::NoImaginationForPet);
 		return;
 	}
@@ -1269,50 +1283,58 @@ bool InventoryComponent::IsTransferInventory(eInventoryType type) {
 }
 
 uint32_t InventoryComponent::FindSkill(const LOT lot) {
-	auto* table = CDClientManager::Instance()->GetTable<CDObjectSkillsTable>("ObjectSkills");
+	return FindItemSkills(lot).skill;
+}
 
-	const auto results = table->Query([=](const CDObjectSkills& entry) {
-		return entry.objectTemplate == static_cast<unsigned int>(lot);
-		});
+const InventoryComponent::ItemSkills& InventoryComponent::FindItemSkills(const LOT lot) {
+	static const ItemSkills none{};
+	static bool loaded = false;
 
-	for (const auto& result : results) {
-		if (result.castOnType == 0) {
-			return result.skillID;
+	if (!loaded) {
+		loaded = true;
+
+		auto* table = CDClientManager::Instance()->GetTable<CDObjectSkillsTable>("ObjectSkills");
+		auto* behaviors = CDClientManager::Instance()->GetTable<CDSkillBehaviorTable>("SkillBehavior");
+
+		for (const auto& entry : table->GetEntries()) {
+			auto& skills = m_ItemSkills[static_cast<LOT>(entry.objectTemplate)];
+
+			if (entry.castOnType == 0) {
+				if (skills.skill == 0) skills.skill = entry.skillID;
+			} else if (entry.castOnType == 1) {
+				const auto& behavior = behaviors->GetSkillByID(entry.skillID);
+
+				if (behavior.skillID == 0) {
+					Game::logger->Log("InventoryComponent", "Failed to find buff behavior for skill (%i)!", entry.skillID);
+
+					continue;
+				}
+
+				skills.buffs.emplace_back(entry.skillID, behavior.behaviorID);
+			}
 		}
 	}
 
-	return 0;
+	const auto index = m_ItemSkills.find(lot);
+
+	if (index == m_ItemSkills.end()) return none;
+
+	return index->second;
 }
 
 std::vector<uint32_t> InventoryComponent::FindBuffs(Item* item, bool castOnEquip) const {
 	std::vector<uint32_t> buffs;
 	if (item == nullptr) return buffs;
-	auto* table = CDClientManager::Instance()->GetTable<CDObjectSkillsTable>("ObjectSkills");
-	auto* behaviors = CDClientManager::Instance()->GetTable<CDSkillBehaviorTable>("SkillBehavior");
-
-	const auto results = table->Query([=](const CDObjectSkills& entry) {
-		return entry.objectTemplate == static_cast<unsigned int>(item->GetLot());
-		});
 
 	auto* missions = static_cast<MissionComponent*>(m_Parent->GetComponent(COMPONENT_TYPE_MISSION));
 
-	for (const auto& result : results) {
-		if (result.castOnType == 1) {
-			const auto entry = behaviors->GetSkillByID(result.skillID);
-
-			if (entry.skillID == 0) {
-				Game::logger->Log("InventoryComponent", "Failed to find buff behavior for skill (%i)!", result.skillID);
-
-				continue;
-			}
-
-			if (missions != nullptr && castOnEquip) {
-				missions->Progress(MissionTaskType::MISSION_TASK_TYPE_SKILL, result.skillID);
-			}
-
-			// If item is not a proxy, add its buff to the added buffs.
-			if (item->GetParent() == LWOOBJID_EMPTY) buffs.push_back(static_cast<uint32_t>(entry.behaviorID));
+	for (const auto& [skillId, behaviorId] : FindItemSkills(item->GetLot()).buffs) {
+		if (missions != nullptr && castOnEquip) {
+			missions->Progress(MissionTaskType::MISSION_TASK_TYPE_SKILL, skillId);
 		}
+
+		// If item is not a proxy, add its buff to the added buffs.
+		if (item->GetParent() == LWOOBJID_EMPTY) buffs.push_back(behaviorId);
 	}
 
 	return buffs;
@@ -1320,6 +1342,7 @@ std::vector<uint32_t> InventoryComponent::FindBuffs(Item* item, bool castOnEquip
 
 void InventoryComponent::SetNPCItems(const std::vector<LOT>& items) {
 	m_Equipped.clear();
+	m_EquippedLots.clear();
 
 	auto slot = 0u;
 
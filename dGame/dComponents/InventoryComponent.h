@@ -5,6 +5,7 @@
 
 #include <map>
 #include <stack>
+#include <unordered_map>
 
 
 #include "BehaviorSlot.h"
@@ -354,6 +355,40 @@ public:
 	~InventoryComponent() override;
 
 private:
+	/**
+	 * The skills of an item, precomputed from the ObjectSkills and SkillBehavior tables
+	 */
+	struct ItemSkills {
+		/**
+		 * The skill added to the item's behavior slot, 0 if there is none
+		 */
+		uint32_t skill = 0;
+
+		/**
+		 * The skill and behavior IDs of the buffs cast when the item is equipped
+		 */
+		std::vector<std::pair<uint32_t, uint32_t>> buffs;
+	};
+
+	/**
+	 * Returns the precomputed skills of an item, the skills of every item are computed the first time this is called
+	 * @param lot the lot of the item
+	 * @return the skills of the item
+	 */
+	static const ItemSkills& FindItemSkills(LOT lot);
+
+	/**
+	 * Skills of every item that has any, shared between all inventories
+	 */
+	static std::unordered_map<LOT, ItemSkills> m_ItemSkills;
+
+	/**
+	 * Updates the index of equipped LOTs
+	 * @param lot the lot that was equipped or unequipped
+	 * @param equipped whether the lot was equipped
+	 */
+	void IndexEquippedLot(LOT lot, bool equipped);
+
 	/**
 	 * All the inventory this entity possesses
 	 */
@@ -375,15 +410,20 @@ private:
 	std::vector<ItemSet*> m_Itemsets;
 
 	/**
-	 * The LOTs we've checked all the item sets for (for cache reasons)
+	 * The item sets each LOT we've checked is part of, LOTs that aren't part of any set map to an empty list
 	 */
-	std::vector<LOT> m_ItemSetsChecked;
+	std::unordered_map<LOT, std::vector<ItemSet*>> m_ItemSetsByLot;
 
 	/**
 	 * all the equipped items
 	 */
 	EquipmentMap m_Equipped;
 
+	/**
+	 * The number of slots each LOT is equipped in
+	 */
+	std::unordered_map<LOT, uint32_t> m_EquippedLots;
+
 	/**
 	 * Clone of the equipped items before unequipping all of them
 	 */
@@ -1,5 +1,13 @@
 #include "ModelComponent.h"
+
+#include <algorithm>
+
 #include "Entity.h"
+#include "ChatPackets.h"
+#include "GameMessages.h"
+#include "GeneralUtils.h"
+#include "ModelBehavior.h"
+#include "ModelBehaviorScheduler.h"
 
 ModelComponent::ModelComponent(Entity* parent) : Component(parent) {
 	m_OriginalPosition = m_Parent->GetDefaultPosition();
@@ -8,6 +16,14 @@ ModelComponent::ModelComponent(Entity* parent) : Component(parent) {
 	m_userModelID = m_Parent->GetVarAs<LWOOBJID>(u"userModelID");
 }
 
+ModelComponent::~ModelComponent() {
+	if (!m_Behaviors.empty()) ModelBehaviorScheduler::Instance()->Unregister(m_Parent->GetObjectID());
+
+	for (auto* behavior : m_Behaviors) {
+		delete behavior;
+	}
+}
+
 void ModelComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags) {
 	// ItemComponent Serialization.  Pets do not get this serialization.
 	if (!m_Parent->HasComponent(COMPONENT_TYPE_PET)) {
@@ -29,3 +45,131 @@ void ModelComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitialU
 	outBitStream->Write1(); // Is this model paused
 	if (bIsInitialUpdate) outBitStream->Write0(); // We are not writing model editing info
 }
+
+void ModelComponent::OnUse(Entity* originator) {
+	OnBehaviorTrigger(eBehaviorTrigger::INTERACT);
+}
+
+ModelBehavior* ModelComponent::FindBehavior(const int32_t behaviorID) const {
+	for (auto* behavior : m_Behaviors) {
+		if (behavior->GetBehaviorID() == behaviorID) return behavior;
+	}
+
+	return nullptr;
+}
+
+bool ModelComponent::AddBehavior(ModelBehavior* behavior, const uint32_t index) {
+	if (m_Behaviors.size() + m_Templates.size() >= MAX_BEHAVIORS) {
+		delete behavior;
+
+		return false;
+	}
+
+	m_Behaviors.insert(m_Behaviors.begin() + std::min<size_t>(index, m_Behaviors.size()), behavior);
+
+	// Only models with behaviors take part in the scheduler
+	ModelBehaviorScheduler::Instance()->Register(this);
+
+	return true;
+}
+
+void ModelComponent::RemoveBehavior(const int32_t behaviorID) {
+	const auto behavior = std::find_if(m_Behaviors.begin(), m_Behaviors.end(), [behaviorID](ModelBehavior* behavior) {
+		return behavior->GetBehaviorID() == behaviorID;
+	});
+
+	if (behavior == m_Behaviors.end()) return;
+
+	delete *behavior;
+	m_Behaviors.erase(behavior);
+
+	if (m_Behaviors.empty()) ModelBehaviorScheduler::Instance()->Unregister(m_Parent->GetObjectID());
+}
+
+bool ModelComponent::AddTemplate(const int32_t templateID) {
+	if (m_Behaviors.size() + m_Templates.size() >= MAX_BEHAVIORS) return false;
+
+	if (std::find(m_Templates.begin(), m_Templates.end(), templateID) != m_Templates.end()) return false;
+
+	m_Templates.push_back(templateID);
+
+	return true;
+}
+
+bool ModelComponent::RemoveTemplate(const int32_t templateID) {
+	const auto found = std::find(m_Templates.begin(), m_Templates.end(), templateID);
+
+	if (found == m_Templates.end()) return false;
+
+	m_Templates.erase(found);
+
+	return true;
+}
+
+void ModelComponent::OnBehaviorTrigger(const eBehaviorTrigger trigger, const std::string& text) {
+	auto* scheduler = ModelBehaviorScheduler::Instance();
+
+	for (auto* behavior : m_Behaviors) {
+		const auto& program = behavior->GetProgram();
+		const auto strips = program.FindStrips(behavior->GetState(), trigger);
+
+		for (auto strip = strips.first; strip < strips.second; strip++) {
+			const auto& compiled = program.GetStrips()[strip];
+
+			// Chat strips wait for a specific message
+			if (trigger == eBehaviorTrigger::CHAT && program.GetString(compiled.text) != text) continue;
+
+			scheduler->Start(this, behavior, strip);
+		}
+	}
+}
+
+float ModelComponent::ExecuteBehaviorAction(const BehaviorInstruction& instruction, const BehaviorProgram& program, ModelBehavior* behavior) {
+	switch (instruction.op) {
+	case eBehaviorOp::MOVE:
+		m_Parent->SetPosition(m_Parent->GetPosition() + instruction.vector);
+		return instruction.value;
+	case eBehaviorOp::ROTATE:
+		m_Parent->SetRotation(NiQuaternion::FromEulerAngles(m_Parent->GetRotation().GetEulerAngles() + instruction.vector));
+		return instruction.value;
+	case eBehaviorOp::WAIT:
+		return instruction.value;
+	case eBehaviorOp::SMASH:
+		if (!m_IsSmashed) {
+			m_IsSmashed = true;
+			GameMessages::SendSmash(m_Parent, 0.0f, 0.0f, LWOOBJID_EMPTY);
+		}
+		return 0.0f;
+	case eBehaviorOp::UNSMASH:
+		if (m_IsSmashed) {
+			m_IsSmashed = false;
+			GameMessages::SendUnSmash(m_Parent);
+		}
+		return 0.0f;
+	case eBehaviorOp::CHAT:
+		ChatPackets::SendChatMessage(UNASSIGNED_SYSTEM_ADDRESS, 4, "", m_Parent->GetObjectID(), false, GeneralUtils::UTF8ToUTF16(program.GetString(instruction.text)));
+		return 0.0f;
+	case eBehaviorOp::SET_STATE:
+		behavior->SetState(static_cast<BEHAVIORSTATE>(instruction.value));
+		return 0.0f;
+	case eBehaviorOp::RESTART:
+		ResetBehaviors();
+		return 0.0f;
+	}
+
+	return 0.0f;
+}
+
+void ModelComponent::ResetBehaviors() {
+	for (auto* behavior : m_Behaviors) {
+		behavior->Reset();
+	}
+
+	if (m_IsSmashed) {
+		m_IsSmashed = false;
+		GameMessages::SendUnSmash(m_Parent);
+	}
+
+	m_Parent->SetPosition(m_OriginalPosition);
+	m_Parent->SetRotation(m_OriginalRotation);
+}
@@ -1,11 +1,16 @@
 #pragma once
+#include <string>
+#include <vector>
+
 #include "dCommonVars.h"
 #include "RakNetTypes.h"
 #include "NiPoint3.h"
 #include "NiQuaternion.h"
 #include "Component.h"
+#include "BehaviorProgram.h"
 
 class Entity;
+class ModelBehavior;
 
 /**
  * Component that represents entities that are a model, e.g. collectible models and BBB models.
@@ -14,10 +19,18 @@ class ModelComponent : public Component {
 public:
 	static const uint32_t ComponentType = COMPONENT_TYPE_MODEL;
 
+	/**
+	 * The most behaviors a model can have
+	 */
+	static const uint32_t MAX_BEHAVIORS = 5;
+
 	ModelComponent(Entity* parent);
+	~ModelComponent() override;
 
 	void Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags);
 
+	void OnUse(Entity* originator) override;
+
 	/**
 	 * Returns the original position of the model
 	 * @return the original position of the model
@@ -42,6 +55,75 @@ public:
 	 */
 	void SetRotation(const NiQuaternion& rot) { m_OriginalRotation = rot; }
 
+	/**
+	 * Returns the behaviors on this model, in the order they are listed in the behavior editor
+	 * @return the behaviors on this model
+	 */
+	const std::vector<ModelBehavior*>& GetBehaviors() const { return m_Behaviors; }
+
+	/**
+	 * Returns a behavior on this model
+	 * @param behaviorID the ID of the behavior
+	 * @return the behavior, or nullptr if the model doesn't have it
+	 */
+	ModelBehavior* FindBehavior(int32_t behaviorID) const;
+
+	/**
+	 * Adds a behavior to this model, which takes ownership of it
+	 * @param behavior the behavior to add
+	 * @param index the position of the behavior in the list of behaviors
+	 * @return false if the model already has the most behaviors it can have, the behavior is deleted in that case
+	 */
+	bool AddBehavior(ModelBehavior* behavior, uint32_t index);
+
+	/**
+	 * Removes and deletes a behavior from this model
+	 * @param behaviorID the ID of the behavior to remove
+	 */
+	void RemoveBehavior(int32_t behaviorID);
+
+	/**
+	 * Returns the templates placed on this model that haven't been edited yet
+	 * @return the IDs of the templates
+	 */
+	const std::vector<int32_t>& GetTemplates() const { return m_Templates; }
+
+	/**
+	 * Places a template on this model. The server doesn't know the blocks of templates, so a template only becomes
+	 * a behavior of the model once an edit gives it its own ID.
+	 * @param templateID the ID of the template
+	 * @return false if the model already has the template or the most behaviors it can have
+	 */
+	bool AddTemplate(int32_t templateID);
+
+	/**
+	 * Removes a template from this model
+	 * @param templateID the ID of the template
+	 * @return whether the model had the template
+	 */
+	bool RemoveTemplate(int32_t templateID);
+
+	/**
+	 * Starts the strips of the behaviors on this model that run on a trigger in their current state
+	 * @param trigger the trigger that happened
+	 * @param text the message that was said, for chat triggers
+	 */
+	void OnBehaviorTrigger(eBehaviorTrigger trigger, const std::string& text = "");
+
+	/**
+	 * Executes an action of a running strip on this model
+	 * @param instruction the action to execute
+	 * @param program the program the action is in
+	 * @param behavior the behavior the program belongs to
+	 * @return the number of seconds until the next action of the strip should run
+	 */
+	float ExecuteBehaviorAction(const BehaviorInstruction& instruction, const BehaviorProgram& program, ModelBehavior* behavior);
+
+	/**
+	 * Stops all behaviors, returning them to their home state and the model to where it was placed
+	 */
+	void ResetBehaviors();
+
 private:
 
 	/**
@@ -58,4 +140,19 @@ private:
 	 * The ID of the user that made the model
 	 */
 	LWOOBJID m_userModelID;
+
+	/**
+	 * The behaviors on this model
+	 */
+	std::vector<ModelBehavior*> m_Behaviors;
+
+	/**
+	 * The templates on this model that haven't been edited yet, they count towards the most behaviors a model can have
+	 */
+	std::vector<int32_t> m_Templates;
+
+	/**
+	 * Whether a behavior smashed this model
+	 */
+	bool m_IsSmashed = false;
 };
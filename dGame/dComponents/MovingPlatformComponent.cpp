@@ -13,6 +13,8 @@
 #include "CppScripts.h"
 #include "SimplePhysicsComponent.h"
 
+#include <limits>
+
 MoverSubComponent::MoverSubComponent(const NiPoint3& startPos) {
 	mPosition = {};
 
@@ -105,6 +107,9 @@ void MovingPlatformComponent::Serialize(RakNet::BitStream* outBitStream, bool bI
 	outBitStream->Write<bool>(hasPlatform);
 
 	if (hasPlatform) {
+		// Players that just loaded in get the platform where it is on its timeline
+		UpdateMover();
+
 		auto* mover = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 		outBitStream->Write<uint32_t>(static_cast<uint32_t>(m_MoverSubComponentType));
 
@@ -116,6 +121,43 @@ void MovingPlatformComponent::Serialize(RakNet::BitStream* outBitStream, bool bI
 	}
 }
 
+void MovingPlatformComponent::Update(const float deltaTime) {
+	if (m_PathingStopped || m_Timeline.IsEmpty()) {
+		return;
+	}
+
+	const auto time = EntityManager::Instance()->GetZoneTime();
+
+	if (time < m_NextArriveTime) {
+		return;
+	}
+
+	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
+
+	const auto completedLegs = m_Timeline.GetCompletedLegs(time);
+	const auto generation = m_TimelineGeneration;
+
+	// The client moves the platform along the same timeline, so reaching a waypoint isn't serialized
+	while (m_CompletedLegs < completedLegs) {
+		const auto& leg = m_Timeline.GetLeg(m_CompletedLegs);
+
+		m_CompletedLegs++;
+
+		subComponent->mCurrentWaypointIndex = leg.to;
+
+		for (CppScripts::Script* script : CppScripts::GetEntityScripts(m_Parent)) {
+			script->OnWaypointReached(m_Parent, leg.to);
+		}
+
+		// A script moved the platform somewhere else
+		if (generation != m_TimelineGeneration) {
+			return;
+		}
+	}
+
+	m_NextArriveTime = m_Timeline.GetArriveTime(m_CompletedLegs);
+}
+
 void MovingPlatformComponent::OnRebuildInitilized() {
 	StopPathing();
 }
@@ -138,188 +180,137 @@ void MovingPlatformComponent::SetMovementState(MovementPlatformState value) {
 void MovingPlatformComponent::GotoWaypoint(uint32_t index, bool stopAtWaypoint) {
 	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 
+	// Go from where the platform is now, finishing the move it is in the middle of
+	const auto pose = GetPose(EntityManager::Instance()->GetZoneTime());
+
+	subComponent->mPosition = pose.position;
+	subComponent->mCurrentWaypointIndex = pose.moving ? pose.next : pose.current;
 	subComponent->mDesiredWaypointIndex = index;
 	subComponent->mNextWaypointIndex = index;
 	subComponent->mShouldStopAtDesiredWaypoint = stopAtWaypoint;
 
-	StartPathing();
+	StartTimeline(stopAtWaypoint ? index : -1, pose.moving ? &pose : nullptr);
 }
 
 void MovingPlatformComponent::StartPathing() {
 	//GameMessages::SendStartPathing(m_Parent);
-	m_PathingStopped = false;
-
 	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 
 	subComponent->mShouldStopAtDesiredWaypoint = true;
-	subComponent->mState = MovementPlatformState::Stationary;
 
-	NiPoint3 targetPosition;
+	StartTimeline(-1);
+}
 
-	if (m_Path != nullptr) {
-		const auto& currentWaypoint = m_Path->pathWaypoints[subComponent->mCurrentWaypointIndex];
-		const auto& nextWaypoint = m_Path->pathWaypoints[subComponent->mNextWaypointIndex];
+void MovingPlatformComponent::ContinuePathing() {
+	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 
-		subComponent->mPosition = currentWaypoint.position;
-		subComponent->mSpeed = currentWaypoint.movingPlatform.speed;
-		subComponent->mWaitTime = currentWaypoint.movingPlatform.wait;
+	StartTimeline(subComponent->mShouldStopAtDesiredWaypoint ? subComponent->mDesiredWaypointIndex : -1);
+}
 
-		targetPosition = nextWaypoint.position;
-	} else {
-		subComponent->mPosition = m_Parent->GetPosition();
-		subComponent->mSpeed = 1.0f;
-		subComponent->mWaitTime = 2.0f;
+void MovingPlatformComponent::StopPathing() {
+	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 
-		targetPosition = m_Parent->GetPosition() + NiPoint3(0.0f, 10.0f, 0.0f);
-	}
+	// Stop where the platform is now
+	if (!m_PathingStopped && !m_Timeline.IsEmpty()) {
+		const auto pose = GetPose(EntityManager::Instance()->GetZoneTime());
 
-	m_Parent->AddCallbackTimer(subComponent->mWaitTime, [this] {
-		SetMovementState(MovementPlatformState::Moving);
-		});
+		subComponent->mPosition = pose.position;
+		subComponent->mCurrentWaypointIndex = pose.current;
+		subComponent->mNextWaypointIndex = pose.next;
+		subComponent->mPercentBetweenPoints = pose.percent;
+	}
 
-	const auto travelTime = Vector3::Distance(targetPosition, subComponent->mPosition) / subComponent->mSpeed + 1.5f;
+	ClearTimeline();
 
-	const auto travelNext = subComponent->mWaitTime + travelTime;
+	m_PathingStopped = true;
 
-	m_Parent->AddCallbackTimer(travelTime, [subComponent, this] {
-		for (CppScripts::Script* script : CppScripts::GetEntityScripts(m_Parent)) {
-			script->OnWaypointReached(m_Parent, subComponent->mNextWaypointIndex);
-		}
-		});
+	subComponent->mState = MovementPlatformState::Stopped;
+	subComponent->mDesiredWaypointIndex = -1;
+	subComponent->mShouldStopAtDesiredWaypoint = false;
 
-	m_Parent->AddCallbackTimer(travelNext, [this] {
-		ContinuePathing();
-		});
+	EntityManager::Instance()->SerializeEntity(m_Parent);
 
 	//GameMessages::SendPlatformResync(m_Parent, UNASSIGNED_SYSTEM_ADDRESS);
-
-	EntityManager::Instance()->SerializeEntity(m_Parent);
 }
 
-void MovingPlatformComponent::ContinuePathing() {
-	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
-
-	subComponent->mState = MovementPlatformState::Stationary;
-
-	subComponent->mCurrentWaypointIndex = subComponent->mNextWaypointIndex;
-
-	NiPoint3 targetPosition;
-	uint32_t pathSize;
-	PathBehavior behavior;
-
-	if (m_Path != nullptr) {
-		const auto& currentWaypoint = m_Path->pathWaypoints[subComponent->mCurrentWaypointIndex];
-		const auto& nextWaypoint = m_Path->pathWaypoints[subComponent->mNextWaypointIndex];
-
-		subComponent->mPosition = currentWaypoint.position;
-		subComponent->mSpeed = currentWaypoint.movingPlatform.speed;
-		subComponent->mWaitTime = currentWaypoint.movingPlatform.wait; // + 2;
+PlatformPose MovingPlatformComponent::GetPose(const double time) const {
+	if (!m_PathingStopped && !m_Timeline.IsEmpty()) {
+		return m_Timeline.Evaluate(time);
+	}
 
-		pathSize = m_Path->pathWaypoints.size() - 1;
+	const auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 
-		behavior = static_cast<PathBehavior>(m_Path->pathBehavior);
+	PlatformPose pose;
+	pose.position = subComponent->mPosition;
+	pose.current = subComponent->mCurrentWaypointIndex;
+	pose.next = subComponent->mNextWaypointIndex;
+	pose.percent = subComponent->mPercentBetweenPoints;
+	pose.finished = true;
 
-		targetPosition = nextWaypoint.position;
-	} else {
-		subComponent->mPosition = m_Parent->GetPosition();
-		subComponent->mSpeed = 1.0f;
-		subComponent->mWaitTime = 2.0f;
-
-		targetPosition = m_Parent->GetPosition() + NiPoint3(0.0f, 10.0f, 0.0f);
+	return pose;
+}
 
-		pathSize = 1;
-		behavior = PathBehavior::Loop;
-	}
+void MovingPlatformComponent::StartTimeline(const int32_t stopAt, const PlatformPose* between) {
+	m_PathingStopped = false;
 
-	if (m_Parent->GetLOT() == 9483) {
-		behavior = PathBehavior::Bounce;
-	} else {
-		return;
-	}
+	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 
-	if (subComponent->mCurrentWaypointIndex >= pathSize) {
-		subComponent->mCurrentWaypointIndex = pathSize;
-		switch (behavior) {
-		case PathBehavior::Once:
-			EntityManager::Instance()->SerializeEntity(m_Parent);
-			return;
+	ClearTimeline();
 
-		case PathBehavior::Bounce:
-			subComponent->mInReverse = true;
-			break;
+	if (m_Path != nullptr && subComponent->mCurrentWaypointIndex < m_Path->pathWaypoints.size()) {
+		auto behavior = static_cast<PathBehavior>(m_Path->pathBehavior);
 
-		case PathBehavior::Loop:
-			subComponent->mNextWaypointIndex = 0;
-			break;
+		// The client takes a moment longer than the path says to get to a waypoint
+		const auto firstExtraTravelTime = 1.5f;
+		auto extraTravelTime = firstExtraTravelTime;
 
-		default:
-			break;
+		// This platform takes its time on every move after the first
+		if (m_Parent->GetLOT() == 9483) {
+			behavior = PathBehavior::Bounce;
+			extraTravelTime += 20;
 		}
-	} else if (subComponent->mCurrentWaypointIndex == 0) {
-		subComponent->mInReverse = false;
-	}
 
-	if (subComponent->mInReverse) {
-		subComponent->mNextWaypointIndex = subComponent->mCurrentWaypointIndex - 1;
+		m_Timeline = PlatformTimeline::Build(*m_Path, subComponent->mCurrentWaypointIndex, stopAt, behavior, extraTravelTime, firstExtraTravelTime, EntityManager::Instance()->GetZoneTime(), between);
+		m_NextArriveTime = m_Timeline.GetArriveTime(0);
 	} else {
-		subComponent->mNextWaypointIndex = subComponent->mCurrentWaypointIndex + 1;
+		subComponent->mPosition = m_Parent->GetPosition();
 	}
 
-	/*
-	subComponent->mNextWaypointIndex = 0;
-	subComponent->mCurrentWaypointIndex = 1;
-	*/
+	UpdateMover();
 
 	//GameMessages::SendPlatformResync(m_Parent, UNASSIGNED_SYSTEM_ADDRESS);
 
-	if (subComponent->mCurrentWaypointIndex == subComponent->mDesiredWaypointIndex) {
-		// TODO: Send event?
-		StopPathing();
-
-		return;
-	}
-
-	m_Parent->CancelCallbackTimers();
-
-	m_Parent->AddCallbackTimer(subComponent->mWaitTime, [this] {
-		SetMovementState(MovementPlatformState::Moving);
-		});
-
-	auto travelTime = Vector3::Distance(targetPosition, subComponent->mPosition) / subComponent->mSpeed + 1.5;
-
-	if (m_Parent->GetLOT() == 9483) {
-		travelTime += 20;
-	}
-
-	const auto travelNext = subComponent->mWaitTime + travelTime;
-
-	m_Parent->AddCallbackTimer(travelTime, [subComponent, this] {
-		for (CppScripts::Script* script : CppScripts::GetEntityScripts(m_Parent)) {
-			script->OnWaypointReached(m_Parent, subComponent->mNextWaypointIndex);
-		}
-		});
-
-	m_Parent->AddCallbackTimer(travelNext, [this] {
-		ContinuePathing();
-		});
-
 	EntityManager::Instance()->SerializeEntity(m_Parent);
 }
 
-void MovingPlatformComponent::StopPathing() {
-	//m_Parent->CancelCallbackTimers();
+void MovingPlatformComponent::ClearTimeline() {
+	m_Timeline = PlatformTimeline();
+	m_TimelineGeneration++;
+	m_CompletedLegs = 0;
+	m_NextArriveTime = std::numeric_limits<double>::infinity();
+}
+
+void MovingPlatformComponent::UpdateMover() {
+	if (m_PathingStopped || m_Timeline.IsEmpty()) {
+		return;
+	}
 
 	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
 
-	m_PathingStopped = true;
+	const auto pose = m_Timeline.Evaluate(EntityManager::Instance()->GetZoneTime());
 
-	subComponent->mState = MovementPlatformState::Stopped;
-	subComponent->mDesiredWaypointIndex = -1;
-	subComponent->mShouldStopAtDesiredWaypoint = false;
+	subComponent->mPosition = pose.position;
+	subComponent->mCurrentWaypointIndex = pose.current;
+	subComponent->mNextWaypointIndex = pose.next;
+	subComponent->mPercentBetweenPoints = pose.percent;
+	subComponent->mState = pose.moving ? MovementPlatformState::Moving : MovementPlatformState::Stationary;
 
-	EntityManager::Instance()->SerializeEntity(m_Parent);
+	if (m_Path != nullptr) {
+		const auto& waypoint = m_Path->pathWaypoints[pose.current];
 
-	//GameMessages::SendPlatformResync(m_Parent, UNASSIGNED_SYSTEM_ADDRESS);
+		subComponent->mSpeed = waypoint.movingPlatform.speed;
+		subComponent->mWaitTime = waypoint.movingPlatform.wait;
+	}
 }
 
 void MovingPlatformComponent::SetSerialized(bool value) {
@@ -337,6 +328,15 @@ void MovingPlatformComponent::SetNoAutoStart(const bool value) {
 void MovingPlatformComponent::WarpToWaypoint(size_t index) {
 	const auto& waypoint = m_Path->pathWaypoints[index];
 
+	auto* subComponent = static_cast<MoverSubComponent*>(m_MoverSubComponent);
+
+	ClearTimeline();
+
+	subComponent->mPosition = waypoint.position;
+	subComponent->mCurrentWaypointIndex = index;
+	subComponent->mNextWaypointIndex = index;
+	subComponent->mPercentBetweenPoints = 0.0f;
+
 	m_Parent->SetPosition(waypoint.position);
 	m_Parent->SetRotation(waypoint.rotation);
 
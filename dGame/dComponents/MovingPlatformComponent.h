@@ -13,6 +13,7 @@
 #include "dCommonVars.h"
 #include "EntityManager.h"
 #include "Component.h"
+#include "PlatformTimeline.h"
 
  /**
   * Different types of available platforms
@@ -119,6 +120,11 @@ public:
 
 	void Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags);
 
+	/**
+	 * Lets scripts know which waypoints the platform reached on its timeline
+	 */
+	void Update(float deltaTime) override;
+
 	/**
 	 * Stops all pathing, called when an entity starts a quick build associated with this platform
 	 */
@@ -148,7 +154,7 @@ public:
 	void StartPathing();
 
 	/**
-	 * Continues the path of the platform, after it's been stopped
+	 * Continues the path of the platform from the waypoint it is at, after it's been stopped
 	 */
 	void ContinuePathing();
 
@@ -193,7 +199,51 @@ public:
 	 */
 	MoverSubComponent* GetMoverSubComponent() const;
 
+	/**
+	 * Returns where the platform is at a zone time, for anything that has to move along with it
+	 * @param time the zone time, see EntityManager::GetZoneTime
+	 * @return where the platform is
+	 */
+	PlatformPose GetPose(double time) const;
+
 private:
+	/**
+	 * Starts the platform on a new timeline from the waypoint it is at, and sends it to the clients
+	 * @param stopAt the waypoint to stop at, or -1 to follow the path
+	 * @param between where the platform is if it is moving towards the waypoint it is at
+	 */
+	void StartTimeline(int32_t stopAt, const PlatformPose* between = nullptr);
+
+	/**
+	 * Drops the timeline of the platform, waypoints it would have reached are no longer reported
+	 */
+	void ClearTimeline();
+
+	/**
+	 * Sets the mover to where the platform is on its timeline now
+	 */
+	void UpdateMover();
+
+	/**
+	 * The movement of the platform along its path
+	 */
+	PlatformTimeline m_Timeline;
+
+	/**
+	 * Increased whenever the timeline is replaced
+	 */
+	uint32_t m_TimelineGeneration = 0;
+
+	/**
+	 * The number of legs of the timeline the platform has completed
+	 */
+	uint64_t m_CompletedLegs = 0;
+
+	/**
+	 * The zone time the platform completes its next leg at
+	 */
+	double m_NextArriveTime = 0.0;
+
 
 	/**
 	 * The path this platform is currently on
@@ -17,7 +17,7 @@
 #include "eUnequippableActiveType.h"
 
 #include "Game.h"
-#include "dConfig.h"
+#include "ConfigOptions.h"
 #include "dChatFilter.h"
 #include "Database.h"
 
@@ -409,7 +409,7 @@ void PetComponent::Update(float deltaTime) {
 		return;
 	}
 
-	SwitchComponent* closestSwitch = SwitchComponent::GetClosestSwitch(position);
+	SwitchComponent* closestSwitch = SwitchComponent::GetClosestSwitch(position, 20);
 
 	float haltDistance = 5;
 
@@ -428,7 +428,7 @@ void PetComponent::Update(float deltaTime) {
 		}
 	}
 
-	Entity* closestTresure = PetDigServer::GetClosestTresure(position);
+	Entity* closestTresure = PetDigServer::GetClosestTresure(position, 10);
 
 	if (closestTresure != nullptr) {
 		// Skeleton Dragon Pat special case for bone digging
@@ -892,7 +892,7 @@ void PetComponent::Activate(Item* item, bool registerPet, bool fromTaming) {
 }
 
 void PetComponent::AddDrainImaginationTimer(Item* item, bool fromTaming) {
-	if (Game::config->GetValue("pets_take_imagination") != "1") return;
+	if (!ConfigOptions::petsTakeImagination.Get()) return;
 
 	auto playerInventory = item->GetInventory();
 	if (!playerInventory) return;
@@ -1113,5 +1113,5 @@ void PetComponent::LoadPetNameFromModeration() {
 }
 
 void PetComponent::SetPreconditions(std::string& preconditions) {
-	m_Preconditions = new PreconditionExpression(preconditions);
+	m_Preconditions = Preconditions::GetExpression(preconditions);
 }
@@ -353,7 +353,7 @@ private:
 	/**
 	 * Preconditions that need to be met before an entity can tame this pet
 	 */
-	PreconditionExpression* m_Preconditions;
+	const PreconditionExpression* m_Preconditions;
 
 	/**
 	 * The rate at which imagination is drained from the user for having the pet out.
@@ -24,6 +24,7 @@
 #include "dpEntity.h"
 #include "dpShapeBox.h"
 #include "dpShapeSphere.h"
+#include "SpatialIndex.h"
 
 PhantomPhysicsComponent::PhantomPhysicsComponent(Entity* parent) : Component(parent) {
 	m_Position = m_Parent->GetDefaultPosition();
@@ -425,10 +426,17 @@ void PhantomPhysicsComponent::SetPosition(const NiPoint3& pos) {
 	m_Position = pos;
 
 	if (m_dpEntity) m_dpEntity->SetPosition(pos);
+
+	// Moves aren't always serialized right away, the cached construction has to have the new position
+	m_Parent->MarkReplicaChanged();
+
+	SpatialIndex::Instance()->Move(m_Parent);
 }
 
 void PhantomPhysicsComponent::SetRotation(const NiQuaternion& rot) {
 	m_Rotation = rot;
 
 	if (m_dpEntity) m_dpEntity->SetRotation(rot);
+
+	m_Parent->MarkReplicaChanged();
 }
@@ -1,5 +1,6 @@
 #include "PropertyManagementComponent.h"
 
+#include <memory>
 #include <sstream>
 
 #include "MissionComponent.h"
@@ -17,6 +18,9 @@
 #include "Player.h"
 #include "RocketLaunchpadControlComponent.h"
 #include "PropertyEntranceComponent.h"
+#include "PropertyListingManager.h"
+#include "ModelComponent.h"
+#include "ModelBehavior.h"
 
 #include <vector>
 #include "CppScripts.h"
@@ -157,6 +161,9 @@ void PropertyManagementComponent::SetPrivacyOption(PropertyPrivacyOption value)
 	propertyUpdate->setInt64(4, propertyId);
 
 	propertyUpdate->executeUpdate();
+
+	// Property launchers list the property with its new privacy from now on
+	PropertyListingManager::Instance()->NotifyChanged(dZoneManager::Instance()->GetZone()->GetZoneID().GetMapID());
 }
 
 void PropertyManagementComponent::UpdatePropertyDetails(std::string name, std::string description) {
@@ -174,6 +181,8 @@ void PropertyManagementComponent::UpdatePropertyDetails(std::string name, std::s
 
 	propertyUpdate->executeUpdate();
 
+	PropertyListingManager::Instance()->NotifyChanged(dZoneManager::Instance()->GetZone()->GetZoneID().GetMapID());
+
 	OnQueryPropertyData(GetOwner(), UNASSIGNED_SYSTEM_ADDRESS);
 }
 
@@ -237,6 +246,8 @@ bool PropertyManagementComponent::Claim(const LWOOBJID playerId) {
 		return false;
 	}
 
+	PropertyListingManager::Instance()->NotifyChanged(propertyZoneId);
+
 	auto* zoneControlObject = dZoneManager::Instance()->GetZoneControlObject();
 	for (CppScripts::Script* script : CppScripts::GetEntityScripts(zoneControlObject)) {
 		script->OnZonePropertyRented(zoneControlObject, entity);
@@ -564,6 +575,8 @@ void PropertyManagementComponent::UpdateApprovedStatus(const bool value) {
 	update->executeUpdate();
 
 	delete update;
+
+	PropertyListingManager::Instance()->NotifyChanged(dZoneManager::Instance()->GetZone()->GetZoneID().GetMapID());
 }
 
 void PropertyManagementComponent::Load() {
@@ -571,7 +584,7 @@ void PropertyManagementComponent::Load() {
 		return;
 	}
 
-	auto* lookup = Database::CreatePreppedStmt("SELECT id, lot, x, y, z, rx, ry, rz, rw, ugc_id FROM properties_contents WHERE property_id = ?;");
+	auto* lookup = Database::CreatePreppedStmt("SELECT id, lot, x, y, z, rx, ry, rz, rw, ugc_id, behavior_1, behavior_2, behavior_3, behavior_4, behavior_5 FROM properties_contents WHERE property_id = ?;");
 
 	lookup->setUInt64(1, propertyId);
 
@@ -657,9 +670,96 @@ void PropertyManagementComponent::Load() {
 		auto* model = spawner->Spawn();
 
 		models.insert_or_assign(model->GetObjectID(), spawnerId);
+
+		auto* modelComponent = model->GetComponent<ModelComponent>();
+
+		if (modelComponent == nullptr) {
+			continue;
+		}
+
+		for (uint32_t i = 0; i < ModelComponent::MAX_BEHAVIORS; i++) {
+			const auto behaviorID = lookupResult->getInt(11 + i);
+
+			if (behaviorID == 0) {
+				continue;
+			}
+
+			auto* behavior = LoadBehavior(behaviorID, owner);
+
+			if (behavior != nullptr) {
+				modelComponent->AddBehavior(behavior, modelComponent->GetBehaviors().size());
+			}
+		}
+	}
+
+	delete lookup;
+}
+
+ModelBehavior* PropertyManagementComponent::LoadBehavior(const int32_t behaviorID, const LWOOBJID ownerID) {
+	auto* lookup = Database::CreatePreppedStmt("SELECT behavior_info FROM behaviors WHERE id = ? AND character_id = ?;");
+
+	lookup->setInt(1, behaviorID);
+	lookup->setUInt64(2, static_cast<uint32_t>(ownerID));
+
+	auto* lookupResult = lookup->executeQuery();
+
+	ModelBehavior* behavior = nullptr;
+
+	if (lookupResult->next()) {
+		behavior = new ModelBehavior(behaviorID);
+
+		if (!behavior->Deserialize(lookupResult->getString(1).c_str())) {
+			Game::logger->Log("PropertyManagementComponent", "Failed to read behavior (%i)", behaviorID);
+
+			delete behavior;
+			behavior = nullptr;
+		}
+	}
+
+	delete lookupResult;
+	delete lookup;
+
+	return behavior;
+}
+
+void PropertyManagementComponent::SaveBehavior(ModelBehavior* behavior, const LWOOBJID ownerID) {
+	if (behavior->GetIsTemplated() || behavior->GetBehaviorID() == -1) {
+		return;
+	}
+
+	auto* lookup = Database::CreatePreppedStmt("SELECT character_id FROM behaviors WHERE id = ? AND character_id != ?;");
+	auto* remove = Database::CreatePreppedStmt("DELETE FROM behaviors WHERE id = ? AND character_id = ?;");
+	auto* insertion = Database::CreatePreppedStmt("INSERT INTO behaviors (id, character_id, behavior_info) VALUES (?, ?, ?);");
+
+	lookup->setInt(1, behavior->GetBehaviorID());
+	lookup->setUInt64(2, static_cast<uint32_t>(ownerID));
+
+	remove->setInt(1, behavior->GetBehaviorID());
+	remove->setUInt64(2, static_cast<uint32_t>(ownerID));
+
+	insertion->setInt(1, behavior->GetBehaviorID());
+	insertion->setUInt64(2, static_cast<uint32_t>(ownerID));
+	insertion->setString(3, behavior->Serialize());
+
+	try {
+		// A behavior ID another character saved is never taken over
+		std::unique_ptr<sql::ResultSet> otherOwner(lookup->executeQuery());
+
+		if (otherOwner->next()) {
+			Game::logger->Log("PropertyManagementComponent", "Not saving behavior (%i), it belongs to another character", behavior->GetBehaviorID());
+		} else {
+			remove->execute();
+			insertion->execute();
+
+			behavior->SetIsDirty(false);
+		}
+	} catch (sql::SQLException& ex) {
+		Game::logger->Log("PropertyManagementComponent", "Error saving behavior (%i). Error %s", behavior->GetBehaviorID(), ex.what());
 	}
 
 	delete lookup;
+	delete remove;
+	delete insertion;
 }
 
 void PropertyManagementComponent::Save() {
@@ -668,7 +768,7 @@ void PropertyManagementComponent::Save() {
 	}
 
 	auto* insertion = Database::CreatePreppedStmt("INSERT INTO properties_contents VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);");
-	auto* update = Database::CreatePreppedStmt("UPDATE properties_contents SET x = ?, y = ?, z = ?, rx = ?, ry = ?, rz = ?, rw = ? WHERE id = ?;");
+	auto* update = Database::CreatePreppedStmt("UPDATE properties_contents SET x = ?, y = ?, z = ?, rx = ?, ry = ?, rz = ?, rw = ?, behavior_1 = ?, behavior_2 = ?, behavior_3 = ?, behavior_4 = ?, behavior_5 = ? WHERE id = ?;");
 	auto* lookup = Database::CreatePreppedStmt("SELECT id FROM properties_contents WHERE property_id = ?;");
 	auto* remove = Database::CreatePreppedStmt("DELETE FROM properties_contents WHERE id = ?;");
 
@@ -702,8 +802,35 @@ void PropertyManagementComponent::Save() {
 			continue;
 		}
 
-		const auto position = entity->GetPosition();
-		const auto rotation = entity->GetRotation();
+		auto position = entity->GetPosition();
+		auto rotation = entity->GetRotation();
+
+		// Behaviors without an ID, or still using a template, are stored as 0
+		std::vector<int32_t> behaviorIDs(ModelComponent::MAX_BEHAVIORS, 0);
+
+		auto* modelComponent = entity->GetComponent<ModelComponent>();
+
+		if (modelComponent != nullptr) {
+			// Behaviors move the model around, it is saved where it was placed
+			position = modelComponent->GetPosition();
+			rotation = modelComponent->GetRotation();
+
+			const auto& behaviors = modelComponent->GetBehaviors();
+
+			for (size_t i = 0; i < behaviors.size() && i < behaviorIDs.size(); i++) {
+				auto* behavior = behaviors[i];
+
+				if (behavior->GetIsTemplated() || behavior->GetBehaviorID() == -1) {
+					continue;
+				}
+
+				behaviorIDs[i] = behavior->GetBehaviorID();
+
+				if (behavior->GetIsDirty()) {
+					SaveBehavior(behavior, owner);
+				}
+			}
+		}
 
 		if (std::find(present.begin(), present.end(), id) == present.end()) {
 			insertion->setInt64(1, id);
@@ -719,11 +846,9 @@ void PropertyManagementComponent::Save() {
 			insertion->setDouble(11, rotation.w);
 			insertion->setString(12, "Objects_" + std::to_string(entity->GetLOT()) + "_name"); // Model name.  TODO make this customizable
 			insertion->setString(13, ""); // Model description.  TODO implement this.
-			insertion->setDouble(14, 0); // behavior 1.  TODO implement this.
-			insertion->setDouble(15, 0); // behavior 2.  TODO implement this.
-			insertion->setDouble(16, 0); // behavior 3.  TODO implement this.
-			insertion->setDouble(17, 0); // behavior 4.  TODO implement this.
-			insertion->setDouble(18, 0); // behavior 5.  TODO implement this.
+			for (size_t i = 0; i < behaviorIDs.size(); i++) {
+				insertion->setInt(14 + i, behaviorIDs[i]);
+			}
 			try {
 				insertion->execute();
 			} catch (sql::SQLException& ex) {
@@ -738,7 +863,11 @@ void PropertyManagementComponent::Save() {
 			update->setDouble(6, rotation.z);
 			update->setDouble(7, rotation.w);
 
-			update->setInt64(8, id);
+			for (size_t i = 0; i < behaviorIDs.size(); i++) {
+				update->setInt(8 + i, behaviorIDs[i]);
+			}
+
+			update->setInt64(13, id);
 			try {
 				update->executeUpdate();
 			} catch (sql::SQLException& ex) {
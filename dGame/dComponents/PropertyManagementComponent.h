@@ -4,6 +4,8 @@
 #include "Entity.h"
 #include "Component.h"
 
+class ModelBehavior;
+
 /**
  * Information regarding which players may visit this property
  */
@@ -148,6 +150,21 @@ public:
 	 */
 	void Save();
 
+	/**
+	 * Loads a behavior a player saved from the database
+	 * @param behaviorID the ID of the behavior to load
+	 * @param ownerID the character the behavior has to belong to
+	 * @return the behavior, or nullptr if the character didn't save it
+	 */
+	static ModelBehavior* LoadBehavior(int32_t behaviorID, LWOOBJID ownerID);
+
+	/**
+	 * Saves a behavior to the database, behaviors that are still a template or belong to another character aren't saved
+	 * @param behavior the behavior to save
+	 * @param ownerID the character the behavior belongs to
+	 */
+	static void SaveBehavior(ModelBehavior* behavior, LWOOBJID ownerID);
+
 	/**
 	 * Adds a model to the cache of models
 	 * @param modelId the ID of the model
@@ -15,12 +15,13 @@
 #include "Player.h"
 #include "PossessableComponent.h"
 #include "PossessorComponent.h"
+#include "RaceTrack.h"
 #include "RacingTaskParam.h"
 #include "Spawner.h"
 #include "VehiclePhysicsComponent.h"
 #include "dServer.h"
 #include "dZoneManager.h"
-#include "dConfig.h"
+#include "ConfigOptions.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846264338327950288
@@ -41,7 +42,7 @@ RacingControlComponent::RacingControlComponent(Entity* parent)
 	m_Finished = 0;
 	m_StartTime = 0;
 	m_EmptyTimer = 0;
-	m_SoloRacing = Game::config->GetValue("solo_racing") == "1";
+	m_SoloRacing = ConfigOptions::soloRacing.Get();
 
 	// Select the main world ID as fallback when a player fails to load.
 
@@ -75,7 +76,9 @@ RacingControlComponent::RacingControlComponent(Entity* parent)
 	}
 }
 
-RacingControlComponent::~RacingControlComponent() {}
+RacingControlComponent::~RacingControlComponent() {
+	delete m_Track;
+}
 
 void RacingControlComponent::OnPlayerLoaded(Entity* player) {
 	// If the race has already started, send the player back to the main world.
@@ -123,10 +126,15 @@ void RacingControlComponent::LoadPlayerVehicle(Entity* player,
 
 	// Calculate the vehicle's starting position.
 
-	auto* path = dZoneManager::Instance()->GetZone()->GetPath(
-		GeneralUtils::UTF16ToWTF8(m_PathName));
+	auto* track = GetTrack();
 
-	auto startPosition = path->pathWaypoints[0].position + NiPoint3::UNIT_Y * 3;
+	if (track == nullptr) {
+		Game::logger->Log("RacingControlComponent", "Failed to find race path");
+
+		return;
+	}
+
+	auto startPosition = track->GetWaypoint(0) + NiPoint3::UNIT_Y * 3;
 
 	const auto spacing = 15;
 
@@ -745,8 +753,11 @@ void RacingControlComponent::Update(float deltaTime) {
 	}
 
 	// Race routines
-	auto* path = dZoneManager::Instance()->GetZone()->GetPath(
-		GeneralUtils::UTF16ToWTF8(m_PathName));
+	auto* track = GetTrack();
+
+	if (track == nullptr) {
+		return;
+	}
 
 	for (auto& player : m_RacingPlayers) {
 		auto* vehicle = EntityManager::Instance()->GetEntity(player.vehicleID);
@@ -771,115 +782,129 @@ void RacingControlComponent::Update(float deltaTime) {
 			continue;
 		}
 
-		// Loop through all the waypoints and see if the player has reached a
-		// new checkpoint
+		if (player.lap == 3) {
+			continue;
+		}
+
+		// See if the player has reached a new checkpoint, not sure how we are
+		// supposed to check this, within 50 units seems safe
 		uint32_t respawnIndex = 0;
-		for (const auto& waypoint : path->pathWaypoints) {
-			if (player.lap == 3) {
-				break;
-			}
 
-			if (player.respawnIndex == respawnIndex) {
-				++respawnIndex;
+		if (!track->FindCheckpoint(player.respawnIndex, vehiclePosition, respawnIndex)) {
+			player.distance = track->GetDistance(player.respawnIndex, vehiclePosition);
 
-				continue;
-			}
+			continue;
+		}
 
-			const auto& position = waypoint.position;
+		const auto lapped = respawnIndex < player.respawnIndex;
 
-			if (std::abs((int)respawnIndex - (int)player.respawnIndex) > 10 &&
-				player.respawnIndex != path->pathWaypoints.size() - 1) {
-				++respawnIndex;
+		// Some offset up to make they don't fall through the terrain on a
+		// respawn, seems to fix itself to the track anyhow
+		player.respawnPosition = track->GetWaypoint(respawnIndex) + NiPoint3::UNIT_Y * 5;
+		player.respawnRotation = vehicle->GetRotation();
+		player.respawnIndex = respawnIndex;
+		player.distance = track->GetDistance(respawnIndex, vehiclePosition);
 
-				continue;
-			}
+		Game::logger->Log("RacingControlComponent",
+			"Reached point (%i)/(%i)", player.respawnIndex,
+			track->GetWaypointCount());
 
-			if (Vector3::DistanceSquared(position, vehiclePosition) > 50 * 50) {
-				++respawnIndex;
+		// Passed the start point, lapped
+		if (!lapped) {
+			continue;
+		}
 
-				continue;
-			}
+		time_t lapTime = std::time(nullptr) - (player.lap == 0 ? m_StartTime : player.lapTime);
 
-			// Only go upwards, except if we've lapped
-			// Not sure how we are supposed to check if they've reach a
-			// checkpoint, within 50 units seems safe
-			if (!(respawnIndex > player.respawnIndex ||
-				player.respawnIndex == path->pathWaypoints.size() - 1)) {
-				++respawnIndex;
+		// Cheating check
+		if (lapTime < 40) {
+			continue;
+		}
 
-				continue;
-			}
+		player.lap++;
 
-			// Some offset up to make they don't fall through the terrain on a
-			// respawn, seems to fix itself to the track anyhow
-			player.respawnPosition = position + NiPoint3::UNIT_Y * 5;
-			player.respawnRotation = vehicle->GetRotation();
-			player.respawnIndex = respawnIndex;
+		player.lapTime = std::time(nullptr);
 
-			// Reached the start point, lapped
-			if (respawnIndex == 0) {
-				time_t lapTime = std::time(nullptr) - (player.lap == 0 ? m_StartTime : player.lapTime);
+		if (player.bestLapTime == 0 || player.bestLapTime > lapTime) {
+			player.bestLapTime = lapTime;
 
-				// Cheating check
-				if (lapTime < 40) {
-					continue;
-				}
+			Game::logger->Log("RacingControlComponent",
+				"Best lap time (%llu)", lapTime);
+		}
 
-				player.lap++;
+		auto* missionComponent =
+			playerEntity->GetComponent<MissionComponent>();
 
-				player.lapTime = std::time(nullptr);
+		if (missionComponent != nullptr) {
 
-				if (player.bestLapTime == 0 || player.bestLapTime > lapTime) {
-					player.bestLapTime = lapTime;
+			// Progress lap time tasks
+			missionComponent->Progress(MissionTaskType::MISSION_TASK_TYPE_RACING, (lapTime) * 1000, (LWOOBJID)RacingTaskParam::RACING_TASK_PARAM_LAP_TIME);
 
-					Game::logger->Log("RacingControlComponent",
-						"Best lap time (%llu)", lapTime);
-				}
+			if (player.lap == 3) {
+				m_Finished++;
+				player.finished = m_Finished;
 
-				auto* missionComponent =
-					playerEntity->GetComponent<MissionComponent>();
+				const auto raceTime =
+					(std::time(nullptr) - m_StartTime);
 
-				if (missionComponent != nullptr) {
+				player.raceTime = raceTime;
 
-					// Progress lap time tasks
-					missionComponent->Progress(MissionTaskType::MISSION_TASK_TYPE_RACING, (lapTime) * 1000, (LWOOBJID)RacingTaskParam::RACING_TASK_PARAM_LAP_TIME);
+				Game::logger->Log("RacingControlComponent",
+					"Completed time %llu, %llu",
+					raceTime, raceTime * 1000);
 
-					if (player.lap == 3) {
-						m_Finished++;
-						player.finished = m_Finished;
+				// Entire race time
+				missionComponent->Progress(MissionTaskType::MISSION_TASK_TYPE_RACING, (raceTime) * 1000, (LWOOBJID)RacingTaskParam::RACING_TASK_PARAM_TOTAL_TRACK_TIME);
 
-						const auto raceTime =
-							(std::time(nullptr) - m_StartTime);
+				auto* characterComponent = playerEntity->GetComponent<CharacterComponent>();
+				if (characterComponent != nullptr) {
+					characterComponent->TrackRaceCompleted(m_Finished == 1);
+				}
 
-						player.raceTime = raceTime;
+				// TODO: Figure out how to update the GUI leaderboard.
+			}
+		}
 
-						Game::logger->Log("RacingControlComponent",
-							"Completed time %llu, %llu",
-							raceTime, raceTime * 1000);
+		Game::logger->Log("RacingControlComponent",
+			"Lapped (%i) in (%llu)", player.lap,
+			lapTime);
+	}
 
-						// Entire race time
-						missionComponent->Progress(MissionTaskType::MISSION_TASK_TYPE_RACING, (raceTime) * 1000, (LWOOBJID)RacingTaskParam::RACING_TASK_PARAM_TOTAL_TRACK_TIME);
+	UpdateLeadingPlayer();
+}
 
-						auto* characterComponent = playerEntity->GetComponent<CharacterComponent>();
-						if (characterComponent != nullptr) {
-							characterComponent->TrackRaceCompleted(m_Finished == 1);
-						}
+RaceTrack* RacingControlComponent::GetTrack() {
+	if (m_Track != nullptr) {
+		return m_Track;
+	}
 
-						// TODO: Figure out how to update the GUI leaderboard.
-					}
-				}
+	const auto* path = dZoneManager::Instance()->GetZone()->GetPath(
+		GeneralUtils::UTF16ToWTF8(m_PathName));
 
-				Game::logger->Log("RacingControlComponent",
-					"Lapped (%i) in (%llu)", player.lap,
-					lapTime);
-			}
+	if (path == nullptr || path->pathWaypoints.empty()) {
+		return nullptr;
+	}
 
-			Game::logger->Log("RacingControlComponent",
-				"Reached point (%i)/(%i)", player.respawnIndex,
-				path->pathWaypoints.size());
+	m_Track = new RaceTrack(*path);
 
-			break;
-		}
+	return m_Track;
+}
+
+void RacingControlComponent::UpdateLeadingPlayer() {
+	// Finished players keep the place they finished in, everyone else is ordered by how far they got
+	const auto leader = std::min_element(m_RacingPlayers.begin(), m_RacingPlayers.end(), [](const RacingPlayerInfo& a, const RacingPlayerInfo& b) {
+		if ((a.finished != 0) != (b.finished != 0)) return a.finished != 0;
+		if (a.finished != 0) return a.finished < b.finished;
+		if (a.lap != b.lap) return a.lap > b.lap;
+		return a.distance > b.distance;
+	});
+
+	const auto leadingPlayer = leader == m_RacingPlayers.end() ? LWOOBJID_EMPTY : leader->playerID;
+
+	if (leadingPlayer != m_LeadingPlayer) {
+		m_LeadingPlayer = leadingPlayer;
+
+		EntityManager::Instance()->SerializeEntity(m_Parent);
 	}
 }
 
@@ -8,6 +8,8 @@
 #include "Entity.h"
 #include "Component.h"
 
+class RaceTrack;
+
  /**
   * Information for each player in the race
   */
@@ -58,6 +60,11 @@ struct RacingPlayerInfo {
 	 */
 	uint32_t lap;
 
+	/**
+	 * How far along the current lap the player is
+	 */
+	float distance = 0;
+
 	/**
 	 * Whether or not the player has finished the race
 	 */
@@ -158,6 +165,22 @@ public:
 	static std::string FormatTimeString(time_t time);
 
 private:
+	/**
+	 * Returns the track of this race, building it from the race path the first time
+	 * @return the track of this race, or nullptr if the zone has no race path
+	 */
+	RaceTrack* GetTrack();
+
+	/**
+	 * Finds the player furthest ahead in the race and serializes them if they changed
+	 */
+	void UpdateLeadingPlayer();
+
+	/**
+	 * The track built from the race path
+	 */
+	RaceTrack* m_Track = nullptr;
+
 
 	/**
 	 * The players that are currently racing
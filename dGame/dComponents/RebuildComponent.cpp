@@ -21,7 +21,7 @@ RebuildComponent::RebuildComponent(Entity* entity) : Component(entity) {
 	std::u16string checkPreconditions = entity->GetVar<std::u16string>(u"CheckPrecondition");
 
 	if (!checkPreconditions.empty()) {
-		m_Precondition = new PreconditionExpression(GeneralUtils::UTF16ToWTF8(checkPreconditions));
+		m_Precondition = Preconditions::GetExpression(GeneralUtils::UTF16ToWTF8(checkPreconditions));
 	}
 
 	// Should a setting that has the build activator position exist, fetch that setting here and parse it for position.
@@ -40,8 +40,6 @@ RebuildComponent::RebuildComponent(Entity* entity) : Component(entity) {
 }
 
 RebuildComponent::~RebuildComponent() {
-	delete m_Precondition;
-
 	Entity* builder = GetBuilder();
 	if (builder) {
 		CancelRebuild(builder, eFailReason::REASON_BUILD_ENDED, true);
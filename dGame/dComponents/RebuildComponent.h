@@ -361,7 +361,7 @@ private:
 	/**
 	 * Preconditions to be met before being able to start the rebuild
 	 */
-	PreconditionExpression* m_Precondition = nullptr;
+	const PreconditionExpression* m_Precondition = nullptr;
 
 	/**
 	 * Starts the rebuild for a certain entity
@@ -125,6 +125,9 @@ Effect* RenderComponent::AddEffect(const int32_t effectId, const std::string& na
 
 	m_Effects.push_back(eff);
 
+	// Effects are only written on construction, so the cached construction is out of date now
+	m_Parent->MarkReplicaChanged();
+
 	return eff;
 }
 
@@ -148,6 +151,8 @@ void RenderComponent::RemoveEffect(const std::string& name) {
 	}
 
 	m_Effects.erase(m_Effects.begin() + index);
+
+	m_Parent->MarkReplicaChanged();
 }
 
 void RenderComponent::Update(const float deltaTime) {
@@ -15,6 +15,21 @@ RigidbodyPhantomPhysicsComponent::RigidbodyPhantomPhysicsComponent(Entity* paren
 RigidbodyPhantomPhysicsComponent::~RigidbodyPhantomPhysicsComponent() {
 }
 
+void RigidbodyPhantomPhysicsComponent::SetPosition(const NiPoint3& pos) {
+	m_Position = pos;
+	m_IsDirty = true;
+
+	// Moves aren't always serialized right away, the cached construction has to have the new position
+	m_Parent->MarkReplicaChanged();
+}
+
+void RigidbodyPhantomPhysicsComponent::SetRotation(const NiQuaternion& rot) {
+	m_Rotation = rot;
+	m_IsDirty = true;
+
+	m_Parent->MarkReplicaChanged();
+}
+
 void RigidbodyPhantomPhysicsComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags) {
 	outBitStream->Write(m_IsDirty || bIsInitialUpdate);
 	if (m_IsDirty || bIsInitialUpdate) {
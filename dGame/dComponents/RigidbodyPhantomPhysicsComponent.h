@@ -35,7 +35,7 @@ public:
 	 * Sets the position of this entity
 	 * @param pos the position to set
 	 */
-	void SetPosition(const NiPoint3& pos) { m_Position = pos; m_IsDirty = true; }
+	void SetPosition(const NiPoint3& pos);
 
 	/**
 	 * Returns the rotation of this entity
@@ -47,7 +47,7 @@ public:
 	 * Sets the rotation for this entity
 	 * @param rot the rotation to tset
 	 */
-	void SetRotation(const NiQuaternion& rot) { m_Rotation = rot; m_IsDirty = true; }
+	void SetRotation(const NiQuaternion& rot);
 
 private:
 
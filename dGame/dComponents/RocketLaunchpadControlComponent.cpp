@@ -29,7 +29,7 @@ RocketLaunchpadControlComponent::RocketLaunchpadControlComponent(Entity* parent,
 		m_TargetZone = result.getIntField(0);
 		m_DefaultZone = result.getIntField(1);
 		m_TargetScene = result.getStringField(2);
-		m_AltPrecondition = new PreconditionExpression(result.getStringField(3));
+		m_AltPrecondition = Preconditions::GetExpression(result.getStringField(3));
 		m_AltLandingScene = result.getStringField(4);
 	}
 
@@ -37,7 +37,6 @@ RocketLaunchpadControlComponent::RocketLaunchpadControlComponent(Entity* parent,
 }
 
 RocketLaunchpadControlComponent::~RocketLaunchpadControlComponent() {
-	delete m_AltPrecondition;
 }
 
 void RocketLaunchpadControlComponent::Launch(Entity* originator, LWOMAPID mapId, LWOCLONEID cloneId) {
@@ -63,7 +62,7 @@ void RocketLaunchpadControlComponent::Launch(Entity* originator, LWOMAPID mapId,
 	TellMasterToPrepZone(zone);
 
 	// Achievement unlocked: "All zones unlocked"
-	if (!m_AltLandingScene.empty() && m_AltPrecondition->Check(originator)) {
+	if (!m_AltLandingScene.empty() && m_AltPrecondition != nullptr && m_AltPrecondition->Check(originator)) {
 		character->SetTargetScene(m_AltLandingScene);
 	} else {
 		character->SetTargetScene(m_TargetScene);
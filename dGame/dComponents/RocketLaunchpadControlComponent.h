@@ -120,7 +120,7 @@ private:
 	/**
 	 * Some precondition that needs to be met to trigger the alternative landing scene
 	 */
-	PreconditionExpression* m_AltPrecondition;
+	const PreconditionExpression* m_AltPrecondition = nullptr;
 
 	/**
 	 * Notifies the master server to prepare some world for a player to be able to travel to it
@@ -15,20 +15,24 @@
 #include "dServer.h"
 #include "GeneralUtils.h"
 #include "dZoneManager.h"
-#include "dConfig.h"
+#include "ConfigOptions.h"
 #include "DestroyableComponent.h"
 
+std::unordered_map<uint32_t, ActivityDefinition> ScriptedActivityComponent::m_Definitions{};
+std::unordered_map<uint32_t, uint32_t> ScriptedActivityComponent::m_ActivitiesByLootMatrix{};
+bool ScriptedActivityComponent::m_DefinitionsLoaded = false;
+
 ScriptedActivityComponent::ScriptedActivityComponent(Entity* parent, int activityID) : Component(parent) {
 	m_ActivityID = activityID;
-	CDActivitiesTable* activitiesTable = CDClientManager::Instance()->GetTable<CDActivitiesTable>("Activities");
-	std::vector<CDActivities> activities = activitiesTable->Query([=](CDActivities entry) {return (entry.ActivityID == m_ActivityID); });
 
-	for (CDActivities activity : activities) {
-		m_ActivityInfo = activity;
+	const auto& definition = GetActivityDefinition(m_ActivityID);
+
+	if (definition.found) {
+		m_ActivityInfo = definition.info;
 
 		const auto mapID = m_ActivityInfo.instanceMapID;
 
-		if ((mapID == 1203 || mapID == 1261 || mapID == 1303 || mapID == 1403) && Game::config->GetValue("solo_racing") == "1") {
+		if ((mapID == 1203 || mapID == 1261 || mapID == 1303 || mapID == 1403) && ConfigOptions::soloRacing.Get()) {
 			m_ActivityInfo.minTeamSize = 1;
 			m_ActivityInfo.minTeams = 1;
 		}
@@ -49,30 +53,84 @@ ScriptedActivityComponent::ScriptedActivityComponent(Entity* parent, int activit
 
 	if (destroyableComponent) {
 		// check for LMIs and set the loot LMIs
-		CDActivityRewardsTable* activityRewardsTable = CDClientManager::Instance()->GetTable<CDActivityRewardsTable>("ActivityRewards");
-		std::vector<CDActivityRewards> activityRewards = activityRewardsTable->Query([=](CDActivityRewards entry) {return (entry.LootMatrixIndex == destroyableComponent->GetLootMatrixID()); });
+		const auto startingLMI = static_cast<uint32_t>(destroyableComponent->GetLootMatrixID());
 
-		uint32_t startingLMI = 0;
+		const auto rewardActivity = m_ActivitiesByLootMatrix.find(startingLMI);
 
-		if (activityRewards.size() > 0) {
-			startingLMI = activityRewards[0].LootMatrixIndex;
+		if (startingLMI > 0 && rewardActivity != m_ActivitiesByLootMatrix.end()) {
+			// now time for bodge :)
+			m_ActivityLootMatrices = GetActivityDefinition(rewardActivity->second).ratingLootMatrices;
 		}
+	}
+}
 
-		if (startingLMI > 0) {
-			// now time for bodge :)
+ScriptedActivityComponent::~ScriptedActivityComponent() {
+	for (const auto& [id, lobby] : m_Lobbies) {
+		for (auto* player : lobby->players) {
+			delete player;
+		}
+
+		delete lobby;
+	}
+}
+
+void ScriptedActivityComponent::LoadDefinitions() {
+	m_DefinitionsLoaded = true;
+
+	auto* activitiesTable = CDClientManager::Instance()->GetTable<CDActivitiesTable>("Activities");
+	auto* activityRewardsTable = CDClientManager::Instance()->GetTable<CDActivityRewardsTable>("ActivityRewards");
+	auto* currencyTableTable = CDClientManager::Instance()->GetTable<CDCurrencyTableTable>("CurrencyTable");
+
+	// Only the last row of an activity is used, like the lookups this replaced
+	for (const auto& activity : activitiesTable->GetEntries()) {
+		auto& definition = m_Definitions[activity.ActivityID];
+		definition.found = true;
+		definition.info = activity;
+	}
+
+	std::unordered_map<uint32_t, std::pair<uint32_t, uint32_t>> coinsByCurrencyIndex;
+
+	for (const auto& currency : currencyTableTable->GetEntries()) {
+		if (currency.npcminlevel != 1) continue;
+
+		coinsByCurrencyIndex.insert({ currency.currencyIndex, { currency.minvalue, currency.maxvalue } });
+	}
+
+	for (const auto& reward : activityRewardsTable->GetEntries()) {
+		auto& definition = m_Definitions[reward.objectTemplate];
+
+		// The first reward of an activity is the one given for completing it
+		if (!definition.hasReward) {
+			definition.hasReward = true;
+			definition.rewardLootMatrix = reward.LootMatrixIndex;
+
+			const auto coins = coinsByCurrencyIndex.find(reward.CurrencyIndex);
 
-			std::vector<CDActivityRewards> objectTemplateActivities = activityRewardsTable->Query([=](CDActivityRewards entry) {return (activityRewards[0].objectTemplate == entry.objectTemplate); });
-			for (const auto& item : objectTemplateActivities) {
-				if (item.activityRating > 0 && item.activityRating < 5) {
-					m_ActivityLootMatrices.insert({ item.activityRating, item.LootMatrixIndex });
-				}
+			if (coins != coinsByCurrencyIndex.end()) {
+				definition.minCoins = coins->second.first;
+				definition.maxCoins = coins->second.second;
 			}
 		}
+
+		if (reward.activityRating > 0 && reward.activityRating < 5) {
+			definition.ratingLootMatrices.insert({ reward.activityRating, reward.LootMatrixIndex });
+		}
+
+		m_ActivitiesByLootMatrix.insert({ reward.LootMatrixIndex, reward.objectTemplate });
 	}
 }
 
-ScriptedActivityComponent::~ScriptedActivityComponent()
-= default;
+const ActivityDefinition& ScriptedActivityComponent::GetActivityDefinition(const uint32_t activityID) {
+	static const ActivityDefinition none{};
+
+	if (!m_DefinitionsLoaded) LoadDefinitions();
+
+	const auto index = m_Definitions.find(activityID);
+
+	if (index == m_Definitions.end()) return none;
+
+	return index->second;
+}
 
 void ScriptedActivityComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags) const {
 	outBitStream->Write(true);
@@ -90,18 +148,31 @@ void ScriptedActivityComponent::Serialize(RakNet::BitStream* outBitStream, bool
 }
 
 void ScriptedActivityComponent::ReloadConfig() {
-	CDActivitiesTable* activitiesTable = CDClientManager::Instance()->GetTable<CDActivitiesTable>("Activities");
-	std::vector<CDActivities> activities = activitiesTable->Query([=](CDActivities entry) {return (entry.ActivityID == m_ActivityID); });
-	for (auto activity : activities) {
+	const auto& definition = GetActivityDefinition(m_ActivityID);
+	if (definition.found) {
 		auto mapID = m_ActivityInfo.instanceMapID;
-		if ((mapID == 1203 || mapID == 1261 || mapID == 1303 || mapID == 1403) && Game::config->GetValue("solo_racing") == "1") {
+		if ((mapID == 1203 || mapID == 1261 || mapID == 1303 || mapID == 1403) && ConfigOptions::soloRacing.Get()) {
 			m_ActivityInfo.minTeamSize = 1;
 			m_ActivityInfo.minTeams = 1;
 		} else {
-			m_ActivityInfo.minTeamSize = activity.minTeamSize;
-			m_ActivityInfo.minTeams = activity.minTeams;
+			m_ActivityInfo.minTeamSize = definition.info.minTeamSize;
+			m_ActivityInfo.minTeams = definition.info.minTeams;
 		}
 	}
+
+	// The minimum may have changed, so lobbies may have to start or stop counting down
+	for (const auto& [id, lobby] : m_Lobbies) {
+		UpdateLobbyStart(lobby);
+	}
+}
+
+void ScriptedActivityComponent::ReloadAllConfigs() {
+	for (auto* entity : EntityManager::Instance()->GetEntitiesByComponent(COMPONENT_TYPE_SCRIPTED_ACTIVITY)) {
+		auto* scriptedActivityComponent = entity->GetComponent<ScriptedActivityComponent>();
+		if (!scriptedActivityComponent) continue;
+
+		scriptedActivityComponent->ReloadConfig();
+	}
 }
 
 void ScriptedActivityComponent::HandleMessageBoxResponse(Entity* player, const std::string& id) {
@@ -137,46 +208,54 @@ void ScriptedActivityComponent::PlayerJoinLobby(Entity* player) {
 		GameMessages::SendMatchResponse(player, player->GetSystemAddress(), 0); // tell the client they joined a lobby
 	LobbyPlayer* newLobbyPlayer = new LobbyPlayer();
 	newLobbyPlayer->entityID = player->GetObjectID();
-	Lobby* playerLobby = nullptr;
 
 	auto* character = player->GetCharacter();
 	if (character != nullptr)
 		character->SetLastNonInstanceZoneID(dZoneManager::Instance()->GetZone()->GetWorldID());
 
-	for (Lobby* lobby : m_Queue) {
-		if (lobby->players.size() < m_ActivityInfo.maxTeamSize || m_ActivityInfo.maxTeamSize == 1 && lobby->players.size() < m_ActivityInfo.maxTeams) {
-			// If an empty slot in an existing lobby is found
-			lobby->players.push_back(newLobbyPlayer);
-			playerLobby = lobby;
-
-			// Update the joining player on players already in the lobby, and update players already in the lobby on the joining player
-			std::string matchUpdateJoined = "player=9:" + std::to_string(player->GetObjectID()) + "\nplayerName=0:" + player->GetCharacter()->GetName();
-			for (LobbyPlayer* joinedPlayer : lobby->players) {
-				auto* entity = joinedPlayer->GetEntity();
-
-				if (entity == nullptr) {
-					continue;
-				}
-
-				std::string matchUpdate = "player=9:" + std::to_string(entity->GetObjectID()) + "\nplayerName=0:" + entity->GetCharacter()->GetName();
-				GameMessages::SendMatchUpdate(player, player->GetSystemAddress(), matchUpdate, eMatchUpdate::MATCH_UPDATE_PLAYER_JOINED);
-				PlayerReady(entity, joinedPlayer->ready);
-				GameMessages::SendMatchUpdate(entity, entity->GetSystemAddress(), matchUpdateJoined, eMatchUpdate::MATCH_UPDATE_PLAYER_JOINED);
+	Lobby* playerLobby = FindOpenLobby();
+	bool wasCounting = false;
+
+	if (playerLobby) {
+		// If an empty slot in an existing lobby is found
+		wasCounting = playerLobby->counting;
+
+		RemoveOpenLobby(playerLobby);
+		playerLobby->players.push_back(newLobbyPlayer);
+		m_PlayerLobbies[newLobbyPlayer->entityID] = playerLobby;
+
+		// Update the joining player on players already in the lobby, and update players already in the lobby on the joining player
+		std::string matchUpdateJoined = "player=9:" + std::to_string(player->GetObjectID()) + "\nplayerName=0:" + player->GetCharacter()->GetName();
+		for (LobbyPlayer* joinedPlayer : playerLobby->players) {
+			auto* entity = joinedPlayer->GetEntity();
+
+			if (entity == nullptr) {
+				continue;
 			}
-		}
-	}
 
-	if (!playerLobby) {
+			std::string matchUpdate = "player=9:" + std::to_string(entity->GetObjectID()) + "\nplayerName=0:" + entity->GetCharacter()->GetName();
+			GameMessages::SendMatchUpdate(player, player->GetSystemAddress(), matchUpdate, eMatchUpdate::MATCH_UPDATE_PLAYER_JOINED);
+			PlayerReady(entity, joinedPlayer->ready);
+			GameMessages::SendMatchUpdate(entity, entity->GetSystemAddress(), matchUpdateJoined, eMatchUpdate::MATCH_UPDATE_PLAYER_JOINED);
+		}
+	} else {
 		// If all lobbies are full
 		playerLobby = new Lobby();
+		playerLobby->id = ++m_LastLobbyID;
 		playerLobby->players.push_back(newLobbyPlayer);
 		playerLobby->timer = m_ActivityInfo.waitTime / 1000;
-		m_Queue.push_back(playerLobby);
+		m_Lobbies.insert({ playerLobby->id, playerLobby });
+		m_PlayerLobbies[newLobbyPlayer->entityID] = playerLobby;
 	}
 
-	if (m_ActivityInfo.maxTeamSize != 1 && playerLobby->players.size() >= m_ActivityInfo.minTeamSize || m_ActivityInfo.maxTeamSize == 1 && playerLobby->players.size() >= m_ActivityInfo.minTeams) {
+	AddOpenLobby(playerLobby);
+
+	// Everyone in the lobby is updated on the match timer once it starts counting down
+	UpdateLobbyStart(playerLobby);
+
+	if (wasCounting) {
 		// Update the joining player on the match timer
-		std::string matchTimerUpdate = "time=3:" + std::to_string(playerLobby->timer);
+		std::string matchTimerUpdate = "time=3:" + std::to_string(GetLobbyTimer(playerLobby));
 		GameMessages::SendMatchUpdate(player, player->GetSystemAddress(), matchTimerUpdate, eMatchUpdate::MATCH_UPDATE_TIME);
 	}
 }
@@ -184,98 +263,193 @@ void ScriptedActivityComponent::PlayerJoinLobby(Entity* player) {
 void ScriptedActivityComponent::PlayerLeave(LWOOBJID playerID) {
 
 	// Removes the player from a lobby and notifies the others, not applicable for non-lobby instances
-	for (Lobby* lobby : m_Queue) {
-		for (int i = 0; i < lobby->players.size(); ++i) {
-			if (lobby->players[i]->entityID == playerID) {
-				std::string matchUpdateLeft = "player=9:" + std::to_string(playerID);
-				for (LobbyPlayer* lobbyPlayer : lobby->players) {
-					auto* entity = lobbyPlayer->GetEntity();
-					if (entity == nullptr)
-						continue;
-
-					GameMessages::SendMatchUpdate(entity, entity->GetSystemAddress(), matchUpdateLeft, eMatchUpdate::MATCH_UPDATE_PLAYER_LEFT);
-				}
-
-				delete lobby->players[i];
-				lobby->players[i] = nullptr;
-				lobby->players.erase(lobby->players.begin() + i);
+	const auto index = m_PlayerLobbies.find(playerID);
 
-				return;
-			}
-		}
+	if (index == m_PlayerLobbies.end()) {
+		return;
+	}
+
+	auto* lobby = index->second;
+	m_PlayerLobbies.erase(index);
+
+	std::string matchUpdateLeft = "player=9:" + std::to_string(playerID);
+	SendLobbyUpdate(lobby, matchUpdateLeft, eMatchUpdate::MATCH_UPDATE_PLAYER_LEFT);
+
+	RemoveOpenLobby(lobby);
+
+	for (size_t i = 0; i < lobby->players.size(); ++i) {
+		if (lobby->players[i]->entityID != playerID) continue;
+
+		if (lobby->players[i]->ready) lobby->readyCount--;
+
+		delete lobby->players[i];
+		lobby->players.erase(lobby->players.begin() + i);
+
+		break;
 	}
+
+	if (lobby->players.empty()) {
+		RemoveLobby(lobby);
+
+		return;
+	}
+
+	AddOpenLobby(lobby);
+	UpdateLobbyStart(lobby);
 }
 
 void ScriptedActivityComponent::Update(float deltaTime) {
+	m_Time += deltaTime;
 
-	// Ticks all the lobbies, not applicable for non-instance activities
-	for (Lobby* lobby : m_Queue) {
-		for (LobbyPlayer* player : lobby->players) {
-			auto* entity = player->GetEntity();
-			if (entity == nullptr) {
-				PlayerLeave(player->entityID);
-				return;
-			}
-		}
+	// Starts every lobby whose timer elapsed during the frame, not applicable for non-instance activities
+	while (!m_LobbyStarts.empty() && m_LobbyStarts.top().startTime <= m_Time) {
+		const auto start = m_LobbyStarts.top();
+		m_LobbyStarts.pop();
 
-		// Update the match time for all players
-		if (m_ActivityInfo.maxTeamSize != 1 && lobby->players.size() >= m_ActivityInfo.minTeamSize
-			|| m_ActivityInfo.maxTeamSize == 1 && lobby->players.size() >= m_ActivityInfo.minTeams) {
-			if (lobby->timer == m_ActivityInfo.waitTime / 1000) {
-				for (LobbyPlayer* joinedPlayer : lobby->players) {
-					auto* entity = joinedPlayer->GetEntity();
-
-					if (entity == nullptr)
-						continue;
-
-					std::string matchTimerUpdate = "time=3:" + std::to_string(lobby->timer);
-					GameMessages::SendMatchUpdate(entity, entity->GetSystemAddress(), matchTimerUpdate, eMatchUpdate::MATCH_UPDATE_TIME);
-				}
-			}
+		const auto index = m_Lobbies.find(start.lobbyID);
 
-			lobby->timer -= deltaTime;
-		}
+		// The lobby may have been removed or rescheduled since this was scheduled
+		if (index == m_Lobbies.end() || index->second->generation != start.generation) continue;
 
-		bool lobbyReady = true;
-		for (LobbyPlayer* player : lobby->players) {
-			if (player->ready) continue;
-			lobbyReady = false;
-		}
+		auto* lobby = index->second;
 
-		// If everyone's ready, jump the timer
-		if (lobbyReady && lobby->timer > m_ActivityInfo.startDelay / 1000) {
-			lobby->timer = m_ActivityInfo.startDelay / 1000;
+		Game::logger->Log("ScriptedActivityComponent", "Setting up instance.");
 
-			// Update players in lobby on switch to start delay
-			std::string matchTimerUpdate = "time=3:" + std::to_string(lobby->timer);
-			for (LobbyPlayer* player : lobby->players) {
-				auto* entity = player->GetEntity();
+		ActivityInstance* instance = NewInstance();
+		LoadPlayersIntoInstance(instance, lobby->players);
+		RemoveLobby(lobby);
+		instance->StartZone();
+	}
+}
 
-				if (entity == nullptr)
-					continue;
+void ScriptedActivityComponent::RemoveLobby(Lobby* lobby) {
+	const auto index = m_Lobbies.find(lobby->id);
 
-				GameMessages::SendMatchUpdate(entity, entity->GetSystemAddress(), matchTimerUpdate, eMatchUpdate::MATCH_UPDATE_TIME_START_DELAY);
-			}
-		}
+	if (index == m_Lobbies.end() || index->second != lobby) {
+		return;
+	}
 
-		// The timer has elapsed, start the instance
-		if (lobby->timer <= 0.0f) {
-			Game::logger->Log("ScriptedActivityComponent", "Setting up instance.");
+	RemoveOpenLobby(lobby);
 
-			ActivityInstance* instance = NewInstance();
-			LoadPlayersIntoInstance(instance, lobby->players);
-			RemoveLobby(lobby);
-			instance->StartZone();
-		}
+	for (auto* player : lobby->players) {
+		const auto playerLobby = m_PlayerLobbies.find(player->entityID);
+
+		if (playerLobby != m_PlayerLobbies.end() && playerLobby->second == lobby) m_PlayerLobbies.erase(playerLobby);
+
+		delete player;
 	}
+
+	m_Lobbies.erase(index);
+
+	delete lobby;
 }
 
-void ScriptedActivityComponent::RemoveLobby(Lobby* lobby) {
-	for (int i = 0; i < m_Queue.size(); ++i) {
-		if (m_Queue[i] == lobby) {
-			m_Queue.erase(m_Queue.begin() + i);
-			return;
+uint32_t ScriptedActivityComponent::GetLobbyCapacity() const {
+	if (m_ActivityInfo.maxTeamSize == 1) return std::max(m_ActivityInfo.maxTeams, 1u);
+
+	return m_ActivityInfo.maxTeamSize;
+}
+
+uint32_t ScriptedActivityComponent::GetLobbyMinimum() const {
+	if (m_ActivityInfo.maxTeamSize == 1) return m_ActivityInfo.minTeams;
+
+	return m_ActivityInfo.minTeamSize;
+}
+
+float ScriptedActivityComponent::GetLobbyTimer(const Lobby* lobby) const {
+	if (!lobby->counting) return lobby->timer;
+
+	return static_cast<float>(std::max(lobby->startTime - m_Time, 0.0));
+}
+
+void ScriptedActivityComponent::UpdateLobbyStart(Lobby* lobby) {
+	const auto enoughPlayers = lobby->players.size() >= GetLobbyMinimum();
+
+	if (enoughPlayers && !lobby->counting) {
+		lobby->counting = true;
+		lobby->startTime = m_Time + lobby->timer;
+		ScheduleLobbyStart(lobby);
+
+		// Update the match time for all players
+		std::string matchTimerUpdate = "time=3:" + std::to_string(lobby->timer);
+		SendLobbyUpdate(lobby, matchTimerUpdate, eMatchUpdate::MATCH_UPDATE_TIME);
+	} else if (!enoughPlayers && lobby->counting) {
+		// Not enough players left, hold the timer until there are
+		lobby->timer = GetLobbyTimer(lobby);
+		lobby->counting = false;
+		lobby->generation++;
+	}
+
+	// If everyone's ready, jump the timer
+	const auto startDelay = m_ActivityInfo.startDelay / 1000;
+
+	if (lobby->readyCount == lobby->players.size() && GetLobbyTimer(lobby) > startDelay) {
+		if (lobby->counting) {
+			lobby->startTime = m_Time + startDelay;
+			ScheduleLobbyStart(lobby);
+		} else {
+			lobby->timer = startDelay;
 		}
+
+		// Update players in lobby on switch to start delay
+		std::string matchTimerUpdate = "time=3:" + std::to_string(GetLobbyTimer(lobby));
+		SendLobbyUpdate(lobby, matchTimerUpdate, eMatchUpdate::MATCH_UPDATE_TIME_START_DELAY);
+	}
+}
+
+void ScriptedActivityComponent::ScheduleLobbyStart(Lobby* lobby) {
+	lobby->generation++;
+
+	m_LobbyStarts.push({ lobby->startTime, m_NextLobbySequence++, lobby->id, lobby->generation });
+}
+
+Lobby* ScriptedActivityComponent::FindOpenLobby() const {
+	// Fill up the fullest lobby first, so it starts as soon as possible
+	for (size_t size = m_OpenLobbies.size(); size > 0; --size) {
+		const auto& bucket = m_OpenLobbies[size - 1];
+
+		if (!bucket.empty()) return bucket.front();
+	}
+
+	return nullptr;
+}
+
+void ScriptedActivityComponent::AddOpenLobby(Lobby* lobby) {
+	const auto size = lobby->players.size();
+
+	if (lobby->open || size == 0 || size >= GetLobbyCapacity()) return;
+
+	if (m_OpenLobbies.size() <= size) m_OpenLobbies.resize(size + 1);
+
+	auto& bucket = m_OpenLobbies[size];
+
+	lobby->open = true;
+	lobby->openSlot = bucket.size();
+	bucket.push_back(lobby);
+}
+
+void ScriptedActivityComponent::RemoveOpenLobby(Lobby* lobby) {
+	if (!lobby->open) return;
+
+	auto& bucket = m_OpenLobbies[lobby->players.size()];
+
+	// Move the last lobby of the bucket into the freed slot
+	auto* last = bucket.back();
+	bucket[lobby->openSlot] = last;
+	last->openSlot = lobby->openSlot;
+	bucket.pop_back();
+
+	lobby->open = false;
+}
+
+void ScriptedActivityComponent::SendLobbyUpdate(const Lobby* lobby, const std::string& data, const eMatchUpdate type) const {
+	for (LobbyPlayer* player : lobby->players) {
+		auto* entity = player->GetEntity();
+
+		if (entity == nullptr)
+			continue;
+
+		GameMessages::SendMatchUpdate(entity, entity->GetSystemAddress(), data, type);
 	}
 }
 
@@ -302,32 +476,17 @@ bool ScriptedActivityComponent::IsValidActivity(Entity* player) {
 }
 
 bool ScriptedActivityComponent::PlayerIsInQueue(Entity* player) {
-	for (Lobby* lobby : m_Queue) {
-		for (LobbyPlayer* lobbyPlayer : lobby->players) {
-			if (player->GetObjectID() == lobbyPlayer->entityID) return true;
-		}
-	}
-
-	return false;
+	return m_PlayerLobbies.find(player->GetObjectID()) != m_PlayerLobbies.end();
 }
 
 bool ScriptedActivityComponent::IsPlayedBy(Entity* player) const {
-	for (const auto* instance : this->m_Instances) {
-		for (const auto* instancePlayer : instance->GetParticipants()) {
-			if (instancePlayer != nullptr && instancePlayer->GetObjectID() == player->GetObjectID())
-				return true;
-		}
-	}
-
-	return false;
+	return IsPlayedBy(player->GetObjectID());
 }
 
 bool ScriptedActivityComponent::IsPlayedBy(LWOOBJID playerID) const {
 	for (const auto* instance : this->m_Instances) {
-		for (const auto* instancePlayer : instance->GetParticipants()) {
-			if (instancePlayer != nullptr && instancePlayer->GetObjectID() == playerID)
-				return true;
-		}
+		if (instance->HasParticipant(playerID))
+			return true;
 	}
 
 	return false;
@@ -350,25 +509,35 @@ bool ScriptedActivityComponent::TakeCost(Entity* player) const {
 }
 
 void ScriptedActivityComponent::PlayerReady(Entity* player, bool bReady) {
-	for (Lobby* lobby : m_Queue) {
-		for (LobbyPlayer* lobbyPlayer : lobby->players) {
-			if (lobbyPlayer->entityID == player->GetObjectID()) {
-
-				lobbyPlayer->ready = bReady;
-
-				// Update players in lobby on player being ready
-				std::string matchReadyUpdate = "player=9:" + std::to_string(player->GetObjectID());
-				eMatchUpdate readyStatus = eMatchUpdate::MATCH_UPDATE_PLAYER_READY;
-				if (!bReady) readyStatus = eMatchUpdate::MATCH_UPDATE_PLAYER_UNREADY;
-				for (LobbyPlayer* otherPlayer : lobby->players) {
-					auto* entity = otherPlayer->GetEntity();
-					if (entity == nullptr)
-						continue;
-
-					GameMessages::SendMatchUpdate(entity, entity->GetSystemAddress(), matchReadyUpdate, readyStatus);
-				}
-			}
+	const auto index = m_PlayerLobbies.find(player->GetObjectID());
+
+	if (index == m_PlayerLobbies.end()) {
+		return;
+	}
+
+	auto* lobby = index->second;
+
+	for (LobbyPlayer* lobbyPlayer : lobby->players) {
+		if (lobbyPlayer->entityID != player->GetObjectID()) continue;
+
+		const auto changed = lobbyPlayer->ready != bReady;
+
+		if (changed) {
+			lobbyPlayer->ready = bReady;
+
+			if (bReady) lobby->readyCount++;
+			else lobby->readyCount--;
 		}
+
+		// Update players in lobby on player being ready
+		std::string matchReadyUpdate = "player=9:" + std::to_string(player->GetObjectID());
+		eMatchUpdate readyStatus = eMatchUpdate::MATCH_UPDATE_PLAYER_READY;
+		if (!bReady) readyStatus = eMatchUpdate::MATCH_UPDATE_PLAYER_UNREADY;
+		SendLobbyUpdate(lobby, matchReadyUpdate, readyStatus);
+
+		if (changed) UpdateLobbyStart(lobby);
+
+		return;
 	}
 }
 
@@ -394,11 +563,9 @@ const std::vector<ActivityInstance*>& ScriptedActivityComponent::GetInstances()
 }
 
 ActivityInstance* ScriptedActivityComponent::GetInstance(const LWOOBJID playerID) {
-	for (const auto* instance : GetInstances()) {
-		for (const auto* participant : instance->GetParticipants()) {
-			if (participant->GetObjectID() == playerID)
-				return const_cast<ActivityInstance*>(instance);
-		}
+	for (auto* instance : m_Instances) {
+		if (instance->HasParticipant(playerID))
+			return instance;
 	}
 
 	return nullptr;
@@ -467,21 +634,25 @@ void ScriptedActivityComponent::SetActivityValue(LWOOBJID playerID, uint32_t ind
 }
 
 void ScriptedActivityComponent::PlayerRemove(LWOOBJID playerID) {
-	for (auto* instance : GetInstances()) {
-		auto participants = instance->GetParticipants();
-		for (const auto* participant : participants) {
-			if (participant != nullptr && participant->GetObjectID() == playerID) {
-				instance->RemoveParticipant(participant);
-				RemoveActivityPlayerData(playerID);
-
-				// If the instance is empty after the delete of the participant, delete the instance too
-				if (instance->GetParticipants().empty()) {
-					m_Instances.erase(std::find(m_Instances.begin(), m_Instances.end(), instance));
-					delete instance;
-				}
-				return;
-			}
-		}
+	auto* instance = GetInstance(playerID);
+
+	if (instance == nullptr) {
+		return;
+	}
+
+	auto* participant = EntityManager::Instance()->GetEntity(playerID);
+
+	if (participant == nullptr) {
+		return;
+	}
+
+	instance->RemoveParticipant(participant);
+	RemoveActivityPlayerData(playerID);
+
+	// If the instance is empty after the delete of the participant, delete the instance too
+	if (instance->GetParticipants().empty()) {
+		m_Instances.erase(std::find(m_Instances.begin(), m_Instances.end(), instance));
+		delete instance;
 	}
 }
 
@@ -544,22 +715,10 @@ void ActivityInstance::RewardParticipant(Entity* participant) {
 	}
 
 	// First, get the activity data
-	auto* activityRewardsTable = CDClientManager::Instance()->GetTable<CDActivityRewardsTable>("ActivityRewards");
-	std::vector<CDActivityRewards> activityRewards = activityRewardsTable->Query([=](CDActivityRewards entry) { return (entry.objectTemplate == m_ActivityInfo.ActivityID); });
-
-	if (!activityRewards.empty()) {
-		uint32_t minCoins = 0;
-		uint32_t maxCoins = 0;
+	const auto& definition = ScriptedActivityComponent::GetActivityDefinition(m_ActivityInfo.ActivityID);
 
-		auto* currencyTableTable = CDClientManager::Instance()->GetTable<CDCurrencyTableTable>("CurrencyTable");
-		std::vector<CDCurrencyTable> currencyTable = currencyTableTable->Query([=](CDCurrencyTable entry) { return (entry.currencyIndex == activityRewards[0].CurrencyIndex && entry.npcminlevel == 1); });
-
-		if (!currencyTable.empty()) {
-			minCoins = currencyTable[0].minvalue;
-			maxCoins = currencyTable[0].maxvalue;
-		}
-
-		LootGenerator::Instance().DropLoot(participant, m_Parent, activityRewards[0].LootMatrixIndex, minCoins, maxCoins);
+	if (definition.hasReward) {
+		LootGenerator::Instance().DropLoot(participant, m_Parent, definition.rewardLootMatrix, definition.minCoins, definition.maxCoins);
 	}
 }
 
@@ -591,6 +750,10 @@ void ActivityInstance::RemoveParticipant(const Entity* participant) {
 	}
 }
 
+bool ActivityInstance::HasParticipant(const LWOOBJID participantID) const {
+	return std::find(m_Participants.begin(), m_Participants.end(), participantID) != m_Participants.end();
+}
+
 uint32_t ActivityInstance::GetScore() const {
 	return score;
 }
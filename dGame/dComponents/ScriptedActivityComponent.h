@@ -8,6 +8,9 @@
 #ifndef SCRIPTEDACTIVITYCOMPONENT_H
 #define SCRIPTEDACTIVITYCOMPONENT_H
 
+#include <queue>
+#include <unordered_map>
+
 #include "BitStream.h"
 #include "Entity.h"
 #include "Component.h"
@@ -48,6 +51,13 @@ public:
 	 */
 	void RemoveParticipant(const Entity* participant);
 
+	/**
+	 * Checks if an entity is a participant of this activity, without looking up the participants
+	 * @param participantID the entity to check
+	 * @return true if the entity is a participant of this activity, false otherwise
+	 */
+	bool HasParticipant(LWOOBJID participantID) const;
+
 	/**
 	 * Returns all the participants of this activity
 	 * @return all the participants of this activity
@@ -118,15 +128,87 @@ struct LobbyPlayer {
  */
 struct Lobby {
 
+	/**
+	 * The ID of this lobby, unique within the activity
+	 */
+	uint32_t id = 0;
+
 	/**
 	 * The lobby of players
 	 */
 	std::vector<LobbyPlayer*> players;
 
 	/**
-	 * The timer that determines when the activity should start
+	 * The time left until the activity should start, only up to date while the lobby isn't counting down
+	 */
+	float timer = 0.0f;
+
+	/**
+	 * Whether the lobby has enough players to count down to the start of the activity
+	 */
+	bool counting = false;
+
+	/**
+	 * The time on the activity's clock the lobby starts at, while it is counting down
+	 */
+	double startTime = 0.0;
+
+	/**
+	 * Changed whenever the start time changes, so starts scheduled before that are ignored
+	 */
+	uint32_t generation = 0;
+
+	/**
+	 * The number of players in the lobby that are ready
+	 */
+	uint32_t readyCount = 0;
+
+	/**
+	 * Whether the lobby is in the bucket for its size, e.g. if there's room for more players
+	 */
+	bool open = false;
+
+	/**
+	 * The position of this lobby in its bucket
+	 */
+	size_t openSlot = 0;
+};
+
+/**
+ * The data of an activity from the client database, prebuilt once for every activity
+ */
+struct ActivityDefinition {
+
+	/**
+	 * Whether the activity exists in the Activities table
+	 */
+	bool found = false;
+
+	/**
+	 * The database information for this activity
+	 */
+	CDActivities info{};
+
+	/**
+	 * Whether the activity has a reward for completing it
+	 */
+	bool hasReward = false;
+
+	/**
+	 * The LMI rewarded for completing this activity
 	 */
-	float timer;
+	uint32_t rewardLootMatrix = 0;
+
+	/**
+	 * The range of coins rewarded for completing this activity
+	 */
+	uint32_t minCoins = 0;
+	uint32_t maxCoins = 0;
+
+	/**
+	 * The rewarded LMIs per activity rating (1 through 4), used to pick loot by team size
+	 */
+	std::unordered_map<uint32_t, uint32_t> ratingLootMatrices;
 };
 
 /**
@@ -282,6 +364,11 @@ public:
 	 */
 	void ReloadConfig();
 
+	/**
+	 * Reloads the config settings of every scripted activity in the zone, for after the config was reloaded
+	 */
+	static void ReloadAllConfigs();
+
 	/**
 	 * Removes all the instances
 	 */
@@ -341,8 +428,98 @@ public:
 	 * @return the LMI that this activity points to for a team size
 	 */
 	uint32_t GetLootMatrixForTeamSize(uint32_t teamSize) { return m_ActivityLootMatrices[teamSize]; }
+
+	/**
+	 * Returns the prebuilt client database information for an activity
+	 * @param activityID the activity to get the information for
+	 * @return the information for the activity, with found set to false if it doesn't exist
+	 */
+	static const ActivityDefinition& GetActivityDefinition(uint32_t activityID);
 private:
 
+	/**
+	 * A scheduled start of a lobby
+	 */
+	struct LobbyStart {
+		double startTime;
+		uint64_t sequence;
+		uint32_t lobbyID;
+		uint32_t generation;
+	};
+
+	/**
+	 * Orders the scheduled starts by time, starts at the same time are handled in the order they were scheduled
+	 */
+	struct StartsLater {
+		bool operator()(const LobbyStart& a, const LobbyStart& b) const {
+			if (a.startTime != b.startTime) return a.startTime > b.startTime;
+			return a.sequence > b.sequence;
+		}
+	};
+
+	/**
+	 * Builds the activity definitions from the Activities, ActivityRewards and CurrencyTable tables
+	 */
+	static void LoadDefinitions();
+
+	/**
+	 * Returns the maximum number of players in a lobby
+	 */
+	uint32_t GetLobbyCapacity() const;
+
+	/**
+	 * Returns the number of players a lobby needs before it counts down to the start of the activity
+	 */
+	uint32_t GetLobbyMinimum() const;
+
+	/**
+	 * Returns the time left until a lobby starts
+	 */
+	float GetLobbyTimer(const Lobby* lobby) const;
+
+	/**
+	 * Starts or pauses the countdown of a lobby after its players changed, and skips to the start delay once everyone is ready
+	 * @param lobby the lobby that changed
+	 */
+	void UpdateLobbyStart(Lobby* lobby);
+
+	/**
+	 * Schedules the start of a lobby which is counting down
+	 */
+	void ScheduleLobbyStart(Lobby* lobby);
+
+	/**
+	 * Returns the fullest lobby with room for another player, if any
+	 */
+	Lobby* FindOpenLobby() const;
+
+	/**
+	 * Adds a lobby to the bucket for its size if it has room for more players, must be called after the players change
+	 */
+	void AddOpenLobby(Lobby* lobby);
+
+	/**
+	 * Removes a lobby from the bucket for its size, must be called before the players change
+	 */
+	void RemoveOpenLobby(Lobby* lobby);
+
+	/**
+	 * Sends a match update to every player in a lobby
+	 */
+	void SendLobbyUpdate(const Lobby* lobby, const std::string& data, eMatchUpdate type) const;
+
+	/**
+	 * The prebuilt client database information of every activity, by activity ID
+	 */
+	static std::unordered_map<uint32_t, ActivityDefinition> m_Definitions;
+
+	/**
+	 * The activity ID every rewarded LMI belongs to
+	 */
+	static std::unordered_map<uint32_t, uint32_t> m_ActivitiesByLootMatrix;
+
+	static bool m_DefinitionsLoaded;
+
 	/**
 	 * The database information for this activity
 	 */
@@ -354,9 +531,33 @@ private:
 	std::vector<ActivityInstance*> m_Instances;
 
 	/**
-	 * The current lobbies for this activity
+	 * The current lobbies for this activity, by lobby ID
 	 */
-	std::vector<Lobby*> m_Queue;
+	std::unordered_map<uint32_t, Lobby*> m_Lobbies;
+
+	/**
+	 * The lobby every queued player is in
+	 */
+	std::unordered_map<LWOOBJID, Lobby*> m_PlayerLobbies;
+
+	/**
+	 * The lobbies with room for more players, by the number of players in them
+	 */
+	std::vector<std::vector<Lobby*>> m_OpenLobbies;
+
+	/**
+	 * The starts of the lobbies that are counting down, including ones that have been rescheduled since
+	 */
+	std::priority_queue<LobbyStart, std::vector<LobbyStart>, StartsLater> m_LobbyStarts;
+
+	/**
+	 * Seconds since the activity was created
+	 */
+	double m_Time = 0.0;
+
+	uint64_t m_NextLobbySequence = 0;
+
+	uint32_t m_LastLobbyID = 0;
 
 	/**
 	 * All the activity score for the players in this activity
@@ -12,6 +12,7 @@
 #include "CDPhysicsComponentTable.h"
 
 #include "Entity.h"
+#include "SpatialIndex.h"
 
 SimplePhysicsComponent::SimplePhysicsComponent(uint32_t componentID, Entity* parent) : Component(parent) {
 	m_Position = m_Parent->GetDefaultPosition();
@@ -33,6 +34,23 @@ SimplePhysicsComponent::SimplePhysicsComponent(uint32_t componentID, Entity* par
 SimplePhysicsComponent::~SimplePhysicsComponent() {
 }
 
+void SimplePhysicsComponent::SetPosition(const NiPoint3& pos) {
+	m_Position = pos;
+	m_IsDirty = true;
+
+	// Moves aren't always serialized right away, the cached construction has to have the new position
+	m_Parent->MarkReplicaChanged();
+
+	SpatialIndex::Instance()->Move(m_Parent);
+}
+
+void SimplePhysicsComponent::SetRotation(const NiQuaternion& rot) {
+	m_Rotation = rot;
+	m_IsDirty = true;
+
+	m_Parent->MarkReplicaChanged();
+}
+
 void SimplePhysicsComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags) {
 	if (bIsInitialUpdate) {
 		outBitStream->Write(m_ClimbableType != eClimbableType::CLIMBABLE_TYPE_NOT);
@@ -44,7 +44,7 @@ public:
 	 * Sets the position of this entity
 	 * @param pos the position to set
 	 */
-	void SetPosition(const NiPoint3& pos) { m_Position = pos; m_IsDirty = true; }
+	void SetPosition(const NiPoint3& pos);
 
 	/**
 	 * Returns the rotation of this entity
@@ -56,7 +56,7 @@ public:
 	 * Sets the rotation of this entity
 	 * @param rot
 	 */
-	void SetRotation(const NiQuaternion& rot) { m_Rotation = rot; m_IsDirty = true; }
+	void SetRotation(const NiQuaternion& rot);
 
 	/**
 	 * Returns the velocity of this entity
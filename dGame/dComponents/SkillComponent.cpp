@@ -5,7 +5,9 @@
 
 #include "SkillComponent.h"
 
+#include <algorithm>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include "BehaviorContext.h"
@@ -292,95 +294,97 @@ void SkillComponent::CalculateUpdate(const float deltaTime) {
 		managedBehavior.second->CalculateUpdate(deltaTime);
 	}
 
-	for (auto& managedProjectile : this->m_managedProjectiles) {
-		auto entry = managedProjectile;
-
-		if (!entry.calculation) continue;
+	UpdateProjectiles(deltaTime);
+}
 
-		entry.time += deltaTime;
+void SkillComponent::UpdateProjectiles(const float deltaTime) {
+	// The targets of each originator, fetched once per update however many projectiles it has in flight
+	std::unordered_map<LWOOBJID, std::vector<ProjectileTarget>> targetsByOriginator;
 
-		auto* origin = EntityManager::Instance()->GetEntity(entry.context->originator);
+	const auto getTargets = [&targetsByOriginator](const LWOOBJID originator) -> const std::vector<ProjectileTarget>& {
+		const auto cached = targetsByOriginator.find(originator);
+		if (cached != targetsByOriginator.end()) return cached->second;
 
-		if (origin == nullptr) {
-			continue;
-		}
+		auto& targets = targetsByOriginator[originator];
 
-		const auto targets = origin->GetTargetsInPhantom();
+		auto* origin = EntityManager::Instance()->GetEntity(originator);
+		if (origin == nullptr) return targets;
 
-		const auto position = entry.startPosition + (entry.velocity * entry.time);
-
-		for (const auto& targetId : targets) {
+		for (const auto targetId : origin->GetTargetsInPhantom()) {
 			auto* target = EntityManager::Instance()->GetEntity(targetId);
+			if (target != nullptr) targets.push_back({ targetId, target->GetPosition() });
+		}
 
-			const auto targetPosition = target->GetPosition();
-
-			const auto closestPoint = Vector3::ClosestPointOnLine(entry.lastPosition, position, targetPosition);
+		return targets;
+	};
 
-			const auto distance = Vector3::DistanceSquared(targetPosition, closestPoint);
+	// Hits are handled after every projectile moved, the behaviors they run may register new projectiles
+	std::vector<ProjectileSyncEntry> hits;
 
-			if (distance > 3 * 3) {
-				/*
-				if (entry.TrackTarget && distance <= entry.TrackRadius)
-				{
-					const auto rotation = NiQuaternion::LookAtUnlocked(position, targetPosition);
+	for (auto& entry : this->m_managedProjectiles) {
+		if (!entry.calculation) continue;
 
-					const auto speed = entry.Velocity.Length();
+		// A projectile doesn't travel past the end of its lifetime
+		const auto step = std::min(deltaTime, std::max(entry.maxTime - entry.time, 0.0f));
+		entry.time += deltaTime;
 
-					const auto homingTarget = rotation.GetForwardVector() * speed;
+		const auto& targets = getTargets(entry.context->originator);
 
-					Vector3 homing;
+		if (entry.trackTarget) {
+			const ProjectileTarget* closest = nullptr;
+			auto closestDistance = entry.trackRadius * entry.trackRadius;
 
-					// Move towards
+			for (const auto& target : targets) {
+				const auto distance = Vector3::DistanceSquared(entry.lastPosition, target.position);
+				if (distance > closestDistance) continue;
 
-					const auto difference = homingTarget - entry.Velocity;
-					const auto mag = difference.Length();
-					if (mag <= speed || mag == 0)
-					{
-						homing = homingTarget;
-					}
-					else
-					{
-						entry.Velocity + homingTarget / mag * speed;
-					}
+				closest = &target;
+				closestDistance = distance;
+			}
 
-					entry.Velocity = homing;
-				}
-				*/
+			// Turn towards the closest target in range, keeping the speed
+			if (closest != nullptr && closestDistance > 0.0f) {
+				const auto speed = entry.velocity.Length();
+				const auto homing = (closest->position - entry.lastPosition).Unitize() * speed;
 
-				continue;
+				entry.velocity = Vector3::MoveTowards(entry.velocity, homing, speed);
 			}
+		}
 
-			entry.branchContext.target = targetId;
+		const auto position = entry.lastPosition + entry.velocity * step;
 
-			SyncProjectileCalculation(entry);
+		// Sweep the whole step so fast projectiles can't pass through a target between updates, the first target along
+		// the path is the one that is hit
+		const ProjectileTarget* hit = nullptr;
+		auto hitFraction = 1.0f;
 
-			entry.time = entry.maxTime;
+		for (const auto& target : targets) {
+			float fraction;
+			if (!Vector3::SweepSphere(entry.lastPosition, position, target.position, ProjectileHitRadius, fraction)) continue;
+			if (hit != nullptr && fraction >= hitFraction) continue;
 
-			break;
+			hit = &target;
+			hitFraction = fraction;
 		}
 
 		entry.lastPosition = position;
 
-		managedProjectile = entry;
-	}
-
-	std::vector<ProjectileSyncEntry> valid;
-
-	for (auto& entry : this->m_managedProjectiles) {
-		if (entry.calculation) {
-			if (entry.time >= entry.maxTime) {
-				entry.branchContext.target = LWOOBJID_EMPTY;
-
-				SyncProjectileCalculation(entry);
+		if (hit != nullptr) {
+			entry.branchContext.target = hit->id;
+			entry.time = entry.maxTime;
 
-				continue;
-			}
+			hits.push_back(entry);
 		}
-
-		valid.push_back(entry);
 	}
 
-	this->m_managedProjectiles = valid;
+	// Projectiles that hit something or ran out of time are done, the ones that didn't hit anything have no effect
+	this->m_managedProjectiles.erase(std::remove_if(this->m_managedProjectiles.begin(), this->m_managedProjectiles.end(), [](const ProjectileSyncEntry& entry) {
+		return entry.calculation && entry.time >= entry.maxTime;
+		}), this->m_managedProjectiles.end());
+
+	for (const auto& entry : hits) {
+		SyncProjectileCalculation(entry);
+	}
 }
 
 
@@ -453,6 +457,30 @@ void SkillComponent::HandleUnmanaged(const uint32_t behaviorId, const LWOOBJID t
 	delete context;
 }
 
+void SkillComponent::HandleUnmanaged(const uint32_t behaviorId, const std::vector<LWOOBJID>& targets, LWOOBJID source) {
+	auto* context = new BehaviorContext(source);
+
+	context->unmanaged = true;
+
+	auto* behavior = Behavior::CreateBehavior(behaviorId);
+
+	RakNet::BitStream bitStream;
+
+	for (const auto target : targets) {
+		context->caster = target;
+		context->foundTarget = false;
+		context->failed = false;
+
+		behavior->Handle(context, &bitStream, { target });
+
+		// Finish this target's timers and ends while it is still the caster
+		context->Reset();
+		bitStream.Reset();
+	}
+
+	delete context;
+}
+
 void SkillComponent::HandleUnCast(const uint32_t behaviorId, const LWOOBJID target) {
 	auto* context = new BehaviorContext(target);
 
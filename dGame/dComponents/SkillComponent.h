@@ -162,6 +162,15 @@ public:
 	 */
 	static void HandleUnmanaged(uint32_t behaviorId, LWOOBJID target, LWOOBJID source = LWOOBJID_EMPTY);
 
+	/**
+	 * Computes the same server-side skill calculation without an associated entity for several targets,
+	 * each target is handled on its own as if HandleUnmanaged was called for it.
+	 * @param behaviorId the root behavior ID of the skill
+	 * @param targets the explicit targets of the skill
+	 * @param source the explicit source of the skill
+	 */
+	static void HandleUnmanaged(uint32_t behaviorId, const std::vector<LWOOBJID>& targets, LWOOBJID source = LWOOBJID_EMPTY);
+
 	/**
 	 * Computes a server-side skill uncast calculation without an associated entity.
 	 * @param behaviorId the root behavior ID of the skill
@@ -190,6 +199,27 @@ private:
 	 */
 	uint32_t m_skillUid;
 
+	/**
+	 * How close a server-side projectile has to pass to a target to hit it
+	 */
+	static constexpr float ProjectileHitRadius = 3.0f;
+
+	/**
+	 * A target of an originator, that its server-side projectiles can hit
+	 */
+	struct ProjectileTarget {
+		LWOOBJID id;
+
+		NiPoint3 position;
+	};
+
+	/**
+	 * Moves the server-side projectiles, homing in on targets if they track them, and handles the ones that hit
+	 * something or ran out of time.
+	 * @param deltaTime the time since the last update
+	 */
+	void UpdateProjectiles(float deltaTime);
+
 	/**
 	 * Sync a server-side projectile calculation.
 	 * @param entry the projectile information
@@ -1,7 +1,6 @@
 #include "SwitchComponent.h"
 #include "EntityManager.h"
-
-std::vector<SwitchComponent*> SwitchComponent::petSwitches;
+#include "SpatialIndex.h"
 
 SwitchComponent::SwitchComponent(Entity* parent) : Component(parent) {
 	m_Active = false;
@@ -12,11 +11,6 @@ SwitchComponent::SwitchComponent(Entity* parent) : Component(parent) {
 }
 
 SwitchComponent::~SwitchComponent() {
-	const auto& iterator = std::find(petSwitches.begin(), petSwitches.end(), this);
-
-	if (iterator != petSwitches.end()) {
-		petSwitches.erase(iterator);
-	}
 }
 
 void SwitchComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitialUpdate, unsigned int& flags) {
@@ -103,20 +97,18 @@ Entity* SwitchComponent::GetParentEntity() const {
 	return m_Parent;
 }
 
-SwitchComponent* SwitchComponent::GetClosestSwitch(NiPoint3 position) {
-	float closestDistance = 0;
-	SwitchComponent* closest = nullptr;
+SwitchComponent* SwitchComponent::GetClosestSwitch(NiPoint3 position, float maxDistance) {
+	SpatialFilter filter{};
+	filter.componentType = COMPONENT_TYPE_SWITCH;
+	filter.predicate = [](Entity* entity) {
+		auto* switchComponent = entity->GetComponent<SwitchComponent>();
 
-	for (SwitchComponent* petSwitch : petSwitches) {
-		float distance = Vector3::DistanceSquared(petSwitch->m_Parent->GetPosition(), position);
+		return switchComponent != nullptr && switchComponent->m_PetBouncer != nullptr;
+	};
 
-		if (closest == nullptr || distance < closestDistance) {
-			closestDistance = distance;
-			closest = petSwitch;
-		}
-	}
+	auto* closest = SpatialIndex::Instance()->FindNearest(position, filter, maxDistance);
 
-	return closest;
+	return closest != nullptr ? closest->GetComponent<SwitchComponent>() : nullptr;
 }
 
 
@@ -125,7 +117,6 @@ void SwitchComponent::SetPetBouncer(BouncerComponent* value) {
 
 	if (value != nullptr) {
 		m_PetBouncer->SetPetEnabled(true);
-		petSwitches.push_back(this);
 	}
 }
 
@@ -8,6 +8,7 @@
 #include "RebuildComponent.h"
 #include "BouncerComponent.h"
 #include <algorithm>
+#include <limits>
 #include "Component.h"
 
 /**
@@ -59,18 +60,14 @@ public:
 	void EntityLeave(Entity* entity);
 
 	/**
-	 * Returns the closest switch from a given position
+	 * Returns the closest pet switch from a given position
 	 * @param position the position to check
-	 * @return the closest switch from a given position
+	 * @param maxDistance how far from the position the switch can be
+	 * @return the closest pet switch from a given position
 	 */
-	static SwitchComponent* GetClosestSwitch(NiPoint3 position);
+	static SwitchComponent* GetClosestSwitch(NiPoint3 position, float maxDistance = std::numeric_limits<float>::max());
 
 private:
-	/**
-	 * A list of all pet switches.
-	 */
-	static std::vector<SwitchComponent*> petSwitches;
-
 	/**
 	 * Attached rebuild component.
 	 */
@@ -1,5 +1,6 @@
 #include "VehiclePhysicsComponent.h"
 #include "EntityManager.h"
+#include "SpatialIndex.h"
 
 VehiclePhysicsComponent::VehiclePhysicsComponent(Entity* parent) : Component(parent) {
 	m_Position = NiPoint3::ZERO;
@@ -19,11 +20,18 @@ VehiclePhysicsComponent::~VehiclePhysicsComponent() {
 
 void VehiclePhysicsComponent::SetPosition(const NiPoint3& pos) {
 	m_Position = pos;
+
+	// Moves aren't always serialized right away, the cached construction has to have the new position
+	m_Parent->MarkReplicaChanged();
+
+	SpatialIndex::Instance()->Move(m_Parent);
 }
 
 void VehiclePhysicsComponent::SetRotation(const NiQuaternion& rot) {
 	m_DirtyPosition = true;
 	m_Rotation = rot;
+
+	m_Parent->MarkReplicaChanged();
 }
 
 void VehiclePhysicsComponent::SetVelocity(const NiPoint3& vel) {
@@ -7,6 +7,7 @@
 #include "Entity.h"
 #include "GameMessages.h"
 #include "RakNetTypes.h"
+#include "VendorStock.h"
 
 /**
  * A component for vendor NPCs. A vendor sells items to the player.
@@ -60,10 +61,10 @@ public:
 	 * Gets the list if items the vendor sells.
 	 * @return the list of items.
 	 */
-	std::map<LOT, int>& GetInventory();
+	const std::map<LOT, int>& GetInventory() const;
 
 	/**
-	 * Refresh the inventory of this vendor.
+	 * Refresh the inventory of this vendor. Vendors whose stock can't change are only stocked on creation.
 	 */
 	void RefreshInventory(bool isCreation = false);
 
@@ -75,27 +76,27 @@ private:
 	/**
 	 * The buy scalar.
 	 */
-	float m_BuyScalar;
+	float m_BuyScalar = 0.0f;
 
 	/**
 	 * The sell scalar.
 	 */
-	float m_SellScalar;
+	float m_SellScalar = 0.0f;
 
 	/**
 	 * The refresh time of this vendors' inventory.
 	 */
-	float m_RefreshTimeSeconds;
+	float m_RefreshTimeSeconds = 0.0f;
 
 	/**
 	 * Loot matrix id of this vendor.
 	 */
-	uint32_t m_LootMatrixID;
+	uint32_t m_LootMatrixID = 0;
 
 	/**
-	 * The list of items the vendor sells.
+	 * The list of items the vendor sells, shared with the other vendors of the same stock template if it has no random items.
 	 */
-	std::map<LOT, int> m_Inventory;
+	std::shared_ptr<const VendorInventory> m_Inventory;
 };
 
 #endif // VENDORCOMPONENT_H
@@ -27,73 +27,18 @@
 #include "SkillComponent.h"
 #include "RacingControlComponent.h"
 
-using namespace std;
+namespace {
+	using Handler = void(*)(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr);
 
-void GameMessageHandler::HandleMessage(RakNet::BitStream* inStream, const SystemAddress& sysAddr, LWOOBJID objectID, GAME_MSG messageID) {
-
-	CBITSTREAM;
-
-	// Get the entity
-	Entity* entity = EntityManager::Instance()->GetEntity(objectID);
-
-	User* usr = UserManager::Instance()->GetUser(sysAddr);
-
-	if (!entity) {
-		Game::logger->Log("GameMessageHandler", "Failed to find associated entity (%llu), aborting GM (%X)!", objectID, messageID);
-
-		return;
-	}
-
-	switch (messageID) {
-
-	case GAME_MSG_UN_USE_BBB_MODEL: {
-		GameMessages::HandleUnUseModel(inStream, entity, sysAddr);
-		break;
-	}
-	case GAME_MSG_PLAY_EMOTE: {
-		GameMessages::HandlePlayEmote(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_MOVE_ITEM_IN_INVENTORY: {
-		GameMessages::HandleMoveItemInInventory(inStream, entity);
-		break;
+	template<void(*Handle)(RakNet::BitStream*, Entity*)>
+	void WithoutAddress(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
+		Handle(inStream, entity);
 	}
 
-	case GAME_MSG_REMOVE_ITEM_FROM_INVENTORY: {
-		GameMessages::HandleRemoveItemFromInventory(inStream, entity, sysAddr);
-		break;
+	void Ignore(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
 	}
 
-	case GAME_MSG_EQUIP_ITEM:
-		GameMessages::HandleEquipItem(inStream, entity);
-		break;
-
-	case GAME_MSG_UN_EQUIP_ITEM:
-		GameMessages::HandleUnequipItem(inStream, entity);
-		break;
-
-	case GAME_MSG_RESPOND_TO_MISSION: {
-		GameMessages::HandleRespondToMission(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_REQUEST_USE: {
-		GameMessages::HandleRequestUse(inStream, entity, sysAddr);
-		break;
-	}
-
-	case GAME_MSG_SET_FLAG: {
-		GameMessages::HandleSetFlag(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_HAS_BEEN_COLLECTED: {
-		GameMessages::HandleHasBeenCollected(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_PLAYER_LOADED: {
+	void HandlePlayerLoaded(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
 		GameMessages::SendRestoreToPostLoadStats(entity, sysAddr);
 		entity->SetPlayerReadyForUpdates();
 
@@ -163,114 +108,29 @@ void GameMessageHandler::HandleMessage(RakNet::BitStream* inStream, const System
 		// After we've done our thing, tell the client they're ready
 		GameMessages::SendPlayerReady(entity, sysAddr);
 		GameMessages::SendPlayerReady(dZoneManager::Instance()->GetZoneControlObject(), sysAddr);
-
-		break;
-	}
-
-	case GAME_MSG_REQUEST_LINKED_MISSION: {
-		GameMessages::HandleRequestLinkedMission(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_MISSION_DIALOGUE_OK: {
-		GameMessages::HandleMissionDialogOK(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_MISSION_DIALOGUE_CANCELLED: {
-		//This message is pointless for our implementation, as the client just carries on after
-		//rejecting a mission offer. We dont need to do anything. This is just here to remove a warning in our logs :)
-		break;
 	}
 
-	case GAME_MSG_REQUEST_PLATFORM_RESYNC: {
-		GameMessages::HandleRequestPlatformResync(inStream, entity, sysAddr);
-		break;
-	}
-
-	case GAME_MSG_FIRE_EVENT_SERVER_SIDE: {
-		GameMessages::HandleFireEventServerSide(inStream, entity, sysAddr);
-		break;
-	}
-
-	case GAME_MSG_SEND_ACTIVITY_SUMMARY_LEADERBOARD_DATA: {
-		GameMessages::HandleActivitySummaryLeaderboardData(inStream, entity, sysAddr);
-		break;
-	}
-
-	case GAME_MSG_REQUEST_ACTIVITY_SUMMARY_LEADERBOARD_DATA: {
-		GameMessages::HandleRequestActivitySummaryLeaderboardData(inStream, entity, sysAddr);
-		break;
-	}
-
-	case GAME_MSG_ACTIVITY_STATE_CHANGE_REQUEST: {
-		GameMessages::HandleActivityStateChangeRequest(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_PARSE_CHAT_MESSAGE: {
-		GameMessages::HandleParseChatMessage(inStream, entity, sysAddr);
-		break;
-	}
-
-	case GAME_MSG_NOTIFY_SERVER_LEVEL_PROCESSING_COMPLETE: {
-		GameMessages::HandleNotifyServerLevelProcessingComplete(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_PICKUP_CURRENCY: {
-		GameMessages::HandlePickupCurrency(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_PICKUP_ITEM: {
-		GameMessages::HandlePickupItem(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_RESURRECT: {
-		GameMessages::HandleResurrect(inStream, entity);
-		break;
-	}
-
-	case GAME_MSG_REQUEST_RESURRECT: {
+	void HandleRequestResurrect(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
 		GameMessages::SendResurrect(entity);
-		/*auto* dest = static_cast<DestroyableComponent*>(entity->GetComponent(COMPONENT_TYPE_DESTROYABLE));
-		if (dest) {
-			dest->SetHealth(4);
-			dest->SetArmor(0);
-			dest->SetImagination(6);
-			EntityManager::Instance()->SerializeEntity(entity);
-		}*/
-		break;
-	}
-	case GAME_MSG_HANDLE_HOT_PROPERTY_DATA: {
-		GameMessages::HandleGetHotPropertyData(inStream, entity, sysAddr);
-		break;
 	}
 
-	case GAME_MSG_REQUEST_SERVER_PROJECTILE_IMPACT:
-	{
+	void HandleRequestServerProjectileImpact(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
 		auto message = GameMessages::RequestServerProjectileImpact();
 
-		message.Deserialize(inStream);
+		if (!message.Deserialize(inStream)) return;
 
 		auto* skill_component = entity->GetComponent<SkillComponent>();
 
 		if (skill_component != nullptr) {
-			auto* bs = new RakNet::BitStream((unsigned char*)message.sBitStream.c_str(), message.sBitStream.size(), false);
-
-			skill_component->SyncPlayerProjectile(message.i64LocalID, bs, message.i64TargetID);
+			RakNet::BitStream bs(reinterpret_cast<unsigned char*>(message.sBitStream.data()), message.sBitStream.size(), false);
 
-			delete bs;
+			skill_component->SyncPlayerProjectile(message.i64LocalID, &bs, message.i64TargetID);
 		}
-
-		break;
 	}
 
-	case GAME_MSG_START_SKILL: {
+	void HandleStartSkill(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
 		GameMessages::StartSkill startSkill = GameMessages::StartSkill();
-		startSkill.Deserialize(inStream); // inStream replaces &bitStream
+		if (!startSkill.Deserialize(inStream)) return;
 
 		if (startSkill.skillID == 1561 || startSkill.skillID == 1562 || startSkill.skillID == 1541) return;
 
@@ -285,22 +145,20 @@ void GameMessageHandler::HandleMessage(RakNet::BitStream* inStream, const System
 		bool success = false;
 
 		if (behaviorId > 0) {
-			RakNet::BitStream* bs = new RakNet::BitStream((unsigned char*)startSkill.sBitStream.c_str(), startSkill.sBitStream.size(), false);
+			RakNet::BitStream bs(reinterpret_cast<unsigned char*>(startSkill.sBitStream.data()), startSkill.sBitStream.size(), false);
 
 			auto* skillComponent = entity->GetComponent<SkillComponent>();
 
-			success = skillComponent->CastPlayerSkill(behaviorId, startSkill.uiSkillHandle, bs, startSkill.optionalTargetID, startSkill.skillID);
+			success = skillComponent->CastPlayerSkill(behaviorId, startSkill.uiSkillHandle, &bs, startSkill.optionalTargetID, startSkill.skillID);
 
 			if (success && entity->GetCharacter()) {
 				DestroyableComponent* destComp = entity->GetComponent<DestroyableComponent>();
 				destComp->SetImagination(destComp->GetImagination() - skillTable->GetSkillByID(startSkill.skillID).imaginationcost);
 			}
-
-			delete bs;
 		}
 
 		if (Game::server->GetZoneID() == 1302) {
-			break;
+			return;
 		}
 
 		if (success) {
@@ -317,352 +175,208 @@ void GameMessageHandler::HandleMessage(RakNet::BitStream* inStream, const System
 			echoStartSkill.optionalOriginatorID = startSkill.optionalOriginatorID;
 			echoStartSkill.optionalTargetID = startSkill.optionalTargetID;
 			echoStartSkill.originatorRot = startSkill.originatorRot;
-			echoStartSkill.sBitStream = startSkill.sBitStream;
+			echoStartSkill.sBitStream = std::move(startSkill.sBitStream);
 			echoStartSkill.skillID = startSkill.skillID;
 			echoStartSkill.uiSkillHandle = startSkill.uiSkillHandle;
 			echoStartSkill.Serialize(&bitStreamLocal);
 
 			Game::server->Send(&bitStreamLocal, entity->GetSystemAddress(), true);
 		}
-	} break;
-
-	case GAME_MSG_SYNC_SKILL: {
-		RakNet::BitStream bitStreamLocal;
-		PacketUtils::WriteHeader(bitStreamLocal, CLIENT, MSG_CLIENT_GAME_MSG);
-		bitStreamLocal.Write(entity->GetObjectID());
-		//bitStreamLocal.Write((unsigned short)GAME_MSG_ECHO_SYNC_SKILL);
-		//bitStreamLocal.Write(inStream);
-
-		GameMessages::SyncSkill sync = GameMessages::SyncSkill(inStream); // inStream replaced &bitStream
-		//sync.Serialize(&bitStreamLocal);
-
-		ostringstream buffer;
-
-		for (unsigned int k = 0; k < sync.sBitStream.size(); k++) {
-			char s;
-			s = sync.sBitStream.at(k);
-			buffer << setw(2) << hex << setfill('0') << (int)s << " ";
-		}
+	}
 
-		//cout << buffer.str() << endl;
+	void HandleSyncSkill(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
+		GameMessages::SyncSkill sync = GameMessages::SyncSkill();
+		if (!sync.Deserialize(inStream)) return;
 
-		if (usr != nullptr) {
-			RakNet::BitStream* bs = new RakNet::BitStream((unsigned char*)sync.sBitStream.c_str(), sync.sBitStream.size(), false);
+		if (UserManager::Instance()->GetUser(sysAddr) != nullptr) {
+			RakNet::BitStream bs(reinterpret_cast<unsigned char*>(sync.sBitStream.data()), sync.sBitStream.size(), false);
 
 			auto* skillComponent = entity->GetComponent<SkillComponent>();
 
-			skillComponent->SyncPlayerSkill(sync.uiSkillHandle, sync.uiBehaviorHandle, bs);
-
-			delete bs;
+			skillComponent->SyncPlayerSkill(sync.uiSkillHandle, sync.uiBehaviorHandle, &bs);
 		}
 
+		RakNet::BitStream bitStreamLocal;
+		PacketUtils::WriteHeader(bitStreamLocal, CLIENT, MSG_CLIENT_GAME_MSG);
+		bitStreamLocal.Write(entity->GetObjectID());
+
 		GameMessages::EchoSyncSkill echo = GameMessages::EchoSyncSkill();
 		echo.bDone = sync.bDone;
-		echo.sBitStream = sync.sBitStream;
+		echo.sBitStream = std::move(sync.sBitStream);
 		echo.uiBehaviorHandle = sync.uiBehaviorHandle;
 		echo.uiSkillHandle = sync.uiSkillHandle;
 
 		echo.Serialize(&bitStreamLocal);
 
 		Game::server->Send(&bitStreamLocal, sysAddr, true);
-	} break;
+	}
 
-	case GAME_MSG_REQUEST_SMASH_PLAYER:
+	void HandleRequestSmashPlayer(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
 		entity->Smash(entity->GetObjectID());
-		break;
-
-	case GAME_MSG_MOVE_ITEM_BETWEEN_INVENTORY_TYPES:
-		GameMessages::HandleMoveItemBetweenInventoryTypes(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_MODULAR_BUILD_FINISH:
-		GameMessages::HandleModularBuildFinish(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_PUSH_EQUIPPED_ITEMS_STATE:
-		GameMessages::HandlePushEquippedItemsState(inStream, entity);
-		break;
-
-	case GAME_MSG_POP_EQUIPPED_ITEMS_STATE:
-		GameMessages::HandlePopEquippedItemsState(inStream, entity);
-		break;
-
-	case GAME_MSG_BUY_FROM_VENDOR:
-		GameMessages::HandleBuyFromVendor(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_SELL_TO_VENDOR:
-		GameMessages::HandleSellToVendor(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_BUYBACK_FROM_VENDOR:
-		GameMessages::HandleBuybackFromVendor(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_MODULAR_BUILD_MOVE_AND_EQUIP:
-		GameMessages::HandleModularBuildMoveAndEquip(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_DONE_ARRANGING_WITH_ITEM:
-		GameMessages::HandleDoneArrangingWithItem(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_MODULAR_BUILD_CONVERT_MODEL:
-		GameMessages::HandleModularBuildConvertModel(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_BUILD_MODE_SET:
-		GameMessages::HandleBuildModeSet(inStream, entity);
-		break;
-
-	case GAME_MSG_REBUILD_CANCEL:
-		GameMessages::HandleRebuildCancel(inStream, entity);
-		break;
-
-	case GAME_MSG_MATCH_REQUEST:
-		GameMessages::HandleMatchRequest(inStream, entity);
-		break;
+	}
 
-	case GAME_MSG_USE_NON_EQUIPMENT_ITEM:
-		GameMessages::HandleUseNonEquipmentItem(inStream, entity);
-		break;
+	void HandleZonePropertyModelRotated(RakNet::BitStream* inStream, Entity* entity, const SystemAddress& sysAddr) {
+		auto* usr = UserManager::Instance()->GetUser(sysAddr);
 
-	case GAME_MSG_CLIENT_ITEM_CONSUMED:
-		GameMessages::HandleClientItemConsumed(inStream, entity);
-		break;
+		if (usr == nullptr) return;
 
-	case GAME_MSG_SET_CONSUMABLE_ITEM:
-		GameMessages::HandleSetConsumableItem(inStream, entity, sysAddr);
-		break;
+		EntityManager::Instance()->GetZoneControlEntity()->OnZonePropertyModelRotated(usr->GetLastUsedChar()->GetEntity());
+	}
 
-	case GAME_MSG_VERIFY_ACK:
-		GameMessages::HandleVerifyAck(inStream, entity, sysAddr);
-		break;
+	/**
+	 * The handlers indexed by message ID, built once so a message is dispatched with a single lookup.
+	 * Messages that are received but need no handling are mapped to Ignore to keep them out of the logs.
+	 */
+	std::vector<Handler> BuildHandlers() {
+		const std::initializer_list<std::pair<GAME_MSG, Handler>> handlers = {
+		{ GAME_MSG_UN_USE_BBB_MODEL, GameMessages::HandleUnUseModel },
+		{ GAME_MSG_PLAY_EMOTE, WithoutAddress<GameMessages::HandlePlayEmote> },
+		{ GAME_MSG_MOVE_ITEM_IN_INVENTORY, WithoutAddress<GameMessages::HandleMoveItemInInventory> },
+		{ GAME_MSG_REMOVE_ITEM_FROM_INVENTORY, GameMessages::HandleRemoveItemFromInventory },
+		{ GAME_MSG_EQUIP_ITEM, WithoutAddress<GameMessages::HandleEquipItem> },
+		{ GAME_MSG_UN_EQUIP_ITEM, WithoutAddress<GameMessages::HandleUnequipItem> },
+		{ GAME_MSG_RESPOND_TO_MISSION, WithoutAddress<GameMessages::HandleRespondToMission> },
+		{ GAME_MSG_REQUEST_USE, GameMessages::HandleRequestUse },
+		{ GAME_MSG_SET_FLAG, WithoutAddress<GameMessages::HandleSetFlag> },
+		{ GAME_MSG_HAS_BEEN_COLLECTED, WithoutAddress<GameMessages::HandleHasBeenCollected> },
+		{ GAME_MSG_PLAYER_LOADED, HandlePlayerLoaded },
+		{ GAME_MSG_REQUEST_LINKED_MISSION, WithoutAddress<GameMessages::HandleRequestLinkedMission> },
+		{ GAME_MSG_MISSION_DIALOGUE_OK, WithoutAddress<GameMessages::HandleMissionDialogOK> },
+		{ GAME_MSG_MISSION_DIALOGUE_CANCELLED, Ignore },
+		{ GAME_MSG_REQUEST_PLATFORM_RESYNC, GameMessages::HandleRequestPlatformResync },
+		{ GAME_MSG_FIRE_EVENT_SERVER_SIDE, GameMessages::HandleFireEventServerSide },
+		{ GAME_MSG_SEND_ACTIVITY_SUMMARY_LEADERBOARD_DATA, GameMessages::HandleActivitySummaryLeaderboardData },
+		{ GAME_MSG_REQUEST_ACTIVITY_SUMMARY_LEADERBOARD_DATA, GameMessages::HandleRequestActivitySummaryLeaderboardData },
+		{ GAME_MSG_ACTIVITY_STATE_CHANGE_REQUEST, WithoutAddress<GameMessages::HandleActivityStateChangeRequest> },
+		{ GAME_MSG_PARSE_CHAT_MESSAGE, GameMessages::HandleParseChatMessage },
+		{ GAME_MSG_NOTIFY_SERVER_LEVEL_PROCESSING_COMPLETE, WithoutAddress<GameMessages::HandleNotifyServerLevelProcessingComplete> },
+		{ GAME_MSG_PICKUP_CURRENCY, WithoutAddress<GameMessages::HandlePickupCurrency> },
+		{ GAME_MSG_PICKUP_ITEM, WithoutAddress<GameMessages::HandlePickupItem> },
+		{ GAME_MSG_RESURRECT, WithoutAddress<GameMessages::HandleResurrect> },
+		{ GAME_MSG_REQUEST_RESURRECT, HandleRequestResurrect },
+		{ GAME_MSG_HANDLE_HOT_PROPERTY_DATA, GameMessages::HandleGetHotPropertyData },
+		{ GAME_MSG_REQUEST_SERVER_PROJECTILE_IMPACT, HandleRequestServerProjectileImpact },
+		{ GAME_MSG_START_SKILL, HandleStartSkill },
+		{ GAME_MSG_SYNC_SKILL, HandleSyncSkill },
+		{ GAME_MSG_REQUEST_SMASH_PLAYER, HandleRequestSmashPlayer },
+		{ GAME_MSG_MOVE_ITEM_BETWEEN_INVENTORY_TYPES, GameMessages::HandleMoveItemBetweenInventoryTypes },
+		{ GAME_MSG_MODULAR_BUILD_FINISH, GameMessages::HandleModularBuildFinish },
+		{ GAME_MSG_PUSH_EQUIPPED_ITEMS_STATE, WithoutAddress<GameMessages::HandlePushEquippedItemsState> },
+		{ GAME_MSG_POP_EQUIPPED_ITEMS_STATE, WithoutAddress<GameMessages::HandlePopEquippedItemsState> },
+		{ GAME_MSG_BUY_FROM_VENDOR, GameMessages::HandleBuyFromVendor },
+		{ GAME_MSG_SELL_TO_VENDOR, GameMessages::HandleSellToVendor },
+		{ GAME_MSG_BUYBACK_FROM_VENDOR, GameMessages::HandleBuybackFromVendor },
+		{ GAME_MSG_MODULAR_BUILD_MOVE_AND_EQUIP, GameMessages::HandleModularBuildMoveAndEquip },
+		{ GAME_MSG_DONE_ARRANGING_WITH_ITEM, GameMessages::HandleDoneArrangingWithItem },
+		{ GAME_MSG_MODULAR_BUILD_CONVERT_MODEL, GameMessages::HandleModularBuildConvertModel },
+		{ GAME_MSG_BUILD_MODE_SET, WithoutAddress<GameMessages::HandleBuildModeSet> },
+		{ GAME_MSG_REBUILD_CANCEL, WithoutAddress<GameMessages::HandleRebuildCancel> },
+		{ GAME_MSG_MATCH_REQUEST, WithoutAddress<GameMessages::HandleMatchRequest> },
+		{ GAME_MSG_USE_NON_EQUIPMENT_ITEM, WithoutAddress<GameMessages::HandleUseNonEquipmentItem> },
+		{ GAME_MSG_CLIENT_ITEM_CONSUMED, WithoutAddress<GameMessages::HandleClientItemConsumed> },
+		{ GAME_MSG_SET_CONSUMABLE_ITEM, GameMessages::HandleSetConsumableItem },
+		{ GAME_MSG_VERIFY_ACK, GameMessages::HandleVerifyAck },
 
 		// Trading
-	case GAME_MSG_CLIENT_TRADE_REQUEST:
-		GameMessages::HandleClientTradeRequest(inStream, entity, sysAddr);
-		break;
-	case GAME_MSG_CLIENT_TRADE_CANCEL:
-		GameMessages::HandleClientTradeCancel(inStream, entity, sysAddr);
-		break;
-	case GAME_MSG_CLIENT_TRADE_ACCEPT:
-		GameMessages::HandleClientTradeAccept(inStream, entity, sysAddr);
-		break;
-	case GAME_MSG_CLIENT_TRADE_UPDATE:
-		GameMessages::HandleClientTradeUpdate(inStream, entity, sysAddr);
-		break;
+		{ GAME_MSG_CLIENT_TRADE_REQUEST, GameMessages::HandleClientTradeRequest },
+		{ GAME_MSG_CLIENT_TRADE_CANCEL, GameMessages::HandleClientTradeCancel },
+		{ GAME_MSG_CLIENT_TRADE_ACCEPT, GameMessages::HandleClientTradeAccept },
+		{ GAME_MSG_CLIENT_TRADE_UPDATE, GameMessages::HandleClientTradeUpdate },
 
 		// Pets
-	case GAME_MSG_PET_TAMING_TRY_BUILD:
-		GameMessages::HandlePetTamingTryBuild(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_NOTIFY_TAMING_BUILD_SUCCESS:
-		GameMessages::HandleNotifyTamingBuildSuccess(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_REQUEST_SET_PET_NAME:
-		GameMessages::HandleRequestSetPetName(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_START_SERVER_PET_MINIGAME_TIMER:
-		GameMessages::HandleStartServerPetMinigameTimer(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_CLIENT_EXIT_TAMING_MINIGAME:
-		GameMessages::HandleClientExitTamingMinigame(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_COMMAND_PET:
-		GameMessages::HandleCommandPet(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_DESPAWN_PET:
-		GameMessages::HandleDespawnPet(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_MESSAGE_BOX_RESPOND:
-		GameMessages::HandleMessageBoxResponse(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_CHOICE_BOX_RESPOND:
-		GameMessages::HandleChoiceBoxRespond(inStream, entity, sysAddr);
-		break;
+		{ GAME_MSG_PET_TAMING_TRY_BUILD, GameMessages::HandlePetTamingTryBuild },
+		{ GAME_MSG_NOTIFY_TAMING_BUILD_SUCCESS, GameMessages::HandleNotifyTamingBuildSuccess },
+		{ GAME_MSG_REQUEST_SET_PET_NAME, GameMessages::HandleRequestSetPetName },
+		{ GAME_MSG_START_SERVER_PET_MINIGAME_TIMER, GameMessages::HandleStartServerPetMinigameTimer },
+		{ GAME_MSG_CLIENT_EXIT_TAMING_MINIGAME, GameMessages::HandleClientExitTamingMinigame },
+		{ GAME_MSG_COMMAND_PET, GameMessages::HandleCommandPet },
+		{ GAME_MSG_DESPAWN_PET, GameMessages::HandleDespawnPet },
+		{ GAME_MSG_MESSAGE_BOX_RESPOND, GameMessages::HandleMessageBoxResponse },
+		{ GAME_MSG_CHOICE_BOX_RESPOND, GameMessages::HandleChoiceBoxRespond },
 
 		// Property
-	case GAME_MSG_QUERY_PROPERTY_DATA:
-		GameMessages::HandleQueryPropertyData(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_START_BUILDING_WITH_ITEM:
-		GameMessages::HandleStartBuildingWithItem(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_SET_BUILD_MODE:
-		GameMessages::HandleSetBuildMode(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_PROPERTY_EDITOR_BEGIN:
-		GameMessages::HandlePropertyEditorBegin(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_PROPERTY_EDITOR_END:
-		GameMessages::HandlePropertyEditorEnd(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_PROPERTY_CONTENTS_FROM_CLIENT:
-		GameMessages::HandlePropertyContentsFromClient(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_ZONE_PROPERTY_MODEL_EQUIPPED:
-		GameMessages::HandlePropertyModelEquipped(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_PLACE_PROPERTY_MODEL:
-		GameMessages::HandlePlacePropertyModel(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_UPDATE_MODEL_FROM_CLIENT:
-		GameMessages::HandleUpdatePropertyModel(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_DELETE_MODEL_FROM_CLIENT:
-		GameMessages::HandleDeletePropertyModel(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_BBB_LOAD_ITEM_REQUEST:
-		GameMessages::HandleBBBLoadItemRequest(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_BBB_SAVE_REQUEST:
-		GameMessages::HandleBBBSaveRequest(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_CONTROL_BEHAVIOR:
-		GameMessages::HandleControlBehaviors(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_PROPERTY_ENTRANCE_SYNC:
-		GameMessages::HandlePropertyEntranceSync(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_ENTER_PROPERTY1:
-		GameMessages::HandleEnterProperty(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_ZONE_PROPERTY_MODEL_ROTATED:
-		EntityManager::Instance()->GetZoneControlEntity()->OnZonePropertyModelRotated(usr->GetLastUsedChar()->GetEntity());
-		break;
-
-	case GAME_MSG_UPDATE_PROPERTY_OR_MODEL_FOR_FILTER_CHECK:
-		GameMessages::HandleUpdatePropertyOrModelForFilterCheck(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_SET_PROPERTY_ACCESS:
-		GameMessages::HandleSetPropertyAccess(inStream, entity, sysAddr);
-		break;
+		{ GAME_MSG_QUERY_PROPERTY_DATA, GameMessages::HandleQueryPropertyData },
+		{ GAME_MSG_START_BUILDING_WITH_ITEM, GameMessages::HandleStartBuildingWithItem },
+		{ GAME_MSG_SET_BUILD_MODE, GameMessages::HandleSetBuildMode },
+		{ GAME_MSG_PROPERTY_EDITOR_BEGIN, GameMessages::HandlePropertyEditorBegin },
+		{ GAME_MSG_PROPERTY_EDITOR_END, GameMessages::HandlePropertyEditorEnd },
+		{ GAME_MSG_PROPERTY_CONTENTS_FROM_CLIENT, GameMessages::HandlePropertyContentsFromClient },
+		{ GAME_MSG_ZONE_PROPERTY_MODEL_EQUIPPED, GameMessages::HandlePropertyModelEquipped },
+		{ GAME_MSG_PLACE_PROPERTY_MODEL, GameMessages::HandlePlacePropertyModel },
+		{ GAME_MSG_UPDATE_MODEL_FROM_CLIENT, GameMessages::HandleUpdatePropertyModel },
+		{ GAME_MSG_DELETE_MODEL_FROM_CLIENT, GameMessages::HandleDeletePropertyModel },
+		{ GAME_MSG_BBB_LOAD_ITEM_REQUEST, GameMessages::HandleBBBLoadItemRequest },
+		{ GAME_MSG_BBB_SAVE_REQUEST, GameMessages::HandleBBBSaveRequest },
+		{ GAME_MSG_CONTROL_BEHAVIOR, GameMessages::HandleControlBehaviors },
+		{ GAME_MSG_PROPERTY_ENTRANCE_SYNC, GameMessages::HandlePropertyEntranceSync },
+		{ GAME_MSG_ENTER_PROPERTY1, GameMessages::HandleEnterProperty },
+		{ GAME_MSG_ZONE_PROPERTY_MODEL_ROTATED, HandleZonePropertyModelRotated },
+		{ GAME_MSG_UPDATE_PROPERTY_OR_MODEL_FOR_FILTER_CHECK, GameMessages::HandleUpdatePropertyOrModelForFilterCheck },
+		{ GAME_MSG_SET_PROPERTY_ACCESS, GameMessages::HandleSetPropertyAccess },
 
 		// Racing
-	case GAME_MSG_MODULE_ASSEMBLY_QUERY_DATA:
-		GameMessages::HandleModuleAssemblyQueryData(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_ACKNOWLEDGE_POSSESSION:
-		GameMessages::HandleAcknowledgePossession(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_VEHICLE_SET_WHEEL_LOCK_STATE:
-		GameMessages::HandleVehicleSetWheelLockState(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_MODULAR_ASSEMBLY_NIF_COMPLETED:
-		GameMessages::HandleModularAssemblyNIFCompleted(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_RACING_CLIENT_READY:
-		GameMessages::HandleRacingClientReady(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_REQUEST_DIE:
-		GameMessages::HandleRequestDie(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_VEHICLE_NOTIFY_SERVER_ADD_PASSIVE_BOOST_ACTION:
-		GameMessages::HandleVehicleNotifyServerAddPassiveBoostAction(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_VEHICLE_NOTIFY_SERVER_REMOVE_PASSIVE_BOOST_ACTION:
-		GameMessages::HandleVehicleNotifyServerRemovePassiveBoostAction(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_RACING_PLAYER_INFO_RESET_FINISHED:
-		GameMessages::HandleRacingPlayerInfoResetFinished(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_VEHICLE_NOTIFY_HIT_IMAGINATION_SERVER:
-		GameMessages::HandleVehicleNotifyHitImaginationServer(inStream, entity, sysAddr);
-		break;
-	case GAME_MSG_UPDATE_PROPERTY_PERFORMANCE_COST:
-		GameMessages::HandleUpdatePropertyPerformanceCost(inStream, entity, sysAddr);
-		break;
+		{ GAME_MSG_MODULE_ASSEMBLY_QUERY_DATA, GameMessages::HandleModuleAssemblyQueryData },
+		{ GAME_MSG_ACKNOWLEDGE_POSSESSION, GameMessages::HandleAcknowledgePossession },
+		{ GAME_MSG_VEHICLE_SET_WHEEL_LOCK_STATE, GameMessages::HandleVehicleSetWheelLockState },
+		{ GAME_MSG_MODULAR_ASSEMBLY_NIF_COMPLETED, GameMessages::HandleModularAssemblyNIFCompleted },
+		{ GAME_MSG_RACING_CLIENT_READY, GameMessages::HandleRacingClientReady },
+		{ GAME_MSG_REQUEST_DIE, GameMessages::HandleRequestDie },
+		{ GAME_MSG_VEHICLE_NOTIFY_SERVER_ADD_PASSIVE_BOOST_ACTION, GameMessages::HandleVehicleNotifyServerAddPassiveBoostAction },
+		{ GAME_MSG_VEHICLE_NOTIFY_SERVER_REMOVE_PASSIVE_BOOST_ACTION, GameMessages::HandleVehicleNotifyServerRemovePassiveBoostAction },
+		{ GAME_MSG_RACING_PLAYER_INFO_RESET_FINISHED, GameMessages::HandleRacingPlayerInfoResetFinished },
+		{ GAME_MSG_VEHICLE_NOTIFY_HIT_IMAGINATION_SERVER, GameMessages::HandleVehicleNotifyHitImaginationServer },
+		{ GAME_MSG_UPDATE_PROPERTY_PERFORMANCE_COST, GameMessages::HandleUpdatePropertyPerformanceCost },
+
 		// SG
-	case GAME_MSG_UPDATE_SHOOTING_GALLERY_ROTATION:
-		GameMessages::HandleUpdateShootingGalleryRotation(inStream, entity, sysAddr);
-		break;
+		{ GAME_MSG_UPDATE_SHOOTING_GALLERY_ROTATION, GameMessages::HandleUpdateShootingGalleryRotation },
 
 		// NT
-	case GAME_MSG_REQUEST_MOVE_ITEM_BETWEEN_INVENTORY_TYPES:
-		GameMessages::HandleRequestMoveItemBetweenInventoryTypes(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_TOGGLE_GHOST_REFERENCE_OVERRIDE:
-		GameMessages::HandleToggleGhostReferenceOverride(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_SET_GHOST_REFERENCE_POSITION:
-		GameMessages::HandleSetGhostReferencePosition(inStream, entity, sysAddr);
-		break;
-
-	case GAME_MSG_READY_FOR_UPDATES:
-		//We don't really care about this message, as it's simply here to inform us that the client is done loading an object.
-		//In the event we _do_ send an update to an object that hasn't finished loading, the client will handle it anyway.
-		break;
-
-	case GAME_MSG_REPORT_BUG:
-		GameMessages::HandleReportBug(inStream, entity);
-		break;
+		{ GAME_MSG_REQUEST_MOVE_ITEM_BETWEEN_INVENTORY_TYPES, GameMessages::HandleRequestMoveItemBetweenInventoryTypes },
+		{ GAME_MSG_TOGGLE_GHOST_REFERENCE_OVERRIDE, GameMessages::HandleToggleGhostReferenceOverride },
+		{ GAME_MSG_SET_GHOST_REFERENCE_POSITION, GameMessages::HandleSetGhostReferencePosition },
+		{ GAME_MSG_READY_FOR_UPDATES, Ignore },
+		{ GAME_MSG_REPORT_BUG, WithoutAddress<GameMessages::HandleReportBug> },
+		{ GAME_MSG_CLIENT_RAIL_MOVEMENT_READY, GameMessages::HandleClientRailMovementReady },
+		{ GAME_MSG_CANCEL_RAIL_MOVEMENT, GameMessages::HandleCancelRailMovement },
+		{ GAME_MSG_PLAYER_RAIL_ARRIVED_NOTIFICATION, GameMessages::HandlePlayerRailArrivedNotification },
+		{ GAME_MSG_CINEMATIC_UPDATE, GameMessages::HandleCinematicUpdate },
+		{ GAME_MSG_MODIFY_PLAYER_ZONE_STATISTIC, WithoutAddress<GameMessages::HandleModifyPlayerZoneStatistic> },
+		{ GAME_MSG_UPDATE_PLAYER_STATISTIC, WithoutAddress<GameMessages::HandleUpdatePlayerStatistic> },
+		{ GAME_MSG_DISMOUNT_COMPLETE, GameMessages::HandleDismountComplete }
+		};
+
+		uint16_t maxMessageID = 0;
+		for (const auto& [messageID, handler] : handlers) {
+			maxMessageID = std::max<uint16_t>(maxMessageID, messageID);
+		}
 
-	case GAME_MSG_CLIENT_RAIL_MOVEMENT_READY:
-		GameMessages::HandleClientRailMovementReady(inStream, entity, sysAddr);
-		break;
+		std::vector<Handler> table(maxMessageID + 1, nullptr);
+		for (const auto& [messageID, handler] : handlers) {
+			table[messageID] = handler;
+		}
 
-	case GAME_MSG_CANCEL_RAIL_MOVEMENT:
-		GameMessages::HandleCancelRailMovement(inStream, entity, sysAddr);
-		break;
+		return table;
+	}
+}
 
-	case GAME_MSG_PLAYER_RAIL_ARRIVED_NOTIFICATION:
-		GameMessages::HandlePlayerRailArrivedNotification(inStream, entity, sysAddr);
-		break;
+void GameMessageHandler::HandleMessage(RakNet::BitStream* inStream, const SystemAddress& sysAddr, LWOOBJID objectID, GAME_MSG messageID) {
+	static const std::vector<Handler> handlers = BuildHandlers();
 
-	case GAME_MSG_CINEMATIC_UPDATE:
-		GameMessages::HandleCinematicUpdate(inStream, entity, sysAddr);
-		break;
+	const auto handler = messageID < handlers.size() ? handlers[messageID] : nullptr;
 
-	case GAME_MSG_MODIFY_PLAYER_ZONE_STATISTIC:
-		GameMessages::HandleModifyPlayerZoneStatistic(inStream, entity);
-		break;
+	if (handler == nullptr) {
+		//Game::logger->Log("GameMessageHandler", "Unknown game message ID: %X", messageID);
+		return;
+	}
 
-	case GAME_MSG_UPDATE_PLAYER_STATISTIC:
-		GameMessages::HandleUpdatePlayerStatistic(inStream, entity);
-		break;
+	// Get the entity
+	Entity* entity = EntityManager::Instance()->GetEntity(objectID);
 
-	case GAME_MSG_DISMOUNT_COMPLETE:
-		GameMessages::HandleDismountComplete(inStream, entity, sysAddr);
-		break;
+	if (!entity) {
+		Game::logger->Log("GameMessageHandler", "Failed to find associated entity (%llu), aborting GM (%X)!", objectID, messageID);
 
-	default:
-		//Game::logger->Log("GameMessageHandler", "Unknown game message ID: %X", messageID);
-		break;
+		return;
 	}
+
+	handler(inStream, entity, sysAddr);
 }
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "BitStream.h"
+
+namespace GameMessages {
+	/**
+	 * Writes a string prefixed by its 32 bit length, the contents are written in one go
+	 * @param stream the stream to write to
+	 * @param value the string to write
+	 */
+	inline void WriteSizedString(RakNet::BitStream* stream, const std::string& value) {
+		const uint32_t length = value.length();
+		stream->Write(length);
+		stream->Write(value.c_str(), length);
+	}
+
+	/**
+	 * Reads a string prefixed by its 32 bit length, the contents are read in one go
+	 * @param stream the stream to read from
+	 * @param value the string to read into
+	 * @return false if the stream is shorter than the length it claims
+	 */
+	inline bool ReadSizedString(RakNet::BitStream* stream, std::string& value) {
+		uint32_t length{};
+		if (!stream->Read(length) || length > stream->GetNumberOfUnreadBits() / 8) return false;
+
+		value.resize(length);
+
+		// RakNet fails reads of no bytes when the stream isn't byte aligned
+		if (length == 0) return true;
+
+		return stream->Read(value.data(), length);
+	}
+
+	/**
+	 * Describes the layout of a game message as a list of its fields, in the order they are sent. A message lists them
+	 * in a static Fields() function and Serialize and Deserialize below write and read it from that list.
+	 */
+	namespace Schema {
+		/**
+		 * A field that is always written
+		 */
+		template<typename Message, typename T>
+		struct ValueField {
+			T Message::* member;
+		};
+
+		/**
+		 * A field written as a flag saying whether it differs from its default, followed by the value if it does
+		 */
+		template<typename Message, typename T>
+		struct DefaultedField {
+			T Message::* member;
+			T defaultValue;
+		};
+
+		/**
+		 * A string written with its 32 bit length in front of it
+		 */
+		template<typename Message>
+		struct SizedStringField {
+			std::string Message::* member;
+		};
+
+		template<typename Message, typename T>
+		ValueField<Message, T> Value(T Message::* member) {
+			return { member };
+		}
+
+		template<typename Message, typename T>
+		DefaultedField<Message, T> Defaulted(T Message::* member, const T& defaultValue) {
+			return { member, defaultValue };
+		}
+
+		template<typename Message>
+		SizedStringField<Message> SizedString(std::string Message::* member) {
+			return { member };
+		}
+
+		template<typename Message, typename T>
+		void Write(RakNet::BitStream* stream, const Message& message, const ValueField<Message, T>& field) {
+			stream->Write(message.*field.member);
+		}
+
+		template<typename Message, typename T>
+		void Write(RakNet::BitStream* stream, const Message& message, const DefaultedField<Message, T>& field) {
+			const auto& value = message.*field.member;
+			const bool isSet = value != field.defaultValue;
+
+			stream->Write(isSet);
+			if (isSet) stream->Write(value);
+		}
+
+		template<typename Message>
+		void Write(RakNet::BitStream* stream, const Message& message, const SizedStringField<Message>& field) {
+			WriteSizedString(stream, message.*field.member);
+		}
+
+		// Like the hand written readers, only sized strings reject a stream that is too short, as their length is
+		// what the rest of the message would be read past
+		template<typename Message, typename T>
+		bool Read(RakNet::BitStream* stream, Message& message, const ValueField<Message, T>& field) {
+			stream->Read(message.*field.member);
+
+			return true;
+		}
+
+		template<typename Message, typename T>
+		bool Read(RakNet::BitStream* stream, Message& message, const DefaultedField<Message, T>& field) {
+			bool isSet{};
+			stream->Read(isSet);
+			if (isSet) stream->Read(message.*field.member);
+
+			return true;
+		}
+
+		template<typename Message>
+		bool Read(RakNet::BitStream* stream, Message& message, const SizedStringField<Message>& field) {
+			return ReadSizedString(stream, message.*field.member);
+		}
+
+		/**
+		 * Writes the fields of a message, without its message ID
+		 * @param stream the stream to write to
+		 * @param message the message to write
+		 */
+		template<typename Message>
+		void Serialize(RakNet::BitStream* stream, const Message& message) {
+			std::apply([&](const auto&... fields) { (Write(stream, message, fields), ...); }, Message::Fields());
+		}
+
+		/**
+		 * Reads the fields of a message, stopping at the first one that can't be read
+		 * @param stream the stream to read from
+		 * @param message the message to read into
+		 * @return false if a field couldn't be read
+		 */
+		template<typename Message>
+		bool Deserialize(RakNet::BitStream* stream, Message& message) {
+			return std::apply([&](const auto&... fields) { return (Read(stream, message, fields) && ...); }, Message::Fields());
+		}
+	}
+};
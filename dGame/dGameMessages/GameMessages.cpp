@@ -21,8 +21,10 @@
 #include "WorldPackets.h"
 #include "Item.h"
 #include "ZCompression.h"
+#include "Sd0.h"
 #include "Player.h"
 #include "dConfig.h"
+#include "ConfigOptions.h"
 #include "TeamManager.h"
 #include "ChatPackets.h"
 #include "GameConfig.h"
@@ -1250,7 +1252,7 @@ void GameMessages::SendVendorStatusUpdate(Entity* entity, const SystemAddress& s
 	VendorComponent* vendor = static_cast<VendorComponent*>(entity->GetComponent(COMPONENT_TYPE_VENDOR));
 	if (!vendor) return;
 
-	std::map<LOT, int> vendorItems = vendor->GetInventory();
+	const auto& vendorItems = vendor->GetInventory();
 
 	bitStream.Write(entity->GetObjectID());
 	bitStream.Write(GAME_MSG::GAME_MSG_VENDOR_STATUS_UPDATE);
@@ -1258,7 +1260,7 @@ void GameMessages::SendVendorStatusUpdate(Entity* entity, const SystemAddress& s
 	bitStream.Write(bUpdateOnly);
 	bitStream.Write(static_cast<uint32_t>(vendorItems.size()));
 
-	for (std::pair<LOT, int> item : vendorItems) {
+	for (const auto& item : vendorItems) {
 		bitStream.Write(static_cast<int>(item.first));
 		bitStream.Write(static_cast<int>(item.second));
 	}
@@ -2510,11 +2512,7 @@ void GameMessages::HandleBBBSaveRequest(RakNet::BitStream* inStream, Entity* ent
 		return;
 	}
 
-	for (uint32_t i = 0; i < sd0Size; ++i) {
-		uint8_t c;
-		inStream->Read(c);
-		sd0Data[i] = c;
-	}
+	inStream->Read(sd0Data.get(), sd0Size);
 
 	uint32_t timeTaken;
 	inStream->Read(timeTaken);
@@ -2595,23 +2593,36 @@ void GameMessages::HandleBBBSaveRequest(RakNet::BitStream* inStream, Entity* ent
 				delete propertyEntry;
 				delete propertyLookup;
 
-				//Insert into ugc:
-				auto ugcs = Database::CreatePreppedStmt("INSERT INTO `ugc`(`id`, `account_id`, `character_id`, `is_optimized`, `lxfml`, `bake_ao`, `filename`) VALUES (?,?,?,?,?,?,?)");
-				ugcs->setUInt(1, blueprintIDSmall);
-				ugcs->setInt(2, entity->GetParentUser()->GetAccountID());
-				ugcs->setInt(3, entity->GetCharacter()->GetID());
-				ugcs->setInt(4, 0);
-
-				//whacky stream biz
-				std::string s(sd0Data.get(), sd0Size);
-				std::istringstream iss(s);
-				std::istream& stream = iss;
-
-				ugcs->setBlob(5, &iss);
-				ugcs->setBoolean(6, false);
-				ugcs->setString(7, "weedeater.lxfml");
-				ugcs->execute();
-				delete ugcs;
+				//Identical models are only stored once, reuse the existing ugc row if there is one:
+				const auto contentHash = Sd0::ContentHash(sd0Data.get(), sd0Size);
+
+				std::unique_ptr<sql::PreparedStatement> existingModelLookup(Database::CreatePreppedStmt("SELECT id FROM ugc WHERE content_hash = ? LIMIT 1;"));
+				existingModelLookup->setString(1, contentHash.c_str());
+
+				std::unique_ptr<sql::ResultSet> existingModel(existingModelLookup->executeQuery());
+
+				if (existingModel->next()) {
+					blueprintIDSmall = existingModel->getUInt(1);
+					blueprintID = blueprintIDSmall;
+					blueprintID = GeneralUtils::SetBit(blueprintID, OBJECT_BIT_CHARACTER);
+					blueprintID = GeneralUtils::SetBit(blueprintID, OBJECT_BIT_PERSISTENT);
+				} else {
+					//Insert into ugc:
+					std::unique_ptr<sql::PreparedStatement> ugcs(Database::CreatePreppedStmt("INSERT INTO `ugc`(`id`, `account_id`, `character_id`, `is_optimized`, `lxfml`, `bake_ao`, `filename`, `content_hash`) VALUES (?,?,?,?,?,?,?,?)"));
+					ugcs->setUInt(1, blueprintIDSmall);
+					ugcs->setInt(2, entity->GetParentUser()->GetAccountID());
+					ugcs->setInt(3, entity->GetCharacter()->GetID());
+					ugcs->setInt(4, 0);
+
+					//whacky stream biz
+					std::istringstream iss(std::string(sd0Data.get(), sd0Size));
+
+					ugcs->setBlob(5, &iss);
+					ugcs->setBoolean(6, false);
+					ugcs->setString(7, "weedeater.lxfml");
+					ugcs->setString(8, contentHash.c_str());
+					ugcs->execute();
+				}
 
 				//Insert into the db as a BBB model:
 				auto* stmt = Database::CreatePreppedStmt("INSERT INTO `properties_contents` VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?)");
@@ -2665,10 +2676,7 @@ void GameMessages::HandleBBBSaveRequest(RakNet::BitStream* inStream, Entity* ent
 				bitStream.Write(blueprintID);
 
 				bitStream.Write<uint32_t>(sd0Size);
-
-				for (size_t i = 0; i < sd0Size; ++i) {
-					bitStream.Write(sd0Data[i]);
-				}
+				bitStream.Write(sd0Data.get(), sd0Size);
 
 				SEND_PACKET;
 
@@ -5227,7 +5235,7 @@ void GameMessages::HandleNotifyServerLevelProcessingComplete(RakNet::BitStream*
 	if (inventoryComponent != nullptr) {
 		auto* inventory = inventoryComponent->GetInventory(ITEMS);
 
-		if (inventory != nullptr && Game::config->GetValue("disable_extra_backpack") != "1") {
+		if (inventory != nullptr && !ConfigOptions::disableExtraBackpack.Get()) {
 			inventory->SetSize(inventory->GetSize() + 2);
 		}
 	}
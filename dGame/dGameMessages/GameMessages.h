@@ -14,6 +14,7 @@
 #include "TradingManager.h"
 #include "LeaderboardManager.h"
 #include "MovingPlatformComponent.h"
+#include "GameMessageSchema.h"
 
 class NiQuaternion;
 class User;
@@ -23,6 +24,7 @@ enum class eUnequippableActiveType;
 
 namespace GameMessages {
 	class PropertyDataMessage;
+
 	void SendFireEventClientSide(const LWOOBJID& objectID, const SystemAddress& sysAddr, std::u16string args, const LWOOBJID& object, int64_t param1, int param2, const LWOOBJID& sender);
 	void SendTeleport(const LWOOBJID& objectID, const NiPoint3& pos, const NiQuaternion& rot, const SystemAddress& sysAddr, bool bSetRotation = false, bool noGravTeleport = true);
 	void SendPlayAnimation(Entity* entity, const std::u16string& animationName, float fPriority = 0.0f, float fScale = 1.0f);
@@ -604,34 +606,28 @@ namespace GameMessages {
 		~EchoSyncSkill() {
 		}
 
+		/**
+		 * The fields of the message, in the order they are sent
+		 */
+		static auto Fields() {
+			using namespace Schema;
+
+			return std::make_tuple(
+				Value(&EchoSyncSkill::bDone),
+				SizedString(&EchoSyncSkill::sBitStream),
+				Value(&EchoSyncSkill::uiBehaviorHandle),
+				Value(&EchoSyncSkill::uiSkillHandle)
+			);
+		}
+
 		void Serialize(RakNet::BitStream* stream) {
 			stream->Write((unsigned short)MsgID);
 
-			stream->Write(bDone);
-			uint32_t sBitStreamLength = sBitStream.length();
-			stream->Write(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				stream->Write(sBitStream[k]);
-			}
-
-			stream->Write(uiBehaviorHandle);
-			stream->Write(uiSkillHandle);
+			Schema::Serialize(stream, *this);
 		}
 
 		bool Deserialize(RakNet::BitStream* stream) {
-			stream->Read(bDone);
-			uint32_t sBitStreamLength{};
-			stream->Read(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				unsigned char character;
-				stream->Read(character);
-				sBitStream.push_back(character);
-			}
-
-			stream->Read(uiBehaviorHandle);
-			stream->Read(uiSkillHandle);
-
-			return true;
+			return Schema::Deserialize(stream, *this);
 		}
 
 		bool bDone{};
@@ -664,34 +660,28 @@ namespace GameMessages {
 		~SyncSkill() {
 		}
 
+		/**
+		 * The fields of the message, in the order they are sent
+		 */
+		static auto Fields() {
+			using namespace Schema;
+
+			return std::make_tuple(
+				Value(&SyncSkill::bDone),
+				SizedString(&SyncSkill::sBitStream),
+				Value(&SyncSkill::uiBehaviorHandle),
+				Value(&SyncSkill::uiSkillHandle)
+			);
+		}
+
 		void Serialize(RakNet::BitStream* stream) {
 			stream->Write((unsigned short)MsgID);
 
-			stream->Write(bDone);
-			uint32_t sBitStreamLength = sBitStream.length();
-			stream->Write(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				stream->Write(sBitStream[k]);
-			}
-
-			stream->Write(uiBehaviorHandle);
-			stream->Write(uiSkillHandle);
+			Schema::Serialize(stream, *this);
 		}
 
 		bool Deserialize(RakNet::BitStream* stream) {
-			stream->Read(bDone);
-			uint32_t sBitStreamLength{};
-			stream->Read(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				unsigned char character;
-				stream->Read(character);
-				sBitStream.push_back(character);
-			}
-
-			stream->Read(uiBehaviorHandle);
-			stream->Read(uiSkillHandle);
-
-			return true;
+			return Schema::Deserialize(stream, *this);
 		}
 
 		bool bDone{};
@@ -727,42 +717,27 @@ namespace GameMessages {
 		~RequestServerProjectileImpact() {
 		}
 
-		void Serialize(RakNet::BitStream* stream) {
-			stream->Write((unsigned short)MsgID);
-
-			stream->Write(i64LocalID != LWOOBJID_EMPTY);
-			if (i64LocalID != LWOOBJID_EMPTY) stream->Write(i64LocalID);
+		/**
+		 * The fields of the message, in the order they are sent
+		 */
+		static auto Fields() {
+			using namespace Schema;
 
-			stream->Write(i64TargetID != LWOOBJID_EMPTY);
-			if (i64TargetID != LWOOBJID_EMPTY) stream->Write(i64TargetID);
+			return std::make_tuple(
+				Defaulted(&RequestServerProjectileImpact::i64LocalID, LWOOBJID_EMPTY),
+				Defaulted(&RequestServerProjectileImpact::i64TargetID, LWOOBJID_EMPTY),
+				SizedString(&RequestServerProjectileImpact::sBitStream)
+			);
+		}
 
-			uint32_t sBitStreamLength = sBitStream.length();
-			stream->Write(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				stream->Write(sBitStream[k]);
-			}
+		void Serialize(RakNet::BitStream* stream) {
+			stream->Write((unsigned short)MsgID);
 
+			Schema::Serialize(stream, *this);
 		}
 
 		bool Deserialize(RakNet::BitStream* stream) {
-			bool i64LocalIDIsDefault{};
-			stream->Read(i64LocalIDIsDefault);
-			if (i64LocalIDIsDefault != 0) stream->Read(i64LocalID);
-
-			bool i64TargetIDIsDefault{};
-			stream->Read(i64TargetIDIsDefault);
-			if (i64TargetIDIsDefault != 0) stream->Read(i64TargetID);
-
-			uint32_t sBitStreamLength{};
-			stream->Read(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				unsigned char character;
-				stream->Read(character);
-				sBitStream.push_back(character);
-			}
-
-
-			return true;
+			return Schema::Deserialize(stream, *this);
 		}
 
 		LWOOBJID i64LocalID;
@@ -799,49 +774,28 @@ namespace GameMessages {
 		~DoClientProjectileImpact() {
 		}
 
-		void Serialize(RakNet::BitStream* stream) {
-			stream->Write((unsigned short)MsgID);
-
-			stream->Write(i64OrgID != LWOOBJID_EMPTY);
-			if (i64OrgID != LWOOBJID_EMPTY) stream->Write(i64OrgID);
-
-			stream->Write(i64OwnerID != LWOOBJID_EMPTY);
-			if (i64OwnerID != LWOOBJID_EMPTY) stream->Write(i64OwnerID);
+		/**
+		 * The fields of the message, in the order they are sent
+		 */
+		static auto Fields() {
+			using namespace Schema;
 
-			stream->Write(i64TargetID != LWOOBJID_EMPTY);
-			if (i64TargetID != LWOOBJID_EMPTY) stream->Write(i64TargetID);
+			return std::make_tuple(
+				Defaulted(&DoClientProjectileImpact::i64OrgID, LWOOBJID_EMPTY),
+				Defaulted(&DoClientProjectileImpact::i64OwnerID, LWOOBJID_EMPTY),
+				Defaulted(&DoClientProjectileImpact::i64TargetID, LWOOBJID_EMPTY),
+				SizedString(&DoClientProjectileImpact::sBitStream)
+			);
+		}
 
-			uint32_t sBitStreamLength = sBitStream.length();
-			stream->Write(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				stream->Write(sBitStream[k]);
-			}
+		void Serialize(RakNet::BitStream* stream) {
+			stream->Write((unsigned short)MsgID);
 
+			Schema::Serialize(stream, *this);
 		}
 
 		bool Deserialize(RakNet::BitStream* stream) {
-			bool i64OrgIDIsDefault{};
-			stream->Read(i64OrgIDIsDefault);
-			if (i64OrgIDIsDefault != 0) stream->Read(i64OrgID);
-
-			bool i64OwnerIDIsDefault{};
-			stream->Read(i64OwnerIDIsDefault);
-			if (i64OwnerIDIsDefault != 0) stream->Read(i64OwnerID);
-
-			bool i64TargetIDIsDefault{};
-			stream->Read(i64TargetIDIsDefault);
-			if (i64TargetIDIsDefault != 0) stream->Read(i64TargetID);
-
-			uint32_t sBitStreamLength{};
-			stream->Read(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				unsigned char character;
-				stream->Read(character);
-				sBitStream.push_back(character);
-			}
-
-
-			return true;
+			return Schema::Deserialize(stream, *this);
 		}
 
 		LWOOBJID i64OrgID;
@@ -893,80 +847,34 @@ namespace GameMessages {
 		~EchoStartSkill() {
 		}
 
-		void Serialize(RakNet::BitStream* stream) {
-			stream->Write((unsigned short)MsgID);
-
-			stream->Write(bUsedMouse);
-
-			stream->Write(fCasterLatency != 0.0f);
-			if (fCasterLatency != 0.0f) stream->Write(fCasterLatency);
-
-			stream->Write(iCastType != 0);
-			if (iCastType != 0) stream->Write(iCastType);
-
-			stream->Write(lastClickedPosit != NiPoint3::ZERO);
-			if (lastClickedPosit != NiPoint3::ZERO) stream->Write(lastClickedPosit);
-
-			stream->Write(optionalOriginatorID);
-
-			stream->Write(optionalTargetID != LWOOBJID_EMPTY);
-			if (optionalTargetID != LWOOBJID_EMPTY) stream->Write(optionalTargetID);
+		/**
+		 * The fields of the message, in the order they are sent
+		 */
+		static auto Fields() {
+			using namespace Schema;
 
-			stream->Write(originatorRot != NiQuaternion::IDENTITY);
-			if (originatorRot != NiQuaternion::IDENTITY) stream->Write(originatorRot);
-
-			uint32_t sBitStreamLength = sBitStream.length();
-			stream->Write(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				stream->Write(sBitStream[k]);
-			}
+			return std::make_tuple(
+				Value(&EchoStartSkill::bUsedMouse),
+				Defaulted(&EchoStartSkill::fCasterLatency, 0.0f),
+				Defaulted(&EchoStartSkill::iCastType, 0),
+				Defaulted(&EchoStartSkill::lastClickedPosit, NiPoint3::ZERO),
+				Value(&EchoStartSkill::optionalOriginatorID),
+				Defaulted(&EchoStartSkill::optionalTargetID, LWOOBJID_EMPTY),
+				Defaulted(&EchoStartSkill::originatorRot, NiQuaternion::IDENTITY),
+				SizedString(&EchoStartSkill::sBitStream),
+				Value(&EchoStartSkill::skillID),
+				Defaulted(&EchoStartSkill::uiSkillHandle, 0u)
+			);
+		}
 
-			stream->Write(skillID);
+		void Serialize(RakNet::BitStream* stream) {
+			stream->Write((unsigned short)MsgID);
 
-			stream->Write(uiSkillHandle != 0);
-			if (uiSkillHandle != 0) stream->Write(uiSkillHandle);
+			Schema::Serialize(stream, *this);
 		}
 
 		bool Deserialize(RakNet::BitStream* stream) {
-			stream->Read(bUsedMouse);
-
-			bool fCasterLatencyIsDefault{};
-			stream->Read(fCasterLatencyIsDefault);
-			if (fCasterLatencyIsDefault != 0) stream->Read(fCasterLatency);
-
-			bool iCastTypeIsDefault{};
-			stream->Read(iCastTypeIsDefault);
-			if (iCastTypeIsDefault != 0) stream->Read(iCastType);
-
-			bool lastClickedPositIsDefault{};
-			stream->Read(lastClickedPositIsDefault);
-			if (lastClickedPositIsDefault != 0) stream->Read(lastClickedPosit);
-
-			stream->Read(optionalOriginatorID);
-
-			bool optionalTargetIDIsDefault{};
-			stream->Read(optionalTargetIDIsDefault);
-			if (optionalTargetIDIsDefault != 0) stream->Read(optionalTargetID);
-
-			bool originatorRotIsDefault{};
-			stream->Read(originatorRotIsDefault);
-			if (originatorRotIsDefault != 0) stream->Read(originatorRot);
-
-			uint32_t sBitStreamLength{};
-			stream->Read(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				unsigned char character;
-				stream->Read(character);
-				sBitStream.push_back(character);
-			}
-
-			stream->Read(skillID);
-
-			bool uiSkillHandleIsDefault{};
-			stream->Read(uiSkillHandleIsDefault);
-			if (uiSkillHandleIsDefault != 0) stream->Read(uiSkillHandle);
-
-			return true;
+			return Schema::Deserialize(stream, *this);
 		}
 
 		bool bUsedMouse;
@@ -1027,87 +935,35 @@ namespace GameMessages {
 		~StartSkill() {
 		}
 
-		void Serialize(RakNet::BitStream* stream) {
-			stream->Write((unsigned short)MsgID);
-
-			stream->Write(bUsedMouse);
-
-			stream->Write(consumableItemID != LWOOBJID_EMPTY);
-			if (consumableItemID != LWOOBJID_EMPTY) stream->Write(consumableItemID);
-
-			stream->Write(fCasterLatency != 0.0f);
-			if (fCasterLatency != 0.0f) stream->Write(fCasterLatency);
+		/**
+		 * The fields of the message, in the order they are sent
+		 */
+		static auto Fields() {
+			using namespace Schema;
 
-			stream->Write(iCastType != 0);
-			if (iCastType != 0) stream->Write(iCastType);
-
-			stream->Write(lastClickedPosit != NiPoint3::ZERO);
-			if (lastClickedPosit != NiPoint3::ZERO) stream->Write(lastClickedPosit);
-
-			stream->Write(optionalOriginatorID);
-
-			stream->Write(optionalTargetID != LWOOBJID_EMPTY);
-			if (optionalTargetID != LWOOBJID_EMPTY) stream->Write(optionalTargetID);
-
-			stream->Write(originatorRot != NiQuaternion::IDENTITY);
-			if (originatorRot != NiQuaternion::IDENTITY) stream->Write(originatorRot);
-
-			uint32_t sBitStreamLength = sBitStream.length();
-			stream->Write(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				stream->Write(sBitStream[k]);
-			}
+			return std::make_tuple(
+				Value(&StartSkill::bUsedMouse),
+				Defaulted(&StartSkill::consumableItemID, LWOOBJID_EMPTY),
+				Defaulted(&StartSkill::fCasterLatency, 0.0f),
+				Defaulted(&StartSkill::iCastType, 0),
+				Defaulted(&StartSkill::lastClickedPosit, NiPoint3::ZERO),
+				Value(&StartSkill::optionalOriginatorID),
+				Defaulted(&StartSkill::optionalTargetID, LWOOBJID_EMPTY),
+				Defaulted(&StartSkill::originatorRot, NiQuaternion::IDENTITY),
+				SizedString(&StartSkill::sBitStream),
+				Value(&StartSkill::skillID),
+				Defaulted(&StartSkill::uiSkillHandle, 0u)
+			);
+		}
 
-			stream->Write(skillID);
+		void Serialize(RakNet::BitStream* stream) {
+			stream->Write((unsigned short)MsgID);
 
-			stream->Write(uiSkillHandle != 0);
-			if (uiSkillHandle != 0) stream->Write(uiSkillHandle);
+			Schema::Serialize(stream, *this);
 		}
 
 		bool Deserialize(RakNet::BitStream* stream) {
-			stream->Read(bUsedMouse);
-
-			bool consumableItemIDIsDefault{};
-			stream->Read(consumableItemIDIsDefault);
-			if (consumableItemIDIsDefault != 0) stream->Read(consumableItemID);
-
-			bool fCasterLatencyIsDefault{};
-			stream->Read(fCasterLatencyIsDefault);
-			if (fCasterLatencyIsDefault != 0) stream->Read(fCasterLatency);
-
-			bool iCastTypeIsDefault{};
-			stream->Read(iCastTypeIsDefault);
-			if (iCastTypeIsDefault != 0) stream->Read(iCastType);
-
-			bool lastClickedPositIsDefault{};
-			stream->Read(lastClickedPositIsDefault);
-			if (lastClickedPositIsDefault != 0) stream->Read(lastClickedPosit);
-
-			stream->Read(optionalOriginatorID);
-
-			bool optionalTargetIDIsDefault{};
-			stream->Read(optionalTargetIDIsDefault);
-			if (optionalTargetIDIsDefault != 0) stream->Read(optionalTargetID);
-
-			bool originatorRotIsDefault{};
-			stream->Read(originatorRotIsDefault);
-			if (originatorRotIsDefault != 0) stream->Read(originatorRot);
-
-			uint32_t sBitStreamLength{};
-			stream->Read(sBitStreamLength);
-			for (unsigned int k = 0; k < sBitStreamLength; k++) {
-				unsigned char character;
-				stream->Read(character);
-				sBitStream.push_back(character);
-			}
-
-			stream->Read(skillID);
-
-			bool uiSkillHandleIsDefault{};
-			stream->Read(uiSkillHandleIsDefault);
-			if (uiSkillHandleIsDefault != 0) stream->Read(uiSkillHandle);
-
-			return true;
+			return Schema::Deserialize(stream, *this);
 		}
 
 		bool bUsedMouse = false;
@@ -4,6 +4,8 @@
 #include "Item.h"
 #include "eItemType.h"
 
+#include <algorithm>
+
 std::vector<LOT> Inventory::m_GameMasterRestrictedItems = {
 		1727, // GM Only - JetPack
 		2243, // GM Only - Hammer of Doom
@@ -38,15 +40,15 @@ std::map<LWOOBJID, Item*>& Inventory::GetItems() {
 }
 
 std::map<uint32_t, Item*> Inventory::GetSlots() const {
-	std::map<uint32_t, Item*> slots;
-
-	for (const auto& pair : items) {
-		auto* item = pair.second;
+	std::map<uint32_t, Item*> slotMap;
 
-		slots.insert_or_assign(item->GetSlot(), item);
+	for (auto i = 0u; i < slots.size(); ++i) {
+		if (slots[i] != nullptr) {
+			slotMap.insert_or_assign(i, slots[i]);
+		}
 	}
 
-	return slots;
+	return slotMap;
 }
 
 InventoryComponent* Inventory::GetComponent() const {
@@ -56,12 +58,14 @@ InventoryComponent* Inventory::GetComponent() const {
 uint32_t Inventory::GetLotCount(const LOT lot) const {
 	uint32_t count = 0;
 
-	for (const auto& pair : items) {
-		const auto* item = pair.second;
+	const auto& index = itemsByLot.find(lot);
 
-		if (item->GetLot() == lot) {
-			count += item->GetCount();
-		}
+	if (index == itemsByLot.end()) {
+		return count;
+	}
+
+	for (const auto* item : index->second) {
+		count += item->GetCount();
 	}
 
 	return count;
@@ -99,12 +103,22 @@ int32_t Inventory::FindEmptySlot() {
 		return -1;
 	}
 
-	const auto slots = GetSlots();
+	// Find the first word of the bitmap that has a free slot, then the first free slot in that word.
+	for (auto word = 0u; word * 64 < size; ++word) {
+		const auto occupied = word < occupiedSlots.size() ? occupiedSlots[word] : 0;
 
-	for (auto i = 0u; i < size; ++i) {
-		if (slots.find(i) == slots.end()) {
-			return i;
+		if (occupied == UINT64_MAX) {
+			continue;
+		}
+
+		auto bit = 0u;
+		while (occupied & (1ULL << bit)) {
+			++bit;
 		}
+
+		const auto slot = word * 64 + bit;
+
+		return slot < size ? static_cast<int32_t>(slot) : -1;
 	}
 
 	return -1;
@@ -115,11 +129,7 @@ int32_t Inventory::GetEmptySlots() {
 }
 
 bool Inventory::IsSlotEmpty(int32_t slot) {
-	const auto slots = GetSlots();
-
-	const auto& index = slots.find(slot);
-
-	return index == slots.end();
+	return FindItemBySlot(slot) == nullptr;
 }
 
 Item* Inventory::FindItemById(const LWOOBJID id) const {
@@ -135,13 +145,13 @@ Item* Inventory::FindItemById(const LWOOBJID id) const {
 Item* Inventory::FindItemByLot(const LOT lot, const bool ignoreEquipped, const bool ignoreBound) const {
 	Item* smallest = nullptr;
 
-	for (const auto& pair : items) {
-		auto* item = pair.second;
+	const auto& index = itemsByLot.find(lot);
 
-		if (item->GetLot() != lot) {
-			continue;
-		}
+	if (index == itemsByLot.end()) {
+		return smallest;
+	}
 
+	for (auto* item : index->second) {
 		if (ignoreEquipped && item->IsEquipped()) {
 			continue;
 		}
@@ -156,7 +166,8 @@ Item* Inventory::FindItemByLot(const LOT lot, const bool ignoreEquipped, const b
 			continue;
 		}
 
-		if (smallest->GetCount() > item->GetCount()) {
+		// Ties go to the lowest object ID, which is the order the items map is sorted in.
+		if (smallest->GetCount() > item->GetCount() || (smallest->GetCount() == item->GetCount() && item->GetId() < smallest->GetId())) {
 			smallest = item;
 		}
 	}
@@ -165,15 +176,11 @@ Item* Inventory::FindItemByLot(const LOT lot, const bool ignoreEquipped, const b
 }
 
 Item* Inventory::FindItemBySlot(const uint32_t slot) const {
-	const auto slots = GetSlots();
-
-	const auto index = slots.find(slot);
-
-	if (index == slots.end()) {
+	if (slot >= slots.size()) {
 		return nullptr;
 	}
 
-	return index->second;
+	return slots[slot];
 }
 
 Item* Inventory::FindItemBySubKey(LWOOBJID id) const {
@@ -195,11 +202,9 @@ void Inventory::AddManagedItem(Item* item) {
 		return;
 	}
 
-	const auto slots = GetSlots();
-
 	const auto slot = item->GetSlot();
 
-	if (slots.find(slot) != slots.end()) {
+	if (FindItemBySlot(slot) != nullptr) {
 		Game::logger->Log("Inventory", "Attempting to add an item with an already present slot (%i)!", slot);
 
 		return;
@@ -207,6 +212,10 @@ void Inventory::AddManagedItem(Item* item) {
 
 	items.insert_or_assign(id, item);
 
+	SetSlotItem(slot, item);
+
+	itemsByLot[item->GetLot()].push_back(item);
+
 	free--;
 }
 
@@ -221,9 +230,54 @@ void Inventory::RemoveManagedItem(Item* item) {
 
 	items.erase(id);
 
+	if (FindItemBySlot(item->GetSlot()) == item) {
+		SetSlotItem(item->GetSlot(), nullptr);
+	}
+
+	const auto& index = itemsByLot.find(item->GetLot());
+
+	if (index != itemsByLot.end()) {
+		auto& lotItems = index->second;
+
+		lotItems.erase(std::remove(lotItems.begin(), lotItems.end(), item), lotItems.end());
+
+		if (lotItems.empty()) {
+			itemsByLot.erase(index);
+		}
+	}
+
 	free++;
 }
 
+void Inventory::SwapSlots(const uint32_t first, const uint32_t second) {
+	auto* firstItem = FindItemBySlot(first);
+	auto* secondItem = FindItemBySlot(second);
+
+	SetSlotItem(first, secondItem);
+	SetSlotItem(second, firstItem);
+}
+
+void Inventory::SetSlotItem(const uint32_t slot, Item* item) {
+	if (slot >= slots.size()) {
+		if (item == nullptr) {
+			return;
+		}
+
+		slots.resize(std::max<size_t>(slot + 1, size), nullptr);
+		occupiedSlots.resize((slots.size() + 63) / 64, 0);
+	}
+
+	slots[slot] = item;
+
+	const auto bit = 1ULL << (slot % 64);
+
+	if (item != nullptr) {
+		occupiedSlots[slot / 64] |= bit;
+	} else {
+		occupiedSlots[slot / 64] &= ~bit;
+	}
+}
+
 eInventoryType Inventory::FindInventoryTypeForLot(const LOT lot) {
 	auto itemComponent = FindItemComponent(lot);
 
@@ -4,6 +4,7 @@
 #define INVENTORY_H
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 
@@ -125,6 +126,13 @@ public:
 	 */
 	void RemoveManagedItem(Item* item);
 
+	/**
+	 * Swaps the contents of two slots in the slot index, used when an item is moved
+	 * @param first the first slot
+	 * @param second the second slot
+	 */
+	void SwapSlots(uint32_t first, uint32_t second);
+
 	/**
 	 * Returns the inventory type an item of the specified lot should be placed in
 	 * @param lot the lot to find the inventory type for
@@ -175,6 +183,21 @@ private:
 	 */
 	std::map<LWOOBJID, Item*> items;
 
+	/**
+	 * The items stored in this inventory, indexed by slot.  Empty slots are nullptr.
+	 */
+	std::vector<Item*> slots;
+
+	/**
+	 * Bitmap of the slots that contain an item, 64 slots per word
+	 */
+	std::vector<uint64_t> occupiedSlots;
+
+	/**
+	 * The items stored in this inventory, grouped by LOT
+	 */
+	std::unordered_map<LOT, std::vector<Item*>> itemsByLot;
+
 	/**
 	 * The inventory component this inventory belongs to
 	 */
@@ -184,6 +207,13 @@ private:
 	 * List of items that are GM restricted
 	 */
 	static std::vector<LOT> m_GameMasterRestrictedItems;
+
+	/**
+	 * Stores an item in the slot index, growing the index if needed
+	 * @param slot the slot to store the item in
+	 * @param item the item to store, or nullptr to empty the slot
+	 */
+	void SetSlotItem(uint32_t slot, Item* item);
 };
 
 #endif
@@ -32,7 +32,7 @@ Item::Item(const LWOOBJID id, const LOT lot, Inventory* inventory, const uint32_
 	this->config = config;
 	this->parent = parent;
 	this->info = &Inventory::FindItemComponent(lot);
-	this->preconditions = new PreconditionExpression(this->info->reqPrecondition);
+	this->preconditions = Preconditions::GetExpression(this->info->reqPrecondition);
 	this->subKey = subKey;
 
 	inventory->AddManagedItem(this);
@@ -67,7 +67,7 @@ Item::Item(
 	this->id = LWOOBJID_EMPTY;
 	this->info = &Inventory::FindItemComponent(lot);
 	this->bound = info->isBOP || bound;
-	this->preconditions = new PreconditionExpression(this->info->reqPrecondition);
+	this->preconditions = Preconditions::GetExpression(this->info->reqPrecondition);
 	this->subKey = subKey;
 
 	LWOOBJID id = ObjectIDManager::GenerateRandomObjectID();
@@ -137,7 +137,7 @@ LWOOBJID Item::GetSubKey() const {
 	return subKey;
 }
 
-PreconditionExpression* Item::GetPreconditionExpression() const {
+const PreconditionExpression* Item::GetPreconditionExpression() const {
 	return preconditions;
 }
 
@@ -180,14 +180,14 @@ void Item::SetSlot(const uint32_t value) {
 		return;
 	}
 
-	for (const auto& pair : inventory->GetItems()) {
-		auto* item = pair.second;
+	auto* occupant = inventory->FindItemBySlot(value);
 
-		if (item->slot == value) {
-			item->slot = slot;
-		}
+	if (occupant != nullptr) {
+		occupant->slot = slot;
 	}
 
+	inventory->SwapSlots(slot, value);
+
 	slot = value;
 }
 
@@ -470,8 +470,6 @@ void Item::RemoveFromInventory() {
 }
 
 Item::~Item() {
-	delete preconditions;
-
 	for (auto* value : config) {
 		delete value;
 	}
@@ -166,7 +166,7 @@ public:
 	 * Returns the preconditions that must be met before this item may be used
 	 * @return the preconditions that must be met before this item may be used
 	 */
-	PreconditionExpression* GetPreconditionExpression() const;
+	const PreconditionExpression* GetPreconditionExpression() const;
 
 	/**
 	 * Equips this item into the linked inventory
@@ -266,5 +266,5 @@ private:
 	/**
 	 * A precondition to using this item
 	 */
-	PreconditionExpression* preconditions = nullptr;
+	const PreconditionExpression* preconditions = nullptr;
 };
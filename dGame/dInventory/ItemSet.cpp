@@ -3,98 +3,113 @@
 #include "InventoryComponent.h"
 #include "Entity.h"
 #include "SkillComponent.h"
-#include "CDClientDatabase.h"
+#include "CDClientManager.h"
 #include "Game.h"
 #include "MissionComponent.h"
 #include <algorithm>
 
+std::unordered_map<uint32_t, ItemSet::ItemSetDefinition> ItemSet::m_Definitions{};
+std::unordered_map<LOT, std::vector<uint32_t>> ItemSet::m_ItemSetsByLot{};
+bool ItemSet::m_DefinitionsLoaded = false;
+
 ItemSet::ItemSet(const uint32_t id, InventoryComponent* inventoryComponent) {
 	this->m_ID = id;
 	this->m_InventoryComponent = inventoryComponent;
 
 	this->m_PassiveAbilities = ItemSetPassiveAbility::FindAbilities(id, m_InventoryComponent->GetParent(), this);
 
-	auto query = CDClientDatabase::CreatePreppedStmt(
-		"SELECT skillSetWith2, skillSetWith3, skillSetWith4, skillSetWith5, skillSetWith6, itemIDs FROM ItemSets WHERE setID = ?;");
-	query.bind(1, (int)id);
+	LoadDefinitions();
 
-	auto result = query.execQuery();
+	const auto definition = m_Definitions.find(id);
 
-	if (result.eof()) {
+	if (definition == m_Definitions.end()) {
 		return;
 	}
 
-	for (auto i = 0; i < 5; ++i) {
-		if (result.fieldIsNull(i)) {
-			continue;
-		}
+	m_Items = definition->second.items;
+	m_SkillsWith2 = definition->second.skillSets[0];
+	m_SkillsWith3 = definition->second.skillSets[1];
+	m_SkillsWith4 = definition->second.skillSets[2];
+	m_SkillsWith5 = definition->second.skillSets[3];
+	m_SkillsWith6 = definition->second.skillSets[4];
 
-		auto skillQuery = CDClientDatabase::CreatePreppedStmt(
-			"SELECT SkillID FROM ItemSetSkills WHERE SkillSetID = ?;");
-		skillQuery.bind(1, result.getIntField(i));
-
-		auto skillResult = skillQuery.execQuery();
+	m_Equipped = {};
 
-		if (skillResult.eof()) {
-			return;
+	for (const auto item : m_Items) {
+		if (inventoryComponent->IsEquipped(item)) {
+			m_Equipped.push_back(item);
 		}
+	}
+}
 
-		while (!skillResult.eof()) {
-			if (skillResult.fieldIsNull(0)) {
-				skillResult.nextRow();
+const std::vector<uint32_t>& ItemSet::FindItemSets(const LOT lot) {
+	static const std::vector<uint32_t> none{};
 
-				continue;
-			}
+	LoadDefinitions();
 
-			const auto skillId = skillResult.getIntField(0);
-
-			switch (i) {
-			case 0:
-				m_SkillsWith2.push_back(skillId);
-				break;
-			case 1:
-				m_SkillsWith3.push_back(skillId);
-				break;
-			case 2:
-				m_SkillsWith4.push_back(skillId);
-				break;
-			case 3:
-				m_SkillsWith5.push_back(skillId);
-				break;
-			case 4:
-				m_SkillsWith6.push_back(skillId);
-				break;
-			default:
-				break;
-			}
+	const auto index = m_ItemSetsByLot.find(lot);
 
-			skillResult.nextRow();
-		}
+	if (index == m_ItemSetsByLot.end()) {
+		return none;
 	}
 
-	std::string ids = result.getStringField(5);
+	return index->second;
+}
 
-	ids.erase(std::remove_if(ids.begin(), ids.end(), ::isspace), ids.end());
+void ItemSet::LoadDefinitions() {
+	if (m_DefinitionsLoaded) {
+		return;
+	}
 
-	std::istringstream stream(ids);
-	std::string token;
+	m_DefinitionsLoaded = true;
 
-	result.finalize();
+	auto* itemSetsTable = CDClientManager::Instance()->GetTable<CDItemSetsTable>("ItemSets");
+	auto* itemSetSkillsTable = CDClientManager::Instance()->GetTable<CDItemSetSkillsTable>("ItemSetSkills");
 
-	m_Items = {};
+	std::unordered_map<uint32_t, std::vector<uint32_t>> skillsBySkillSet;
 
-	while (std::getline(stream, token, ',')) {
-		int32_t value;
-		if (GeneralUtils::TryParse(token, value)) {
-			m_Items.push_back(value);
+	for (const auto& entry : itemSetSkillsTable->GetEntries()) {
+		// Null skills are read as -1
+		if (entry.SkillID == static_cast<unsigned int>(-1)) {
+			continue;
 		}
+
+		skillsBySkillSet[entry.SkillSetID].push_back(entry.SkillID);
 	}
 
-	m_Equipped = {};
+	for (const auto& entry : itemSetsTable->GetEntries()) {
+		auto& definition = m_Definitions[entry.setID];
 
-	for (const auto item : m_Items) {
-		if (inventoryComponent->IsEquipped(item)) {
-			m_Equipped.push_back(item);
+		const unsigned int skillSetIds[] = { entry.skillSetWith2, entry.skillSetWith3, entry.skillSetWith4, entry.skillSetWith5, entry.skillSetWith6 };
+
+		for (auto i = 0; i < 5; ++i) {
+			const auto skills = skillsBySkillSet.find(skillSetIds[i]);
+
+			if (skills != skillsBySkillSet.end()) {
+				definition.skillSets[i] = skills->second;
+			}
+		}
+
+		std::string ids = entry.itemIDs;
+
+		ids.erase(std::remove_if(ids.begin(), ids.end(), ::isspace), ids.end());
+
+		std::istringstream stream(ids);
+		std::string token;
+
+		while (std::getline(stream, token, ',')) {
+			int32_t value;
+			if (!GeneralUtils::TryParse(token, value)) {
+				continue;
+			}
+
+			definition.items.push_back(value);
+
+			auto& sets = m_ItemSetsByLot[value];
+
+			if (std::find(sets.begin(), sets.end(), entry.setID) == sets.end()) {
+				sets.push_back(entry.setID);
+			}
 		}
 	}
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <unordered_map>
 #include <vector>
 
 #include "dCommonVars.h"
@@ -61,7 +62,37 @@ public:
 	 */
 	std::vector<uint32_t> GetSkillSet(uint32_t itemCount) const;
 
+	/**
+	 * Returns the IDs of the item sets that contain an item
+	 * @param lot the LOT of the item
+	 * @return the IDs of the item sets that contain the item
+	 */
+	static const std::vector<uint32_t>& FindItemSets(LOT lot);
+
 private:
+	/**
+	 * The items and skills of an item set, shared by every inventory using the set
+	 */
+	struct ItemSetDefinition {
+		std::vector<LOT> items;
+
+		/**
+		 * The skills for 2 up to 6 items equipped
+		 */
+		std::vector<uint32_t> skillSets[5];
+	};
+
+	/**
+	 * Reads every item set from the CDClient once and indexes them by their items
+	 */
+	static void LoadDefinitions();
+
+	static std::unordered_map<uint32_t, ItemSetDefinition> m_Definitions;
+
+	static std::unordered_map<LOT, std::vector<uint32_t>> m_ItemSetsByLot;
+
+	static bool m_DefinitionsLoaded;
+
 	/**
 	 * The ID of this skill set
 	 */
@@ -0,0 +1,131 @@
+#include "BehaviorProgram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "ModelBehavior.h"
+#include "Game.h"
+#include "dLogger.h"
+
+namespace {
+	// The axis is constructed here rather than taken from NiPoint3's constants, which may not be initialized yet
+	struct ActionDefinition {
+		eBehaviorOp op;
+		NiPoint3 axis;
+	};
+
+	const std::unordered_map<std::string, eBehaviorTrigger> triggers = {
+		{ "OnInteract", eBehaviorTrigger::INTERACT },
+		{ "OnAttack", eBehaviorTrigger::ATTACK },
+		{ "OnChat", eBehaviorTrigger::CHAT }
+	};
+
+	const std::unordered_map<std::string, ActionDefinition> actions = {
+		{ "MoveRight", { eBehaviorOp::MOVE, NiPoint3(1.0f, 0.0f, 0.0f) } },
+		{ "MoveLeft", { eBehaviorOp::MOVE, NiPoint3(-1.0f, 0.0f, 0.0f) } },
+		{ "FlyUp", { eBehaviorOp::MOVE, NiPoint3(0.0f, 1.0f, 0.0f) } },
+		{ "FlyDown", { eBehaviorOp::MOVE, NiPoint3(0.0f, -1.0f, 0.0f) } },
+		{ "MoveForward", { eBehaviorOp::MOVE, NiPoint3(0.0f, 0.0f, 1.0f) } },
+		{ "MoveBackward", { eBehaviorOp::MOVE, NiPoint3(0.0f, 0.0f, -1.0f) } },
+		{ "Spin", { eBehaviorOp::ROTATE, NiPoint3(0.0f, 1.0f, 0.0f) } },
+		{ "Tilt", { eBehaviorOp::ROTATE, NiPoint3(1.0f, 0.0f, 0.0f) } },
+		{ "Roll", { eBehaviorOp::ROTATE, NiPoint3(0.0f, 0.0f, 1.0f) } },
+		{ "Wait", { eBehaviorOp::WAIT, NiPoint3() } },
+		{ "Smash", { eBehaviorOp::SMASH, NiPoint3() } },
+		{ "UnSmash", { eBehaviorOp::UNSMASH, NiPoint3() } },
+		{ "Chat", { eBehaviorOp::CHAT, NiPoint3() } },
+		{ "SetState", { eBehaviorOp::SET_STATE, NiPoint3() } },
+		{ "Restart", { eBehaviorOp::RESTART, NiPoint3() } }
+	};
+
+	bool StripOrder(const CompiledStrip& a, const CompiledStrip& b) {
+		if (a.state != b.state) return a.state < b.state;
+		return a.trigger < b.trigger;
+	}
+}
+
+BehaviorProgram BehaviorProgram::Compile(const ModelBehavior& behavior) {
+	BehaviorProgram program;
+
+	for (const auto& [stateID, strips] : behavior.GetStates()) {
+		for (const auto& [stripID, strip] : strips) {
+			if (strip.actions.empty()) continue;
+
+			// Strips only run when their first block is a trigger
+			const auto& first = strip.actions.front();
+			const auto trigger = triggers.find(first.type);
+
+			if (trigger == triggers.end()) continue;
+
+			CompiledStrip compiled{};
+			compiled.state = stateID;
+			compiled.trigger = trigger->second;
+			compiled.text = program.AddString(first.parameterValueString);
+			compiled.firstInstruction = static_cast<uint32_t>(program.m_Instructions.size());
+
+			for (size_t i = 1; i < strip.actions.size(); i++) {
+				const auto& action = strip.actions[i];
+				const auto definition = actions.find(action.type);
+
+				if (definition == actions.end()) {
+					Game::logger->Log("BehaviorProgram", "Skipping unknown action (%s) in behavior (%i)", action.type.c_str(), behavior.GetBehaviorID());
+					continue;
+				}
+
+				BehaviorInstruction instruction{};
+				instruction.op = definition->second.op;
+
+				const auto parameter = static_cast<float>(action.parameterValueDouble);
+
+				switch (instruction.op) {
+				case eBehaviorOp::MOVE:
+					instruction.vector = definition->second.axis * parameter;
+					instruction.value = std::abs(parameter) / MOVE_SPEED;
+					break;
+				case eBehaviorOp::ROTATE:
+					instruction.vector = definition->second.axis * (parameter * 3.14159265f / 180.0f);
+					instruction.value = std::abs(parameter) / ROTATE_SPEED;
+					break;
+				case eBehaviorOp::WAIT:
+				case eBehaviorOp::SET_STATE:
+					instruction.value = parameter;
+					break;
+				case eBehaviorOp::CHAT:
+					instruction.text = program.AddString(action.parameterValueString);
+					break;
+				default:
+					break;
+				}
+
+				program.m_Instructions.push_back(instruction);
+			}
+
+			compiled.instructionCount = static_cast<uint32_t>(program.m_Instructions.size()) - compiled.firstInstruction;
+
+			program.m_Strips.push_back(compiled);
+		}
+	}
+
+	std::stable_sort(program.m_Strips.begin(), program.m_Strips.end(), StripOrder);
+
+	return program;
+}
+
+std::pair<uint32_t, uint32_t> BehaviorProgram::FindStrips(const BEHAVIORSTATE state, const eBehaviorTrigger trigger) const {
+	CompiledStrip key{};
+	key.state = state;
+	key.trigger = trigger;
+
+	const auto range = std::equal_range(m_Strips.begin(), m_Strips.end(), key, StripOrder);
+
+	return { static_cast<uint32_t>(range.first - m_Strips.begin()), static_cast<uint32_t>(range.second - m_Strips.begin()) };
+}
+
+uint32_t BehaviorProgram::AddString(const std::string& value) {
+	if (value.empty()) return 0;
+
+	m_Strings.push_back(value);
+
+	return static_cast<uint32_t>(m_Strings.size() - 1);
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#ifndef __BEHAVIORPROGRAM__H__
+#define __BEHAVIORPROGRAM__H__
+
+#include <string>
+#include <vector>
+
+#include "dCommonVars.h"
+#include "NiPoint3.h"
+
+class ModelBehavior;
+
+/**
+ * The events that start a strip, set by the first block of the strip
+ */
+enum class eBehaviorTrigger : uint8_t {
+	NONE,
+	INTERACT,
+	ATTACK,
+	CHAT
+};
+
+enum class eBehaviorOp : uint8_t {
+	MOVE,
+	ROTATE,
+	WAIT,
+	SMASH,
+	UNSMASH,
+	CHAT,
+	SET_STATE,
+	RESTART
+};
+
+/**
+ * A single action of a compiled strip
+ */
+struct BehaviorInstruction {
+	eBehaviorOp op;
+
+	/**
+	 * The offset to move by, or the euler angles in radians to rotate by
+	 */
+	NiPoint3 vector;
+
+	/**
+	 * The number of seconds the action takes, or the state to switch to
+	 */
+	float value = 0.0f;
+
+	/**
+	 * Index of the message of the action in the strings of the program
+	 */
+	uint32_t text = 0;
+};
+
+/**
+ * A strip of a behavior, its actions are stored back to back in the instructions of the program
+ */
+struct CompiledStrip {
+	BEHAVIORSTATE state;
+	eBehaviorTrigger trigger;
+
+	/**
+	 * Index of the message a chat trigger waits for in the strings of the program
+	 */
+	uint32_t text;
+
+	uint32_t firstInstruction;
+	uint32_t instructionCount;
+};
+
+/**
+ * The states and strips of a model behavior compiled into a flat list of instructions, with the strips sorted
+ * by the state and trigger they run on so an event only touches the strips it starts.
+ */
+class BehaviorProgram {
+public:
+	/**
+	 * The speed models move at in units per second
+	 */
+	static constexpr float MOVE_SPEED = 4.0f;
+
+	/**
+	 * The speed models rotate at in degrees per second
+	 */
+	static constexpr float ROTATE_SPEED = 90.0f;
+
+	/**
+	 * Compiles the states and strips of a behavior, strips without a trigger and unknown actions are left out
+	 * @param behavior the behavior to compile
+	 * @return the compiled behavior
+	 */
+	static BehaviorProgram Compile(const ModelBehavior& behavior);
+
+	/**
+	 * Returns the range of strips that start on a trigger in a state
+	 * @param state the state the behavior is in
+	 * @param trigger the trigger that happened
+	 * @return the first and one past the last index of the strips that start
+	 */
+	std::pair<uint32_t, uint32_t> FindStrips(BEHAVIORSTATE state, eBehaviorTrigger trigger) const;
+
+	const std::vector<CompiledStrip>& GetStrips() const { return m_Strips; }
+
+	const BehaviorInstruction& GetInstruction(uint32_t index) const { return m_Instructions[index]; }
+
+	size_t GetInstructionCount() const { return m_Instructions.size(); }
+
+	const std::string& GetString(uint32_t index) const { return m_Strings[index]; }
+
+private:
+	/**
+	 * Adds a string to the program, index 0 is always the empty string
+	 */
+	uint32_t AddString(const std::string& value);
+
+	std::vector<CompiledStrip> m_Strips;
+
+	std::vector<BehaviorInstruction> m_Instructions;
+
+	std::vector<std::string> m_Strings = { "" };
+};
+
+#endif  //!__BEHAVIORPROGRAM__H__
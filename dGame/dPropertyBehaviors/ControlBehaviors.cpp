@@ -5,15 +5,22 @@
 #include "Game.h"
 #include "GameMessages.h"
 #include "ModelComponent.h"
+#include "ModelBehavior.h"
+#include "PropertyManagementComponent.h"
+#include "EntityManager.h"
 #include "../../dWorldServer/ObjectIDManager.h"
 #include "dLogger.h"
 
-uint32_t GetBehaviorIDFromArgument(AMFArrayValue* arguments, const std::string& key = "BehaviorID") {
+/**
+ * Returns the behavior ID of a command, -1 if the behavior is new and has no ID yet. The IDs are signed like the
+ * ones ModelBehavior and the database use.
+ */
+int32_t GetBehaviorIDFromArgument(AMFArrayValue* arguments, const std::string& key = "BehaviorID") {
 	auto* behaviorIDValue = arguments->FindValue<AMFStringValue>(key);
-	uint32_t behaviorID = -1;
+	int32_t behaviorID = -1;
 
 	if (behaviorIDValue) {
-		behaviorID = std::stoul(behaviorIDValue->GetStringValue());
+		behaviorID = static_cast<int32_t>(std::stoul(behaviorIDValue->GetStringValue()));
 	} else if (arguments->FindValue<AMFUndefinedValue>(key) == nullptr){
 		throw std::invalid_argument("Unable to find behavior ID from argument \"" + key + "\"");
 	}
@@ -39,30 +46,48 @@ STRIPID GetStripIDFromArgument(AMFArrayValue* arguments, const std::string& key
 	return stripID;
 }
 
-void RequestUpdatedID(int32_t behaviorID, ModelComponent* modelComponent, Entity* modelOwner, const SystemAddress& sysAddr) {
-	// auto behavior = modelComponent->FindBehavior(behaviorID);
-	// if (behavior->GetBehaviorID() == -1 || behavior->GetShouldSetNewID()) {
-	// 	ObjectIDManager::Instance()->RequestPersistentID(
-	// 		[behaviorID, behavior, modelComponent, modelOwner, sysAddr](uint32_t persistentId) {
-	// 		behavior->SetShouldGetNewID(false);
-	// 		behavior->SetIsTemplated(false);
-	// 		behavior->SetBehaviorID(persistentId);
-
-	// 		// This updates the behavior ID of the behavior should this be a new behavior
-	// 		AMFArrayValue args;
-
-	// 		AMFStringValue* behaviorIDString = new AMFStringValue();
-	// 		behaviorIDString->SetStringValue(std::to_string(persistentId));
-	// 		args.InsertValue("behaviorID", behaviorIDString);
-
-	// 		AMFStringValue* objectIDAsString = new AMFStringValue();
-	// 		objectIDAsString->SetStringValue(std::to_string(modelComponent->GetParent()->GetObjectID()));
-	// 		args.InsertValue("objectID", objectIDAsString);
-
-	// 		GameMessages::SendUIMessageServerToSingleClient(modelOwner, sysAddr, "UpdateBehaviorID", &args);
-	// 		ControlBehaviors::SendBehaviorListToClient(modelComponent->GetParent(), sysAddr, modelOwner);
-	// 	});
-	// }
+BehaviorAction GetActionFromArgument(AMFArrayValue* actionAsArray) {
+	BehaviorAction action;
+
+	for (auto& typeValueMap : actionAsArray->GetAssociativeMap()) {
+		if (typeValueMap.first == "Type") {
+			if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
+			action.type = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
+		} else {
+			action.parameterName = typeValueMap.first;
+			// Message is the only known string parameter
+			if (action.parameterName == "Message") {
+				if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
+				action.parameterValueString = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
+			} else {
+				if (typeValueMap.second->GetValueType() != AMFValueType::AMFDouble) continue;
+				action.parameterValueDouble = static_cast<AMFDoubleValue*>(typeValueMap.second)->GetDoubleValue();
+			}
+		}
+	}
+
+	return action;
+}
+
+/**
+ * Returns the behavior a command edits. A behavior without an ID is one the player just started in the editor, and a
+ * template on the model becomes a behavior on its first edit. Both are added to the model and get their own ID from
+ * RequestUpdatedID.
+ */
+ModelBehavior* GetBehaviorToEdit(ModelComponent* modelComponent, int32_t behaviorID) {
+	auto* behavior = modelComponent->FindBehavior(behaviorID);
+
+	if (behavior) return behavior;
+
+	const auto isTemplate = behaviorID != -1;
+
+	if (isTemplate && !modelComponent->RemoveTemplate(behaviorID)) return nullptr;
+
+	behavior = new ModelBehavior(behaviorID, isTemplate);
+
+	if (!modelComponent->AddBehavior(behavior, modelComponent->GetBehaviors().size())) return nullptr;
+
+	return behavior;
 }
 
 void SendBehaviorListToClient(
@@ -76,7 +101,7 @@ void SendBehaviorListToClient(
 
 	AMFArrayValue behaviorsToSerialize;
 
-	AMFArrayValue* behaviors = new AMFArrayValue(); // Empty for now
+	AMFArrayValue* behaviors = new AMFArrayValue();
 
 	/**
 	 * The behaviors AMFArray will have up to 5 elements in the dense portion.
@@ -87,6 +112,41 @@ void SendBehaviorListToClient(
 	 * "isLoot": AMFTrue or AMFFalse of whether or not the behavior is a custom behavior (true if custom)
 	 * "name": The name of the behavior formatted as an AMFString
 	 */
+	for (auto* behavior : modelComponent->GetBehaviors()) {
+		AMFArrayValue* behaviorInfo = new AMFArrayValue();
+
+		AMFStringValue* id = new AMFStringValue();
+		id->SetStringValue(std::to_string(behavior->GetBehaviorID()));
+		behaviorInfo->InsertValue("id", id);
+
+		behaviorInfo->InsertValue("isLocked", new AMFFalseValue());
+
+		if (behavior->GetIsTemplated()) {
+			behaviorInfo->InsertValue("isLoot", new AMFFalseValue());
+		} else {
+			behaviorInfo->InsertValue("isLoot", new AMFTrueValue());
+		}
+
+		AMFStringValue* name = new AMFStringValue();
+		name->SetStringValue(behavior->GetName());
+		behaviorInfo->InsertValue("name", name);
+
+		behaviors->PushBackValue(behaviorInfo);
+	}
+
+	// Templates that haven't been edited are listed by their ID, the client knows their names
+	for (const auto templateID : modelComponent->GetTemplates()) {
+		AMFArrayValue* behaviorInfo = new AMFArrayValue();
+
+		AMFStringValue* id = new AMFStringValue();
+		id->SetStringValue(std::to_string(templateID));
+		behaviorInfo->InsertValue("id", id);
+
+		behaviorInfo->InsertValue("isLocked", new AMFFalseValue());
+		behaviorInfo->InsertValue("isLoot", new AMFFalseValue());
+
+		behaviors->PushBackValue(behaviorInfo);
+	}
 
 	behaviorsToSerialize.InsertValue("behaviors", behaviors);
 
@@ -97,6 +157,45 @@ void SendBehaviorListToClient(
 	GameMessages::SendUIMessageServerToSingleClient(modelOwner, sysAddr, "UpdateBehaviorList", &behaviorsToSerialize);
 }
 
+void RequestUpdatedID(int32_t behaviorID, ModelComponent* modelComponent, Entity* modelOwner, const SystemAddress& sysAddr) {
+	auto* behavior = modelComponent->FindBehavior(behaviorID);
+	if (!behavior || (behavior->GetBehaviorID() != -1 && !behavior->GetIsTemplated())) return;
+
+	// The model may be gone by the time the ID arrives
+	const auto modelID = modelComponent->GetParent()->GetObjectID();
+	const auto modelOwnerID = modelOwner->GetObjectID();
+
+	ObjectIDManager::Instance()->RequestPersistentID(
+		[behaviorID, modelID, modelOwnerID, sysAddr](uint32_t persistentId) {
+		auto* modelEntity = EntityManager::Instance()->GetEntity(modelID);
+		auto* modelOwner = EntityManager::Instance()->GetEntity(modelOwnerID);
+		if (!modelEntity || !modelOwner) return;
+
+		auto* modelComponent = modelEntity->GetComponent<ModelComponent>();
+		if (!modelComponent) return;
+
+		auto* behavior = modelComponent->FindBehavior(behaviorID);
+		if (!behavior) return;
+
+		behavior->SetIsTemplated(false);
+		behavior->SetBehaviorID(persistentId);
+
+		// This updates the behavior ID of the behavior should this be a new behavior
+		AMFArrayValue args;
+
+		AMFStringValue* behaviorIDString = new AMFStringValue();
+		behaviorIDString->SetStringValue(std::to_string(persistentId));
+		args.InsertValue("behaviorID", behaviorIDString);
+
+		AMFStringValue* objectIDAsString = new AMFStringValue();
+		objectIDAsString->SetStringValue(std::to_string(modelID));
+		args.InsertValue("objectID", objectIDAsString);
+
+		GameMessages::SendUIMessageServerToSingleClient(modelOwner, sysAddr, "UpdateBehaviorID", &args);
+		SendBehaviorListToClient(modelEntity, sysAddr, modelOwner);
+	});
+}
+
 void ModelTypeChanged(AMFArrayValue* arguments, ModelComponent* ModelComponent) {
 	auto* modelTypeAmf = arguments->FindValue<AMFDoubleValue>("ModelType");
 	if (!modelTypeAmf) return;
@@ -110,7 +209,7 @@ void ToggleExecutionUpdates() {
 	//TODO do something with this info
 }
 
-void AddStrip(AMFArrayValue* arguments) {
+void AddStrip(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	auto* strip = arguments->FindValue<AMFArrayValue>("strip");
 	if (!strip) return;
 
@@ -134,55 +233,40 @@ void AddStrip(AMFArrayValue* arguments) {
 
 	BEHAVIORSTATE stateID = GetBehaviorStateFromArgument(arguments);
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
-	std::string type = "";
-	std::string valueParameterName = "";
-	std::string valueParameterString = "";
-	double valueParameterDouble = 0.0;
+	std::vector<BehaviorAction> stripActions;
 	for (uint32_t position = 0; position < actions->GetDenseValueSize(); position++) {
 		auto* actionAsArray = actions->GetValueAt<AMFArrayValue>(position);
 		if (!actionAsArray) continue;
 
-		for (auto& typeValueMap : actionAsArray->GetAssociativeMap()) {
-			if (typeValueMap.first == "Type") {
-				if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
-
-				type = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
-			} else {
-				valueParameterName = typeValueMap.first;
-				// Message is the only known string parameter
-				if (valueParameterName == "Message") {
-					if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
-					valueParameterString = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
-				} else {
-					if (typeValueMap.second->GetValueType() != AMFValueType::AMFDouble) continue;
-					valueParameterDouble = static_cast<AMFDoubleValue*>(typeValueMap.second)->GetDoubleValue();
-				}
-			}
-		}
-		// modelComponent->AddStrip(stateID, stripID, type, behaviorID, valueParameterName, valueParameterString, valueParameterDouble, "", xPosition, yPosition);
-		type.clear();
-		valueParameterName.clear();
-		valueParameterString.clear();
-		valueParameterDouble = 0.0;
+		stripActions.push_back(GetActionFromArgument(actionAsArray));
 	}
-	// RequestUpdatedID(behaviorID);
+
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
+
+	behavior->AddStrip(stateID, stripID, stripActions, xPosition, yPosition);
+
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void RemoveStrip(AMFArrayValue* arguments) {
+void RemoveStrip(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	STRIPID stripID = GetStripIDFromArgument(arguments);
 
 	BEHAVIORSTATE stateID = GetBehaviorStateFromArgument(arguments);
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// modelComponent->RemoveStrip(stateID, stripID, behaviorID);
+	behavior->RemoveStrip(stateID, stripID);
 
-	// RequestUpdatedID(behaviorID);
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void MergeStrips(AMFArrayValue* arguments) {
+void MergeStrips(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	STRIPID srcStripID = GetStripIDFromArgument(arguments, "srcStripID");
 
 	BEHAVIORSTATE dstStateID = GetBehaviorStateFromArgument(arguments, "dstStateID");
@@ -196,14 +280,17 @@ void MergeStrips(AMFArrayValue* arguments) {
 
 	STRIPID dstStripID = GetStripIDFromArgument(arguments, "dstStripID");
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
-	// modelComponent->MergeStrips(srcStripID, dstStripID, srcStateID, dstStateID, behaviorID, dstActionIndex);
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// RequestUpdatedID(behaviorID);
+	behavior->MergeStrips(srcStripID, srcStateID, dstStripID, dstStateID, dstActionIndex);
+
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void SplitStrip(AMFArrayValue* arguments) {
+void SplitStrip(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	auto* srcActionIndexValue = arguments->FindValue<AMFDoubleValue>("srcActionIndex");
 	if (!srcActionIndexValue) return;
 
@@ -228,14 +315,17 @@ void SplitStrip(AMFArrayValue* arguments) {
 	double yPosition = yPositionValue->GetDoubleValue();
 	double xPosition = xPositionValue->GetDoubleValue();
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// modelComponent->SplitStrip(srcActionIndex, srcStripID, srcStateID, dstStripID, dstStateID, behaviorID, yPosition, xPosition);
+	behavior->SplitStrip(srcActionIndex, srcStripID, srcStateID, dstStripID, dstStateID, xPosition, yPosition);
 
-	// RequestUpdatedID(behaviorID);
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void UpdateStripUI(AMFArrayValue* arguments) {
+void UpdateStripUI(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	auto* uiArray = arguments->FindValue<AMFArrayValue>("ui");
 	if (!uiArray) return;
 
@@ -250,14 +340,17 @@ void UpdateStripUI(AMFArrayValue* arguments) {
 
 	BEHAVIORSTATE stateID = GetBehaviorStateFromArgument(arguments);
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
-	// modelComponent->UpdateUIOfStrip(stateID, stripID, xPosition, yPosition, behaviorID);
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// RequestUpdatedID(behaviorID);
+	behavior->UpdateStripUI(stateID, stripID, xPosition, yPosition);
+
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void AddAction(AMFArrayValue* arguments) {
+void AddAction(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	auto* actionIndexAmf = arguments->FindValue<AMFDoubleValue>("actionIndex");
 	if (!actionIndexAmf) return;
 
@@ -267,38 +360,20 @@ void AddAction(AMFArrayValue* arguments) {
 
 	BEHAVIORSTATE stateID = GetBehaviorStateFromArgument(arguments);
 
-	std::string type = "";
-	std::string valueParameterName = "";
-	std::string valueParameterString = "";
-	double valueParameterDouble = 0.0;
 	auto* action = arguments->FindValue<AMFArrayValue>("action");
 	if (!action) return;
 
-	for (auto& typeValueMap : action->GetAssociativeMap()) {
-		if (typeValueMap.first == "Type") {
-			if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
-			type = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
-		} else {
-			valueParameterName = typeValueMap.first;
-			// Message is the only known string parameter
-			if (valueParameterName == "Message") {
-				if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
-				valueParameterString = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
-			} else {
-				if (typeValueMap.second->GetValueType() != AMFValueType::AMFDouble) continue;
-				valueParameterDouble = static_cast<AMFDoubleValue*>(typeValueMap.second)->GetDoubleValue();
-			}
-		}
-	}
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// modelComponent->AddAction(stateID, stripID, type, valueParameterName, valueParameterString, valueParameterDouble, "", actionIndex, behaviorID);
+	behavior->AddAction(stateID, stripID, GetActionFromArgument(action), actionIndex);
 
-	// RequestUpdatedID(behaviorID);
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void MigrateActions(AMFArrayValue* arguments) {
+void MigrateActions(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	auto* srcActionIndexAmf = arguments->FindValue<AMFDoubleValue>("srcActionIndex");
 	if (!srcActionIndexAmf) return;
 
@@ -317,33 +392,43 @@ void MigrateActions(AMFArrayValue* arguments) {
 
 	BEHAVIORSTATE dstStateID = GetBehaviorStateFromArgument(arguments, "dstStateID");
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
-	// modelComponent->MigrateActions(srcActionIndex, srcStripID, srcStateID, dstActionIndex, dstStripID, dstStateID, behaviorID);
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// RequestUpdatedID(behaviorID);
+	behavior->MigrateActions(srcActionIndex, srcStripID, srcStateID, dstActionIndex, dstStripID, dstStateID);
+
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void RearrangeStrip(AMFArrayValue* arguments) {
+void RearrangeStrip(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
 	auto* srcActionIndexValue = arguments->FindValue<AMFDoubleValue>("srcActionIndex");
+	if (!srcActionIndexValue) return;
+
 	uint32_t srcActionIndex = static_cast<uint32_t>(srcActionIndexValue->GetDoubleValue());
 
 	uint32_t stripID = GetStripIDFromArgument(arguments);
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
 	auto* dstActionIndexValue = arguments->FindValue<AMFDoubleValue>("dstActionIndex");
+	if (!dstActionIndexValue) return;
+
 	uint32_t dstActionIndex = static_cast<uint32_t>(dstActionIndexValue->GetDoubleValue());
 
 	BEHAVIORSTATE stateID = GetBehaviorStateFromArgument(arguments);
 
-	// modelComponent->RearrangeStrip(stateID, stripID, srcActionIndex, dstActionIndex, behaviorID);
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
+
+	behavior->RearrangeStrip(stateID, stripID, srcActionIndex, dstActionIndex);
 
-	// RequestUpdatedID(behaviorID);
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-void Add(AMFArrayValue* arguments) {
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+void Add(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
 	uint32_t behaviorIndex = 0;
 	auto* behaviorIndexAmf = arguments->FindValue<AMFDoubleValue>("BehaviorIndex");
@@ -352,13 +437,22 @@ void Add(AMFArrayValue* arguments) {
 
 	behaviorIndex = static_cast<uint32_t>(behaviorIndexAmf->GetDoubleValue());
 
-	// modelComponent->AddBehavior(behaviorID, behaviorIndex, modelOwner);
+	if (modelComponent->FindBehavior(behaviorID)) return;
 
-	// SendBehaviorListToClient();
+	// Custom behaviors the owner saved before are loaded back, anything else is a template
+	auto* behavior = PropertyManagementComponent::LoadBehavior(behaviorID, modelOwner->GetObjectID());
+
+	if (behavior) {
+		modelComponent->AddBehavior(behavior, behaviorIndex);
+	} else {
+		modelComponent->AddTemplate(behaviorID);
+	}
+
+	SendBehaviorListToClient(modelComponent->GetParent(), sysAddr, modelOwner);
 }
 
-void RemoveActions(AMFArrayValue* arguments) {
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+void RemoveActions(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
 	auto* actionIndexAmf = arguments->FindValue<AMFDoubleValue>("actionIndex");
 	if (!actionIndexAmf) return;
@@ -369,157 +463,130 @@ void RemoveActions(AMFArrayValue* arguments) {
 
 	BEHAVIORSTATE stateID = GetBehaviorStateFromArgument(arguments);
 
-	// modelComponent->RemoveAction(stateID, stripID, actionIndex, behaviorID);
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// RequestUpdatedID(behaviorID);
+	behavior->RemoveActions(stateID, stripID, actionIndex);
+
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
 void Rename(Entity* modelEntity, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
 	auto* nameAmf = arguments->FindValue<AMFStringValue>("Name");
 	if (!nameAmf) return;
 
 	auto name = nameAmf->GetStringValue();
 
-	// modelComponent->Rename(behaviorID, name);
+	auto* modelComponent = modelEntity->GetComponent<ModelComponent>();
+
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
+
+	behavior->SetName(name);
 
 	SendBehaviorListToClient(modelEntity, sysAddr, modelOwner);
 
-	// RequestUpdatedID(behaviorID);
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
-// TODO This is also supposed to serialize the state of the behaviors in progress but those aren't implemented yet
+// TODO This is also supposed to serialize the state of the behaviors in progress
 void SendBehaviorBlocksToClient(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
-
-	// auto modelBehavior = modelComponent->FindBehavior(behaviorID);
-
-	// if (!modelBehavior) return;
-
-	// modelBehavior->VerifyStates();
-
-	// auto states = modelBehavior->GetBehaviorStates();
-
-	// // Begin serialization.
-
-	// /**
-	//  * for each state
-	//  *	  strip id
-	//  *	  ui info
-	//  *		  x
-	//  *		  y
-	//  *	  actions
-	//  *		  action1
-	//  *		  action2
-	//  *		  ...
-	//  * behaviorID of strip
-	//  * objectID of strip
-	//  */
-	// LWOOBJID targetObjectID = LWOOBJID_EMPTY;
-	// behaviorID = 0;
-	// AMFArrayValue behaviorInfo;
-
-	// AMFArrayValue* stateSerialize = new AMFArrayValue();
-
-	// for (auto it = states.begin(); it != states.end(); it++) {
-	// 	Game::logger->Log("PropertyBehaviors", "Begin serialization of state %i!\n", it->first);
-	// 	AMFArrayValue* state = new AMFArrayValue();
-
-	// 	AMFDoubleValue* stateAsDouble = new AMFDoubleValue();
-	// 	stateAsDouble->SetDoubleValue(it->first);
-	// 	state->InsertValue("id", stateAsDouble);
-
-	// 	AMFArrayValue* strips = new AMFArrayValue();
-	// 	auto stripsInState = it->second->GetStrips();
-	// 	for (auto strip = stripsInState.begin(); strip != stripsInState.end(); strip++) {
-	// 		Game::logger->Log("PropertyBehaviors", "Begin serialization of strip %i!\n", strip->first);
-	// 		AMFArrayValue* thisStrip = new AMFArrayValue();
-
-	// 		AMFDoubleValue* stripID = new AMFDoubleValue();
-	// 		stripID->SetDoubleValue(strip->first);
-	// 		thisStrip->InsertValue("id", stripID);
-
-	// 		AMFArrayValue* uiArray = new AMFArrayValue();
-	// 		AMFDoubleValue* yPosition = new AMFDoubleValue();
-	// 		yPosition->SetDoubleValue(strip->second->GetYPosition());
-	// 		uiArray->InsertValue("y", yPosition);
-
-	// 		AMFDoubleValue* xPosition = new AMFDoubleValue();
-	// 		xPosition->SetDoubleValue(strip->second->GetXPosition());
-	// 		uiArray->InsertValue("x", xPosition);
-
-	// 		thisStrip->InsertValue("ui", uiArray);
-	// 		targetObjectID = modelComponent->GetParent()->GetObjectID();
-	// 		behaviorID = modelBehavior->GetBehaviorID();
-
-	// 		AMFArrayValue* stripSerialize = new AMFArrayValue();
-	// 		for (auto behaviorAction : strip->second->GetActions()) {
-	// 			Game::logger->Log("PropertyBehaviors", "Begin serialization of action %s!\n", behaviorAction->actionName.c_str());
-	// 			AMFArrayValue* thisAction = new AMFArrayValue();
-
-	// 			AMFStringValue* actionName = new AMFStringValue();
-	// 			actionName->SetStringValue(behaviorAction->actionName);
-	// 			thisAction->InsertValue("Type", actionName);
-
-	// 			if (behaviorAction->parameterValueString != "")
-	// 			{
-	// 				AMFStringValue* valueAsString = new AMFStringValue();
-	// 				valueAsString->SetStringValue(behaviorAction->parameterValueString);
-	// 				thisAction->InsertValue(behaviorAction->parameterName, valueAsString);
-	// 			}
-	// 			else if (behaviorAction->parameterValueDouble != 0.0)
-	// 			{
-	// 				AMFDoubleValue* valueAsDouble = new AMFDoubleValue();
-	// 				valueAsDouble->SetDoubleValue(behaviorAction->parameterValueDouble);
-	// 				thisAction->InsertValue(behaviorAction->parameterName, valueAsDouble);
-	// 			}
-	// 			stripSerialize->PushBackValue(thisAction);
-	// 		}
-	// 		thisStrip->InsertValue("actions", stripSerialize);
-	// 		strips->PushBackValue(thisStrip);
-	// 	}
-	// 	state->InsertValue("strips", strips);
-	// 	stateSerialize->PushBackValue(state);
-	// }
-	// behaviorInfo.InsertValue("states", stateSerialize);
-
-	// AMFStringValue* objectidAsString = new AMFStringValue();
-	// objectidAsString->SetStringValue(std::to_string(targetObjectID));
-	// behaviorInfo.InsertValue("objectID", objectidAsString);
-
-	// AMFStringValue* behaviorIDAsString = new AMFStringValue();
-	// behaviorIDAsString->SetStringValue(std::to_string(behaviorID));
-	// behaviorInfo.InsertValue("BehaviorID", behaviorIDAsString);
-
-	// GameMessages::SendUIMessageServerToSingleClient(modelOwner, sysAddr, "UpdateBehaviorBlocks", &behaviorInfo);
-}
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
-void UpdateAction(AMFArrayValue* arguments) {
-	std::string type = "";
-	std::string valueParameterName = "";
-	std::string valueParameterString = "";
-	double valueParameterDouble = 0.0;
-	auto* actionAsArray = arguments->FindValue<AMFArrayValue>("action");
-	if (!actionAsArray) return;
-	for (auto& typeValueMap : actionAsArray->GetAssociativeMap()) {
-		if (typeValueMap.first == "Type") {
-			if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
-			type = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
-		} else {
-			valueParameterName = typeValueMap.first;
-			// Message is the only known string parameter
-			if (valueParameterName == "Message") {
-				if (typeValueMap.second->GetValueType() != AMFValueType::AMFString) continue;
-				valueParameterString = static_cast<AMFStringValue*>(typeValueMap.second)->GetStringValue();
-			} else {
-				if (typeValueMap.second->GetValueType() != AMFValueType::AMFDouble) continue;
-				valueParameterDouble = static_cast<AMFDoubleValue*>(typeValueMap.second)->GetDoubleValue();
+	auto* modelBehavior = modelComponent->FindBehavior(behaviorID);
+
+	if (!modelBehavior) return;
+
+	/**
+	 * for each state
+	 *	  strip id
+	 *	  ui info
+	 *		  x
+	 *		  y
+	 *	  actions
+	 *		  action1
+	 *		  action2
+	 *		  ...
+	 * behaviorID of strip
+	 * objectID of strip
+	 */
+	AMFArrayValue behaviorInfo;
+
+	AMFArrayValue* stateSerialize = new AMFArrayValue();
+
+	for (const auto& [stateID, strips] : modelBehavior->GetStates()) {
+		AMFArrayValue* state = new AMFArrayValue();
+
+		AMFDoubleValue* stateAsDouble = new AMFDoubleValue();
+		stateAsDouble->SetDoubleValue(stateID);
+		state->InsertValue("id", stateAsDouble);
+
+		AMFArrayValue* stripsSerialize = new AMFArrayValue();
+		for (const auto& [stripID, strip] : strips) {
+			AMFArrayValue* thisStrip = new AMFArrayValue();
+
+			AMFDoubleValue* stripIDAsDouble = new AMFDoubleValue();
+			stripIDAsDouble->SetDoubleValue(stripID);
+			thisStrip->InsertValue("id", stripIDAsDouble);
+
+			AMFArrayValue* uiArray = new AMFArrayValue();
+			AMFDoubleValue* yPosition = new AMFDoubleValue();
+			yPosition->SetDoubleValue(strip.yPosition);
+			uiArray->InsertValue("y", yPosition);
+
+			AMFDoubleValue* xPosition = new AMFDoubleValue();
+			xPosition->SetDoubleValue(strip.xPosition);
+			uiArray->InsertValue("x", xPosition);
+
+			thisStrip->InsertValue("ui", uiArray);
+
+			AMFArrayValue* actionsSerialize = new AMFArrayValue();
+			for (const auto& behaviorAction : strip.actions) {
+				AMFArrayValue* thisAction = new AMFArrayValue();
+
+				AMFStringValue* actionName = new AMFStringValue();
+				actionName->SetStringValue(behaviorAction.type);
+				thisAction->InsertValue("Type", actionName);
+
+				if (behaviorAction.parameterValueString != "") {
+					AMFStringValue* valueAsString = new AMFStringValue();
+					valueAsString->SetStringValue(behaviorAction.parameterValueString);
+					thisAction->InsertValue(behaviorAction.parameterName, valueAsString);
+				} else if (behaviorAction.parameterValueDouble != 0.0) {
+					AMFDoubleValue* valueAsDouble = new AMFDoubleValue();
+					valueAsDouble->SetDoubleValue(behaviorAction.parameterValueDouble);
+					thisAction->InsertValue(behaviorAction.parameterName, valueAsDouble);
+				}
+				actionsSerialize->PushBackValue(thisAction);
 			}
+			thisStrip->InsertValue("actions", actionsSerialize);
+			stripsSerialize->PushBackValue(thisStrip);
 		}
+		state->InsertValue("strips", stripsSerialize);
+		stateSerialize->PushBackValue(state);
 	}
+	behaviorInfo.InsertValue("states", stateSerialize);
+
+	AMFStringValue* objectidAsString = new AMFStringValue();
+	objectidAsString->SetStringValue(std::to_string(modelComponent->GetParent()->GetObjectID()));
+	behaviorInfo.InsertValue("objectID", objectidAsString);
+
+	AMFStringValue* behaviorIDAsString = new AMFStringValue();
+	behaviorIDAsString->SetStringValue(std::to_string(modelBehavior->GetBehaviorID()));
+	behaviorInfo.InsertValue("BehaviorID", behaviorIDAsString);
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	GameMessages::SendUIMessageServerToSingleClient(modelOwner, sysAddr, "UpdateBehaviorBlocks", &behaviorInfo);
+}
+
+void UpdateAction(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
+	auto* actionAsArray = arguments->FindValue<AMFArrayValue>("action");
+	if (!actionAsArray) return;
+
+	auto action = GetActionFromArgument(actionAsArray);
+
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
 	auto* actionIndexValue = arguments->FindValue<AMFDoubleValue>("actionIndex");
 	if (!actionIndexValue) return;
@@ -530,9 +597,12 @@ void UpdateAction(AMFArrayValue* arguments) {
 
 	BEHAVIORSTATE stateID = GetBehaviorStateFromArgument(arguments);
 
-	// modelComponent->UpdateAction(stateID, stripID, type, valueParameterName, valueParameterString, valueParameterDouble, "", actionIndex, behaviorID);
+	auto* behavior = GetBehaviorToEdit(modelComponent, behaviorID);
+	if (!behavior) return;
 
-	// RequestUpdatedID(behaviorID);
+	behavior->UpdateAction(stateID, stripID, action, actionIndex);
+
+	RequestUpdatedID(behavior->GetBehaviorID(), modelComponent, modelOwner, sysAddr);
 }
 
 void MoveToInventory(ModelComponent* modelComponent, const SystemAddress& sysAddr, Entity* modelOwner, AMFArrayValue* arguments) {
@@ -544,14 +614,23 @@ void MoveToInventory(ModelComponent* modelComponent, const SystemAddress& sysAdd
 
 	GameMessages::SendUIMessageServerToSingleClient(modelOwner, modelOwner->GetParentUser()->GetSystemAddress(), "ToggleBehaviorEditor", &args);
 
-	uint32_t behaviorID = GetBehaviorIDFromArgument(arguments);
+	int32_t behaviorID = GetBehaviorIDFromArgument(arguments);
 
 	auto* behaviorIndexValue = arguments->FindValue<AMFDoubleValue>("BehaviorIndex");
 	if (!behaviorIndexValue) return;
 
-	uint32_t behaviorIndex = static_cast<uint32_t>(behaviorIndexValue->GetDoubleValue());
+	auto* behavior = modelComponent->FindBehavior(behaviorID);
+
+	if (!behavior) {
+		if (modelComponent->RemoveTemplate(behaviorID)) SendBehaviorListToClient(modelComponent->GetParent(), sysAddr, modelOwner);
+
+		return;
+	}
+
+	// Save the behavior so it can be added back to a model later
+	if (!behavior->GetIsTemplated()) PropertyManagementComponent::SaveBehavior(behavior, modelOwner->GetObjectID());
 
-	// modelComponent->MoveBehaviorToInventory(behaviorID, behaviorIndex, modelOwner);
+	modelComponent->RemoveBehavior(behaviorID);
 
 	SendBehaviorListToClient(modelComponent->GetParent(), sysAddr, modelOwner);
 }
@@ -569,25 +648,25 @@ void ControlBehaviors::ProcessCommand(Entity* modelEntity, const SystemAddress&
 	else if (command == "toggleExecutionUpdates")
 		ToggleExecutionUpdates();
 	else if (command == "addStrip")
-		AddStrip(arguments);
+		AddStrip(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "removeStrip")
-		RemoveStrip(arguments);
+		RemoveStrip(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "mergeStrips")
-		MergeStrips(arguments);
+		MergeStrips(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "splitStrip")
-		SplitStrip(arguments);
+		SplitStrip(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "updateStripUI")
-		UpdateStripUI(arguments);
+		UpdateStripUI(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "addAction")
-		AddAction(arguments);
+		AddAction(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "migrateActions")
-		MigrateActions(arguments);
+		MigrateActions(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "rearrangeStrip")
-		RearrangeStrip(arguments);
+		RearrangeStrip(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "add")
-		Add(arguments);
+		Add(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "removeActions")
-		RemoveActions(arguments);
+		RemoveActions(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "rename")
 		Rename(modelEntity, sysAddr, modelOwner, arguments);
 	else if (command == "sendBehaviorBlocksToClient")
@@ -595,7 +674,7 @@ void ControlBehaviors::ProcessCommand(Entity* modelEntity, const SystemAddress&
 	else if (command == "moveToInventory")
 		MoveToInventory(modelComponent, sysAddr, modelOwner, arguments);
 	else if (command == "updateAction")
-		UpdateAction(arguments);
+		UpdateAction(modelComponent, sysAddr, modelOwner, arguments);
 	else
 		Game::logger->Log("ControlBehaviors", "Unknown behavior command (%s)\n", command.c_str());
 }
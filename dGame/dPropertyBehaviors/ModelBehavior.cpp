@@ -0,0 +1,258 @@
+#include "ModelBehavior.h"
+
+#include <algorithm>
+
+#include "tinyxml2.h"
+
+ModelBehavior::ModelBehavior(const int32_t behaviorID, const bool isTemplated) {
+	m_BehaviorID = behaviorID;
+	m_IsTemplated = isTemplated;
+}
+
+void ModelBehavior::SetBehaviorID(const int32_t behaviorID) {
+	m_BehaviorID = behaviorID;
+	m_Generation++;
+	m_IsDirty = true;
+}
+
+void ModelBehavior::SetName(const std::string& name) {
+	m_Name = name;
+	m_IsDirty = true;
+}
+
+void ModelBehavior::AddStrip(const BEHAVIORSTATE state, const STRIPID strip, const std::vector<BehaviorAction>& actions, const double xPosition, const double yPosition) {
+	auto& newStrip = m_States[state][strip];
+	newStrip.actions = actions;
+	newStrip.xPosition = xPosition;
+	newStrip.yPosition = yPosition;
+
+	OnChanged();
+}
+
+void ModelBehavior::RemoveStrip(const BEHAVIORSTATE state, const STRIPID strip) {
+	const auto stateIt = m_States.find(state);
+	if (stateIt == m_States.end()) return;
+
+	stateIt->second.erase(strip);
+
+	OnChanged();
+}
+
+void ModelBehavior::AddAction(const BEHAVIORSTATE state, const STRIPID strip, const BehaviorAction& action, const uint32_t actionIndex) {
+	auto* targetStrip = FindStrip(state, strip);
+	if (!targetStrip) return;
+
+	auto& actions = targetStrip->actions;
+	actions.insert(actions.begin() + std::min<size_t>(actionIndex, actions.size()), action);
+
+	OnChanged();
+}
+
+void ModelBehavior::UpdateAction(const BEHAVIORSTATE state, const STRIPID strip, const BehaviorAction& action, const uint32_t actionIndex) {
+	auto* targetStrip = FindStrip(state, strip);
+	if (!targetStrip || actionIndex >= targetStrip->actions.size()) return;
+
+	targetStrip->actions[actionIndex] = action;
+
+	OnChanged();
+}
+
+void ModelBehavior::RemoveActions(const BEHAVIORSTATE state, const STRIPID strip, const uint32_t actionIndex) {
+	auto* targetStrip = FindStrip(state, strip);
+	if (!targetStrip || actionIndex >= targetStrip->actions.size()) return;
+
+	targetStrip->actions.erase(targetStrip->actions.begin() + actionIndex, targetStrip->actions.end());
+
+	if (targetStrip->actions.empty()) {
+		RemoveStrip(state, strip);
+		return;
+	}
+
+	OnChanged();
+}
+
+void ModelBehavior::RearrangeStrip(const BEHAVIORSTATE state, const STRIPID strip, const uint32_t srcActionIndex, const uint32_t dstActionIndex) {
+	auto* targetStrip = FindStrip(state, strip);
+	if (!targetStrip || srcActionIndex >= targetStrip->actions.size()) return;
+
+	auto& actions = targetStrip->actions;
+
+	std::vector<BehaviorAction> moved(actions.begin() + srcActionIndex, actions.end());
+	actions.erase(actions.begin() + srcActionIndex, actions.end());
+	actions.insert(actions.begin() + std::min<size_t>(dstActionIndex, actions.size()), moved.begin(), moved.end());
+
+	OnChanged();
+}
+
+void ModelBehavior::MigrateActions(const uint32_t srcActionIndex, const STRIPID srcStrip, const BEHAVIORSTATE srcState, const uint32_t dstActionIndex, const STRIPID dstStrip, const BEHAVIORSTATE dstState) {
+	auto* source = FindStrip(srcState, srcStrip);
+	auto* destination = FindStrip(dstState, dstStrip);
+	if (!source || !destination || source == destination || srcActionIndex >= source->actions.size()) return;
+
+	auto& actions = destination->actions;
+	actions.insert(actions.begin() + std::min<size_t>(dstActionIndex, actions.size()), source->actions.begin() + srcActionIndex, source->actions.end());
+
+	RemoveActions(srcState, srcStrip, srcActionIndex);
+}
+
+void ModelBehavior::SplitStrip(const uint32_t srcActionIndex, const STRIPID srcStrip, const BEHAVIORSTATE srcState, const STRIPID dstStrip, const BEHAVIORSTATE dstState, const double xPosition, const double yPosition) {
+	auto* source = FindStrip(srcState, srcStrip);
+	if (!source || srcActionIndex >= source->actions.size()) return;
+
+	std::vector<BehaviorAction> moved(source->actions.begin() + srcActionIndex, source->actions.end());
+
+	RemoveActions(srcState, srcStrip, srcActionIndex);
+	AddStrip(dstState, dstStrip, moved, xPosition, yPosition);
+}
+
+void ModelBehavior::MergeStrips(const STRIPID srcStrip, const BEHAVIORSTATE srcState, const STRIPID dstStrip, const BEHAVIORSTATE dstState, const uint32_t dstActionIndex) {
+	auto* source = FindStrip(srcState, srcStrip);
+	auto* destination = FindStrip(dstState, dstStrip);
+	if (!source || !destination || source == destination) return;
+
+	auto& actions = destination->actions;
+	actions.insert(actions.begin() + std::min<size_t>(dstActionIndex, actions.size()), source->actions.begin(), source->actions.end());
+
+	RemoveStrip(srcState, srcStrip);
+}
+
+void ModelBehavior::UpdateStripUI(const BEHAVIORSTATE state, const STRIPID strip, const double xPosition, const double yPosition) {
+	auto* targetStrip = FindStrip(state, strip);
+	if (!targetStrip) return;
+
+	targetStrip->xPosition = xPosition;
+	targetStrip->yPosition = yPosition;
+
+	// Moving a strip around doesn't change what it does
+	m_IsDirty = true;
+}
+
+const BehaviorProgram& ModelBehavior::GetProgram() {
+	if (m_ProgramDirty) {
+		m_Program = BehaviorProgram::Compile(*this);
+		m_ProgramDirty = false;
+	}
+
+	return m_Program;
+}
+
+void ModelBehavior::SetState(const BEHAVIORSTATE state) {
+	m_State = state;
+	m_Generation++;
+}
+
+void ModelBehavior::Reset() {
+	SetState(HOME_STATE);
+}
+
+std::string ModelBehavior::Serialize() const {
+	tinyxml2::XMLDocument document;
+
+	auto* behaviorElement = document.NewElement("Behavior");
+	behaviorElement->SetAttribute("name", m_Name.c_str());
+	document.LinkEndChild(behaviorElement);
+
+	for (const auto& [stateID, strips] : m_States) {
+		auto* stateElement = document.NewElement("State");
+		behaviorElement->LinkEndChild(stateElement);
+		stateElement->SetAttribute("id", stateID);
+
+		for (const auto& [stripID, strip] : strips) {
+			auto* stripElement = document.NewElement("Strip");
+			stateElement->LinkEndChild(stripElement);
+			stripElement->SetAttribute("id", stripID);
+			stripElement->SetAttribute("x", strip.xPosition);
+			stripElement->SetAttribute("y", strip.yPosition);
+
+			for (const auto& action : strip.actions) {
+				auto* actionElement = document.NewElement("Action");
+				stripElement->LinkEndChild(actionElement);
+				actionElement->SetAttribute("Type", action.type.c_str());
+
+				if (action.parameterName.empty()) continue;
+
+				// The parameter name comes from the client, so it is stored as a value and not as an attribute name
+				actionElement->SetAttribute("ParamName", action.parameterName.c_str());
+
+				// Message is the only known string parameter
+				if (action.parameterName == "Message") {
+					actionElement->SetAttribute("Value", action.parameterValueString.c_str());
+				} else {
+					actionElement->SetAttribute("Value", action.parameterValueDouble);
+				}
+			}
+		}
+	}
+
+	tinyxml2::XMLPrinter printer(nullptr, true);
+	document.Print(&printer);
+
+	return printer.CStr();
+}
+
+bool ModelBehavior::Deserialize(const std::string& behaviorInfo) {
+	tinyxml2::XMLDocument document;
+
+	if (document.Parse(behaviorInfo.c_str(), behaviorInfo.size()) != tinyxml2::XML_SUCCESS) return false;
+
+	auto* behaviorElement = document.FirstChildElement("Behavior");
+	if (!behaviorElement) return false;
+
+	m_States.clear();
+
+	const auto* name = behaviorElement->Attribute("name");
+	if (name) m_Name = name;
+
+	for (auto* stateElement = behaviorElement->FirstChildElement("State"); stateElement; stateElement = stateElement->NextSiblingElement("State")) {
+		auto& strips = m_States[stateElement->UnsignedAttribute("id")];
+
+		for (auto* stripElement = stateElement->FirstChildElement("Strip"); stripElement; stripElement = stripElement->NextSiblingElement("Strip")) {
+			auto& strip = strips[stripElement->UnsignedAttribute("id")];
+			strip.xPosition = stripElement->DoubleAttribute("x");
+			strip.yPosition = stripElement->DoubleAttribute("y");
+
+			for (auto* actionElement = stripElement->FirstChildElement("Action"); actionElement; actionElement = actionElement->NextSiblingElement("Action")) {
+				BehaviorAction action;
+
+				const auto* type = actionElement->Attribute("Type");
+				if (type) action.type = type;
+
+				const auto* parameterName = actionElement->Attribute("ParamName");
+
+				if (parameterName) {
+					action.parameterName = parameterName;
+
+					if (action.parameterName == "Message") {
+						const auto* value = actionElement->Attribute("Value");
+						if (value) action.parameterValueString = value;
+					} else {
+						action.parameterValueDouble = actionElement->DoubleAttribute("Value");
+					}
+				}
+
+				strip.actions.push_back(action);
+			}
+		}
+	}
+
+	m_ProgramDirty = true;
+	m_Generation++;
+
+	return true;
+}
+
+BehaviorStrip* ModelBehavior::FindStrip(const BEHAVIORSTATE state, const STRIPID strip) {
+	const auto stateIt = m_States.find(state);
+	if (stateIt == m_States.end()) return nullptr;
+
+	const auto stripIt = stateIt->second.find(strip);
+	if (stripIt == stateIt->second.end()) return nullptr;
+
+	return &stripIt->second;
+}
+
+void ModelBehavior::OnChanged() {
+	m_ProgramDirty = true;
+	m_IsDirty = true;
+	m_Generation++;
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#ifndef __MODELBEHAVIOR__H__
+#define __MODELBEHAVIOR__H__
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "dCommonVars.h"
+#include "BehaviorProgram.h"
+#include "BehaviorStates.h"
+
+/**
+ * A block of a strip as it was placed in the behavior editor
+ */
+struct BehaviorAction {
+	std::string type;
+	std::string parameterName;
+	std::string parameterValueString;
+	double parameterValueDouble = 0.0;
+};
+
+/**
+ * A chain of blocks in a state of a behavior
+ */
+struct BehaviorStrip {
+	std::vector<BehaviorAction> actions;
+	double xPosition = 0.0;
+	double yPosition = 0.0;
+};
+
+/**
+ * A behavior on a model, as edited in the behavior editor. The blocks are compiled into a BehaviorProgram
+ * whenever they changed and the behavior is run.
+ */
+class ModelBehavior {
+public:
+	ModelBehavior(int32_t behaviorID, bool isTemplated = false);
+
+	int32_t GetBehaviorID() const { return m_BehaviorID; }
+
+	/**
+	 * Sets the ID of this behavior, stopping any strips that are running
+	 * @param behaviorID the new ID
+	 */
+	void SetBehaviorID(int32_t behaviorID);
+
+	/**
+	 * Returns if this behavior is still a copy of a template, which gets its own ID once it is edited
+	 */
+	bool GetIsTemplated() const { return m_IsTemplated; }
+
+	void SetIsTemplated(bool isTemplated) { m_IsTemplated = isTemplated; }
+
+	const std::string& GetName() const { return m_Name; }
+
+	void SetName(const std::string& name);
+
+	const std::map<BEHAVIORSTATE, std::map<STRIPID, BehaviorStrip>>& GetStates() const { return m_States; }
+
+	void AddStrip(BEHAVIORSTATE state, STRIPID strip, const std::vector<BehaviorAction>& actions, double xPosition, double yPosition);
+
+	void RemoveStrip(BEHAVIORSTATE state, STRIPID strip);
+
+	void AddAction(BEHAVIORSTATE state, STRIPID strip, const BehaviorAction& action, uint32_t actionIndex);
+
+	void UpdateAction(BEHAVIORSTATE state, STRIPID strip, const BehaviorAction& action, uint32_t actionIndex);
+
+	/**
+	 * Removes an action and every action after it, the strip is removed if it ends up empty
+	 */
+	void RemoveActions(BEHAVIORSTATE state, STRIPID strip, uint32_t actionIndex);
+
+	/**
+	 * Moves an action and every action after it to another position in the same strip
+	 */
+	void RearrangeStrip(BEHAVIORSTATE state, STRIPID strip, uint32_t srcActionIndex, uint32_t dstActionIndex);
+
+	/**
+	 * Moves an action and every action after it into another strip
+	 */
+	void MigrateActions(uint32_t srcActionIndex, STRIPID srcStrip, BEHAVIORSTATE srcState, uint32_t dstActionIndex, STRIPID dstStrip, BEHAVIORSTATE dstState);
+
+	/**
+	 * Moves an action and every action after it into a new strip
+	 */
+	void SplitStrip(uint32_t srcActionIndex, STRIPID srcStrip, BEHAVIORSTATE srcState, STRIPID dstStrip, BEHAVIORSTATE dstState, double xPosition, double yPosition);
+
+	/**
+	 * Moves all the actions of a strip into another strip
+	 */
+	void MergeStrips(STRIPID srcStrip, BEHAVIORSTATE srcState, STRIPID dstStrip, BEHAVIORSTATE dstState, uint32_t dstActionIndex);
+
+	void UpdateStripUI(BEHAVIORSTATE state, STRIPID strip, double xPosition, double yPosition);
+
+	/**
+	 * Returns the compiled blocks of this behavior, compiling them if they changed
+	 * @return the compiled blocks of this behavior
+	 */
+	const BehaviorProgram& GetProgram();
+
+	/**
+	 * Returns the state this behavior is in while it runs
+	 */
+	BEHAVIORSTATE GetState() const { return m_State; }
+
+	/**
+	 * Switches the state this behavior is in, stopping any strips that are running
+	 */
+	void SetState(BEHAVIORSTATE state);
+
+	/**
+	 * Stops all running strips and returns to the home state
+	 */
+	void Reset();
+
+	/**
+	 * Returns the generation of this behavior, strips that were started in an older generation have been stopped
+	 */
+	uint32_t GetGeneration() const { return m_Generation; }
+
+	/**
+	 * Returns if this behavior has changed since it was last saved
+	 */
+	bool GetIsDirty() const { return m_IsDirty; }
+
+	void SetIsDirty(bool isDirty) { m_IsDirty = isDirty; }
+
+	/**
+	 * Writes the states, strips and actions of this behavior to an XML string
+	 */
+	std::string Serialize() const;
+
+	/**
+	 * Reads the states, strips and actions of this behavior from an XML string written by Serialize
+	 * @return false if the string couldn't be read
+	 */
+	bool Deserialize(const std::string& behaviorInfo);
+
+private:
+	/**
+	 * Returns a strip, or nullptr if it doesn't exist
+	 */
+	BehaviorStrip* FindStrip(BEHAVIORSTATE state, STRIPID strip);
+
+	/**
+	 * Marks the blocks as changed, which stops running strips and recompiles the program
+	 */
+	void OnChanged();
+
+	int32_t m_BehaviorID;
+
+	bool m_IsTemplated;
+
+	std::string m_Name = "New Behavior";
+
+	std::map<BEHAVIORSTATE, std::map<STRIPID, BehaviorStrip>> m_States;
+
+	BehaviorProgram m_Program;
+
+	bool m_ProgramDirty = true;
+
+	BEHAVIORSTATE m_State = HOME_STATE;
+
+	uint32_t m_Generation = 0;
+
+	bool m_IsDirty = false;
+};
+
+#endif  //!__MODELBEHAVIOR__H__
@@ -0,0 +1,95 @@
+#include "ModelBehaviorScheduler.h"
+
+#include "ConfigOptions.h"
+#include "Entity.h"
+#include "ModelBehavior.h"
+#include "ModelComponent.h"
+
+ModelBehaviorScheduler* ModelBehaviorScheduler::m_Address = nullptr; //For singleton method
+
+ModelBehaviorScheduler::ModelBehaviorScheduler() {
+}
+
+uint32_t ModelBehaviorScheduler::GetActionBudget() const {
+	return m_ActionBudget.value_or(ConfigOptions::maxModelBehaviorActionsPerFrame.Get());
+}
+
+void ModelBehaviorScheduler::Register(ModelComponent* model) {
+	m_Models.insert_or_assign(model->GetParent()->GetObjectID(), model);
+}
+
+void ModelBehaviorScheduler::Unregister(const LWOOBJID modelID) {
+	m_Models.erase(modelID);
+}
+
+void ModelBehaviorScheduler::Start(ModelComponent* model, ModelBehavior* behavior, const uint32_t strip) {
+	StripRun run{};
+	run.modelID = model->GetParent()->GetObjectID();
+	run.behaviorID = behavior->GetBehaviorID();
+	run.generation = behavior->GetGeneration();
+	run.strip = strip;
+	run.action = 0;
+
+	Push(run, m_Time);
+}
+
+void ModelBehaviorScheduler::OnChat(const std::string& message) {
+	for (const auto& [modelID, model] : m_Models) {
+		model->OnBehaviorTrigger(eBehaviorTrigger::CHAT, message);
+	}
+}
+
+void ModelBehaviorScheduler::Update(const float deltaTime) {
+	m_Time += deltaTime;
+
+	uint32_t executed = 0;
+
+	// 0 means there is no limit
+	const auto actionBudget = GetActionBudget();
+	const auto budgetReached = [actionBudget, &executed]() { return actionBudget != 0 && executed >= actionBudget; };
+
+	while (!m_Queue.empty() && m_Queue.top().dueTime <= m_Time && !budgetReached()) {
+		auto run = m_Queue.top();
+		m_Queue.pop();
+
+		// The model may have been removed, or the behavior changed, since this was queued
+		const auto model = m_Models.find(run.modelID);
+		if (model == m_Models.end()) continue;
+
+		auto* behavior = model->second->FindBehavior(run.behaviorID);
+		if (!behavior || behavior->GetGeneration() != run.generation) continue;
+
+		const auto& program = behavior->GetProgram();
+		if (run.strip >= program.GetStrips().size()) continue;
+
+		const auto& strip = program.GetStrips()[run.strip];
+
+		while (run.action < strip.instructionCount) {
+			if (budgetReached()) {
+				Push(run, m_Time);
+				break;
+			}
+
+			const auto& instruction = program.GetInstruction(strip.firstInstruction + run.action);
+			run.action++;
+			executed++;
+
+			const auto duration = model->second->ExecuteBehaviorAction(instruction, program, behavior);
+
+			// Setting the state or restarting stops the strip
+			if (behavior->GetGeneration() != run.generation) break;
+
+			if (duration > 0.0f) {
+				if (run.action < strip.instructionCount) Push(run, m_Time + duration);
+				break;
+			}
+		}
+	}
+}
+
+void ModelBehaviorScheduler::Push(StripRun run, const double dueTime) {
+	run.dueTime = dueTime;
+	run.sequence = m_NextSequence++;
+
+	m_Queue.push(run);
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#ifndef __MODELBEHAVIORSCHEDULER__H__
+#define __MODELBEHAVIORSCHEDULER__H__
+
+#include <optional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dCommonVars.h"
+
+class ModelComponent;
+class ModelBehavior;
+
+/**
+ * Runs the strips of every model behavior in the zone. Running strips wait in a queue ordered by the time their
+ * next action is due, and only a fixed number of actions is executed per frame; actions over the budget are
+ * picked up first on the next frame.
+ */
+class ModelBehaviorScheduler {
+public:
+	static ModelBehaviorScheduler* Instance() {
+		if (!m_Address) {
+			m_Address = new ModelBehaviorScheduler();
+		}
+
+		return m_Address;
+	}
+
+	/**
+	 * Registers a model that has behaviors, so its strips can be run
+	 * @param model the model to register
+	 */
+	void Register(ModelComponent* model);
+
+	/**
+	 * Unregisters a model, its running strips are dropped when they come up
+	 * @param modelID the ID of the model to unregister
+	 */
+	void Unregister(LWOOBJID modelID);
+
+	/**
+	 * Starts a strip of a behavior on a model
+	 * @param model the model the behavior is on
+	 * @param behavior the behavior the strip is in
+	 * @param strip the index of the strip in the compiled behavior
+	 */
+	void Start(ModelComponent* model, ModelBehavior* behavior, uint32_t strip);
+
+	/**
+	 * Sends a chat message to every registered model, starting their chat strips that wait for it
+	 * @param message the message that was said
+	 */
+	void OnChat(const std::string& message);
+
+	/**
+	 * Advances the clock and executes the actions that are due, up to the action budget
+	 * @param deltaTime the time since the last update
+	 */
+	void Update(float deltaTime);
+
+	/**
+	 * Sets the maximum number of actions executed per frame, instead of max_model_behavior_actions_per_frame
+	 */
+	void SetActionBudget(uint32_t actionBudget) { m_ActionBudget = actionBudget; }
+
+	/**
+	 * Returns the maximum number of actions executed per frame, 0 for no limit
+	 */
+	uint32_t GetActionBudget() const;
+
+	/**
+	 * Returns the number of strips waiting in the queue, including ones that have been stopped but not popped yet
+	 */
+	size_t GetQueuedCount() const { return m_Queue.size(); }
+
+	double GetTime() const { return m_Time; }
+
+private:
+	ModelBehaviorScheduler();
+
+	/**
+	 * A strip that is running on a model
+	 */
+	struct StripRun {
+		double dueTime;
+		uint64_t sequence;
+		LWOOBJID modelID;
+		int32_t behaviorID;
+
+		/**
+		 * The generation of the behavior when the strip was started, it stops when the behavior changes
+		 */
+		uint32_t generation;
+
+		uint32_t strip;
+
+		/**
+		 * The index of the next action in the strip
+		 */
+		uint32_t action;
+	};
+
+	/**
+	 * Orders the queue by due time, strips due at the same time are handled in the order they were queued
+	 */
+	struct DueLater {
+		bool operator()(const StripRun& a, const StripRun& b) const {
+			if (a.dueTime != b.dueTime) return a.dueTime > b.dueTime;
+			return a.sequence > b.sequence;
+		}
+	};
+
+	void Push(StripRun run, double dueTime);
+
+	static ModelBehaviorScheduler* m_Address; //For singleton method
+
+	std::unordered_map<LWOOBJID, ModelComponent*> m_Models;
+
+	std::priority_queue<StripRun, std::vector<StripRun>, DueLater> m_Queue;
+
+	/**
+	 * The action budget set in code, the config option is followed if there is none
+	 */
+	std::optional<uint32_t> m_ActionBudget;
+
+	/**
+	 * Seconds since the scheduler was created
+	 */
+	double m_Time = 0.0;
+
+	uint64_t m_NextSequence = 0;
+};
+
+#endif  //!__MODELBEHAVIORSCHEDULER__H__
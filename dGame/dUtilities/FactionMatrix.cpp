@@ -0,0 +1,76 @@
+#include "FactionMatrix.h"
+
+#include "CDClientManager.h"
+#include "Game.h"
+#include "dLogger.h"
+
+FactionMatrix* FactionMatrix::m_Address = nullptr; //For singleton method
+
+namespace {
+	const std::vector<int32_t> EmptyList{};
+	const FactionMask EmptyMask{};
+};
+
+FactionMatrix::FactionMatrix() {
+	auto* factionsTable = CDClientManager::Instance()->GetTable<CDFactionsTable>("Factions");
+	if (!factionsTable) return;
+
+	// The factions in the table get their bits first, so they are the ones that fit if there are too many
+	uint32_t bit;
+	for (const auto& row : factionsTable->GetEntries()) {
+		GetBit(row.faction, bit);
+	}
+
+	for (const auto& row : factionsTable->GetEntries()) {
+		auto& entry = m_Factions[row.faction];
+		entry.enemyList = row.enemyList;
+
+		for (const auto enemy : row.enemyList) {
+			if (!AddToMask(entry.enemyMask, enemy)) entry.enemyMaskComplete = false;
+		}
+	}
+}
+
+bool FactionMatrix::GetBit(const int32_t factionID, uint32_t& bit) {
+	const auto existing = m_Bits.find(factionID);
+	if (existing != m_Bits.end()) {
+		bit = existing->second;
+		return true;
+	}
+
+	if (m_Bits.size() >= FactionMask().size()) {
+		if (!m_WarnedFull) {
+			Game::logger->Log("FactionMatrix", "Faction %i doesn't fit in a faction mask, factions past the mask are compared one by one", factionID);
+			m_WarnedFull = true;
+		}
+
+		return false;
+	}
+
+	bit = static_cast<uint32_t>(m_Bits.size());
+	m_Bits.insert(std::make_pair(factionID, bit));
+	return true;
+}
+
+bool FactionMatrix::AddToMask(FactionMask& mask, const int32_t factionID) {
+	uint32_t bit;
+	if (!GetBit(factionID, bit)) return false;
+
+	mask.set(bit);
+	return true;
+}
+
+const std::vector<int32_t>& FactionMatrix::GetEnemyList(const int32_t factionID) const {
+	const auto entry = m_Factions.find(factionID);
+	return entry != m_Factions.end() ? entry->second.enemyList : EmptyList;
+}
+
+const FactionMask& FactionMatrix::GetEnemyMask(const int32_t factionID) const {
+	const auto entry = m_Factions.find(factionID);
+	return entry != m_Factions.end() ? entry->second.enemyMask : EmptyMask;
+}
+
+bool FactionMatrix::IsEnemyMaskComplete(const int32_t factionID) const {
+	const auto entry = m_Factions.find(factionID);
+	return entry == m_Factions.end() || entry->second.enemyMaskComplete;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A set of factions, every faction the matrix knows has its own bit
+ */
+typedef std::bitset<256> FactionMask;
+
+/**
+ * The Factions table compiled into a bit per faction, and for each faction the mask of the factions it is hostile to.
+ * Entities keep their factions as masks, so checking whether one is hostile to another is a single AND.
+ */
+class FactionMatrix {
+public:
+	static FactionMatrix* Instance() {
+		if (!m_Address) {
+			m_Address = new FactionMatrix();
+		}
+
+		return m_Address;
+	}
+
+	/**
+	 * Adds a faction to a mask, the faction gets a bit if it doesn't have one yet
+	 * @param mask the mask to add the faction to
+	 * @param factionID the faction to add
+	 * @return false if every bit is taken and the faction couldn't be added
+	 */
+	bool AddToMask(FactionMask& mask, int32_t factionID);
+
+	/**
+	 * Returns the factions a faction is hostile to, from the Factions table
+	 * @param factionID the faction to get the enemies of
+	 * @return the IDs of the enemy factions
+	 */
+	const std::vector<int32_t>& GetEnemyList(int32_t factionID) const;
+
+	/**
+	 * Returns the factions a faction is hostile to as a mask
+	 * @param factionID the faction to get the enemies of
+	 * @return the mask of the enemy factions
+	 */
+	const FactionMask& GetEnemyMask(int32_t factionID) const;
+
+	/**
+	 * Returns whether every enemy of a faction has a bit, if not its enemy mask is missing some of them
+	 * @param factionID the faction to check
+	 * @return whether the enemy mask of the faction is complete
+	 */
+	bool IsEnemyMaskComplete(int32_t factionID) const;
+
+	/**
+	 * Returns the number of factions that have a bit
+	 */
+	size_t GetFactionCount() const { return m_Bits.size(); }
+
+private:
+	FactionMatrix();
+
+	/**
+	 * Returns the bit of a faction, the faction gets one if it doesn't have one yet
+	 * @param factionID the faction to get the bit of
+	 * @param bit set to the bit of the faction
+	 * @return false if every bit is taken
+	 */
+	bool GetBit(int32_t factionID, uint32_t& bit);
+
+	static FactionMatrix* m_Address; //For singleton method
+
+	struct FactionEntry {
+		std::vector<int32_t> enemyList;
+		FactionMask enemyMask;
+		bool enemyMaskComplete = true;
+	};
+
+	/**
+	 * The bit of every faction that has one, given out in the order the factions are first seen
+	 */
+	std::unordered_map<int32_t, uint32_t> m_Bits;
+
+	std::unordered_map<int32_t, FactionEntry> m_Factions;
+
+	bool m_WarnedFull = false;
+};
@@ -3,7 +3,6 @@
 #include "Game.h"
 #include "dLogger.h"
 
-#include <sstream>
 
 #include "InventoryComponent.h"
 #include "MissionComponent.h"
@@ -14,42 +13,14 @@
 #include "GameMessages.h"
 
 
-std::map<uint32_t, Precondition*> Preconditions::cache = {};
+bool Preconditions::loaded = false;
 
-Precondition::Precondition(const uint32_t condition) {
-	auto query = CDClientDatabase::CreatePreppedStmt(
-		"SELECT type, targetLOT, targetCount FROM Preconditions WHERE id = ?;");
-	query.bind(1, (int)condition);
+std::unordered_map<uint32_t, Precondition> Preconditions::cache = {};
 
-	auto result = query.execQuery();
+std::unordered_map<std::string, PreconditionExpression> Preconditions::expressions = {};
 
-	if (result.eof()) {
-		this->type = PreconditionType::ItemEquipped;
-		this->count = 1;
-		this->values = { 0 };
-
-		Game::logger->Log("Precondition", "Failed to find precondition of id (%i)!", condition);
-
-		return;
-	}
-
-	this->type = static_cast<PreconditionType>(result.fieldIsNull(0) ? 0 : result.getIntField(0));
-
-	if (!result.fieldIsNull(1)) {
-		std::istringstream stream(result.getStringField(1));
-		std::string token;
-
-		while (std::getline(stream, token, ',')) {
-			uint32_t value;
-			if (GeneralUtils::TryParse(token, value)) {
-				this->values.push_back(value);
-			}
-		}
-	}
-
-	this->count = result.fieldIsNull(2) ? 1 : result.getIntField(2);
-
-	result.finalize();
+Precondition::Precondition(const PreconditionType type, std::vector<uint32_t> values, const uint32_t count)
+	: type(type), values(std::move(values)), count(count) {
 }
 
 
@@ -205,69 +176,32 @@ PreconditionExpression::PreconditionExpression(const std::string& conditions) {
 		return;
 	}
 
-	std::stringstream a;
-	std::stringstream b;
-
-	auto bor = false;
-
-	auto done = false;
-
-	for (auto i = 0u; i < conditions.size(); ++i) {
-		if (done) {
-			break;
-		}
-
-		const auto character = conditions[i];
+	// Every separator ends a term, the numbers in between are its condition.
+	// Parentheses are not nested, an expression is read as a op (b op (c ...)).
+	uint32_t condition = 0;
 
+	for (const auto character : conditions) {
 		switch (character) {
 		case '|':
-			bor = true;
-			b << conditions.substr(i + 1);
-			done = true;
-			break;
-		case ' ':
-		case ')':
-			break;
 		case ',':
 		case '&':
 		case ';':
 		case '(':
-			b << conditions.substr(i + 1);
-			done = true;
-			break;
-		case '0':
-		case '1':
-		case '2':
-		case '3':
-		case '4':
-		case '5':
-		case '6':
-		case '7':
-		case '8':
-		case '9':
-			a << character;
+			terms.push_back({ condition, Preconditions::GetPrecondition(condition), character == '|' });
+			condition = 0;
 			break;
 		default:
+			if (character >= '0' && character <= '9') {
+				condition = condition * 10 + (character - '0');
+			}
 			break;
 		}
 	}
 
-	this->m_or = bor;
-
-	const auto aString = a.str();
-
-	if (!aString.empty()) {
-		this->condition = std::stoul(a.str());
-	} else {
-		this->condition = 0;
-	}
-
-	const auto bString = b.str();
-
-	if (!bString.empty()) {
-		this->next = new PreconditionExpression(bString);
-	} else {
-		this->next = nullptr;
+	// Anything after the last separator, even without a number, is another term.
+	const auto last = conditions.back();
+	if (last != '|' && last != ',' && last != '&' && last != ';' && last != '(') {
+		terms.push_back({ condition, Preconditions::GetPrecondition(condition), false });
 	}
 }
 
@@ -277,48 +211,91 @@ bool PreconditionExpression::Check(Entity* player, bool evaluateCosts) const {
 		return true;
 	}
 
-	const auto a = Preconditions::Check(player, condition, evaluateCosts);
+	// The terms are checked in order, which leaves the rest of the expression unknown when a term is combined.
+	// Combining with the rest either fixes the result or passes the rest through, so only that has to be tracked.
+	auto decided = false;
+	auto result = true;
+
+	for (const auto& term : terms) {
+		const auto passed = term.precondition->Check(player, evaluateCosts);
+
+		if (!passed) {
+			GameMessages::SendNotifyClientFailedPrecondition(player->GetObjectID(), player->GetSystemAddress(), u"", term.condition);
+		}
 
-	if (!a) {
-		GameMessages::SendNotifyClientFailedPrecondition(player->GetObjectID(), player->GetSystemAddress(), u"", condition);
+		if (decided) continue;
+
+		if (term.m_or && passed) {
+			decided = true;
+			result = true;
+		} else if (!term.m_or && !passed) {
+			decided = true;
+			result = false;
+		}
 	}
 
-	const auto b = next == nullptr ? true : next->Check(player, evaluateCosts);
+	return result;
+}
 
-	return m_or ? a || b : a && b;
+
+bool Preconditions::Check(Entity* player, const uint32_t condition, bool evaluateCosts) {
+	return GetPrecondition(condition)->Check(player, evaluateCosts);
 }
 
-PreconditionExpression::~PreconditionExpression() {
-	delete next;
+
+const PreconditionExpression* Preconditions::GetExpression(const std::string& conditions) {
+	const auto& index = expressions.find(conditions);
+
+	if (index != expressions.end()) {
+		return &index->second;
+	}
+
+	return &expressions.emplace(conditions, PreconditionExpression(conditions)).first->second;
 }
 
 
-bool Preconditions::Check(Entity* player, const uint32_t condition, bool evaluateCosts) {
-	Precondition* precondition;
+const Precondition* Preconditions::GetPrecondition(const uint32_t condition) {
+	if (!loaded) {
+		LoadPreconditions();
+	}
 
 	const auto& index = cache.find(condition);
 
 	if (index != cache.end()) {
-		precondition = index->second;
-	} else {
-		precondition = new Precondition(condition);
-
-		cache.insert_or_assign(condition, precondition);
+		return &index->second;
 	}
 
-	return precondition->Check(player, evaluateCosts);
+	Game::logger->Log("Precondition", "Failed to find precondition of id (%i)!", condition);
+
+	return &cache.emplace(condition, Precondition(PreconditionType::ItemEquipped, { 0 }, 1)).first->second;
 }
 
 
-PreconditionExpression Preconditions::CreateExpression(const std::string& conditions) {
-	return PreconditionExpression(conditions);
-}
+void Preconditions::LoadPreconditions() {
+	loaded = true;
+
+	auto result = CDClientDatabase::ExecuteQuery("SELECT id, type, targetLOT, targetCount FROM Preconditions;");
+
+	while (!result.eof()) {
+		const auto type = static_cast<PreconditionType>(result.fieldIsNull(1) ? 0 : result.getIntField(1));
 
+		std::vector<uint32_t> values;
 
-Preconditions::~Preconditions() {
-	for (const auto& condition : cache) {
-		delete condition.second;
+		if (!result.fieldIsNull(2)) {
+			for (const auto& token : GeneralUtils::SplitString(result.getStringField(2), ',')) {
+				uint32_t value;
+				if (GeneralUtils::TryParse(token, value)) {
+					values.push_back(value);
+				}
+			}
+		}
+
+		const auto count = result.fieldIsNull(3) ? 1 : result.getIntField(3);
+
+		cache.emplace(result.getIntField(0), Precondition(type, std::move(values), count));
+
+		result.nextRow();
 	}
 
-	cache.clear();
+	result.finalize();
 }
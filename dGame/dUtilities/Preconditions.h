@@ -1,5 +1,7 @@
 #pragma once
 #include <vector>
+#include <string>
+#include <unordered_map>
 
 #include "Entity.h"
 
@@ -33,7 +35,7 @@ enum class PreconditionType
 class Precondition final
 {
 public:
-	explicit Precondition(uint32_t condition);
+	Precondition(PreconditionType type, std::vector<uint32_t> values, uint32_t count);
 
 	bool Check(Entity* player, bool evaluateCosts = false) const;
 
@@ -48,6 +50,10 @@ private:
 };
 
 
+/**
+ * A precondition string compiled into the list of preconditions it checks.
+ * Expressions are shared, get them from Preconditions::GetExpression instead of constructing them.
+ */
 class PreconditionExpression final
 {
 public:
@@ -55,16 +61,21 @@ public:
 
 	bool Check(Entity* player, bool evaluateCosts = false) const;
 
-	~PreconditionExpression();
-
 private:
-	uint32_t condition = 0;
+	struct Term {
+		uint32_t condition;
 
-	bool m_or = false;
+		const Precondition* precondition;
 
-	bool empty = false;
+		/**
+		 * Whether this term is or'ed with the rest of the expression instead of and'ed
+		 */
+		bool m_or;
+	};
 
-	PreconditionExpression* next = nullptr;
+	std::vector<Term> terms;
+
+	bool empty = false;
 };
 
 class Preconditions final
@@ -72,10 +83,26 @@ class Preconditions final
 public:
 	static bool Check(Entity* player, uint32_t condition, bool evaluateCosts = false);
 
-	static PreconditionExpression CreateExpression(const std::string& conditions);
+	/**
+	 * Returns the compiled expression for a precondition string, compiling it the first time it is seen
+	 * @param conditions the precondition string
+	 * @return the compiled expression, valid for the lifetime of the server
+	 */
+	static const PreconditionExpression* GetExpression(const std::string& conditions);
 
-	~Preconditions();
+	/**
+	 * Returns a precondition from the Preconditions table, loading the whole table the first time it is called
+	 * @param condition the ID of the precondition
+	 * @return the precondition, a precondition that always fails if the ID is not in the table
+	 */
+	static const Precondition* GetPrecondition(uint32_t condition);
 
 private:
-	static std::map<uint32_t, Precondition*> cache;
+	static void LoadPreconditions();
+
+	static bool loaded;
+
+	static std::unordered_map<uint32_t, Precondition> cache;
+
+	static std::unordered_map<std::string, PreconditionExpression> expressions;
 };
@@ -27,6 +27,7 @@
 #include "CharacterComponent.h"
 #include "ChatPackets.h"
 #include "ControllablePhysicsComponent.h"
+#include "CppScripts.h"
 #include "Database.h"
 #include "DestroyableComponent.h"
 #include "Entity.h"
@@ -1846,6 +1847,17 @@ void SlashCommandHandler::HandleChatCommand(const std::u16string& command, Entit
 			sysAddr,
 			u"Process ID: " + GeneralUtils::to_u16string(Metrics::GetProcessID()));
 
+		// The scripts most entities in this world use
+		const auto scriptUsage = CppScripts::GetScriptUsage();
+
+		for (size_t i = 0; i < scriptUsage.size() && i < 5; i++) {
+			const auto& [scriptName, uses] = scriptUsage[i];
+
+			ChatPackets::SendSystemMessage(
+				sysAddr,
+				GeneralUtils::ASCIIToUTF16(scriptName.empty() ? "(no script)" : scriptName) + u": " + GeneralUtils::to_u16string(uses) + u" uses");
+		}
+
 		return;
 	}
 
@@ -1853,13 +1865,7 @@ void SlashCommandHandler::HandleChatCommand(const std::u16string& command, Entit
 		Game::config->ReloadConfig();
 		VanityUtilities::SpawnVanity();
 		dpWorld::Instance().Reload();
-		auto entities = EntityManager::Instance()->GetEntitiesByComponent(COMPONENT_TYPE_SCRIPTED_ACTIVITY);
-		for (auto entity : entities) {
-			auto* scriptedActivityComponent = entity->GetComponent<ScriptedActivityComponent>();
-			if (!scriptedActivityComponent) continue;
-
-			scriptedActivityComponent->ReloadConfig();
-		}
+		ScriptedActivityComponent::ReloadAllConfigs();
 		Game::server->UpdateBandwidthLimit();
 		ChatPackets::SendSystemMessage(sysAddr, u"Successfully reloaded config for world!");
 	}
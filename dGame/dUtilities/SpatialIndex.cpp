@@ -0,0 +1,322 @@
+#include "SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Entity.h"
+#include "DestroyableComponent.h"
+
+SpatialIndex* SpatialIndex::m_Address = nullptr; //For singleton method
+
+bool SpatialFilter::Matches(Entity* entity) const {
+	if (exclude != LWOOBJID_EMPTY && entity->GetObjectID() == exclude) return false;
+
+	if (lot != LOT_NULL && entity->GetLOT() != lot) return false;
+
+	if (componentType != -1 && !entity->HasComponent(componentType)) return false;
+
+	if (faction != -1) {
+		auto* destroyableComponent = entity->GetComponent<DestroyableComponent>();
+
+		if (destroyableComponent == nullptr || !destroyableComponent->HasFaction(faction)) return false;
+	}
+
+	if (!group.empty()) {
+		const auto& groups = entity->GetGroups();
+
+		if (std::find(groups.begin(), groups.end(), group) == groups.end()) return false;
+	}
+
+	return !predicate || predicate(entity);
+}
+
+SpatialIndex::SpatialIndex(const float cellSize) {
+	m_CellSize = cellSize;
+
+	Clear();
+}
+
+void SpatialIndex::Add(Entity* entity) {
+	if (entity == nullptr) return;
+
+	const auto objectID = entity->GetObjectID();
+
+	const auto location = m_Locations.find(objectID);
+
+	if (location != m_Locations.end()) {
+		Erase(location->second);
+	}
+
+	Insert(entity, objectID, entity->GetPosition());
+}
+
+void SpatialIndex::Remove(const LWOOBJID objectID) {
+	const auto location = m_Locations.find(objectID);
+
+	if (location == m_Locations.end()) return;
+
+	Erase(location->second);
+
+	m_Locations.erase(location);
+}
+
+void SpatialIndex::Move(Entity* entity) {
+	const auto location = m_Locations.find(entity->GetObjectID());
+
+	if (location == m_Locations.end()) return;
+
+	const auto& position = entity->GetPosition();
+
+	const auto cell = GetCellKey(GetCellCoordinate(position.x), GetCellCoordinate(position.z));
+
+	// Moving within a cell only updates the position
+	if (cell == location->second.cell) {
+		m_Cells[cell][location->second.index].position = position;
+
+		return;
+	}
+
+	Erase(location->second);
+	Insert(entity, entity->GetObjectID(), position);
+}
+
+Entity* SpatialIndex::FindNearest(const NiPoint3& position, const SpatialFilter& filter, const float maxDistance) const {
+	const auto found = FindNearest(position, 1, filter, maxDistance);
+
+	return found.empty() ? nullptr : found[0];
+}
+
+std::vector<Entity*> SpatialIndex::FindNearest(const NiPoint3& position, const size_t count, const SpatialFilter& filter, const float maxDistance) const {
+	std::vector<Entity*> found;
+
+	if (count == 0 || m_Locations.empty() || maxDistance < 0.0f) return found;
+
+	const int64_t x = GetCellCoordinate(position.x);
+	const int64_t z = GetCellCoordinate(position.z);
+
+	// Rings of cells past the furthest cell that has had entities can't have any
+	int64_t rings = std::max({ x - m_MinX, m_MaxX - x, z - m_MinZ, m_MaxZ - z, int64_t(0) });
+
+	if (maxDistance < std::numeric_limits<float>::max()) {
+		rings = std::min(rings, static_cast<int64_t>(maxDistance / m_CellSize) + 1);
+	}
+
+	std::vector<Match> heap;
+
+	// Searching ring by ring would visit more empty cells than there are cells with entities
+	const auto side = static_cast<double>(2 * rings + 1);
+
+	if (side * side > static_cast<double>(m_Cells.size())) {
+		for (const auto& [key, records] : m_Cells) {
+			const auto cellX = static_cast<int32_t>(key >> 32);
+			const auto cellZ = static_cast<int32_t>(static_cast<uint32_t>(key));
+
+			CollectNearest(cellX, cellZ, position, maxDistance, count, filter, heap);
+		}
+	} else {
+		for (int64_t ring = 0; ring <= rings; ring++) {
+			// Every cell in this ring and further out is at least this far away
+			if (ring > 0 && heap.size() == count) {
+				const auto closest = static_cast<float>(ring - 1) * m_CellSize;
+
+				if (heap.front().distance < closest * closest) break;
+			}
+
+			if (ring == 0) {
+				CollectNearest(x, z, position, maxDistance, count, filter, heap);
+
+				continue;
+			}
+
+			for (auto offset = -ring; offset <= ring; offset++) {
+				CollectNearest(x + offset, z - ring, position, maxDistance, count, filter, heap);
+				CollectNearest(x + offset, z + ring, position, maxDistance, count, filter, heap);
+			}
+
+			for (auto offset = -ring + 1; offset < ring; offset++) {
+				CollectNearest(x - ring, z + offset, position, maxDistance, count, filter, heap);
+				CollectNearest(x + ring, z + offset, position, maxDistance, count, filter, heap);
+			}
+		}
+	}
+
+	std::sort_heap(heap.begin(), heap.end());
+
+	found.reserve(heap.size());
+
+	for (const auto& match : heap) {
+		found.push_back(match.record->entity);
+	}
+
+	return found;
+}
+
+std::vector<Entity*> SpatialIndex::FindInRadius(const NiPoint3& position, const float radius, const SpatialFilter& filter) const {
+	std::vector<Match> matches;
+
+	Collect(position, radius, filter, matches);
+
+	std::vector<Entity*> found;
+	found.reserve(matches.size());
+
+	for (const auto& match : matches) {
+		found.push_back(match.record->entity);
+	}
+
+	return found;
+}
+
+std::vector<Entity*> SpatialIndex::FindInCone(const NiPoint3& position, const NiPoint3& direction, const float angle, const float range, const SpatialFilter& filter) const {
+	std::vector<Match> matches;
+
+	Collect(position, range, filter, matches);
+
+	const auto forward = direction.Unitize();
+	const auto cosine = std::cos(angle * 3.14159265f / 180.0f);
+
+	std::vector<Entity*> found;
+
+	for (const auto& match : matches) {
+		const auto offset = match.record->position - position;
+		const auto distance = std::sqrt(match.distance);
+
+		// Something right at the tip of the cone is in it
+		if (distance != 0.0f && offset.DotProduct(forward) < cosine * distance) continue;
+
+		found.push_back(match.record->entity);
+	}
+
+	return found;
+}
+
+void SpatialIndex::Clear() {
+	m_Cells.clear();
+	m_Locations.clear();
+
+	m_MinX = std::numeric_limits<int32_t>::max();
+	m_MaxX = std::numeric_limits<int32_t>::min();
+	m_MinZ = std::numeric_limits<int32_t>::max();
+	m_MaxZ = std::numeric_limits<int32_t>::min();
+}
+
+int32_t SpatialIndex::GetCellCoordinate(const float value) const {
+	const auto cell = std::floor(value / m_CellSize);
+
+	// Keeps positions far out of any zone, or NaN, from overflowing
+	if (!(cell > -1e9f)) return -1000000000;
+	if (cell > 1e9f) return 1000000000;
+
+	return static_cast<int32_t>(cell);
+}
+
+int64_t SpatialIndex::GetCellKey(const int32_t x, const int32_t z) {
+	return static_cast<int64_t>(static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32 | static_cast<uint32_t>(z));
+}
+
+void SpatialIndex::Insert(Entity* entity, const LWOOBJID objectID, const NiPoint3& position) {
+	const auto x = GetCellCoordinate(position.x);
+	const auto z = GetCellCoordinate(position.z);
+	const auto cell = GetCellKey(x, z);
+
+	auto& records = m_Cells[cell];
+
+	m_Locations.insert_or_assign(objectID, Location{ cell, static_cast<uint32_t>(records.size()) });
+
+	records.push_back(Record{ objectID, entity, position });
+
+	m_MinX = std::min(m_MinX, x);
+	m_MaxX = std::max(m_MaxX, x);
+	m_MinZ = std::min(m_MinZ, z);
+	m_MaxZ = std::max(m_MaxZ, z);
+}
+
+void SpatialIndex::Erase(const Location& location) {
+	const auto cell = m_Cells.find(location.cell);
+
+	if (cell == m_Cells.end()) return;
+
+	auto& records = cell->second;
+
+	// Fill the gap with the last record of the cell
+	if (location.index + 1 != records.size()) {
+		records[location.index] = records.back();
+
+		m_Locations[records[location.index].objectID].index = location.index;
+	}
+
+	records.pop_back();
+
+	if (records.empty()) m_Cells.erase(cell);
+}
+
+void SpatialIndex::Collect(const NiPoint3& position, const float radius, const SpatialFilter& filter, std::vector<Match>& matches) const {
+	if (radius < 0.0f) return;
+
+	const auto radiusSquared = radius * radius;
+
+	const auto check = [&](const std::vector<Record>& records) {
+		for (const auto& record : records) {
+			const auto distance = NiPoint3::DistanceSquared(position, record.position);
+
+			if (distance > radiusSquared || !filter.Matches(record.entity)) continue;
+
+			matches.push_back(Match{ distance, &record });
+		}
+	};
+
+	const int64_t minX = GetCellCoordinate(position.x - radius);
+	const int64_t maxX = GetCellCoordinate(position.x + radius);
+	const int64_t minZ = GetCellCoordinate(position.z - radius);
+	const int64_t maxZ = GetCellCoordinate(position.z + radius);
+
+	const auto cellCount = static_cast<double>(maxX - minX + 1) * static_cast<double>(maxZ - minZ + 1);
+
+	// A radius covering more cells than have entities is quicker to answer from the cells that do
+	if (cellCount > static_cast<double>(m_Cells.size())) {
+		for (const auto& [key, records] : m_Cells) {
+			const auto cellX = static_cast<int32_t>(key >> 32);
+			const auto cellZ = static_cast<int32_t>(static_cast<uint32_t>(key));
+
+			if (cellX < minX || cellX > maxX || cellZ < minZ || cellZ > maxZ) continue;
+
+			check(records);
+		}
+	} else {
+		for (auto x = minX; x <= maxX; x++) {
+			for (auto z = minZ; z <= maxZ; z++) {
+				const auto cell = m_Cells.find(GetCellKey(static_cast<int32_t>(x), static_cast<int32_t>(z)));
+
+				if (cell != m_Cells.end()) check(cell->second);
+			}
+		}
+	}
+
+	std::sort(matches.begin(), matches.end());
+}
+
+void SpatialIndex::CollectNearest(const int32_t x, const int32_t z, const NiPoint3& position, const float maxDistance, const size_t count, const SpatialFilter& filter, std::vector<Match>& heap) const {
+	const auto cell = m_Cells.find(GetCellKey(x, z));
+
+	if (cell == m_Cells.end()) return;
+
+	const auto maxDistanceSquared = maxDistance * maxDistance;
+
+	for (const auto& record : cell->second) {
+		const Match match{ NiPoint3::DistanceSquared(position, record.position), &record };
+
+		if (match.distance > maxDistanceSquared) continue;
+
+		// Only closer than the furthest of a full heap can get in, checked before the filter as that is slower
+		if (heap.size() == count && !(match < heap.front())) continue;
+
+		if (!filter.Matches(record.entity)) continue;
+
+		if (heap.size() == count) {
+			std::pop_heap(heap.begin(), heap.end());
+			heap.pop_back();
+		}
+
+		heap.push_back(match);
+		std::push_heap(heap.begin(), heap.end());
+	}
+}
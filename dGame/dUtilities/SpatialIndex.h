@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dCommonVars.h"
+#include "NiPoint3.h"
+
+class Entity;
+
+/**
+ * What the entities found by a spatial query have to match, every field that is set has to match
+ */
+struct SpatialFilter {
+	LOT lot = LOT_NULL;
+
+	/**
+	 * A component type the entity has, -1 for any
+	 */
+	int32_t componentType = -1;
+
+	/**
+	 * A group the entity is in, empty for any
+	 */
+	std::string group;
+
+	/**
+	 * A faction the entity is in, -1 for any
+	 */
+	int32_t faction = -1;
+
+	/**
+	 * An entity to leave out, usually the one asking
+	 */
+	LWOOBJID exclude = LWOOBJID_EMPTY;
+
+	/**
+	 * Any other check the entity has to pass, run last
+	 */
+	std::function<bool(Entity*)> predicate;
+
+	bool Matches(Entity* entity) const;
+};
+
+/**
+ * Every entity in the zone placed in a grid on the horizontal plane, so the entities near a position are found by
+ * looking at the cells around it instead of every entity. Entities are moved between cells as their physics
+ * components move them. Results are ordered by distance, then by object ID, so they don't depend on the order
+ * entities were added in.
+ */
+class SpatialIndex {
+public:
+	static SpatialIndex* Instance() {
+		if (!m_Address) {
+			m_Address = new SpatialIndex();
+		}
+
+		return m_Address;
+	}
+
+	/**
+	 * Adds an entity at its current position
+	 * @param entity the entity to add
+	 */
+	void Add(Entity* entity);
+
+	/**
+	 * Removes an entity, nothing happens if it wasn't added
+	 * @param objectID the ID of the entity to remove
+	 */
+	void Remove(LWOOBJID objectID);
+
+	/**
+	 * Updates the position of an entity after it moved, nothing happens if it wasn't added
+	 * @param entity the entity that moved
+	 */
+	void Move(Entity* entity);
+
+	/**
+	 * Finds the entity closest to a position
+	 * @param position the position to search around
+	 * @param filter what the entity has to match
+	 * @param maxDistance how far from the position the entity can be
+	 * @return the closest entity, or nullptr if none matched
+	 */
+	Entity* FindNearest(const NiPoint3& position, const SpatialFilter& filter = {}, float maxDistance = std::numeric_limits<float>::max()) const;
+
+	/**
+	 * Finds the entities closest to a position
+	 * @param position the position to search around
+	 * @param count how many entities to find at most
+	 * @param filter what the entities have to match
+	 * @param maxDistance how far from the position the entities can be
+	 * @return the closest entities, closest first
+	 */
+	std::vector<Entity*> FindNearest(const NiPoint3& position, size_t count, const SpatialFilter& filter = {}, float maxDistance = std::numeric_limits<float>::max()) const;
+
+	/**
+	 * Finds the entities within a distance of a position
+	 * @param position the position to search around
+	 * @param radius how far from the position the entities can be
+	 * @param filter what the entities have to match
+	 * @return the entities in the radius, closest first
+	 */
+	std::vector<Entity*> FindInRadius(const NiPoint3& position, float radius, const SpatialFilter& filter = {}) const;
+
+	/**
+	 * Finds the entities in a cone, such as the ones in front of an entity
+	 * @param position the tip of the cone
+	 * @param direction the direction the cone points in
+	 * @param angle the angle between the direction and the side of the cone, in degrees
+	 * @param range how far from the tip the entities can be
+	 * @param filter what the entities have to match
+	 * @return the entities in the cone, closest first
+	 */
+	std::vector<Entity*> FindInCone(const NiPoint3& position, const NiPoint3& direction, float angle, float range, const SpatialFilter& filter = {}) const;
+
+	/**
+	 * Returns the number of entities in the index
+	 */
+	size_t GetCount() const { return m_Locations.size(); }
+
+	/**
+	 * Removes every entity
+	 */
+	void Clear();
+
+private:
+	SpatialIndex(float cellSize = 32.0f);
+
+	struct Record {
+		LWOOBJID objectID;
+		Entity* entity;
+		NiPoint3 position;
+	};
+
+	struct Location {
+		int64_t cell;
+		uint32_t index;
+	};
+
+	/**
+	 * A record found by a query, with its squared distance to the position searched around
+	 */
+	struct Match {
+		float distance;
+		const Record* record;
+
+		bool operator<(const Match& other) const {
+			if (distance != other.distance) return distance < other.distance;
+			return record->objectID < other.record->objectID;
+		}
+	};
+
+	int32_t GetCellCoordinate(float value) const;
+
+	static int64_t GetCellKey(int32_t x, int32_t z);
+
+	void Insert(Entity* entity, LWOOBJID objectID, const NiPoint3& position);
+
+	void Erase(const Location& location);
+
+	/**
+	 * Collects the records that match a filter within a distance of a position
+	 */
+	void Collect(const NiPoint3& position, float radius, const SpatialFilter& filter, std::vector<Match>& matches) const;
+
+	/**
+	 * Checks the records in a cell, keeping the closest count matches in a heap with the furthest on top
+	 */
+	void CollectNearest(int32_t x, int32_t z, const NiPoint3& position, float maxDistance, size_t count, const SpatialFilter& filter, std::vector<Match>& heap) const;
+
+	static SpatialIndex* m_Address; //For singleton method
+
+	float m_CellSize;
+
+	std::unordered_map<int64_t, std::vector<Record>> m_Cells;
+
+	std::unordered_map<LWOOBJID, Location> m_Locations;
+
+	/**
+	 * The range of cells that have had entities in them, the searches for the nearest entities stop at it
+	 */
+	int32_t m_MinX = 0;
+	int32_t m_MaxX = 0;
+	int32_t m_MinZ = 0;
+	int32_t m_MaxZ = 0;
+};
@@ -0,0 +1,124 @@
+#include "VendorStock.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "CDClientManager.h"
+#include "CDLootMatrixTable.h"
+#include "CDLootTableTable.h"
+#include "GeneralUtils.h"
+
+VendorStock* VendorStock::m_Address = nullptr; //For singleton method
+
+VendorStock::VendorStock() {
+	auto* vendorComponentTable = CDClientManager::Instance()->GetTable<CDVendorComponentTable>("VendorComponent");
+	auto* lootMatrixTable = CDClientManager::Instance()->GetTable<CDLootMatrixTable>("LootMatrix");
+	auto* lootTableTable = CDClientManager::Instance()->GetTable<CDLootTableTable>("LootTable");
+
+	std::unordered_set<uint32_t> vendorMatrices;
+
+	for (const auto& vendorComponent : vendorComponentTable->GetEntries()) {
+		// The first row with an ID is the one vendors used
+		m_VendorComponents.insert({ static_cast<int32_t>(vendorComponent.id), vendorComponent });
+
+		vendorMatrices.insert(vendorComponent.LootMatrixIndex);
+	}
+
+	// The rows of the vendor loot matrices in table order, and the items of the loot tables they use
+	std::unordered_map<uint32_t, std::vector<const CDLootMatrix*>> matrices;
+	std::unordered_map<uint32_t, std::vector<std::pair<LOT, int>>> tables;
+
+	for (const auto& row : lootMatrixTable->GetEntries()) {
+		if (vendorMatrices.find(row.LootMatrixIndex) == vendorMatrices.end()) continue;
+
+		matrices[row.LootMatrixIndex].push_back(&row);
+		tables[row.LootTableIndex];
+	}
+
+	for (const auto& item : lootTableTable->GetEntries()) {
+		const auto table = tables.find(item.LootTableIndex);
+
+		if (table == tables.end()) continue;
+
+		table->second.emplace_back(static_cast<LOT>(item.itemid), static_cast<int>(item.sortPriority));
+	}
+
+	for (const auto& [index, rows] : matrices) {
+		std::vector<VendorStockEntry> entries;
+		entries.reserve(rows.size());
+
+		for (const auto* row : rows) {
+			entries.push_back(VendorStockEntry{ tables[row->LootTableIndex], row->minToDrop, row->maxToDrop });
+		}
+
+		m_Templates.insert({ index, Compile(std::move(entries)) });
+	}
+}
+
+const CDVendorComponent* VendorStock::GetVendorComponent(const int32_t componentID) const {
+	const auto vendorComponent = m_VendorComponents.find(componentID);
+
+	return vendorComponent != m_VendorComponents.end() ? &vendorComponent->second : nullptr;
+}
+
+const VendorStockTemplate* VendorStock::GetTemplate(const uint32_t lootMatrixIndex) const {
+	const auto stockTemplate = m_Templates.find(lootMatrixIndex);
+
+	return stockTemplate != m_Templates.end() ? &stockTemplate->second : nullptr;
+}
+
+VendorStockTemplate VendorStock::Compile(std::vector<VendorStockEntry> entries) {
+	VendorStockTemplate stockTemplate{};
+	stockTemplate.entries = std::move(entries);
+
+	const auto isRandom = std::any_of(stockTemplate.entries.begin(), stockTemplate.entries.end(), [](const VendorStockEntry& entry) {
+		return entry.IsRandom();
+		});
+
+	if (!isRandom) {
+		auto inventory = std::make_shared<VendorInventory>();
+
+		Fill(stockTemplate, *inventory);
+
+		stockTemplate.shared = std::move(inventory);
+	}
+
+	return stockTemplate;
+}
+
+std::shared_ptr<const VendorInventory> VendorStock::Roll(const VendorStockTemplate& stockTemplate) {
+	if (stockTemplate.shared != nullptr) return stockTemplate.shared;
+
+	auto inventory = std::make_shared<VendorInventory>();
+
+	Fill(stockTemplate, *inventory);
+
+	return inventory;
+}
+
+void VendorStock::Fill(const VendorStockTemplate& stockTemplate, VendorInventory& inventory) {
+	std::vector<std::pair<LOT, int>> candidates;
+
+	for (const auto& entry : stockTemplate.entries) {
+		if (!entry.IsRandom()) {
+			for (const auto& item : entry.candidates) {
+				inventory.insert(item);
+			}
+
+			continue;
+		}
+
+		const auto count = GeneralUtils::GenerateRandomNumber<int32_t>(entry.minToDrop, entry.maxToDrop);
+
+		// Pick without putting back by swapping the picked items to the front
+		candidates = entry.candidates;
+
+		for (size_t i = 0; i < static_cast<size_t>(count) && i < candidates.size(); i++) {
+			const auto pick = GeneralUtils::GenerateRandomNumber<size_t>(i, candidates.size() - 1);
+
+			std::swap(candidates[i], candidates[pick]);
+
+			inventory.insert(candidates[i]);
+		}
+	}
+}
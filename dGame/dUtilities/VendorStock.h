@@ -0,0 +1,102 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "dCommonVars.h"
+#include "CDVendorComponentTable.h"
+
+/**
+ * The items a vendor sells, with the sort priority of each
+ */
+typedef std::map<LOT, int> VendorInventory;
+
+/**
+ * A row of the loot matrix of a vendor, compiled from the LootMatrix and LootTable tables
+ */
+struct VendorStockEntry {
+	/**
+	 * The items of the loot table of the row, with their sort priority
+	 */
+	std::vector<std::pair<LOT, int>> candidates;
+
+	/**
+	 * How many of the candidates are picked at random on a restock, the vendor sells all of them if either is 0
+	 */
+	uint32_t minToDrop;
+	uint32_t maxToDrop;
+
+	bool IsRandom() const { return minToDrop != 0 && maxToDrop != 0; }
+};
+
+/**
+ * The stock of the vendors that use a loot matrix. Templates without random rows always stock the same items,
+ * so every vendor using one shares its inventory.
+ */
+struct VendorStockTemplate {
+	std::vector<VendorStockEntry> entries;
+
+	/**
+	 * The inventory every vendor with this template has, nullptr if the template has random rows
+	 */
+	std::shared_ptr<const VendorInventory> shared;
+};
+
+/**
+ * The VendorComponent table and the stock of every vendor loot matrix, read from the tables once per world instead
+ * of per vendor. Restocks pick from the compiled candidates without going back to the tables.
+ */
+class VendorStock {
+public:
+	static VendorStock* Instance() {
+		if (!m_Address) {
+			m_Address = new VendorStock();
+		}
+
+		return m_Address;
+	}
+
+	/**
+	 * Returns a row of the VendorComponent table
+	 * @param componentID the ID of the row
+	 * @return the row, or nullptr if there is none with the ID
+	 */
+	const CDVendorComponent* GetVendorComponent(int32_t componentID) const;
+
+	/**
+	 * Returns the stock template of a loot matrix
+	 * @param lootMatrixIndex the index of the loot matrix
+	 * @return the template, or nullptr if the loot matrix has no rows
+	 */
+	const VendorStockTemplate* GetTemplate(uint32_t lootMatrixIndex) const;
+
+	/**
+	 * Rolls the inventory of a vendor from a template. Templates without random rows return their shared inventory.
+	 * @param stockTemplate the template to roll
+	 * @return the inventory of the vendor
+	 */
+	static std::shared_ptr<const VendorInventory> Roll(const VendorStockTemplate& stockTemplate);
+
+	/**
+	 * Builds the template of a list of rows
+	 * @param entries the rows of the loot matrix, in table order
+	 * @return the template
+	 */
+	static VendorStockTemplate Compile(std::vector<VendorStockEntry> entries);
+
+private:
+	VendorStock();
+
+	/**
+	 * Adds the items of the rows of a template to an inventory, picking from the random rows
+	 */
+	static void Fill(const VendorStockTemplate& stockTemplate, VendorInventory& inventory);
+
+	static VendorStock* m_Address; //For singleton method
+
+	std::unordered_map<int32_t, CDVendorComponent> m_VendorComponents;
+
+	std::unordered_map<uint32_t, VendorStockTemplate> m_Templates;
+};
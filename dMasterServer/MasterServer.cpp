@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <ctime>
@@ -405,14 +406,20 @@ void HandlePacket(Packet* packet) {
 	if (packet->data[1] == MASTER) {
 		switch (packet->data[3]) {
 		case MSG_MASTER_REQUEST_PERSISTENT_ID: {
-			Game::logger->Log("MasterServer", "A persistent ID req");
 			RakNet::BitStream inStream(packet->data, packet->length, false);
 			uint64_t header = inStream.Read(header);
 			uint64_t requestID = 0;
 			inStream.Read(requestID);
 
-			uint32_t objID = ObjectIDManager::Instance()->GeneratePersistentID();
-			MasterPackets::SendPersistentIDResponse(Game::server, packet->systemAddress, requestID, objID);
+			// Worlds from before leasing ask for a single ID without a count
+			uint32_t count = 1;
+			inStream.Read(count);
+			count = std::clamp<uint32_t>(count, 1, ObjectIDManager::MAX_LEASE_SIZE);
+
+			Game::logger->Log("MasterServer", "A persistent ID req for %u IDs", count);
+
+			uint32_t objID = ObjectIDManager::Instance()->GeneratePersistentIDs(count);
+			MasterPackets::SendPersistentIDResponse(Game::server, packet->systemAddress, requestID, objID, count);
 			break;
 		}
 
@@ -746,6 +753,26 @@ void HandlePacket(Packet* packet) {
 			break;
 		}
 
+		case MSG_MASTER_PROPERTY_LISTING_CHANGED: {
+			RakNet::BitStream inStream(packet->data, packet->length, false);
+			uint64_t header = inStream.Read(header);
+
+			LWOMAPID mapId = LWOMAPID_INVALID;
+			inStream.Read(mapId);
+
+			// Any world can have a property launcher listing the map
+			CBITSTREAM;
+			PacketUtils::WriteHeader(bitStream, MASTER, MSG_MASTER_PROPERTY_LISTING_CHANGED);
+			bitStream.Write(mapId);
+
+			for (auto* instance : Game::im->GetInstances()) {
+				if (instance == nullptr || instance->GetSysAddr() == packet->systemAddress) continue;
+
+				Game::server->Send(&bitStream, instance->GetSysAddr(), false);
+			}
+			break;
+		}
+
 		case MSG_MASTER_GET_INSTANCES: {
 			RakNet::BitStream inStream(packet->data, packet->length, false);
 			uint64_t header = inStream.Read(header);
@@ -48,16 +48,17 @@ void ObjectIDManager::Initialize(dLogger* logger) {
 
 //! Generates a new persistent ID
 uint32_t ObjectIDManager::GeneratePersistentID(void) {
-	uint32_t toReturn = ++this->currentPersistentID;
+	return GeneratePersistentIDs(1);
+}
 
-	// So we peroidically save our ObjID to the database:
-	// if (toReturn % 25 == 0) { // TEMP: DISABLED FOR DEBUG / DEVELOPMENT!
-		sql::PreparedStatement* stmt = Database::CreatePreppedStmt(
-			"UPDATE object_id_tracker SET last_object_id=?");
-		stmt->setUInt(1, toReturn);
-		stmt->execute();
-		delete stmt;
-	// }
+//! Generates a block of new persistent IDs
+uint32_t ObjectIDManager::GeneratePersistentIDs(uint32_t count) {
+	uint32_t toReturn = this->currentPersistentID + 1;
+
+	this->currentPersistentID += count;
+
+	// Save the high-water mark before anyone can use the IDs
+	SaveToDatabase();
 
 	return toReturn;
 }
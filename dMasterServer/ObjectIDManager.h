@@ -19,6 +19,8 @@ private:
 	uint32_t currentPersistentID;               //!< The highest current persistent ID in use
 
 public:
+	//! The most IDs a world can lease at once
+	static constexpr uint32_t MAX_LEASE_SIZE = 4096;
 
 	//! Return the singleton if it is initialized
 	static ObjectIDManager* TryInstance() {
@@ -43,5 +45,14 @@ public:
 	 */
 	uint32_t GeneratePersistentID(void);
 
+	//! Generates a block of new persistent IDs
+	/*!
+	  The end of the block is saved to the database before it is handed out, so IDs are never handed out twice
+	  even if master goes down before the IDs are used.
+	  \param count The number of IDs in the block
+	  \return The first ID of the block
+	 */
+	uint32_t GeneratePersistentIDs(uint32_t count);
+
 	void SaveToDatabase();
 };
@@ -31,6 +31,7 @@
 #include "dConfig.h"
 #include "CharacterComponent.h"
 #include "Database.h"
+#include "ModelBehaviorScheduler.h"
 
 
 
@@ -73,6 +74,8 @@ void ClientPackets::HandleChatMessage(const SystemAddress& sysAddr, Packet* pack
 	std::string sMessage = GeneralUtils::UTF16ToWTF8(message);
 	Game::logger->Log("Chat", "%s: %s", playerName.c_str(), sMessage.c_str());
 	ChatPackets::SendChatMessage(sysAddr, chatChannel, playerName, user->GetLoggedInChar(), isMythran, message);
+
+	ModelBehaviorScheduler::Instance()->OnChat(sMessage);
 }
 
 void ClientPackets::HandleClientPositionUpdate(const SystemAddress& sysAddr, Packet* packet) {
@@ -7,19 +7,21 @@
 
 #include <string>
 
-void MasterPackets::SendPersistentIDRequest(dServer* server, uint64_t requestID) {
+void MasterPackets::SendPersistentIDRequest(dServer* server, uint64_t requestID, uint32_t count) {
 	CBITSTREAM;
 	PacketUtils::WriteHeader(bitStream, MASTER, MSG_MASTER_REQUEST_PERSISTENT_ID);
 	bitStream.Write(requestID);
+	bitStream.Write(count);
 	server->SendToMaster(&bitStream);
 }
 
-void MasterPackets::SendPersistentIDResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, uint32_t objID) {
+void MasterPackets::SendPersistentIDResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, uint32_t objID, uint32_t count) {
 	RakNet::BitStream bitStream;
 	PacketUtils::WriteHeader(bitStream, MASTER, MSG_MASTER_REQUEST_PERSISTENT_ID_RESPONSE);
 
 	bitStream.Write(requestID);
 	bitStream.Write(objID);
+	bitStream.Write(count);
 
 	server->Send(&bitStream, sysAddr, false);
 }
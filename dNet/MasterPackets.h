@@ -8,8 +8,8 @@
 class dServer;
 
 namespace MasterPackets {
-	void SendPersistentIDRequest(dServer* server, uint64_t requestID); //Called from the World server
-	void SendPersistentIDResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, uint32_t objID);
+	void SendPersistentIDRequest(dServer* server, uint64_t requestID, uint32_t count = 1); //Called from the World server
+	void SendPersistentIDResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, uint32_t objID, uint32_t count = 1);
 
 	void SendZoneTransferRequest(dServer* server, uint64_t requestID, bool mythranShift, uint32_t zoneID, uint32_t cloneID);
 	void SendZoneTransferResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, bool mythranShift, uint32_t zoneID, uint32_t zoneInstance, uint32_t zoneClone, const std::string& serverIP, uint32_t serverPort);
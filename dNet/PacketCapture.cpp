@@ -0,0 +1,153 @@
+#include "PacketCapture.h"
+
+#include "BinaryIO.h"
+
+PacketCaptureWriter::PacketCaptureWriter(const std::string& path, const PacketCaptureHeader& header) {
+	m_File.open(path, std::ios::binary | std::ios::out | std::ios::trunc);
+
+	if (!m_File.is_open()) return;
+
+	BinaryIO::BinaryWrite(m_File, PacketCapture::MAGIC);
+	BinaryIO::BinaryWrite(m_File, PacketCapture::VERSION);
+	BinaryIO::BinaryWrite(m_File, header.zoneID);
+	BinaryIO::BinaryWrite(m_File, header.instanceID);
+	BinaryIO::BinaryWrite(m_File, header.cloneID);
+	BinaryIO::BinaryWrite(m_File, header.seed);
+	BinaryIO::BinaryWrite(m_File, header.startTime);
+}
+
+PacketCaptureWriter::~PacketCaptureWriter() {
+	if (m_File.is_open()) m_File.close();
+}
+
+void PacketCaptureWriter::WriteFrame(const float deltaTime) {
+	BinaryIO::BinaryWrite(m_File, PacketCapture::eRecordType::FRAME);
+	BinaryIO::BinaryWrite(m_File, deltaTime);
+}
+
+void PacketCaptureWriter::WritePacket(const ePacketSource source, const Packet* packet) {
+	BinaryIO::BinaryWrite(m_File, PacketCapture::eRecordType::PACKET);
+	BinaryIO::BinaryWrite(m_File, source);
+	BinaryIO::BinaryWrite(m_File, packet->systemAddress.binaryAddress);
+	BinaryIO::BinaryWrite(m_File, packet->systemAddress.port);
+	BinaryIO::BinaryWrite(m_File, static_cast<uint32_t>(packet->length));
+	m_File.write(reinterpret_cast<const char*>(packet->data), packet->length);
+
+	m_PacketCount++;
+}
+
+void PacketCaptureWriter::WriteObjectID(const uint32_t objectID) {
+	BinaryIO::BinaryWrite(m_File, PacketCapture::eRecordType::OBJECT_ID);
+	BinaryIO::BinaryWrite(m_File, objectID);
+}
+
+void PacketCaptureWriter::Flush() {
+	m_File.flush();
+}
+
+PacketCaptureReader::PacketCaptureReader(const std::string& path) {
+	m_File.open(path, std::ios::binary | std::ios::in);
+
+	if (!m_File.is_open()) return;
+
+	try {
+		BinaryIO::BinaryRead(m_File, m_Header.magic);
+		BinaryIO::BinaryRead(m_File, m_Header.version);
+		BinaryIO::BinaryRead(m_File, m_Header.zoneID);
+		BinaryIO::BinaryRead(m_File, m_Header.instanceID);
+		BinaryIO::BinaryRead(m_File, m_Header.cloneID);
+		BinaryIO::BinaryRead(m_File, m_Header.seed);
+		BinaryIO::BinaryRead(m_File, m_Header.startTime);
+	} catch (std::runtime_error&) {
+		return;
+	}
+
+	m_Valid = m_File.good() && m_Header.magic == PacketCapture::MAGIC && m_Header.version == PacketCapture::VERSION;
+
+	// The IDs generated while the world started come before the first frame
+	if (m_Valid) {
+		try {
+			ReadObjectIDs();
+		} catch (std::runtime_error&) {
+			m_Valid = false;
+		}
+	}
+}
+
+bool PacketCaptureReader::TakeObjectID(uint32_t& objectID) {
+	if (m_ObjectIDs.empty()) return false;
+
+	objectID = m_ObjectIDs.front();
+	m_ObjectIDs.pop_front();
+
+	return true;
+}
+
+bool PacketCaptureReader::ReadObjectIDs() {
+	while (m_File.peek() != EOF) {
+		BinaryIO::BinaryRead(m_File, m_NextRecord);
+
+		if (m_NextRecord != PacketCapture::eRecordType::OBJECT_ID) {
+			m_HasNextRecord = true;
+			return true;
+		}
+
+		uint32_t objectID = 0;
+		BinaryIO::BinaryRead(m_File, objectID);
+
+		if (m_File.fail()) return false;
+
+		m_ObjectIDs.push_back(objectID);
+	}
+
+	return false;
+}
+
+bool PacketCaptureReader::ReadFrame(float& deltaTime, std::vector<CapturedPacket>& packets) {
+	packets.clear();
+
+	if (!m_Valid) return false;
+
+	// A capture cut off by a crash ends with a partial record, which is treated as the end of the capture
+	try {
+		if (!m_HasNextRecord) {
+			if (m_File.peek() == EOF) return false;
+
+			BinaryIO::BinaryRead(m_File, m_NextRecord);
+		}
+
+		if (m_NextRecord != PacketCapture::eRecordType::FRAME) return false;
+
+		BinaryIO::BinaryRead(m_File, deltaTime);
+
+		if (m_File.fail()) return false;
+
+		m_HasNextRecord = false;
+
+		while (ReadObjectIDs()) {
+			if (m_NextRecord != PacketCapture::eRecordType::PACKET) break;
+
+			m_HasNextRecord = false;
+
+			CapturedPacket packet;
+			uint32_t length = 0;
+
+			BinaryIO::BinaryRead(m_File, packet.source);
+			BinaryIO::BinaryRead(m_File, packet.systemAddress.binaryAddress);
+			BinaryIO::BinaryRead(m_File, packet.systemAddress.port);
+			BinaryIO::BinaryRead(m_File, length);
+
+			packet.data.resize(length);
+			m_File.read(reinterpret_cast<char*>(packet.data.data()), length);
+
+			if (m_File.fail()) return false;
+
+			packets.push_back(std::move(packet));
+		}
+	} catch (std::runtime_error&) {
+		m_Valid = false;
+		return false;
+	}
+
+	return true;
+}
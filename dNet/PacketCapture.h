@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "RakNetTypes.h"
+
+/**
+ * Where a captured packet was received from
+ */
+enum class ePacketSource : uint8_t {
+	CLIENT,
+	MASTER,
+	CHAT
+};
+
+/**
+ * Everything needed to start a world server the same way the captured one was started
+ */
+struct PacketCaptureHeader {
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	uint32_t zoneID = 0;
+	uint32_t instanceID = 0;
+	uint32_t cloneID = 0;
+
+	/**
+	 * The seed of Game::randomEngine
+	 */
+	uint32_t seed = 0;
+
+	/**
+	 * Unix time the capture was started at
+	 */
+	uint64_t startTime = 0;
+};
+
+struct CapturedPacket {
+	ePacketSource source;
+	SystemAddress systemAddress;
+	std::vector<unsigned char> data;
+};
+
+/**
+ * A capture file is the header followed by a record for every frame, each frame record is followed by a record for
+ * every packet handled during that frame in the order they were handled. Random object IDs are recorded where they
+ * were generated, so a replay hands out the same ones without making the live generator predictable.
+ */
+namespace PacketCapture {
+	constexpr uint32_t MAGIC = 0x43554C44; // "DLUC"
+	constexpr uint32_t VERSION = 2;
+
+	enum class eRecordType : uint8_t {
+		FRAME,
+		PACKET,
+		OBJECT_ID
+	};
+}
+
+/**
+ * Records the packets a world server handles to a capture file
+ */
+class PacketCaptureWriter {
+public:
+	PacketCaptureWriter(const std::string& path, const PacketCaptureHeader& header);
+	~PacketCaptureWriter();
+
+	bool IsOpen() const { return m_File.is_open() && m_File.good(); }
+
+	/**
+	 * Starts a new frame, the packets written after this are replayed during it
+	 * @param deltaTime the delta time the frame was updated with
+	 */
+	void WriteFrame(float deltaTime);
+
+	void WritePacket(ePacketSource source, const Packet* packet);
+
+	/**
+	 * Records a random object ID that was generated
+	 * @param objectID the generated ID
+	 */
+	void WriteObjectID(uint32_t objectID);
+
+	void Flush();
+
+	uint64_t GetPacketCount() const { return m_PacketCount; }
+
+private:
+	std::ofstream m_File;
+
+	uint64_t m_PacketCount = 0;
+};
+
+/**
+ * Reads a capture file back frame by frame
+ */
+class PacketCaptureReader {
+public:
+	explicit PacketCaptureReader(const std::string& path);
+
+	/**
+	 * @return whether the file could be opened and has a valid header
+	 */
+	bool IsValid() const { return m_Valid; }
+
+	const PacketCaptureHeader& GetHeader() const { return m_Header; }
+
+	/**
+	 * Reads the next frame
+	 * @param deltaTime set to the delta time of the frame
+	 * @param packets filled with the packets handled during the frame, in the order they were handled
+	 * @return false if the capture has ended
+	 */
+	bool ReadFrame(float& deltaTime, std::vector<CapturedPacket>& packets);
+
+	/**
+	 * Takes the next recorded random object ID, the ones of a frame are read with it
+	 * @param objectID set to the recorded ID
+	 * @return false if there are no recorded IDs left
+	 */
+	bool TakeObjectID(uint32_t& objectID);
+
+private:
+	/**
+	 * Reads the object ID records up to the next other record, leaving its type read
+	 * @return false if the capture ended
+	 */
+	bool ReadObjectIDs();
+
+	std::ifstream m_File;
+	PacketCaptureHeader m_Header;
+	bool m_Valid = false;
+
+	/**
+	 * Whether the type of the next record has been read already, which happens when reading a frame ends
+	 */
+	bool m_HasNextRecord = false;
+	PacketCapture::eRecordType m_NextRecord = PacketCapture::eRecordType::FRAME;
+
+	std::deque<uint32_t> m_ObjectIDs;
+};
@@ -0,0 +1,122 @@
+#include "ReplayServer.h"
+
+#include <cstring>
+
+#include "dLogger.h"
+#include "RakNetworkFactory.h"
+#include "MessageIdentifiers.h"
+
+ReplayServer::ReplayServer(dLogger* logger, const unsigned int zoneID, const int instanceID) {
+	mLogger = logger;
+	mIP = "";
+	mPort = 0;
+	mMaxConnections = 0;
+	mZoneID = zoneID;
+	mInstanceID = instanceID;
+	mUseEncryption = false;
+	mIsInternal = false;
+	mIsOkay = true;
+	mServerType = ServerType::World;
+	mMasterPort = 0;
+
+	// Set by the captured connection accepted packet from master, like a live server
+	mMasterConnectionActive = false;
+
+	// The replica manager still needs a peer to serialize through, one which isn't started drops everything sent to it
+	mPeer = RakNetworkFactory::GetRakPeerInterface();
+
+	mNetIDManager = new NetworkIDManager();
+	mNetIDManager->SetIsNetworkIDAuthority(true);
+
+	mReplicaManager = new ReplicaManager();
+	mReplicaManager->SetAutoParticipateNewConnections(false);
+	mReplicaManager->SetAutoConstructToNewParticipants(false);
+	mReplicaManager->SetAutoSerializeInScope(true);
+
+	mPeer->AttachPlugin(mReplicaManager);
+	mPeer->SetNetworkIDManager(mNetIDManager);
+
+	mLogger->Log("ReplayServer", "Replaying zone %i / %i", zoneID, instanceID);
+}
+
+bool ReplayServer::NextFrame(PacketCaptureReader& reader, float& deltaTime) {
+	if (!reader.ReadFrame(deltaTime, m_FramePackets)) return false;
+
+	for (auto& packet : m_FramePackets) {
+		switch (packet.source) {
+		case ePacketSource::CLIENT:
+			m_ClientPackets.push_back(std::move(packet));
+			break;
+		case ePacketSource::MASTER:
+			m_MasterPackets.push_back(std::move(packet));
+			break;
+		case ePacketSource::CHAT:
+			m_ChatPackets.push_back(std::move(packet));
+			break;
+		}
+	}
+
+	return true;
+}
+
+Packet* ReplayServer::ReceiveFromMaster() {
+	auto* packet = PopPacket(m_MasterPackets);
+
+	if (!packet) return nullptr;
+
+	return HandleMasterPacket(packet);
+}
+
+Packet* ReplayServer::Receive() {
+	auto* packet = PopPacket(m_ClientPackets);
+
+	// A live peer removes the participant itself when the connection closes
+	if (packet && (packet->data[0] == ID_DISCONNECTION_NOTIFICATION || packet->data[0] == ID_CONNECTION_LOST)) {
+		mReplicaManager->RemoveParticipant(packet->systemAddress);
+	}
+
+	return packet;
+}
+
+Packet* ReplayServer::ReceiveFromChat() {
+	return PopPacket(m_ChatPackets);
+}
+
+void ReplayServer::DeallocatePacket(Packet* packet) {
+	delete[] packet->data;
+	delete packet;
+}
+
+void ReplayServer::DeallocateMasterPacket(Packet* packet) {
+	DeallocatePacket(packet);
+}
+
+void ReplayServer::DeallocateChatPacket(Packet* packet) {
+	DeallocatePacket(packet);
+}
+
+void ReplayServer::Disconnect(const SystemAddress& sysAddr, uint32_t disconNotifyID) {
+	mReplicaManager->RemoveParticipant(sysAddr);
+}
+
+Packet* ReplayServer::PopPacket(std::deque<CapturedPacket>& queue) {
+	if (queue.empty()) return nullptr;
+
+	auto& captured = queue.front();
+
+	auto* packet = new Packet();
+	packet->systemIndex = 0;
+	packet->systemAddress = captured.systemAddress;
+	packet->length = static_cast<unsigned int>(captured.data.size());
+	packet->bitSize = BYTES_TO_BITS(packet->length);
+	packet->data = new unsigned char[packet->length];
+	packet->deleteData = true;
+
+	std::memcpy(packet->data, captured.data.data(), packet->length);
+
+	queue.pop_front();
+
+	m_PacketCount++;
+
+	return packet;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <deque>
+
+#include "dServer.h"
+#include "PacketCapture.h"
+
+/**
+ * A world server without a network, it hands out the packets of a capture instead of receiving them.
+ * Everything sent by the server is dropped.
+ */
+class ReplayServer : public dServer {
+public:
+	ReplayServer(dLogger* logger, unsigned int zoneID, int instanceID);
+
+	/**
+	 * Queues up the packets of the next frame in the capture
+	 * @param reader the capture to read from
+	 * @param deltaTime set to the delta time of the frame
+	 * @return false if the capture has ended
+	 */
+	bool NextFrame(PacketCaptureReader& reader, float& deltaTime);
+
+	Packet* ReceiveFromMaster() override;
+	Packet* Receive() override;
+
+	/**
+	 * Stands in for receiving from the chat server
+	 */
+	Packet* ReceiveFromChat();
+
+	void DeallocatePacket(Packet* packet) override;
+	void DeallocateMasterPacket(Packet* packet) override;
+	void DeallocateChatPacket(Packet* packet);
+
+	void Send(RakNet::BitStream* bitStream, const SystemAddress& sysAddr, bool broadcast) override {};
+	void SendToMaster(RakNet::BitStream* bitStream) override {};
+
+	void Disconnect(const SystemAddress& sysAddr, uint32_t disconNotifyID) override;
+
+	bool IsConnected(const SystemAddress& sysAddr) override { return true; };
+	void UpdateBandwidthLimit() override {};
+
+	int GetPing(const SystemAddress& sysAddr) const override { return 0; };
+	int GetLatestPing(const SystemAddress& sysAddr) const override { return 0; };
+
+	uint64_t GetPacketCount() const { return m_PacketCount; }
+
+private:
+	/**
+	 * Pops the next packet from a queue and hands it out the way RakNet would
+	 */
+	Packet* PopPacket(std::deque<CapturedPacket>& queue);
+
+	std::deque<CapturedPacket> m_ClientPackets;
+	std::deque<CapturedPacket> m_MasterPackets;
+	std::deque<CapturedPacket> m_ChatPackets;
+
+	/**
+	 * Reused between frames to avoid allocating a new vector every frame
+	 */
+	std::vector<CapturedPacket> m_FramePackets;
+
+	uint64_t m_PacketCount = 0;
+};
@@ -11,6 +11,7 @@
 #include "dMessageIdentifiers.h"
 #include "MasterPackets.h"
 #include "ZoneInstanceManager.h"
+#include "PacketCapture.h"
 
 //! Replica Constructor class
 class ReplicaConstructor : public ReceiveConstructionInterface {
@@ -103,44 +104,56 @@ Packet* dServer::ReceiveFromMaster() {
 	if (packet) {
 		if (packet->length < 1) { mMasterPeer->DeallocatePacket(packet); return nullptr; }
 
-		if (packet->data[0] == ID_DISCONNECTION_NOTIFICATION || packet->data[0] == ID_CONNECTION_LOST) {
-			mLogger->Log("dServer", "Lost our connection to master, shutting DOWN!");
-			mMasterConnectionActive = false;
-			//ConnectToMaster(); //We'll just shut down now
-		}
+		if (mCapture) mCapture->WritePacket(ePacketSource::MASTER, packet);
 
-		if (packet->data[0] == ID_CONNECTION_REQUEST_ACCEPTED) {
-			mLogger->Log("dServer", "Established connection to master, zone (%i), instance (%i)", this->GetZoneID(), this->GetInstanceID());
-			mMasterConnectionActive = true;
-			mMasterSystemAddress = packet->systemAddress;
-			MasterPackets::SendServerInfo(this, packet);
-		}
+		return HandleMasterPacket(packet);
+	}
+
+	return nullptr;
+}
 
-		if (packet->data[0] == ID_USER_PACKET_ENUM) {
-			if (packet->data[1] == MASTER) {
-				switch (packet->data[3]) {
-				case MSG_MASTER_REQUEST_ZONE_TRANSFER_RESPONSE: {
-					uint64_t requestID = PacketUtils::ReadPacketU64(8, packet);
-					ZoneInstanceManager::Instance()->HandleRequestZoneTransferResponse(requestID, packet);
-					break;
-				}
+Packet* dServer::HandleMasterPacket(Packet* packet) {
+	if (packet->data[0] == ID_DISCONNECTION_NOTIFICATION || packet->data[0] == ID_CONNECTION_LOST) {
+		mLogger->Log("dServer", "Lost our connection to master, shutting DOWN!");
+		mMasterConnectionActive = false;
+		//ConnectToMaster(); //We'll just shut down now
+	}
 
-															  //When we handle these packets in World instead dServer, we just return the packet's pointer.
-				default:
+	if (packet->data[0] == ID_CONNECTION_REQUEST_ACCEPTED) {
+		mLogger->Log("dServer", "Established connection to master, zone (%i), instance (%i)", this->GetZoneID(), this->GetInstanceID());
+		mMasterConnectionActive = true;
+		mMasterSystemAddress = packet->systemAddress;
+		MasterPackets::SendServerInfo(this, packet);
+	}
 
-					return packet;
-				}
+	if (packet->data[0] == ID_USER_PACKET_ENUM) {
+		if (packet->data[1] == MASTER) {
+			switch (packet->data[3]) {
+			case MSG_MASTER_REQUEST_ZONE_TRANSFER_RESPONSE: {
+				uint64_t requestID = PacketUtils::ReadPacketU64(8, packet);
+				ZoneInstanceManager::Instance()->HandleRequestZoneTransferResponse(requestID, packet);
+				break;
 			}
-		}
 
-		mMasterPeer->DeallocatePacket(packet);
+														  //When we handle these packets in World instead dServer, we just return the packet's pointer.
+			default:
+
+				return packet;
+			}
+		}
 	}
 
+	DeallocateMasterPacket(packet);
+
 	return nullptr;
 }
 
 Packet* dServer::Receive() {
-	return mPeer->Receive();
+	Packet* packet = mPeer->Receive();
+
+	if (packet && mCapture) mCapture->WritePacket(ePacketSource::CLIENT, packet);
+
+	return packet;
 }
 
 void dServer::DeallocatePacket(Packet* packet) {
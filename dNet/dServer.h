@@ -6,6 +6,7 @@
 
 class dLogger;
 class dConfig;
+class PacketCaptureWriter;
 
 enum class ServerType : uint32_t {
 	Master,
@@ -19,18 +20,18 @@ public:
 	// Default constructor should only used for testing!
 	dServer() {};
 	dServer(const std::string& ip, int port, int instanceID, int maxConnections, bool isInternal, bool useEncryption, dLogger* logger, const std::string masterIP, int masterPort, ServerType serverType, dConfig* config, unsigned int zoneID = 0);
-	~dServer();
+	virtual ~dServer();
 
-	Packet* ReceiveFromMaster();
-	Packet* Receive();
-	void DeallocatePacket(Packet* packet);
-	void DeallocateMasterPacket(Packet* packet);
+	virtual Packet* ReceiveFromMaster();
+	virtual Packet* Receive();
+	virtual void DeallocatePacket(Packet* packet);
+	virtual void DeallocateMasterPacket(Packet* packet);
 	virtual void Send(RakNet::BitStream* bitStream, const SystemAddress& sysAddr, bool broadcast);
-	void SendToMaster(RakNet::BitStream* bitStream);
+	virtual void SendToMaster(RakNet::BitStream* bitStream);
 
-	void Disconnect(const SystemAddress& sysAddr, uint32_t disconNotifyID);
+	virtual void Disconnect(const SystemAddress& sysAddr, uint32_t disconNotifyID);
 
-	bool IsConnected(const SystemAddress& sysAddr);
+	virtual bool IsConnected(const SystemAddress& sysAddr);
 	const std::string& GetIP() const { return mIP; }
 	const int GetPort() const { return mPort; }
 	const int GetMaxConnections() const { return mMaxConnections; }
@@ -42,23 +43,37 @@ public:
 	const unsigned int GetZoneID() const { return mZoneID; }
 	const int GetInstanceID() const { return mInstanceID; }
 	ReplicaManager* GetReplicaManager() { return mReplicaManager; }
-	void UpdateReplica();
-	void UpdateBandwidthLimit();
+	virtual void UpdateReplica();
+	virtual void UpdateBandwidthLimit();
 
-	int GetPing(const SystemAddress& sysAddr) const;
-	int GetLatestPing(const SystemAddress& sysAddr) const;
+	virtual int GetPing(const SystemAddress& sysAddr) const;
+	virtual int GetLatestPing(const SystemAddress& sysAddr) const;
 
 	NetworkIDManager* GetNetworkIDManager() { return mNetIDManager; }
 
 	const ServerType GetServerType() const { return mServerType; }
 
+	/**
+	 * Records every packet received from clients and master to a capture, until it is set back to nullptr
+	 * @param capture the capture to write to, owned by the caller
+	 */
+	void SetCapture(PacketCaptureWriter* capture) { mCapture = capture; }
+
+protected:
+	/**
+	 * Handles the packets from master which dServer takes care of itself
+	 * @param packet a packet received from master
+	 * @return the packet if it should be handled by the server, otherwise nullptr
+	 */
+	Packet* HandleMasterPacket(Packet* packet);
+
 private:
 	bool Startup();
 	void Shutdown();
 	void SetupForMasterConnection();
 	bool ConnectToMaster();
 
-private:
+protected:
 	dLogger* mLogger = nullptr;
 	dConfig* mConfig = nullptr;
 	RakPeerInterface* mPeer = nullptr;
@@ -81,4 +96,6 @@ private:
 	SystemAddress mMasterSystemAddress;
 	std::string mMasterIP;
 	int mMasterPort;
+
+	PacketCaptureWriter* mCapture = nullptr;
 };
@@ -4,6 +4,7 @@
 #include "EntityManager.h"
 #include "Character.h"
 #include "PetComponent.h"
+#include "SpatialIndex.h"
 
 std::vector<LWOOBJID> PetDigServer::treasures{};
 
@@ -213,22 +214,11 @@ void PetDigServer::SpawnPet(Entity* self, const Entity* owner, const DigInfo dig
 	EntityManager::Instance()->ConstructEntity(spawnedPet);
 }
 
-Entity* PetDigServer::GetClosestTresure(NiPoint3 position) {
-	float closestDistance = 0;
-	Entity* closest = nullptr;
-
-	for (const auto tresureId : treasures) {
-		auto* tresure = EntityManager::Instance()->GetEntity(tresureId);
-
-		if (tresure == nullptr) continue;
-
-		float distance = Vector3::DistanceSquared(tresure->GetPosition(), position);
-
-		if (closest == nullptr || distance < closestDistance) {
-			closestDistance = distance;
-			closest = tresure;
-		}
-	}
+Entity* PetDigServer::GetClosestTresure(NiPoint3 position, float maxDistance) {
+	SpatialFilter filter{};
+	filter.predicate = [](Entity* entity) {
+		return std::find(treasures.begin(), treasures.end(), entity->GetObjectID()) != treasures.end();
+	};
 
-	return closest;
+	return SpatialIndex::Instance()->FindNearest(position, filter, maxDistance);
 }
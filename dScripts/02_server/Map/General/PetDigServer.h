@@ -1,6 +1,8 @@
 #pragma once
 #include "CppScripts.h"
 
+#include <limits>
+
 struct DigInfo {
 	LOT digLot; // The lot of the chest
 	LOT spawnLot; // Option lot of pet to spawn
@@ -17,7 +19,7 @@ public:
 	void OnStartup(Entity* self) override;
 	void OnDie(Entity* self, Entity* killer) override;
 
-	static Entity* GetClosestTresure(NiPoint3 position);
+	static Entity* GetClosestTresure(NiPoint3 position, float maxDistance = std::numeric_limits<float>::max());
 
 private:
 	static void ProgressPetDigMissions(const Entity* owner, const Entity* chest);
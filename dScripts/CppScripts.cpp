@@ -3,6 +3,9 @@
 // do you think god stays in heaven because he too lives in fear of what he's created?
 
 #include "CppScripts.h"
+
+#include <algorithm>
+#include <unordered_map>
 #include "GameMessages.h"
 #include "Entity.h"
 #include "ScriptComponent.h"
@@ -292,578 +295,376 @@
 // WBL scripts
 #include "WblGenericZone.h"
 
-//Big bad global bc this is a namespace and not a class:
-InvalidScript* invalidToReturn = new InvalidScript();
-std::map<std::string, CppScripts::Script*> m_Scripts;
-
-// yeah sorry darwin ill fix the global later
-
-CppScripts::Script* CppScripts::GetScript(Entity* parent, const std::string& scriptName) {
-	Script* script;
-
-	if (m_Scripts.find(scriptName) != m_Scripts.end()) {
-		script = m_Scripts[scriptName];
+namespace {
+	using ScriptFactory = CppScripts::Script* (*)();
 
-		return script;
+	// As picks the Script base of scripts that inherit it privately through more than one path,
+	// which is why this is a C style cast.
+	template<typename T, typename As = T>
+	CppScripts::Script* Create() {
+		return (As*)new T();
 	}
 
-	script = invalidToReturn;
-
-	//VE / AG:
-	if (scriptName == "scripts\\ai\\AG\\L_AG_SHIP_PLAYER_DEATH_TRIGGER.lua")
-		script = new AgShipPlayerDeathTrigger();
-	else if (scriptName == "scripts\\ai\\NP\\L_NPC_NP_SPACEMAN_BOB.lua")
-		script = new NpcNpSpacemanBob();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_SPACE_STUFF.lua") // Broken, will (sometimes) display all animations at once on initial login
-		script = new AgSpaceStuff();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_SHIP_PLAYER_SHOCK_SERVER.lua")
-		script = new AgShipPlayerShockServer();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_IMAG_SMASHABLE.lua")
-		script = new AgImagSmashable();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_STORY_BOX_INTERACT_SERVER.lua")
-		script = new StoryBoxInteractServer();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_BINOCULARS.lua")
-		script = new Binoculars();
-	else if (scriptName == "scripts\\ai\\WILD\\L_ALL_CRATE_CHICKEN.lua")
-		script = new AllCrateChicken();
-	else if (scriptName == "scripts\\ai\\NS\\WH\\L_ROCKHYDRANT_SMASHABLE.lua")
-		script = new RockHydrantSmashable(); // Broken?
-	else if (scriptName == "scripts\\02_server\\Map\\SS\\L_SS_MODULAR_BUILD_SERVER.lua")
-		script = new SsModularBuildServer();
-	else if (scriptName == "scripts\\02_server\\Map\\Property\\AG_Small\\L_ZONE_AG_PROPERTY.lua")
-		script = new ZoneAgProperty();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_POI_MISSION.lua")
-		script = new InvalidScript(); // this is done in Entity.cpp, not needed for our implementation
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_TOUCH_MISSION_UPDATE_SERVER.lua")
-		script = new TouchMissionUpdateServer();
-	else if (scriptName == "scripts\\ai\\AG\\L_ACT_SHARK_PLAYER_DEATH_TRIGGER.lua")
-		script = new ActSharkPlayerDeathTrigger();
-	else if (scriptName == "scripts\\02_server\\Enemy\\General\\L_BASE_ENEMY_MECH.lua")
-		script = new BaseEnemyMech();
-	else if (scriptName == "scripts\\zone\\AG\\L_ZONE_AG_SURVIVAL.lua")
-		script = new ZoneAgSurvival();
-	else if (scriptName == "scripts\\02_server\\Objects\\L_BUFF_STATION_SERVER.lua")
-		script = new AgSurvivalBuffStation();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_BUS_DOOR.lua")
-		script = new AgBusDoor();
-	else if (scriptName == "scripts\\02_server\\Equipment\\L_MAESTROM_EXTRACTICATOR_SERVER.lua")
-		script = new MaestromExtracticatorServer();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_AG_CAGED_BRICKS_SERVER.lua")
-		script = new AgCagedBricksServer();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_NPC_WISP_SERVER.lua")
-		script = new NpcWispServer();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_NPC_EPSILON_SERVER.lua")
-		script = new NpcEpsilonServer();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_TURRET.lua" || scriptName == "scripts\\ai\\AG\\L_AG_TURRET_FOR_SHIP.lua")
-		script = new AgTurret();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_AG_LASER_SENSOR_SERVER.lua")
-		script = new AgLaserSensorServer();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_AG_MONUMENT_LASER_SERVER.lua")
-		script = new AgMonumentLaserServer();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_FANS.lua")
-		script = new AgFans();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_AG_MONUMENT_BIRDS.lua")
-		script = new AgMonumentBirds();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_REMOVE_RENTAL_GEAR.lua")
-		script = new RemoveRentalGear();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_NPC_NJ_ASSISTANT_SERVER.lua")
-		script = new NpcNjAssistantServer();
-	else if (scriptName == "scripts\\ai\\SPEC\\L_SPECIAL_IMAGINE-POWERUP-SPAWNER.lua")
-		script = new SpecialImaginePowerupSpawner();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_SALUTING_NPCS.lua")
-		script = new AgSalutingNpcs();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_JET_EFFECT_SERVER.lua")
-		script = new AgJetEffectServer();
-	else if (scriptName == "scripts\\02_server\\Enemy\\AG\\L_BOSS_SPIDER_QUEEN_ENEMY_SERVER.lua")
-		script = new BossSpiderQueenEnemyServer();
-	else if (scriptName == "scripts\\02_server\\Map\\Property\\AG_Small\\L_ENEMY_SPIDER_SPAWNER.lua")
-		script = new EnemySpiderSpawner();
-	else if (scriptName == "scripts/02_server/Map/Property/AG_Small/L_ENEMY_SPIDER_SPAWNER.lua")
-		script = new EnemySpiderSpawner();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_QB_Elevator.lua")
-		script = new AgQbElevator();
-	else if (scriptName == "scripts\\ai\\PROPERTY\\AG\\L_AG_PROP_GUARD.lua")
-		script = new AgPropGuard();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_AG_BUGSPRAYER.lua")
-		script = new AgBugsprayer();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_NPC_AG_COURSE_STARTER.lua")
-		script = new NpcAgCourseStarter();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L__AG_MONUMENT_RACE_GOAL.lua")
-		script = new AgMonumentRaceGoal();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L__AG_MONUMENT_RACE_CANCEL.lua")
-		script = new AgMonumentRaceCancel();
-	else if (scriptName == "scripts\\02_server\\Map\\AG_Spider_Queen\\L_ZONE_AG_SPIDER_QUEEN.lua")
-		script = (ZoneAgProperty*)new ZoneAgSpiderQueen();
-	else if (scriptName == "scripts\\02_server\\Map\\AG_Spider_Queen\\L_SPIDER_BOSS_TREASURE_CHEST_SERVER.lua")
-		script = new SpiderBossTreasureChestServer();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_NPC_COWBOY_SERVER.lua")
-		script = new NpcCowboyServer();
-	else if (scriptName == "scripts\\02_server\\Map\\Property\\AG_Med\\L_ZONE_AG_MED_PROPERTY.lua")
-		script = new ZoneAgMedProperty();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_STROMBIE_PROPERTY.lua")
-		script = new AgStromlingProperty();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_DARKLING_MECH.lua")
-		script = new BaseEnemyMech();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_DARK_SPIDERLING.lua")
-		script = new AgDarkSpiderling();
-	else if (scriptName == "scripts\\ai\\PROPERTY\\L_PROP_GUARDS.lua")
-		script = new AgPropguards();
-	else if (scriptName == "scripts\\ai\\PROPERTY\\L_PROPERTY_FX_DAMAGE.lua")
-		script = new PropertyFXDamage();
-	else if (scriptName == "scripts\\02_server\\Map\\AG\\L_NPC_PIRATE_SERVER.lua")
-		script = new NpcPirateServer();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_PICNIC_BLANKET.lua")
-		script = new AgPicnicBlanket();
-	else if (scriptName == "scripts\\02_server\\Map\\Property\\L_PROPERTY_BANK_INTERACT_SERVER.lua")
-		script = new PropertyBankInteract();
-	else if (scriptName == "scripts\\02_server\\Enemy\\VE\\L_VE_MECH.lua")
-		script = new VeMech();
-	else if (scriptName == "scripts\\02_server\\Map\\VE\\L_MISSION_CONSOLE_SERVER.lua")
-		script = new VeMissionConsole();
-	else if (scriptName == "scripts\\02_server\\Map\\VE\\L_EPSILON_SERVER.lua")
-		script = new VeEpsilonServer();
-	// Win32 thinks this if chain is too long, let's cut it up and serve it as a three course meal
-	//NS:
-	if (scriptName == "scripts\\ai\\NS\\L_NS_MODULAR_BUILD.lua")
-		script = new NsModularBuild();
-	else if (scriptName == "scripts\\ai\\NS\\L_NS_GET_FACTION_MISSION_SERVER.lua")
-		script = new NsGetFactionMissionServer();
-	else if (scriptName == "scripts\\ai\\NS\\L_NS_QB_IMAGINATION_STATUE.lua")
-		script = new NsQbImaginationStatue();
-	else if (scriptName == "scripts\\02_server\\Map\\NS\\CONCERT_CHOICEBUILD_MANAGER_SERVER.lua")
-		script = new NsConcertChoiceBuildManager();
-	else if (scriptName == "scripts\\ai\\NS\\L_NS_CONCERT_CHOICEBUILD.lua")
-		script = new NsConcertChoiceBuild();
-	else if (scriptName == "scripts\\ai\\NS\\L_NS_CONCERT_QUICKBUILD.lua")
-		script = new NsConcertQuickBuild();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_STAGE_PLATFORMS.lua")
-		script = new AgStagePlatforms();
-	else if (scriptName == "scripts\\ai\\NS\\L_NS_CONCERT_INSTRUMENT_QB.lua")
-		script = new NsConcertInstrument();
-	else if (scriptName == "scripts\\ai\\NS\\L_NS_JONNY_FLAG_MISSION_SERVER.lua")
-		script = new NsJohnnyMissionServer();
-	else if (scriptName == "scripts\\02_server\\Objects\\L_STINKY_FISH_TARGET.lua")
-		script = new StinkyFishTarget();
-	else if (scriptName == "scripts\\zone\\PROPERTY\\NS\\L_ZONE_NS_PROPERTY.lua")
-		script = new ZoneNsProperty();
-	else if (scriptName == "scripts\\02_server\\Map\\Property\\NS_Med\\L_ZONE_NS_MED_PROPERTY.lua")
-		script = new ZoneNsMedProperty();
-	else if (scriptName == "scripts\\02_server\\Map\\NS\\L_NS_TOKEN_CONSOLE_SERVER.lua")
-		script = new NsTokenConsoleServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NS\\L_NS_LUP_TELEPORT.lua")
-		script = new NsLupTeleport();
-	else if (scriptName == "scripts\\02_server\\Map\\NS\\Waves\\L_ZONE_NS_WAVES.lua")
-		script = new ZoneNsWaves();
-	else if (scriptName == "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_HAMMERLING_ENEMY_SERVER.lua")
-		script = new WaveBossHammerling();
-	else if (scriptName == "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_APE_ENEMY_SERVER.lua")
-		script = (BaseEnemyApe*) new WaveBossApe();
-	else if (scriptName == "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_DARK_SPIDERLING_ENEMY_SERVER.lua")
-		script = new WaveBossSpiderling();
-	else if (scriptName == "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_HORESEMEN_ENEMY_SERVER.lua")
-		script = new WaveBossHorsemen();
-	else if (scriptName == "scripts\\02_server\\Minigame\\General\\L_MINIGAME_TREASURE_CHEST_SERVER.lua")
-		script = new MinigameTreasureChestServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NS\\L_NS_LEGO_CLUB_DOOR.lua")
-		script = new NsLegoClubDoor();
-	else if (scriptName == "scripts/ai/NS/L_CL_RING.lua")
-		script = new ClRing();
-	else if (scriptName == "scripts\\ai\\WILD\\L_WILD_AMBIENTS.lua")
-		script = new WildAmbients();
-	else if (scriptName == "scripts\\ai\\NS\\NS_PP_01\\L_NS_PP_01_TELEPORT.lua")
-		script = new PropertyDeathPlane();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_QB_SPAWNER.lua")
-		script = new QbSpawner();
-	else if (scriptName == "scripts\\ai\\AG\\L_AG_QB_Wall.lua")
-		script = new AgQbWall();
-
-	//GF:
-	else if (scriptName == "scripts\\02_server\\Map\\GF\\L_GF_TORCH.lua")
-		script = new GfTikiTorch();
-	else if (scriptName == "scripts\\ai\\GF\\L_SPECIAL_FIREPIT.lua")
-		script = new GfCampfire();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_ORGAN.lua")
-		script = new GfOrgan();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_BANANA.lua")
-		script = new GfBanana();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_BANANA_CLUSTER.lua")
-		script = new GfBananaCluster();
-	else if (scriptName == "scripts/ai/GF/L_GF_JAILKEEP_MISSION.lua")
-		script = new GfJailkeepMission();
-	else if (scriptName == "scripts\\ai\\GF\\L_TRIGGER_AMBUSH.lua")
-		script = new TriggerAmbush();
-	else if (scriptName == "scripts\\02_server\\Map\\GF\\L_GF_CAPTAINS_CANNON.lua")
-		script = new GfCaptainsCannon();
-	else if (scriptName == "scripts\\02_server\\Map\\GF\\L_MAST_TELEPORT.lua")
-		script = new MastTeleport();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_JAIL_WALLS.lua")
-		script = new GfJailWalls();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_QB_ENEMY_STUNNER.lua")
-		script = new QbEnemyStunner();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_PET_DIG_BUILD.lua")
-		script = new PetDigBuild(); // Technically also used once in AG
-	else if (scriptName == "scripts\\02_server\\Map\\GF\\L_SPAWN_LION_SERVER.lua")
-		script = new SpawnLionServer();
-	else if (scriptName == "scripts\\02_server\\Enemy\\General\\L_BASE_ENEMY_APE.lua")
-		script = new BaseEnemyApe();
-	else if (scriptName == "scripts\\02_server\\Enemy\\General\\L_GF_APE_SMASHING_QB.lua")
-		script = new GfApeSmashingQB();
-	else if (scriptName == "scripts\\zone\\PROPERTY\\GF\\L_ZONE_GF_PROPERTY.lua")
-		script = new ZoneGfProperty();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_ARCHWAY.lua")
-		script = new GfArchway();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_MAELSTROM_GEYSER.lua")
-		script = new GfMaelstromGeyser();
-	else if (scriptName == "scripts\\ai\\GF\\L_PIRATE_REP.lua")
-		script = new PirateRep();
-	else if (scriptName == "scripts\\ai\\GF\\L_GF_PARROT_CRASH.lua")
-		script = new GfParrotCrash();
-
-	// SG
-	else if (scriptName == "scripts\\ai\\MINIGAME\\SG_GF\\SERVER\\SG_CANNON.lua")
-		script = new SGCannon();
-	else if (scriptName == "scripts\\ai\\MINIGAME\\SG_GF\\L_ZONE_SG_SERVER.lua")
-		script = new ZoneSGServer();
-
-	//PR:
-	else if (scriptName == "scripts\\client\\ai\\PR\\L_PR_WHISTLE.lua")
-		script = new PrWhistle();
-	else if (scriptName == "scripts\\02_server\\Map\\PR\\L_PR_SEAGULL_FLY.lua")
-		script = new PrSeagullFly();
-	else if (scriptName == "scripts\\ai\\PETS\\L_HYDRANT_SMASHABLE.lua")
-		script = new HydrantSmashable();
-	else if (scriptName == "scripts\\02_server\\map\\PR\\L_HYDRANT_BROKEN.lua")
-		script = new HydrantBroken();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\PET_DIG_SERVER.lua" || scriptName == "scripts\\02_server\\Map\\AM\\L_SKELETON_DRAGON_PET_DIG_SERVER.lua")
-		script = new PetDigServer();
-	else if (scriptName == "scripts\\client\\ai\\PR\\L_CRAB_SERVER.lua")
-		script = new CrabServer();
-	else if (scriptName == "scripts\\02_server\\Pets\\L_PET_FROM_DIG_SERVER.lua")
-		script = new PetFromDigServer();
-	else if (scriptName == "scripts\\02_server\\Pets\\L_PET_FROM_OBJECT_SERVER.lua")
-		script = new PetFromObjectServer();
-	else if (scriptName == "scripts\\02_server\\Pets\\L_DAMAGING_PET.lua")
-		script = new DamagingPets();
-	else if (scriptName == "scripts\\02_server\\Map\\PR\\L_SPAWN_GRYPHON_SERVER.lua")
-		script = new SpawnGryphonServer();
-
-	//FV Scripts:
-	else if (scriptName == "scripts\\02_server\\Map\\FV\\L_ACT_CANDLE.lua")
-		script = new FvCandle();
-	else if (scriptName == "scripts\\02_server\\Map\\FV\\L_ENEMY_RONIN_SPAWNER.lua")
-		script = new EnemyRoninSpawner();
-	else if (scriptName == "scripts\\02_server\\Enemy\\FV\\L_FV_MAELSTROM_CAVALRY.lua")
-		script = new FvMaelstromCavalry();
-	else if (scriptName == "scripts\\ai\\FV\\L_ACT_NINJA_TURRET_1.lua")
-		script = new ActNinjaTurret();
-	else if (scriptName == "scripts\\02_server\\Map\\FV\\L_FV_HORSEMEN_TRIGGER.lua")
-		script = new FvHorsemenTrigger();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_FLYING_CREVICE_DRAGON.lua")
-		script = new FvFlyingCreviceDragon();
-	else if (scriptName == "scripts\\02_server\\Enemy\\FV\\L_FV_MAELSTROM_DRAGON.lua")
-		script = new FvMaelstromDragon();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_DRAGON_SMASHING_GOLEM_QB.lua")
-		script = new FvDragonSmashingGolemQb();
-	else if (scriptName == "scripts\\02_server\\Enemy\\General\\L_TREASURE_CHEST_DRAGON_SERVER.lua")
-		script = new TreasureChestDragonServer();
-	else if (scriptName == "scripts\\ai\\GENERAL\\L_INSTANCE_EXIT_TRANSFER_PLAYER_TO_LAST_NON_INSTANCE.lua")
-		script = new InstanceExitTransferPlayerToLastNonInstance();
-	else if (scriptName == "scripts\\ai\\FV\\L_NPC_FREE_GF_NINJAS.lua")
-		script = new FvFreeGfNinjas();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_PANDA_SPAWNER_SERVER.lua")
-		script = new FvPandaSpawnerServer();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_PANDA_SERVER.lua")
-		script = new FvPandaServer();
-	else if (scriptName == "scripts\\zone\\PROPERTY\\FV\\L_ZONE_FV_PROPERTY.lua")
-		script = new ZoneFvProperty();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_BRICK_PUZZLE_SERVER.lua")
-		script = new FvBrickPuzzleServer();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_CONSOLE_LEFT_QUICKBUILD.lua")
-		script = new FvConsoleLeftQuickbuild();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_CONSOLE_RIGHT_QUICKBUILD.lua")
-		script = new FvConsoleRightQuickbuild();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_FACILITY_BRICK.lua")
-		script = new FvFacilityBrick();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_FACILITY_PIPES.lua")
-		script = new FvFacilityPipes();
-	else if (scriptName == "scripts\\02_server\\Map\\FV\\L_IMG_BRICK_CONSOLE_QB.lua")
-		script = new ImgBrickConsoleQB();
-	else if (scriptName == "scripts\\ai\\FV\\L_ACT_PARADOX_PIPE_FIX.lua")
-		script = new ActParadoxPipeFix();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_NINJA_GUARDS.lua")
-		script = new FvNinjaGuard();
-	else if (scriptName == "scripts\\ai\\FV\\L_ACT_PASS_THROUGH_WALL.lua")
-		script = new FvPassThroughWall();
-	else if (scriptName == "scripts\\ai\\FV\\L_ACT_BOUNCE_OVER_WALL.lua")
-		script = new FvBounceOverWall();
-	else if (scriptName == "scripts\\02_server\\Map\\FV\\L_NPC_FONG.lua")
-		script = new FvFong();
-	else if (scriptName == "scripts\\ai\\FV\\L_FV_MAELSTROM_GEYSER.lua") {
-		script = new FvMaelstromGeyser();
-	}
+	struct ScriptRegistration {
+		ScriptFactory factory;
+
+		/**
+		 * Whether all entities share one instance of the script, scripts that keep per entity state get their own
+		 */
+		bool shared = true;
+	};
+
+	/**
+	 * Every script path that has a C++ implementation, looked up once per entity with a script component
+	 */
+	const std::unordered_map<std::string, ScriptRegistration> scriptRegistry = {
+		//VE / AG:
+		{ "scripts\\ai\\AG\\L_AG_SHIP_PLAYER_DEATH_TRIGGER.lua", { Create<AgShipPlayerDeathTrigger> } },
+		{ "scripts\\ai\\NP\\L_NPC_NP_SPACEMAN_BOB.lua", { Create<NpcNpSpacemanBob> } },
+		{ "scripts\\ai\\AG\\L_AG_SPACE_STUFF.lua", { Create<AgSpaceStuff> } }, // Broken, will (sometimes) display all animations at once on initial login
+		{ "scripts\\ai\\AG\\L_AG_SHIP_PLAYER_SHOCK_SERVER.lua", { Create<AgShipPlayerShockServer> } },
+		{ "scripts\\ai\\AG\\L_AG_IMAG_SMASHABLE.lua", { Create<AgImagSmashable> } },
+		{ "scripts\\02_server\\Map\\General\\L_STORY_BOX_INTERACT_SERVER.lua", { Create<StoryBoxInteractServer> } },
+		{ "scripts\\02_server\\Map\\General\\L_BINOCULARS.lua", { Create<Binoculars> } },
+		{ "scripts\\ai\\WILD\\L_ALL_CRATE_CHICKEN.lua", { Create<AllCrateChicken> } },
+		{ "scripts\\ai\\NS\\WH\\L_ROCKHYDRANT_SMASHABLE.lua", { Create<RockHydrantSmashable> } }, // Broken?
+		{ "scripts\\02_server\\Map\\SS\\L_SS_MODULAR_BUILD_SERVER.lua", { Create<SsModularBuildServer> } },
+		{ "scripts\\02_server\\Map\\Property\\AG_Small\\L_ZONE_AG_PROPERTY.lua", { Create<ZoneAgProperty> } },
+		{ "scripts\\02_server\\Map\\General\\L_POI_MISSION.lua", { Create<InvalidScript> } }, // this is done in Entity.cpp, not needed for our implementation
+		{ "scripts\\02_server\\Map\\General\\L_TOUCH_MISSION_UPDATE_SERVER.lua", { Create<TouchMissionUpdateServer> } },
+		{ "scripts\\ai\\AG\\L_ACT_SHARK_PLAYER_DEATH_TRIGGER.lua", { Create<ActSharkPlayerDeathTrigger> } },
+		{ "scripts\\02_server\\Enemy\\General\\L_BASE_ENEMY_MECH.lua", { Create<BaseEnemyMech> } },
+		{ "scripts\\zone\\AG\\L_ZONE_AG_SURVIVAL.lua", { Create<ZoneAgSurvival> } },
+		{ "scripts\\02_server\\Objects\\L_BUFF_STATION_SERVER.lua", { Create<AgSurvivalBuffStation> } },
+		{ "scripts\\ai\\AG\\L_AG_BUS_DOOR.lua", { Create<AgBusDoor> } },
+		{ "scripts\\02_server\\Equipment\\L_MAESTROM_EXTRACTICATOR_SERVER.lua", { Create<MaestromExtracticatorServer> } },
+		{ "scripts\\02_server\\Map\\AG\\L_AG_CAGED_BRICKS_SERVER.lua", { Create<AgCagedBricksServer> } },
+		{ "scripts\\02_server\\Map\\AG\\L_NPC_WISP_SERVER.lua", { Create<NpcWispServer> } },
+		{ "scripts\\02_server\\Map\\AG\\L_NPC_EPSILON_SERVER.lua", { Create<NpcEpsilonServer> } },
+		{ "scripts\\ai\\AG\\L_AG_TURRET.lua", { Create<AgTurret> } },
+		{ "scripts\\ai\\AG\\L_AG_TURRET_FOR_SHIP.lua", { Create<AgTurret> } },
+		{ "scripts\\02_server\\Map\\AG\\L_AG_LASER_SENSOR_SERVER.lua", { Create<AgLaserSensorServer> } },
+		{ "scripts\\02_server\\Map\\AG\\L_AG_MONUMENT_LASER_SERVER.lua", { Create<AgMonumentLaserServer> } },
+		{ "scripts\\ai\\AG\\L_AG_FANS.lua", { Create<AgFans> } },
+		{ "scripts\\02_server\\Map\\AG\\L_AG_MONUMENT_BIRDS.lua", { Create<AgMonumentBirds> } },
+		{ "scripts\\02_server\\Map\\AG\\L_REMOVE_RENTAL_GEAR.lua", { Create<RemoveRentalGear> } },
+		{ "scripts\\02_server\\Map\\AG\\L_NPC_NJ_ASSISTANT_SERVER.lua", { Create<NpcNjAssistantServer> } },
+		{ "scripts\\ai\\SPEC\\L_SPECIAL_IMAGINE-POWERUP-SPAWNER.lua", { Create<SpecialImaginePowerupSpawner> } },
+		{ "scripts\\ai\\AG\\L_AG_SALUTING_NPCS.lua", { Create<AgSalutingNpcs> } },
+		{ "scripts\\ai\\AG\\L_AG_JET_EFFECT_SERVER.lua", { Create<AgJetEffectServer> } },
+		{ "scripts\\02_server\\Enemy\\AG\\L_BOSS_SPIDER_QUEEN_ENEMY_SERVER.lua", { Create<BossSpiderQueenEnemyServer> } },
+		{ "scripts\\02_server\\Map\\Property\\AG_Small\\L_ENEMY_SPIDER_SPAWNER.lua", { Create<EnemySpiderSpawner> } },
+		{ "scripts/02_server/Map/Property/AG_Small/L_ENEMY_SPIDER_SPAWNER.lua", { Create<EnemySpiderSpawner> } },
+		{ "scripts\\ai\\AG\\L_AG_QB_Elevator.lua", { Create<AgQbElevator> } },
+		{ "scripts\\ai\\PROPERTY\\AG\\L_AG_PROP_GUARD.lua", { Create<AgPropGuard> } },
+		{ "scripts\\02_server\\Map\\AG\\L_AG_BUGSPRAYER.lua", { Create<AgBugsprayer> } },
+		{ "scripts\\02_server\\Map\\AG\\L_NPC_AG_COURSE_STARTER.lua", { Create<NpcAgCourseStarter> } },
+		{ "scripts\\02_server\\Map\\AG\\L__AG_MONUMENT_RACE_GOAL.lua", { Create<AgMonumentRaceGoal> } },
+		{ "scripts\\02_server\\Map\\AG\\L__AG_MONUMENT_RACE_CANCEL.lua", { Create<AgMonumentRaceCancel> } },
+		{ "scripts\\02_server\\Map\\AG_Spider_Queen\\L_ZONE_AG_SPIDER_QUEEN.lua", { Create<ZoneAgSpiderQueen, ZoneAgProperty> } },
+		{ "scripts\\02_server\\Map\\AG_Spider_Queen\\L_SPIDER_BOSS_TREASURE_CHEST_SERVER.lua", { Create<SpiderBossTreasureChestServer> } },
+		{ "scripts\\02_server\\Map\\AG\\L_NPC_COWBOY_SERVER.lua", { Create<NpcCowboyServer> } },
+		{ "scripts\\02_server\\Map\\Property\\AG_Med\\L_ZONE_AG_MED_PROPERTY.lua", { Create<ZoneAgMedProperty> } },
+		{ "scripts\\ai\\AG\\L_AG_STROMBIE_PROPERTY.lua", { Create<AgStromlingProperty> } },
+		{ "scripts\\ai\\AG\\L_AG_DARKLING_MECH.lua", { Create<BaseEnemyMech> } },
+		{ "scripts\\ai\\AG\\L_AG_DARK_SPIDERLING.lua", { Create<AgDarkSpiderling> } },
+		{ "scripts\\ai\\PROPERTY\\L_PROP_GUARDS.lua", { Create<AgPropguards> } },
+		{ "scripts\\ai\\PROPERTY\\L_PROPERTY_FX_DAMAGE.lua", { Create<PropertyFXDamage> } },
+		{ "scripts\\02_server\\Map\\AG\\L_NPC_PIRATE_SERVER.lua", { Create<NpcPirateServer> } },
+		{ "scripts\\ai\\AG\\L_AG_PICNIC_BLANKET.lua", { Create<AgPicnicBlanket> } },
+		{ "scripts\\02_server\\Map\\Property\\L_PROPERTY_BANK_INTERACT_SERVER.lua", { Create<PropertyBankInteract> } },
+		{ "scripts\\02_server\\Enemy\\VE\\L_VE_MECH.lua", { Create<VeMech> } },
+		{ "scripts\\02_server\\Map\\VE\\L_MISSION_CONSOLE_SERVER.lua", { Create<VeMissionConsole> } },
+		{ "scripts\\02_server\\Map\\VE\\L_EPSILON_SERVER.lua", { Create<VeEpsilonServer> } },
+
+		//NS:
+		{ "scripts\\ai\\NS\\L_NS_MODULAR_BUILD.lua", { Create<NsModularBuild> } },
+		{ "scripts\\ai\\NS\\L_NS_GET_FACTION_MISSION_SERVER.lua", { Create<NsGetFactionMissionServer> } },
+		{ "scripts\\ai\\NS\\L_NS_QB_IMAGINATION_STATUE.lua", { Create<NsQbImaginationStatue> } },
+		{ "scripts\\02_server\\Map\\NS\\CONCERT_CHOICEBUILD_MANAGER_SERVER.lua", { Create<NsConcertChoiceBuildManager> } },
+		{ "scripts\\ai\\NS\\L_NS_CONCERT_CHOICEBUILD.lua", { Create<NsConcertChoiceBuild> } },
+		{ "scripts\\ai\\NS\\L_NS_CONCERT_QUICKBUILD.lua", { Create<NsConcertQuickBuild> } },
+		{ "scripts\\ai\\AG\\L_AG_STAGE_PLATFORMS.lua", { Create<AgStagePlatforms> } },
+		{ "scripts\\ai\\NS\\L_NS_CONCERT_INSTRUMENT_QB.lua", { Create<NsConcertInstrument> } },
+		{ "scripts\\ai\\NS\\L_NS_JONNY_FLAG_MISSION_SERVER.lua", { Create<NsJohnnyMissionServer> } },
+		{ "scripts\\02_server\\Objects\\L_STINKY_FISH_TARGET.lua", { Create<StinkyFishTarget> } },
+		{ "scripts\\zone\\PROPERTY\\NS\\L_ZONE_NS_PROPERTY.lua", { Create<ZoneNsProperty> } },
+		{ "scripts\\02_server\\Map\\Property\\NS_Med\\L_ZONE_NS_MED_PROPERTY.lua", { Create<ZoneNsMedProperty> } },
+		{ "scripts\\02_server\\Map\\NS\\L_NS_TOKEN_CONSOLE_SERVER.lua", { Create<NsTokenConsoleServer> } },
+		{ "scripts\\02_server\\Map\\NS\\L_NS_LUP_TELEPORT.lua", { Create<NsLupTeleport> } },
+		{ "scripts\\02_server\\Map\\NS\\Waves\\L_ZONE_NS_WAVES.lua", { Create<ZoneNsWaves> } },
+		{ "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_HAMMERLING_ENEMY_SERVER.lua", { Create<WaveBossHammerling> } },
+		{ "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_APE_ENEMY_SERVER.lua", { Create<WaveBossApe, BaseEnemyApe> } },
+		{ "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_DARK_SPIDERLING_ENEMY_SERVER.lua", { Create<WaveBossSpiderling> } },
+		{ "scripts\\02_server\\Enemy\\Waves\\L_WAVES_BOSS_HORESEMEN_ENEMY_SERVER.lua", { Create<WaveBossHorsemen> } },
+		{ "scripts\\02_server\\Minigame\\General\\L_MINIGAME_TREASURE_CHEST_SERVER.lua", { Create<MinigameTreasureChestServer> } },
+		{ "scripts\\02_server\\Map\\NS\\L_NS_LEGO_CLUB_DOOR.lua", { Create<NsLegoClubDoor> } },
+		{ "scripts/ai/NS/L_CL_RING.lua", { Create<ClRing> } },
+		{ "scripts\\ai\\WILD\\L_WILD_AMBIENTS.lua", { Create<WildAmbients> } },
+		{ "scripts\\ai\\NS\\NS_PP_01\\L_NS_PP_01_TELEPORT.lua", { Create<PropertyDeathPlane> } },
+		{ "scripts\\02_server\\Map\\General\\L_QB_SPAWNER.lua", { Create<QbSpawner> } },
+		{ "scripts\\ai\\AG\\L_AG_QB_Wall.lua", { Create<AgQbWall> } },
+
+		//GF:
+		{ "scripts\\02_server\\Map\\GF\\L_GF_TORCH.lua", { Create<GfTikiTorch> } },
+		{ "scripts\\ai\\GF\\L_SPECIAL_FIREPIT.lua", { Create<GfCampfire> } },
+		{ "scripts\\ai\\GF\\L_GF_ORGAN.lua", { Create<GfOrgan> } },
+		{ "scripts\\ai\\GF\\L_GF_BANANA.lua", { Create<GfBanana> } },
+		{ "scripts\\ai\\GF\\L_GF_BANANA_CLUSTER.lua", { Create<GfBananaCluster> } },
+		{ "scripts/ai/GF/L_GF_JAILKEEP_MISSION.lua", { Create<GfJailkeepMission> } },
+		{ "scripts\\ai\\GF\\L_TRIGGER_AMBUSH.lua", { Create<TriggerAmbush> } },
+		{ "scripts\\02_server\\Map\\GF\\L_GF_CAPTAINS_CANNON.lua", { Create<GfCaptainsCannon> } },
+		{ "scripts\\02_server\\Map\\GF\\L_MAST_TELEPORT.lua", { Create<MastTeleport> } },
+		{ "scripts\\ai\\GF\\L_GF_JAIL_WALLS.lua", { Create<GfJailWalls> } },
+		{ "scripts\\02_server\\Map\\General\\L_QB_ENEMY_STUNNER.lua", { Create<QbEnemyStunner> } },
+		{ "scripts\\ai\\GF\\L_GF_PET_DIG_BUILD.lua", { Create<PetDigBuild> } }, // Technically also used once in AG
+		{ "scripts\\02_server\\Map\\GF\\L_SPAWN_LION_SERVER.lua", { Create<SpawnLionServer> } },
+		{ "scripts\\02_server\\Enemy\\General\\L_BASE_ENEMY_APE.lua", { Create<BaseEnemyApe> } },
+		{ "scripts\\02_server\\Enemy\\General\\L_GF_APE_SMASHING_QB.lua", { Create<GfApeSmashingQB> } },
+		{ "scripts\\zone\\PROPERTY\\GF\\L_ZONE_GF_PROPERTY.lua", { Create<ZoneGfProperty> } },
+		{ "scripts\\ai\\GF\\L_GF_ARCHWAY.lua", { Create<GfArchway> } },
+		{ "scripts\\ai\\GF\\L_GF_MAELSTROM_GEYSER.lua", { Create<GfMaelstromGeyser> } },
+		{ "scripts\\ai\\GF\\L_PIRATE_REP.lua", { Create<PirateRep> } },
+		{ "scripts\\ai\\GF\\L_GF_PARROT_CRASH.lua", { Create<GfParrotCrash> } },
+
+		// SG
+		{ "scripts\\ai\\MINIGAME\\SG_GF\\SERVER\\SG_CANNON.lua", { Create<SGCannon> } },
+		{ "scripts\\ai\\MINIGAME\\SG_GF\\L_ZONE_SG_SERVER.lua", { Create<ZoneSGServer> } },
+
+		//PR:
+		{ "scripts\\client\\ai\\PR\\L_PR_WHISTLE.lua", { Create<PrWhistle> } },
+		{ "scripts\\02_server\\Map\\PR\\L_PR_SEAGULL_FLY.lua", { Create<PrSeagullFly> } },
+		{ "scripts\\ai\\PETS\\L_HYDRANT_SMASHABLE.lua", { Create<HydrantSmashable> } },
+		{ "scripts\\02_server\\map\\PR\\L_HYDRANT_BROKEN.lua", { Create<HydrantBroken> } },
+		{ "scripts\\02_server\\Map\\General\\PET_DIG_SERVER.lua", { Create<PetDigServer> } },
+		{ "scripts\\02_server\\Map\\AM\\L_SKELETON_DRAGON_PET_DIG_SERVER.lua", { Create<PetDigServer> } },
+		{ "scripts\\client\\ai\\PR\\L_CRAB_SERVER.lua", { Create<CrabServer> } },
+		{ "scripts\\02_server\\Pets\\L_PET_FROM_DIG_SERVER.lua", { Create<PetFromDigServer> } },
+		{ "scripts\\02_server\\Pets\\L_PET_FROM_OBJECT_SERVER.lua", { Create<PetFromObjectServer> } },
+		{ "scripts\\02_server\\Pets\\L_DAMAGING_PET.lua", { Create<DamagingPets> } },
+		{ "scripts\\02_server\\Map\\PR\\L_SPAWN_GRYPHON_SERVER.lua", { Create<SpawnGryphonServer> } },
+
+		//FV Scripts:
+		{ "scripts\\02_server\\Map\\FV\\L_ACT_CANDLE.lua", { Create<FvCandle> } },
+		{ "scripts\\02_server\\Map\\FV\\L_ENEMY_RONIN_SPAWNER.lua", { Create<EnemyRoninSpawner> } },
+		{ "scripts\\02_server\\Enemy\\FV\\L_FV_MAELSTROM_CAVALRY.lua", { Create<FvMaelstromCavalry> } },
+		{ "scripts\\ai\\FV\\L_ACT_NINJA_TURRET_1.lua", { Create<ActNinjaTurret> } },
+		{ "scripts\\02_server\\Map\\FV\\L_FV_HORSEMEN_TRIGGER.lua", { Create<FvHorsemenTrigger> } },
+		{ "scripts\\ai\\FV\\L_FV_FLYING_CREVICE_DRAGON.lua", { Create<FvFlyingCreviceDragon> } },
+		{ "scripts\\02_server\\Enemy\\FV\\L_FV_MAELSTROM_DRAGON.lua", { Create<FvMaelstromDragon> } },
+		{ "scripts\\ai\\FV\\L_FV_DRAGON_SMASHING_GOLEM_QB.lua", { Create<FvDragonSmashingGolemQb> } },
+		{ "scripts\\02_server\\Enemy\\General\\L_TREASURE_CHEST_DRAGON_SERVER.lua", { Create<TreasureChestDragonServer> } },
+		{ "scripts\\ai\\GENERAL\\L_INSTANCE_EXIT_TRANSFER_PLAYER_TO_LAST_NON_INSTANCE.lua", { Create<InstanceExitTransferPlayerToLastNonInstance> } },
+		{ "scripts\\ai\\FV\\L_NPC_FREE_GF_NINJAS.lua", { Create<FvFreeGfNinjas> } },
+		{ "scripts\\ai\\FV\\L_FV_PANDA_SPAWNER_SERVER.lua", { Create<FvPandaSpawnerServer> } },
+		{ "scripts\\ai\\FV\\L_FV_PANDA_SERVER.lua", { Create<FvPandaServer> } },
+		{ "scripts\\zone\\PROPERTY\\FV\\L_ZONE_FV_PROPERTY.lua", { Create<ZoneFvProperty> } },
+		{ "scripts\\ai\\FV\\L_FV_BRICK_PUZZLE_SERVER.lua", { Create<FvBrickPuzzleServer> } },
+		{ "scripts\\ai\\FV\\L_FV_CONSOLE_LEFT_QUICKBUILD.lua", { Create<FvConsoleLeftQuickbuild> } },
+		{ "scripts\\ai\\FV\\L_FV_CONSOLE_RIGHT_QUICKBUILD.lua", { Create<FvConsoleRightQuickbuild> } },
+		{ "scripts\\ai\\FV\\L_FV_FACILITY_BRICK.lua", { Create<FvFacilityBrick> } },
+		{ "scripts\\ai\\FV\\L_FV_FACILITY_PIPES.lua", { Create<FvFacilityPipes> } },
+		{ "scripts\\02_server\\Map\\FV\\L_IMG_BRICK_CONSOLE_QB.lua", { Create<ImgBrickConsoleQB> } },
+		{ "scripts\\ai\\FV\\L_ACT_PARADOX_PIPE_FIX.lua", { Create<ActParadoxPipeFix> } },
+		{ "scripts\\ai\\FV\\L_FV_NINJA_GUARDS.lua", { Create<FvNinjaGuard> } },
+		{ "scripts\\ai\\FV\\L_ACT_PASS_THROUGH_WALL.lua", { Create<FvPassThroughWall> } },
+		{ "scripts\\ai\\FV\\L_ACT_BOUNCE_OVER_WALL.lua", { Create<FvBounceOverWall> } },
+		{ "scripts\\02_server\\Map\\FV\\L_NPC_FONG.lua", { Create<FvFong> } },
+		{ "scripts\\ai\\FV\\L_FV_MAELSTROM_GEYSER.lua", { Create<FvMaelstromGeyser> } },
+
+		//Misc:
+		{ "scripts\\02_server\\Map\\General\\L_EXPLODING_ASSET.lua", { Create<ExplodingAsset> } },
+		{ "scripts\\02_server\\Map\\General\\L_WISHING_WELL_SERVER.lua", { Create<WishingWellServer> } },
+		{ "scripts\\ai\\ACT\\L_ACT_PLAYER_DEATH_TRIGGER.lua", { Create<ActPlayerDeathTrigger> } },
+		{ "scripts\\02_server\\Map\\General\\L_GROWING_FLOWER_SERVER.lua", { Create<GrowingFlower> } },
+		{ "scripts\\02_server\\Map\\General\\L_TOKEN_CONSOLE_SERVER.lua", { Create<TokenConsoleServer> } },
+		{ "scripts\\ai\\ACT\\FootRace\\L_ACT_BASE_FOOT_RACE.lua", { Create<BaseFootRaceManager> } },
+		{ "scripts\\02_server\\Map\\General\\L_PROP_PLATFORM.lua", { Create<PropertyPlatform> } },
+		{ "scripts\\02_server\\Map\\VE\\L_VE_BRICKSAMPLE_SERVER.lua", { Create<VeBricksampleServer>, false } },
+		{ "scripts\\02_server\\Map\\General\\L_MAIL_BOX_SERVER.lua", { Create<MailBoxServer> } },
+		{ "scripts\\ai\\ACT\\L_ACT_MINE.lua", { Create<ActMine> } },
+
+		//Racing:
+		{ "scripts\\ai\\RACING\\OBJECTS\\RACE_IMAGINE_CRATE_SERVER.lua", { Create<RaceImagineCrateServer> } },
+		{ "scripts\\ai\\ACT\\L_ACT_VEHICLE_DEATH_TRIGGER.lua", { Create<ActVehicleDeathTrigger> } },
+		{ "scripts\\ai\\RACING\\OBJECTS\\RACE_IMAGINE_POWERUP.lua", { Create<RaceImaginePowerup> } },
+		{ "scripts\\02_server\\Map\\FV\\Racing\\RACE_MAELSTROM_GEISER.lua", { Create<RaceMaelstromGeiser> } },
+		{ "scripts\\ai\\RACING\\OBJECTS\\FV_RACE_SMASH_EGG_IMAGINE_SERVER.lua", { Create<FvRaceSmashEggImagineServer> } },
+		{ "scripts\\ai\\RACING\\OBJECTS\\RACE_SMASH_SERVER.lua", { Create<RaceSmashServer> } },
+
+		//NT:
+		{ "scripts\\02_server\\Map\\NT\\L_NT_SENTINELWALKWAY_SERVER.lua", { Create<NtSentinelWalkwayServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_PARADOXTELE_SERVER.lua", { Create<NtParadoxTeleServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_DARKITECT_REVEAL_SERVER.lua", { Create<NtDarkitectRevealServer> } },
+		{ "scripts\\02_server\\Map\\General\\L_BANK_INTERACT_SERVER.lua", { Create<BankInteractServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_VENTURESPEEDPAD_SERVER.lua", { Create<NtVentureSpeedPadServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_VENTURE_CANNON_SERVER.lua", { Create<NtVentureCannonServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_COMBAT_CHALLENGE_SERVER.lua", { Create<NtCombatChallengeServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_COMBAT_CHALLENGE_DUMMY.lua", { Create<NtCombatChallengeDummy> } },
+		{ "scripts\\02_server\\Map\\NT\\\\L_NT_COMBAT_EXPLODING_TARGET.lua", { Create<NtCombatChallengeExplodingDummy> } },
+		{ "scripts\\02_server\\Map\\General\\L_BASE_INTERACT_DROP_LOOT_SERVER.lua", { Create<BaseInteractDropLootServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_ASSEMBLYTUBE_SERVER.lua", { Create<NtAssemblyTubeServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_PARADOX_PANEL_SERVER.lua", { Create<NtParadoxPanelServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_IMAG_BEAM_BUFFER.lua", { Create<NtImagBeamBuffer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_BEAM_IMAGINATION_COLLECTORS.lua", { Create<NtBeamImaginationCollectors> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_DIRT_CLOUD_SERVER.lua", { Create<NtDirtCloudServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_CONSOLE_TELEPORT_SERVER.lua", { Create<NtConsoleTeleportServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_SPAWN_STEGO_SERVER.lua", { Create<SpawnStegoServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_SPAWN_SABERCAT_SERVER.lua", { Create<SpawnSaberCatServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_SPAWN_SHRAKE_SERVER.lua", { Create<SpawnShrakeServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_DUKE_SERVER.lua", { Create<NtDukeServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_HAEL_SERVER.lua", { Create<NtHaelServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_OVERBUILD_SERVER.lua", { Create<NtOverbuildServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_VANDA_SERVER.lua", { Create<NtVandaServer> } },
+		{ "scripts\\02_server\\Map\\General\\L_FORCE_VOLUME_SERVER.lua", { Create<ForceVolumeServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_XRAY_SERVER.lua", { Create<NtXRayServer> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_SLEEPING_GUARD.lua", { Create<NtSleepingGuard> } },
+		{ "scripts\\02_server\\Map\\NT\\L_NT_IMAGIMETER_VISIBILITY_SERVER.lua", { Create<NTImagimeterVisibility> } },
+
+		//AM:
+		{ "scripts\\02_server\\Map\\AM\\L_AM_CONSOLE_TELEPORT_SERVER.lua", { Create<AmConsoleTeleportServer> } },
+		{ "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_FIN.lua", { Create<RandomSpawnerFin> } },
+		{ "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_PIT.lua", { Create<RandomSpawnerPit> } },
+		{ "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_STR.lua", { Create<RandomSpawnerStr> } },
+		{ "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_ZIP.lua", { Create<RandomSpawnerZip> } },
+		{ "scripts\\02_server\\Enemy\\AM\\L_AM_DARKLING_MECH.lua", { Create<AmDarklingMech> } },
+		{ "scripts\\02_server\\Map\\AM\\L_BRIDGE.lua", { Create<AmBridge> } },
+		{ "scripts\\02_server\\Map\\AM\\L_DRAW_BRIDGE.lua", { Create<AmDrawBridge> } },
+		{ "scripts\\02_server\\Map\\AM\\L_SHIELD_GENERATOR.lua", { Create<AmShieldGenerator> } },
+		{ "scripts\\02_server\\Map\\AM\\L_SHIELD_GENERATOR_QUICKBUILD.lua", { Create<AmShieldGeneratorQuickbuild> } },
+		{ "scripts\\02_server\\Map\\AM\\L_DROPSHIP_COMPUTER.lua", { Create<AmDropshipComputer> } },
+		{ "scripts\\02_server\\Map\\AM\\L_SCROLL_READER_SERVER.lua", { Create<AmScrollReaderServer> } },
+		{ "scripts\\02_server\\Map\\AM\\L_TEMPLE_SKILL_VOLUME.lua", { Create<AmTemplateSkillVolume> } },
+		{ "scripts\\02_server\\Enemy\\General\\L_ENEMY_NJ_BUFF.lua", { Create<EnemyNjBuff> } },
+		{ "scripts\\02_server\\Enemy\\AM\\L_AM_SKELETON_ENGINEER.lua", { Create<AmSkeletonEngineer> } },
+		{ "scripts\\02_server\\Map\\AM\\L_SKULLKIN_DRILL.lua", { Create<AmSkullkinDrill> } },
+		{ "scripts\\02_server\\Map\\AM\\L_SKULLKIN_DRILL_STAND.lua", { Create<AmSkullkinDrillStand> } },
+		{ "scripts\\02_server\\Map\\AM\\L_SKULLKIN_TOWER.lua", { Create<AmSkullkinTower> } },
+		{ "scripts\\02_server\\Enemy\\AM\\L_AM_NAMED_DARKLING_DRAGON.lua", { Create<AmDarklingDragon> } },
+		{ "scripts\\02_server\\Enemy\\AM\\L_AM_DARKLING_DRAGON.lua", { Create<AmDarklingDragon> } },
+		{ "scripts\\02_server\\Enemy\\AM\\L_AM_DARKLING_APE.lua", { Create<BaseEnemyApe> } },
+		{ "scripts\\02_server\\Map\\AM\\L_BLUE_X.lua", { Create<AmBlueX> } },
+		{ "scripts\\02_server\\Map\\AM\\L_TEAPOT_SERVER.lua", { Create<AmTeapotServer> } },
+
+		// Ninjago
+		{ "scripts\\02_server\\Map\\njhub\\L_GARMADON_CELEBRATION_SERVER.lua", { Create<NjGarmadonCelebration> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_WU_NPC.lua", { Create<NjWuNPC> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_SCROLL_CHEST_SERVER.lua", { Create<NjScrollChestServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_COLE_NPC.lua", { Create<NjColeNPC> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_JAY_MISSION_ITEMS.lua", { Create<NjJayMissionItems, NjNPCMissionSpinjitzuServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_NPC_MISSION_SPINJITZU_SERVER.lua", { Create<NjNPCMissionSpinjitzuServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_ENEMY_SKELETON_SPAWNER.lua", { Create<EnemySkeletonSpawner> } },
+		{ "scripts\\02_server\\Map\\General\\L_NJ_RAIL_SWITCH.lua", { Create<NjRailSwitch> } },
+		{ "scripts\\02_server\\Map\\General\\Ninjago\\L_RAIL_ACTIVATORS_SERVER.lua", { Create<NjRailActivatorsServer> } },
+		{ "scripts\\02_server\\Map\\General\\Ninjago\\L_RAIL_POST_SERVER.lua", { Create<NjRailPostServer> } },
+		{ "scripts\\02_server\\Map\\General\\Ninjago\\L_ICE_RAIL_ACTIVATOR_SERVER.lua", { Create<NjIceRailActivator> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_FALLING_TILE.lua", { Create<FallingTile> } },
+		{ "scripts\\02_server\\Enemy\\General\\L_ENEMY_NJ_BUFF_STUN_IMMUNITY.lua", { Create<EnemyNjBuff> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_IMAGINATION_SHRINE_SERVER.lua", { Create<ImaginationShrineServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_LIEUTENANT.lua", { Create<Lieutenant> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_RAIN_OF_ARROWS.lua", { Create<RainOfArrows> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_CAVE_PRISON_CAGE.lua", { Create<CavePrisonCage> } },
+		{ "scripts\\02_server\\Map\\njhub\\boss_instance\\L_MONASTERY_BOSS_INSTANCE_SERVER.lua", { Create<NjMonastryBossInstance> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_CATAPULT_BOUNCER_SERVER.lua", { Create<CatapultBouncerServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_CATAPULT_BASE_SERVER.lua", { Create<CatapultBaseServer> } },
+		{ "scripts\\02_server\\Map\\General\\Ninjago\\L_NJHUB_LAVA_PLAYER_DEATH_TRIGGER.lua", { Create<NjhubLavaPlayerDeathTrigger> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_MON_CORE_NOOK_DOORS.lua", { Create<MonCoreNookDoors> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_MON_CORE_SMASHABLE_DOORS.lua", { Create<MonCoreSmashableDoors> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_FLAME_JET_SERVER.lua", { Create<FlameJetServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_BURNING_TILE.lua", { Create<BurningTile> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_SPAWN_EARTH_PET_SERVER.lua", { Create<NjEarthDragonPetServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_EARTH_PET_SERVER.lua", { Create<NjEarthPetServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_DRAGON_EMBLEM_CHEST_SERVER.lua", { Create<NjDragonEmblemChestServer> } },
+		{ "scripts\\02_server\\Map\\njhub\\L_NYA_MISSION_ITEMS.lua", { Create<NjNyaMissionitems> } },
+
+		//DLU:
+		{ "scripts\\02_server\\DLU\\DLUVanityNPC.lua", { Create<DLUVanityNPC> } },
+
+		// Survival minigame
+		{ "scripts\\02_server\\Enemy\\Survival\\L_AG_SURVIVAL_STROMBIE.lua", { Create<AgSurvivalStromling> } },
+		{ "scripts\\02_server\\Enemy\\Survival\\L_AG_SURVIVAL_DARKLING_MECH.lua", { Create<AgSurvivalMech> } },
+		{ "scripts\\02_server\\Enemy\\Survival\\L_AG_SURVIVAL_DARK_SPIDERLING.lua", { Create<AgSurvivalSpiderling> } },
+
+		// Scripted equipment
+		{ "scripts\\EquipmentScripts\\Sunflower.lua", { Create<Sunflower> } },
+		{ "scripts/EquipmentScripts/AnvilOfArmor.lua", { Create<AnvilOfArmor> } },
+		{ "scripts/EquipmentScripts/FountainOfImagination.lua", { Create<FountainOfImagination> } },
+		{ "scripts/EquipmentScripts/CauldronOfLife.lua", { Create<CauldronOfLife> } },
+		{ "scripts\\02_server\\Equipment\\L_BOOTYDIG_SERVER.lua", { Create<BootyDigServer> } },
+		{ "scripts\\EquipmentScripts\\PersonalFortress.lua", { Create<PersonalFortress> } },
+		{ "scripts\\02_server\\Map\\General\\L_PROPERTY_DEVICE.lua", { Create<PropertyDevice> } },
+		{ "scripts\\02_server\\Map\\General\\L_IMAG_BACKPACK_HEALS_SERVER.lua", { Create<ImaginationBackpackHealServer> } },
+		{ "scripts\\ai\\GENERAL\\L_LEGO_DIE_ROLL.lua", { Create<LegoDieRoll> } },
+		{ "scripts\\EquipmentScripts\\BuccaneerValiantShip.lua", { Create<BuccaneerValiantShip> } },
+		{ "scripts\\EquipmentScripts\\XMarksTheSpot1.lua", { Create<XMarksTheSpotChest> } },
+		{ "scripts\\EquipmentScripts\\FireFirstSkillonStartup.lua", { Create<FireFirstSkillonStartup> } },
+
+		// FB
+		{ "scripts\\ai\\NS\\WH\\L_ROCKHYDRANT_BROKEN.lua", { Create<RockHydrantBroken> } },
+		{ "scripts\\ai\\NS\\L_NS_WH_FANS.lua", { Create<WhFans> } },
+
+		// WBL
+		{ "scripts\\zone\\LUPs\\WBL_generic_zone.lua", { Create<WblGenericZone> } }
+	};
+
+	//Big bad global bc this is a namespace and not a class:
+	InvalidScript* invalidToReturn = new InvalidScript();
+	struct ScriptEntry {
+		CppScripts::Script* script = nullptr; // The shared instance, nullptr if every entity gets its own
+		uint32_t uses = 0;
+	};
+
+	std::unordered_map<std::string, ScriptEntry> m_Scripts;
+}
 
-	//Misc:
-	if (scriptName == "scripts\\02_server\\Map\\General\\L_EXPLODING_ASSET.lua")
-		script = new ExplodingAsset();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_WISHING_WELL_SERVER.lua")
-		script = new WishingWellServer();
-	else if (scriptName == "scripts\\ai\\ACT\\L_ACT_PLAYER_DEATH_TRIGGER.lua")
-		script = new ActPlayerDeathTrigger();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_GROWING_FLOWER_SERVER.lua")
-		script = new GrowingFlower();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_TOKEN_CONSOLE_SERVER.lua")
-		script = new TokenConsoleServer();
-	else if (scriptName == "scripts\\ai\\ACT\\FootRace\\L_ACT_BASE_FOOT_RACE.lua")
-		script = new BaseFootRaceManager();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_PROP_PLATFORM.lua")
-		script = new PropertyPlatform();
-	else if (scriptName == "scripts\\02_server\\Map\\VE\\L_VE_BRICKSAMPLE_SERVER.lua")
-		return new VeBricksampleServer();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_MAIL_BOX_SERVER.lua")
-		script = new MailBoxServer();
-	else if (scriptName == "scripts\\ai\\ACT\\L_ACT_MINE.lua")
-		script = new ActMine();
-
-	//Racing:
-	else if (scriptName == "scripts\\ai\\RACING\\OBJECTS\\RACE_IMAGINE_CRATE_SERVER.lua")
-		script = new RaceImagineCrateServer();
-	else if (scriptName == "scripts\\ai\\ACT\\L_ACT_VEHICLE_DEATH_TRIGGER.lua")
-		script = new ActVehicleDeathTrigger();
-	else if (scriptName == "scripts\\ai\\RACING\\OBJECTS\\RACE_IMAGINE_POWERUP.lua")
-		script = new RaceImaginePowerup();
-	else if (scriptName == "scripts\\02_server\\Map\\FV\\Racing\\RACE_MAELSTROM_GEISER.lua")
-		script = new RaceMaelstromGeiser();
-	else if (scriptName == "scripts\\ai\\RACING\\OBJECTS\\FV_RACE_SMASH_EGG_IMAGINE_SERVER.lua")
-		script = new FvRaceSmashEggImagineServer();
-	else if (scriptName == "scripts\\ai\\RACING\\OBJECTS\\RACE_SMASH_SERVER.lua")
-		script = new RaceSmashServer();
-
-	//NT:
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_SENTINELWALKWAY_SERVER.lua")
-		script = new NtSentinelWalkwayServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_PARADOXTELE_SERVER.lua")
-		script = new NtParadoxTeleServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_DARKITECT_REVEAL_SERVER.lua")
-		script = new NtDarkitectRevealServer();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_BANK_INTERACT_SERVER.lua")
-		script = new BankInteractServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_VENTURESPEEDPAD_SERVER.lua")
-		script = new NtVentureSpeedPadServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_VENTURE_CANNON_SERVER.lua")
-		script = new NtVentureCannonServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_COMBAT_CHALLENGE_SERVER.lua")
-		script = new NtCombatChallengeServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_COMBAT_CHALLENGE_DUMMY.lua")
-		script = new NtCombatChallengeDummy();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\\\L_NT_COMBAT_EXPLODING_TARGET.lua")
-		script = new NtCombatChallengeExplodingDummy();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_BASE_INTERACT_DROP_LOOT_SERVER.lua")
-		script = new BaseInteractDropLootServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_ASSEMBLYTUBE_SERVER.lua")
-		script = new NtAssemblyTubeServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_PARADOX_PANEL_SERVER.lua")
-		script = new NtParadoxPanelServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_IMAG_BEAM_BUFFER.lua")
-		script = new NtImagBeamBuffer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_BEAM_IMAGINATION_COLLECTORS.lua")
-		script = new NtBeamImaginationCollectors();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_DIRT_CLOUD_SERVER.lua")
-		script = new NtDirtCloudServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_CONSOLE_TELEPORT_SERVER.lua")
-		script = new NtConsoleTeleportServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_SPAWN_STEGO_SERVER.lua")
-		script = new SpawnStegoServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_SPAWN_SABERCAT_SERVER.lua")
-		script = new SpawnSaberCatServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_SPAWN_SHRAKE_SERVER.lua")
-		script = new SpawnShrakeServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_DUKE_SERVER.lua")
-		script = new NtDukeServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_HAEL_SERVER.lua")
-		script = new NtHaelServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_OVERBUILD_SERVER.lua")
-		script = new NtOverbuildServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_VANDA_SERVER.lua")
-		script = new NtVandaServer();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_FORCE_VOLUME_SERVER.lua")
-		script = new ForceVolumeServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_XRAY_SERVER.lua")
-		script = new NtXRayServer();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_SLEEPING_GUARD.lua")
-		script = new NtSleepingGuard();
-	else if (scriptName == "scripts\\02_server\\Map\\NT\\L_NT_IMAGIMETER_VISIBILITY_SERVER.lua") {
-		script = new NTImagimeterVisibility();
+CppScripts::Script* CppScripts::GetScript(Entity* parent, const std::string& scriptName) {
+	// Counting the use shares the lookup of the cached instance
+	auto& cached = m_Scripts[scriptName];
+	cached.uses++;
+
+	if (cached.script != nullptr) {
+		return cached.script;
 	}
 
-	//AM:
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_AM_CONSOLE_TELEPORT_SERVER.lua")
-		script = new AmConsoleTeleportServer();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_FIN.lua")
-		script = new RandomSpawnerFin();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_PIT.lua")
-		script = new RandomSpawnerPit();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_STR.lua")
-		script = new RandomSpawnerStr();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_RANDOM_SPAWNER_ZIP.lua")
-		script = new RandomSpawnerZip();
-	else if (scriptName == "scripts\\02_server\\Enemy\\AM\\L_AM_DARKLING_MECH.lua")
-		script = new AmDarklingMech();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_BRIDGE.lua")
-		script = new AmBridge();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_DRAW_BRIDGE.lua")
-		script = new AmDrawBridge();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_SHIELD_GENERATOR.lua")
-		script = new AmShieldGenerator();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_SHIELD_GENERATOR_QUICKBUILD.lua")
-		script = new AmShieldGeneratorQuickbuild();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_DROPSHIP_COMPUTER.lua")
-		script = new AmDropshipComputer();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_SCROLL_READER_SERVER.lua")
-		script = new AmScrollReaderServer();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_TEMPLE_SKILL_VOLUME.lua")
-		script = new AmTemplateSkillVolume();
-	else if (scriptName == "scripts\\02_server\\Enemy\\General\\L_ENEMY_NJ_BUFF.lua")
-		script = new EnemyNjBuff();
-	else if (scriptName == "scripts\\02_server\\Enemy\\AM\\L_AM_SKELETON_ENGINEER.lua")
-		script = new AmSkeletonEngineer();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_SKULLKIN_DRILL.lua")
-		script = new AmSkullkinDrill();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_SKULLKIN_DRILL_STAND.lua")
-		script = new AmSkullkinDrillStand();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_SKULLKIN_TOWER.lua")
-		script = new AmSkullkinTower();
-	else if (scriptName == "scripts\\02_server\\Enemy\\AM\\L_AM_NAMED_DARKLING_DRAGON.lua")
-		script = new AmDarklingDragon();
-	else if (scriptName == "scripts\\02_server\\Enemy\\AM\\L_AM_DARKLING_DRAGON.lua")
-		script = new AmDarklingDragon();
-	else if (scriptName == "scripts\\02_server\\Enemy\\AM\\L_AM_DARKLING_APE.lua")
-		script = new BaseEnemyApe();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_BLUE_X.lua")
-		script = new AmBlueX();
-	else if (scriptName == "scripts\\02_server\\Map\\AM\\L_TEAPOT_SERVER.lua")
-		script = new AmTeapotServer();
-
-	// Ninjago
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_GARMADON_CELEBRATION_SERVER.lua")
-		script = new NjGarmadonCelebration();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_WU_NPC.lua")
-		script = new NjWuNPC();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_SCROLL_CHEST_SERVER.lua")
-		script = new NjScrollChestServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_COLE_NPC.lua")
-		script = new NjColeNPC();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_JAY_MISSION_ITEMS.lua")
-		script = (NjNPCMissionSpinjitzuServer*) new NjJayMissionItems();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_NPC_MISSION_SPINJITZU_SERVER.lua")
-		script = new NjNPCMissionSpinjitzuServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_ENEMY_SKELETON_SPAWNER.lua")
-		script = new EnemySkeletonSpawner();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_NJ_RAIL_SWITCH.lua")
-		script = new NjRailSwitch();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\Ninjago\\L_RAIL_ACTIVATORS_SERVER.lua")
-		script = new NjRailActivatorsServer();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\Ninjago\\L_RAIL_POST_SERVER.lua")
-		script = new NjRailPostServer();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\Ninjago\\L_ICE_RAIL_ACTIVATOR_SERVER.lua")
-		script = new NjIceRailActivator();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_FALLING_TILE.lua")
-		script = new FallingTile();
-	else if (scriptName == "scripts\\02_server\\Enemy\\General\\L_ENEMY_NJ_BUFF_STUN_IMMUNITY.lua")
-		script = new EnemyNjBuff();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_IMAGINATION_SHRINE_SERVER.lua")
-		script = new ImaginationShrineServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_LIEUTENANT.lua")
-		script = new Lieutenant();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_RAIN_OF_ARROWS.lua")
-		script = new RainOfArrows();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_CAVE_PRISON_CAGE.lua")
-		script = new CavePrisonCage();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\boss_instance\\L_MONASTERY_BOSS_INSTANCE_SERVER.lua")
-		script = new NjMonastryBossInstance();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_CATAPULT_BOUNCER_SERVER.lua")
-		script = new CatapultBouncerServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_CATAPULT_BASE_SERVER.lua")
-		script = new CatapultBaseServer();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\Ninjago\\L_NJHUB_LAVA_PLAYER_DEATH_TRIGGER.lua")
-		script = new NjhubLavaPlayerDeathTrigger();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_MON_CORE_NOOK_DOORS.lua")
-		script = new MonCoreNookDoors();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_MON_CORE_SMASHABLE_DOORS.lua")
-		script = new MonCoreSmashableDoors();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_FLAME_JET_SERVER.lua")
-		script = new FlameJetServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_BURNING_TILE.lua")
-		script = new BurningTile();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_SPAWN_EARTH_PET_SERVER.lua")
-		script = new NjEarthDragonPetServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_EARTH_PET_SERVER.lua")
-		script = new NjEarthPetServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_DRAGON_EMBLEM_CHEST_SERVER.lua")
-		script = new NjDragonEmblemChestServer();
-	else if (scriptName == "scripts\\02_server\\Map\\njhub\\L_NYA_MISSION_ITEMS.lua")
-		script = new NjNyaMissionitems();
-
-	//DLU:
-	else if (scriptName == "scripts\\02_server\\DLU\\DLUVanityNPC.lua")
-		script = new DLUVanityNPC();
-
-	// Survival minigame
-	else if (scriptName == "scripts\\02_server\\Enemy\\Survival\\L_AG_SURVIVAL_STROMBIE.lua")
-		script = new AgSurvivalStromling();
-	else if (scriptName == "scripts\\02_server\\Enemy\\Survival\\L_AG_SURVIVAL_DARKLING_MECH.lua")
-		script = new AgSurvivalMech();
-	else if (scriptName == "scripts\\02_server\\Enemy\\Survival\\L_AG_SURVIVAL_DARK_SPIDERLING.lua")
-		script = new AgSurvivalSpiderling();
-
-	// Scripted equipment
-	else if (scriptName == "scripts\\EquipmentScripts\\Sunflower.lua")
-		script = new Sunflower();
-	else if (scriptName == "scripts/EquipmentScripts/AnvilOfArmor.lua")
-		script = new AnvilOfArmor();
-	else if (scriptName == "scripts/EquipmentScripts/FountainOfImagination.lua")
-		script = new FountainOfImagination();
-	else if (scriptName == "scripts/EquipmentScripts/CauldronOfLife.lua")
-		script = new CauldronOfLife();
-	else if (scriptName == "scripts\\02_server\\Equipment\\L_BOOTYDIG_SERVER.lua")
-		script = new BootyDigServer();
-	else if (scriptName == "scripts\\EquipmentScripts\\PersonalFortress.lua")
-		script = new PersonalFortress();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_PROPERTY_DEVICE.lua")
-		script = new PropertyDevice();
-	else if (scriptName == "scripts\\02_server\\Map\\General\\L_IMAG_BACKPACK_HEALS_SERVER.lua")
-		script = new ImaginationBackpackHealServer();
-	else if (scriptName == "scripts\\ai\\GENERAL\\L_LEGO_DIE_ROLL.lua")
-		script = new LegoDieRoll();
-	else if (scriptName == "scripts\\EquipmentScripts\\BuccaneerValiantShip.lua")
-		script = new BuccaneerValiantShip();
-	else if (scriptName == "scripts\\EquipmentScripts\\XMarksTheSpot1.lua")
-		script = new XMarksTheSpotChest();
-	else if (scriptName == "scripts\\EquipmentScripts\\FireFirstSkillonStartup.lua")
-		script = new FireFirstSkillonStartup();
-
-	// FB
-	else if (scriptName == "scripts\\ai\\NS\\WH\\L_ROCKHYDRANT_BROKEN.lua")
-		script = new RockHydrantBroken();
-	else if (scriptName == "scripts\\ai\\NS\\L_NS_WH_FANS.lua")
-		script = new WhFans();
-
-	// WBL
-	else if (scriptName == "scripts\\zone\\LUPs\\WBL_generic_zone.lua")
-		script = new WblGenericZone();
+	const auto registration = scriptRegistry.find(scriptName);
 
 	// handle invalid script reporting if the path is greater than zero and it's not an ignored script
 	// information not really needed for sys admins but is for developers
-	else if (script == invalidToReturn) {
+	if (registration == scriptRegistry.end()) {
 		if ((scriptName.length() > 0) && !((scriptName == "scripts\\02_server\\Enemy\\General\\L_SUSPEND_LUA_AI.lua") ||
 			(scriptName == "scripts\\02_server\\Enemy\\General\\L_BASE_ENEMY_SPIDERLING.lua") ||
 			(scriptName == "scripts\\empty.lua")
 			)) Game::logger->LogDebug("CppScripts", "LOT %i attempted to load CppScript for '%s', but returned InvalidScript.", parent->GetLOT(), scriptName.c_str());
+
+		cached.script = invalidToReturn;
+		return invalidToReturn;
+	}
+
+	auto* script = registration->second.factory();
+
+	if (registration->second.shared) {
+		cached.script = script;
 	}
 
-	m_Scripts[scriptName] = script;
 	return script;
 }
 
+std::vector<std::pair<std::string, uint32_t>> CppScripts::GetScriptUsage() {
+	std::vector<std::pair<std::string, uint32_t>> usage;
+	usage.reserve(m_Scripts.size());
+
+	for (const auto& [scriptName, entry] : m_Scripts) {
+		usage.emplace_back(scriptName, entry.uses);
+	}
+
+	std::sort(usage.begin(), usage.end(), [](const auto& a, const auto& b) {
+		if (a.second != b.second) return a.second > b.second;
+		return a.first < b.first;
+		});
+
+	return usage;
+}
+
 std::vector<CppScripts::Script*> CppScripts::GetEntityScripts(Entity* entity) {
 	std::vector<CppScripts::Script*> scripts;
 	std::vector<ScriptComponent*> comps = entity->GetScriptComponents();
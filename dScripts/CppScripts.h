@@ -319,5 +319,11 @@ namespace CppScripts {
 	};
 
 	Script* GetScript(Entity* parent, const std::string& scriptName);
+
+	/**
+	 * Returns how many times each script was requested for an entity in this world, including paths without a C++ script
+	 * @return the number of requests per script path, most requested first
+	 */
+	std::vector<std::pair<std::string, uint32_t>> GetScriptUsage();
 	std::vector<Script*> GetEntityScripts(Entity* entity);
 };
@@ -25,18 +25,7 @@ void ScriptComponent::Serialize(RakNet::BitStream* outBitStream, bool bIsInitial
 
 		if (hasNetworkSettings) {
 
-			// First write the most inner LDF data
-			RakNet::BitStream ldfData;
-			ldfData.Write<uint8_t>(0);
-			ldfData.Write<uint32_t>(networkSettings.size());
-
-			for (auto* networkSetting : networkSettings) {
-				networkSetting->WriteToPacket(&ldfData);
-			}
-
-			// Finally write everything to the stream
-			outBitStream->Write<uint32_t>(ldfData.GetNumberOfBytesUsed());
-			outBitStream->Write(ldfData);
+			LDFBaseData::WriteListToPacket(outBitStream, networkSettings);
 		}
 	}
 }
@@ -8,10 +8,16 @@
 #include "Database.h"
 #include "dLogger.h"
 #include "Game.h"
+#include "ConfigOptions.h"
+#include "PacketCapture.h"
+
+// How long master has to answer a lease request before it's sent again
+constexpr auto leaseTimeout = std::chrono::seconds(10);
 
 // Static Variables
 ObjectIDManager* ObjectIDManager::m_Address = nullptr;
-static std::uniform_int_distribution<int> uni(10000000, INT32_MAX);
+PacketCaptureWriter* ObjectIDManager::capture = nullptr;
+PacketCaptureReader* ObjectIDManager::replay = nullptr;
 
 //! Initializes the manager
 void ObjectIDManager::Initialize(void) {
@@ -21,38 +27,114 @@ void ObjectIDManager::Initialize(void) {
 
 //! Requests a persistent ID
 void ObjectIDManager::RequestPersistentID(std::function<void(uint32_t)> callback) {
-	PersistentIDRequest* request = new PersistentIDRequest();
-	request->requestID = ++this->currentRequestID;
-	request->callback = callback;
+	uint32_t id = 0;
+
+	if (!this->waitingRequests.empty() || !TakeLeasedID(id)) {
+		this->waitingRequests.push_back(callback);
+
+		RequestLease();
+
+		return;
+	}
 
-	this->requests.push_back(request);
+	TopUpLeases();
 
-	MasterPackets::SendPersistentIDRequest(Game::server, request->requestID);
+	callback(id);
 }
 
 //! Handles a persistent ID response
-void ObjectIDManager::HandleRequestPersistentIDResponse(uint64_t requestID, uint32_t persistentID) {
-	for (uint32_t i = 0; i < this->requests.size(); ++i) {
-		if (this->requests[i]->requestID == requestID) {
-
-			// Call the callback function
-			this->requests[i]->callback(persistentID);
-
-			// Then delete the request
-			delete this->requests[i];
-			this->requests.erase(this->requests.begin() + i);
-			return;
-		}
+void ObjectIDManager::HandleRequestPersistentIDResponse(uint64_t requestID, uint32_t persistentID, uint32_t count) {
+	if (requestID != this->leaseRequestID) {
+		Game::logger->Log("ObjectIDManager", "Received a persistent ID lease (%llu) which wasn't requested", requestID);
+		return;
 	}
+
+	this->leaseRequested = false;
+
+	if (count > 0) this->leases.push_back({ persistentID, count });
+
+	// Hand out the new IDs to everyone who was waiting in the order they asked, callbacks may request more IDs
+	uint32_t id = 0;
+	while (!this->waitingRequests.empty() && TakeLeasedID(id)) {
+		const auto callback = this->waitingRequests.front();
+		this->waitingRequests.pop_front();
+
+		callback(id);
+	}
+
+	if (!this->waitingRequests.empty()) {
+		RequestLease();
+	} else {
+		TopUpLeases();
+	}
+}
+
+//! Leases persistent IDs from master ahead of time when the leased IDs are running low
+void ObjectIDManager::TopUpLeases(void) {
+	uint32_t available = 0;
+	for (const auto& lease : this->leases) {
+		available += lease.count;
+	}
+
+	if (available <= ConfigOptions::persistentIdLeaseSize.Get() / 2) RequestLease();
+}
+
+//! Takes the next leased ID
+bool ObjectIDManager::TakeLeasedID(uint32_t& id) {
+	if (this->leases.empty()) return false;
+
+	auto& lease = this->leases.front();
+
+	id = lease.next++;
+
+	if (--lease.count == 0) this->leases.pop_front();
+
+	return true;
+}
+
+//! Asks master for a new lease if none is on its way
+void ObjectIDManager::RequestLease() {
+	if (this->leaseRequested) return;
+
+	this->leaseRequested = true;
+	this->leaseRequestID = ++this->currentRequestID;
+	this->leaseRequestTime = std::chrono::steady_clock::now();
+
+	MasterPackets::SendPersistentIDRequest(Game::server, this->leaseRequestID, ConfigOptions::persistentIdLeaseSize.Get());
+}
+
+//! Requests the lease on its way again if master hasn't answered in time
+void ObjectIDManager::RetryLease(void) {
+	if (!this->leaseRequested || std::chrono::steady_clock::now() - this->leaseRequestTime < leaseTimeout) return;
+
+	Game::logger->Log("ObjectIDManager", "Master didn't answer persistent ID lease (%llu), requesting it again", this->leaseRequestID);
+
+	this->leaseRequested = false;
+
+	RequestLease();
 }
 
 //! Handles cases where we have to get a unique object ID synchronously
 uint32_t ObjectIDManager::GenerateRandomObjectID() {
-	std::random_device rd;
+	uint32_t id = 0;
+
+	// A replay hands out the IDs the captured world generated
+	if (replay && replay->TakeObjectID(id)) return id;
+
+	// These IDs are persistent keys, so they come from real entropy and not the world's seeded engine,
+	// which other worlds started in the same second share
+	static thread_local std::mt19937 generator = []() {
+		std::random_device device;
+		std::seed_seq seed{ device(), device(), device(), device(), device(), device(), device(), device() };
+		return std::mt19937(seed);
+	}();
+	static thread_local std::uniform_int_distribution<int> distribution(10000000, INT32_MAX);
+
+	id = distribution(generator);
 
-	std::mt19937 rng(rd());
+	if (capture) capture->WriteObjectID(id);
 
-	return  uni(rng);
+	return id;
 }
 
 
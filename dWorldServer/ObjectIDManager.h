@@ -1,20 +1,23 @@
 #pragma once
 
 // C++
+#include <chrono>
+#include <deque>
 #include <functional>
-#include <vector>
 #include <stdint.h>
 
+class PacketCaptureWriter;
+class PacketCaptureReader;
+
 /*!
   \file ObjectIDManager.hpp
   \brief A manager for handling object ID generation
  */
 
- //! The persistent ID request
-struct PersistentIDRequest {
-	uint64_t requestID;
-
-	std::function<void(uint32_t)> callback;
+ //! A block of persistent IDs leased from master
+struct PersistentIDLease {
+	uint32_t next;  //!< The next unused ID in the block
+	uint32_t count; //!< The number of unused IDs left in the block
 };
 
 //! The Object ID Manager
@@ -22,10 +25,27 @@ class ObjectIDManager {
 private:
 	static ObjectIDManager* m_Address;         //!< The singleton instance
 
-	std::vector<PersistentIDRequest*> requests; //!< All outstanding persistent ID requests
-	uint64_t currentRequestID;                  //!< The current request ID
+	std::deque<std::function<void(uint32_t)>> waitingRequests; //!< Requests waiting for a lease, in the order they were made
+	std::deque<PersistentIDLease> leases;                      //!< The leased IDs which haven't been handed out yet
+	bool leaseRequested = false;                               //!< Whether a lease is on its way from master
+	uint64_t leaseRequestID = 0;                               //!< The request ID of the lease on its way
+	std::chrono::steady_clock::time_point leaseRequestTime;    //!< When the lease on its way was requested
+	uint64_t currentRequestID = 0;                             //!< The current request ID
+
+	uint32_t currentObjectID;                                  //!< The current object ID
 
-	uint32_t currentObjectID;                   //!< The current object ID
+	static PacketCaptureWriter* capture;                       //!< Records the random object IDs, if capturing
+	static PacketCaptureReader* replay;                        //!< Hands out the recorded random object IDs, if replaying
+
+	//! Takes the next leased ID
+	/*!
+	  \param id Set to the leased ID
+	  \return Whether there was a leased ID left
+	 */
+	bool TakeLeasedID(uint32_t& id);
+
+	//! Asks master for a new lease if none is on its way
+	void RequestLease();
 
 public:
 
@@ -43,6 +63,8 @@ public:
 
 	//! Requests a persistent ID
 	/*!
+	  The callback is called right away with a leased ID if there is one, otherwise it is called once
+	  the next lease arrives from master.
 	  \param callback The callback function
 	 */
 	void RequestPersistentID(std::function<void(uint32_t)> callback);
@@ -51,9 +73,20 @@ public:
 	//! Handles a persistent ID response
 	/*!
 	  \param requestID The request ID
-	  \param persistentID The persistent ID
+	  \param persistentID The first persistent ID of the lease
+	  \param count The number of persistent IDs in the lease
 	 */
-	void HandleRequestPersistentIDResponse(uint64_t requestID, uint32_t persistentID);
+	void HandleRequestPersistentIDResponse(uint64_t requestID, uint32_t persistentID, uint32_t count = 1);
+
+	//! Leases persistent IDs from master ahead of time when the leased IDs are running low
+	void TopUpLeases(void);
+
+	//! Requests the lease on its way again if master hasn't answered in time
+	/*!
+	  A lease master never answers, such as one lost while master restarted, would otherwise block every
+	  later lease. The answer to the first request is ignored if it does arrive.
+	 */
+	void RetryLease(void);
 
 	//! Generates an object ID server-sided
 	/*!
@@ -67,6 +100,18 @@ public:
 	 */
 	static uint32_t GenerateRandomObjectID();
 
+	//! Sets the capture random object IDs are recorded to
+	/*!
+	  \param writer The capture, or nullptr to stop recording
+	 */
+	static void SetCapture(PacketCaptureWriter* writer) { capture = writer; }
+
+	//! Sets the capture random object IDs are replayed from
+	/*!
+	  \param reader The capture, or nullptr to stop replaying
+	 */
+	static void SetReplay(PacketCaptureReader* reader) { replay = reader; }
+
 	//! Generates a persistent object ID server-sided
 	/*!
 	  \return A generated object ID
@@ -12,6 +12,7 @@
 #include "dLogger.h"
 #include "Database.h"
 #include "dConfig.h"
+#include "ConfigOptions.h"
 #include "dpWorld.h"
 #include "dZoneManager.h"
 #include "Metrics.hpp"
@@ -55,8 +56,12 @@
 #include "MasterPackets.h"
 #include "Player.h"
 #include "PropertyManagementComponent.h"
+#include "PropertyListingManager.h"
+#include "ScriptedActivityComponent.h"
 #include "AssetManager.h"
 #include "eBlueprintSaveResponseType.h"
+#include "PacketCapture.h"
+#include "ReplayServer.h"
 
 #include "ZCompression.h"
 
@@ -79,10 +84,21 @@ bool chatDisabled = false;
 bool chatConnected = false;
 bool worldShutdownSequenceStarted = false;
 bool worldShutdownSequenceComplete = false;
+
+/**
+ * Set when running with -capture, records everything the server handles
+ */
+PacketCaptureWriter* packetCapture = nullptr;
+
+/**
+ * Set when running with -replay, in which case it is also Game::server
+ */
+ReplayServer* replayServer = nullptr;
 void WorldShutdownSequence();
 void WorldShutdownProcess(uint32_t zoneId);
 void FinalizeShutdown();
 void SendShutdownMessageToMaster();
+void LogMetrics();
 
 dLogger* SetupLogger(int zoneID, int instanceID);
 void HandlePacketChat(Packet* packet);
@@ -113,6 +129,8 @@ int main(int argc, char** argv) {
 	int cloneID = 0;
 	int maxClients = 8;
 	int ourPort = 2007;
+	std::string capturePath;
+	std::string replayPath;
 
 	//Check our arguments:
 	for (int i = 0; i < argc; ++i) {
@@ -123,6 +141,20 @@ int main(int argc, char** argv) {
 		if (argument == "-clone") cloneID = atoi(argv[i + 1]);
 		if (argument == "-maxclients") maxClients = atoi(argv[i + 1]);
 		if (argument == "-port") ourPort = atoi(argv[i + 1]);
+		if (argument == "-capture" && i + 1 < argc) capturePath = argv[i + 1];
+		if (argument == "-replay" && i + 1 < argc) replayPath = argv[i + 1];
+	}
+
+	// A replay runs the zone the capture was recorded in
+	std::unique_ptr<PacketCaptureReader> replayReader;
+	if (!replayPath.empty()) {
+		replayReader = std::make_unique<PacketCaptureReader>(replayPath);
+
+		if (replayReader->IsValid()) {
+			zoneID = replayReader->GetHeader().zoneID;
+			instanceID = replayReader->GetHeader().instanceID;
+			cloneID = replayReader->GetHeader().cloneID;
+		}
 	}
 
 	//Create all the objects we need to run our service:
@@ -138,6 +170,13 @@ int main(int argc, char** argv) {
 	Game::logger->SetLogToConsole(false); //By default, turn it back off if not in debug.
 #endif
 
+	if (replayReader && !replayReader->IsValid()) {
+		Game::logger->Log("WorldServer", "Unable to replay %s, it is not a valid capture", replayPath.c_str());
+		return EXIT_FAILURE;
+	}
+
+	if (replayReader) ObjectIDManager::SetReplay(replayReader.get());
+
 	//Read our config:
 	dConfig config("worldconfig.ini");
 	Game::config = &config;
@@ -208,7 +247,12 @@ int main(int argc, char** argv) {
 	LootGenerator::Instance();
 	Game::chatFilter = new dChatFilter(Game::assetManager->GetResPath().string() + "/chatplus_en_us", bool(std::stoi(config.GetValue("dont_generate_dcf"))));
 
-	Game::server = new dServer(masterIP, ourPort, instanceID, maxClients, false, true, Game::logger, masterIP, masterPort, ServerType::World, Game::config, zoneID);
+	if (replayReader) {
+		replayServer = new ReplayServer(Game::logger, zoneID, instanceID);
+		Game::server = replayServer;
+	} else {
+		Game::server = new dServer(masterIP, ourPort, instanceID, maxClients, false, true, Game::logger, masterIP, masterPort, ServerType::World, Game::config, zoneID);
+	}
 
 	//Connect to the chat server:
 	int chatPort = 1501;
@@ -216,11 +260,42 @@ int main(int argc, char** argv) {
 
 	auto chatSock = SocketDescriptor(uint16_t(ourPort + 2), 0);
 	Game::chatServer = RakNetworkFactory::GetRakPeerInterface();
-	Game::chatServer->Startup(1, 30, &chatSock, 1);
-	Game::chatServer->Connect(masterIP.c_str(), chatPort, "3.25 ND1", 8);
+
+	// When replaying, the chat packets come from the capture and the peer is never started so nothing is sent to chat
+	if (!replayReader) {
+		Game::chatServer->Startup(1, 30, &chatSock, 1);
+		Game::chatServer->Connect(masterIP.c_str(), chatPort, "3.25 ND1", 8);
+	}
 
 	//Set up other things:
-	Game::randomEngine = std::mt19937(time(0));
+	const uint32_t seed = replayReader ? replayReader->GetHeader().seed : static_cast<uint32_t>(time(0));
+	Game::randomEngine = std::mt19937(seed);
+	srand(seed);
+
+	if (capturePath.empty() && !Game::config->GetValue("packet_capture_folder").empty()) {
+		capturePath = Game::config->GetValue("packet_capture_folder") + "/WorldServer_" + std::to_string(zoneID) + "_" + std::to_string(instanceID) + "_" + std::to_string(time(nullptr)) + ".capture";
+	}
+
+	if (!capturePath.empty() && !replayReader) {
+		PacketCaptureHeader header;
+		header.zoneID = zoneID;
+		header.instanceID = instanceID;
+		header.cloneID = cloneID;
+		header.seed = seed;
+		header.startTime = static_cast<uint64_t>(time(0));
+
+		packetCapture = new PacketCaptureWriter(capturePath, header);
+
+		if (packetCapture->IsOpen()) {
+			Game::logger->Log("WorldServer", "Capturing packets to %s", capturePath.c_str());
+			Game::server->SetCapture(packetCapture);
+			ObjectIDManager::SetCapture(packetCapture);
+		} else {
+			Game::logger->Log("WorldServer", "Unable to open %s for capturing packets", capturePath.c_str());
+			delete packetCapture;
+			packetCapture = nullptr;
+		}
+	}
 
 	//Run it until server gets a kill message from Master:
 	auto lastTime = std::chrono::high_resolution_clock::now();
@@ -242,9 +317,16 @@ int main(int argc, char** argv) {
 	int framesSinceShutdownSequence = 0;
 	int currentFramerate = highFrameRate;
 
+	float timeSinceMetricsLog = 0.0f;
+	float timeSinceConfigCheck = 0.0f;
+
 	int ghostingStepCount = 0;
 	auto ghostingLastTime = std::chrono::high_resolution_clock::now();
 
+	uint64_t replayedFrames = 0;
+	float replayedTime = 0.0f;
+	const auto replayStartTime = std::chrono::high_resolution_clock::now();
+
 	PerformanceManager::SelectProfile(zoneID);
 
 	//Load our level:
@@ -301,8 +383,34 @@ int main(int argc, char** argv) {
 
 		std::clock_t metricCPUTimeStart = std::clock();
 
-		const auto currentTime = std::chrono::high_resolution_clock::now();
+		auto currentTime = std::chrono::high_resolution_clock::now();
 		float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
+
+		if (replayServer) {
+			// Frames run back to back with the time they took when captured, the clock only moves as far as the capture says
+			if (replayServer->NextFrame(*replayReader, deltaTime)) {
+				replayedFrames++;
+				replayedTime += deltaTime;
+			} else {
+				if (!worldShutdownSequenceStarted) {
+					const auto wallTime = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - replayStartTime).count();
+
+					Game::logger->Log("WorldServer", "Replay finished, %llu frames and %llu packets in %.2fs, captured over %.2fs (%.1fx)",
+						static_cast<unsigned long long>(replayedFrames), static_cast<unsigned long long>(replayServer->GetPacketCount()),
+						wallTime, replayedTime, wallTime > 0.0f ? replayedTime / wallTime : 0.0f);
+					LogMetrics();
+
+					worldShutdownSequenceStarted = true;
+				}
+
+				deltaTime = 0.0f;
+			}
+
+			currentTime = lastTime + std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::duration<float>(deltaTime));
+		} else if (packetCapture) {
+			packetCapture->WriteFrame(deltaTime);
+		}
+
 		lastTime = currentTime;
 
 		const auto occupied = UserManager::Instance()->GetUserCount() != 0;
@@ -318,6 +426,32 @@ int main(int argc, char** argv) {
 			Game::logger->Log("WorldServer", "We're running behind, dT: %f > %f (framerate)", deltaTime, currentFramerate);
 		}
 
+		const auto metricsLogInterval = ConfigOptions::metricsLogInterval.Get();
+		if (metricsLogInterval > 0.0f) {
+			timeSinceMetricsLog += deltaTime;
+
+			if (timeSinceMetricsLog >= metricsLogInterval) {
+				LogMetrics();
+				timeSinceMetricsLog = 0.0f;
+			}
+		}
+
+		// Pick up changes to the config files, the config options follow them without a restart
+		const auto configReloadInterval = ConfigOptions::configReloadInterval.Get();
+		if (configReloadInterval > 0.0f) {
+			timeSinceConfigCheck += deltaTime;
+
+			if (timeSinceConfigCheck >= configReloadInterval) {
+				if (Game::config->ReloadIfChanged()) {
+					// Activities copy their lobby sizes from the config, the options follow it on their own
+					ScriptedActivityComponent::ReloadAllConfigs();
+
+					Game::logger->Log("WorldServer", "Reloaded the config");
+				}
+				timeSinceConfigCheck = 0.0f;
+			}
+		}
+
 		//Check if we're still connected to master:
 		if (!Game::server->GetIsConnectedToMaster()) {
 			framesSinceMasterDisconnect++;
@@ -330,7 +464,7 @@ int main(int argc, char** argv) {
 		} else framesSinceMasterDisconnect = 0;
 
 		// Check if we're still connected to chat:
-		if (!chatConnected) {
+		if (!chatConnected && !replayServer) {
 			framesSinceChatDisconnect++;
 
 			// Attempt to reconnect every 30 seconds.
@@ -374,10 +508,20 @@ int main(int argc, char** argv) {
 		}
 
 		//Handle our chat packets:
-		packet = Game::chatServer->Receive();
-		if (packet) {
-			HandlePacketChat(packet);
-			Game::chatServer->DeallocatePacket(packet);
+		if (replayServer) {
+			packet = replayServer->ReceiveFromChat();
+			if (packet) {
+				HandlePacketChat(packet);
+				replayServer->DeallocateChatPacket(packet);
+			}
+		} else {
+			packet = Game::chatServer->Receive();
+			if (packet) {
+				if (packetCapture) packetCapture->WritePacket(ePacketSource::CHAT, packet);
+
+				HandlePacketChat(packet);
+				Game::chatServer->DeallocatePacket(packet);
+			}
 		}
 
 		//Handle world-specific packets:
@@ -386,7 +530,7 @@ int main(int argc, char** argv) {
 		UserManager::Instance()->DeletePendingRemovals();
 
 		auto t1 = std::chrono::high_resolution_clock::now();
-		for (int curPacket = 0; curPacket < maxPacketsToProcess && timeSpent < maxPacketProcessingTime; curPacket++) {
+		for (int curPacket = 0; curPacket < maxPacketsToProcess && (timeSpent < maxPacketProcessingTime || replayServer); curPacket++) {
 			packet = Game::server->Receive();
 			if (packet) {
 				auto t1 = std::chrono::high_resolution_clock::now();
@@ -413,6 +557,7 @@ int main(int argc, char** argv) {
 		//Push our log every 15s:
 		if (framesSinceLastFlush >= 1000) {
 			Game::logger->Flush();
+			if (packetCapture) packetCapture->Flush();
 			framesSinceLastFlush = 0;
 		} else framesSinceLastFlush++;
 
@@ -460,7 +605,7 @@ int main(int argc, char** argv) {
 		Metrics::StartMeasurement(MetricVariable::Sleep);
 
 		t += std::chrono::milliseconds(currentFramerate);
-		std::this_thread::sleep_until(t);
+		if (!replayServer) std::this_thread::sleep_until(t);
 
 		Metrics::EndMeasurement(MetricVariable::Sleep);
 
@@ -474,10 +619,15 @@ int main(int argc, char** argv) {
 
 				MasterPackets::SendWorldReady(Game::server, Game::server->GetZoneID(), Game::server->GetInstanceID());
 
+				// Lease persistent IDs now, so the first player to need one doesn't wait on master
+				ObjectIDManager::Instance()->TopUpLeases();
+
 				ready = true;
 			}
 		}
 
+		ObjectIDManager::Instance()->RetryLease();
+
 		if (worldShutdownSequenceStarted && !worldShutdownSequenceComplete) {
 			WorldShutdownProcess(zoneID);
 			break;
@@ -706,7 +856,10 @@ void HandlePacket(Packet* packet) {
 		case MSG_MASTER_REQUEST_PERSISTENT_ID_RESPONSE: {
 			uint64_t requestID = PacketUtils::ReadPacketU64(8, packet);
 			uint32_t objectID = PacketUtils::ReadPacketU32(16, packet);
-			ObjectIDManager::Instance()->HandleRequestPersistentIDResponse(requestID, objectID);
+
+			// Masters from before leasing send a single ID without a count
+			uint32_t count = packet->length >= 24 ? PacketUtils::ReadPacketU32(20, packet) : 1;
+			ObjectIDManager::Instance()->HandleRequestPersistentIDResponse(requestID, objectID, count);
 			break;
 		}
 
@@ -802,6 +955,17 @@ void HandlePacket(Packet* packet) {
 			break;
 		}
 
+		case MSG_MASTER_PROPERTY_LISTING_CHANGED: {
+			RakNet::BitStream inStream(packet->data, packet->length, false);
+			uint64_t header = inStream.Read(header);
+
+			LWOMAPID mapId = LWOMAPID_INVALID;
+			inStream.Read(mapId);
+
+			PropertyListingManager::Instance()->Invalidate(mapId);
+			break;
+		}
+
 		case MSG_MASTER_NEW_SESSION_ALERT: {
 			RakNet::BitStream inStream(packet->data, packet->length, false);
 			uint64_t header = inStream.Read(header);
@@ -1022,7 +1186,19 @@ void HandlePacket(Packet* packet) {
 					GameMessages::SendPlayerReachedRespawnCheckpoint(player, respawnPoint, NiQuaternion::IDENTITY);
 				}
 
-				EntityManager::Instance()->ConstructAllEntities(packet->systemAddress);
+				// The client is told it's done loading once the entities streamed to it are all constructed
+				const auto playerID = player->GetObjectID();
+				const auto playerAddress = packet->systemAddress;
+
+				EntityManager::Instance()->ConstructAllEntities(packet->systemAddress, [playerID, playerAddress]() {
+					auto* player = EntityManager::Instance()->GetEntity(playerID);
+
+					if (player == nullptr) return;
+
+					// Tell the client it's done loading:
+					GameMessages::SendInvalidZoneTransferList(player, playerAddress, GeneralUtils::ASCIIToUTF16(Game::config->GetValue("source")), u"", false, false);
+					GameMessages::SendServerDoneLoadingAllObjects(player, playerAddress);
+					});
 
 				auto* characterComponent = player->GetComponent<CharacterComponent>();
 				if (characterComponent) {
@@ -1114,8 +1290,9 @@ void HandlePacket(Packet* packet) {
 
 								bitStream.Write<uint32_t>(lxfmlSize);
 
-								for (size_t i = 0; i < lxfmlSize; ++i)
-									bitStream.Write<uint8_t>(lxfml->get());
+								std::unique_ptr<char[]> lxfmlData(new char[lxfmlSize]);
+								lxfml->read(lxfmlData.get(), lxfmlSize);
+								bitStream.Write(lxfmlData.get(), lxfmlSize);
 
 								SystemAddress sysAddr = packet->systemAddress;
 								SEND_PACKET;
@@ -1133,10 +1310,6 @@ void HandlePacket(Packet* packet) {
 
 			noBBB:
 
-				// Tell the client it's done loading:
-				GameMessages::SendInvalidZoneTransferList(player, packet->systemAddress, GeneralUtils::ASCIIToUTF16(Game::config->GetValue("source")), u"", false, false);
-				GameMessages::SendServerDoneLoadingAllObjects(player, packet->systemAddress);
-
 				//Send the player it's mail count:
 				//update: this might not be needed so im going to try disabling this here.
 				//Mail::HandleNotificationRequest(packet->systemAddress, player->GetObjectID());
@@ -1241,7 +1414,7 @@ void HandlePacket(Packet* packet) {
 		//Could be insane lag, but I'mma just YEET them as it's usually speedhacking.
 		//This is updated to now count the amount of times we've been caught "speedhacking" to kick with a delay
 		//This is hopefully going to fix the random disconnects people face sometimes.
-		if (Game::config->GetValue("disable_anti_speedhack") == "1") {
+		if (ConfigOptions::disableAntiSpeedhack.Get()) {
 			return;
 		}
 
@@ -1315,6 +1488,14 @@ void FinalizeShutdown() {
 	Metrics::Clear();
 	Database::Destroy("WorldServer");
 	delete Game::chatFilter;
+
+	if (packetCapture) {
+		Game::server->SetCapture(nullptr);
+		ObjectIDManager::SetCapture(nullptr);
+		delete packetCapture;
+		packetCapture = nullptr;
+	}
+
 	delete Game::server;
 	delete Game::logger;
 
@@ -1323,6 +1504,22 @@ void FinalizeShutdown() {
 	exit(EXIT_SUCCESS);
 }
 
+void LogMetrics() {
+	Game::logger->Log("Metrics", "Users: %i", static_cast<uint32_t>(UserManager::Instance()->GetUserCount()));
+
+	for (const auto variable : Metrics::GetAllMetrics()) {
+		const auto* metric = Metrics::GetMetric(variable);
+		if (metric == nullptr) continue;
+
+		Game::logger->Log(
+			"Metrics", "%s: average %.2fms, min %.2fms, max %.2fms",
+			Metrics::MetricVariableToString(variable).c_str(),
+			Metrics::ToMiliseconds(metric->average),
+			Metrics::ToMiliseconds(metric->min),
+			Metrics::ToMiliseconds(metric->max));
+	}
+}
+
 void SendShutdownMessageToMaster() {
 	CBITSTREAM;
 	PacketUtils::WriteHeader(bitStream, MASTER, MSG_MASTER_SHUTDOWN_RESPONSE);
@@ -193,14 +193,21 @@ void Level::ReadSceneObjectDataChunk(std::istream& file, Header& header) {
 			ldfString.push_back(data);
 		}
 
-		std::string sData = GeneralUtils::UTF16ToWTF8(ldfString);
-		std::stringstream ssData(sData);
-		std::string token;
-		char deliminator = '\n';
-
-		while (std::getline(ssData, token, deliminator)) {
-			LDFBaseData* ldfData = LDFBaseData::DataFromString(token);
-			obj.settings.push_back(ldfData);
+		const std::string sData = GeneralUtils::UTF16ToWTF8(ldfString);
+		std::string_view remaining = sData;
+
+		// Every line is a setting, they are parsed in place
+		while (!remaining.empty()) {
+			const auto lineEnd = remaining.find('\n');
+			const auto line = remaining.substr(0, lineEnd);
+
+			remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+
+			LDFBaseData* ldfData = LDFBaseData::DataFromString(line);
+
+			if (ldfData != nullptr) {
+				obj.settings.push_back(ldfData);
+			}
 		}
 
 		BinaryIO::BinaryRead(file, obj.value3);
@@ -0,0 +1,226 @@
+#include "PlatformTimeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Zone.h"
+
+PlatformTimeline PlatformTimeline::Build(const Path& path, const uint32_t start, const int32_t stopAt, const PathBehavior behavior, const float extraTravelTime, const float firstExtraTravelTime, const double startTime, const PlatformPose* between) {
+	PlatformTimeline timeline;
+	timeline.m_StartTime = startTime;
+
+	const auto count = static_cast<uint32_t>(path.pathWaypoints.size());
+
+	if (count < 2 || start >= count || (between != nullptr && between->current >= count)) {
+		return timeline;
+	}
+
+	double time = 0.0;
+
+	// Finish the move the platform is in the middle of, it doesn't wait as it is already moving
+	if (between != nullptr) {
+		const auto& from = path.pathWaypoints[between->current];
+		const auto speed = from.movingPlatform.speed > 0.0f ? from.movingPlatform.speed : 1.0f;
+
+		PlatformLeg leg{};
+		leg.from = between->current;
+		leg.to = start;
+		leg.fromPosition = between->position;
+		leg.toPosition = path.pathWaypoints[start].position;
+		leg.depart = time;
+		leg.arrive = leg.depart + Vector3::Distance(leg.fromPosition, leg.toPosition) / speed + extraTravelTime;
+
+		time = leg.arrive;
+
+		timeline.m_Legs.push_back(leg);
+		timeline.m_CycleStart = 1;
+		timeline.m_CycleStartTime = time;
+	}
+
+	// The order the platform visits the waypoints in
+	std::vector<uint32_t> route = { start };
+
+	if (stopAt >= 0) {
+		const auto target = std::min<uint32_t>(stopAt, count - 1);
+
+		// Sent to the waypoint it is at, the platform still arrives there
+		if (target == start && between == nullptr) {
+			route.push_back(target);
+		}
+
+		while (route.back() != target) {
+			route.push_back(route.back() < target ? route.back() + 1 : route.back() - 1);
+		}
+	} else if (behavior == PathBehavior::Loop) {
+		for (uint32_t i = 1; i <= count; i++) {
+			route.push_back((start + i) % count);
+		}
+
+		timeline.m_Repeats = true;
+	} else if (behavior == PathBehavior::Bounce) {
+		// Out to one end, back to the other and back to the start again
+		int32_t direction = start == count - 1 ? -1 : 1;
+
+		for (uint32_t i = 0; i < 2 * (count - 1); i++) {
+			const auto current = static_cast<int32_t>(route.back());
+
+			if (current + direction < 0 || current + direction >= static_cast<int32_t>(count)) {
+				direction = -direction;
+			}
+
+			route.push_back(current + direction);
+		}
+
+		timeline.m_Repeats = true;
+	} else {
+		for (auto i = start + 1; i < count; i++) {
+			route.push_back(i);
+		}
+	}
+
+	for (size_t i = 1; i < route.size(); i++) {
+		const auto& from = path.pathWaypoints[route[i - 1]];
+		const auto& to = path.pathWaypoints[route[i]];
+
+		const auto speed = from.movingPlatform.speed > 0.0f ? from.movingPlatform.speed : 1.0f;
+
+		PlatformLeg leg{};
+		leg.from = route[i - 1];
+		leg.to = route[i];
+		leg.fromPosition = from.position;
+		leg.toPosition = to.position;
+
+		// A platform that stays where it is doesn't wait to leave
+		leg.depart = leg.from != leg.to ? time + from.movingPlatform.wait : time;
+		leg.arrive = leg.depart + Vector3::Distance(from.position, to.position) / speed + extraTravelTime;
+
+		time = leg.arrive;
+
+		timeline.m_Legs.push_back(leg);
+	}
+
+	timeline.m_Duration = time;
+
+	// The first move can't be quicker than moving without any extra time
+	if (!timeline.m_Legs.empty() && firstExtraTravelTime < extraTravelTime) {
+		const auto& first = timeline.m_Legs.front();
+
+		timeline.m_HeadStart = std::min<double>(extraTravelTime - std::max(firstExtraTravelTime, 0.0f), first.arrive - first.depart);
+	}
+
+	// A cycle that takes no time, or has no legs, can't repeat
+	if (timeline.m_Duration <= timeline.m_CycleStartTime || timeline.m_CycleStart >= timeline.m_Legs.size()) {
+		timeline.m_Repeats = false;
+	}
+
+	return timeline;
+}
+
+PlatformPose PlatformTimeline::Evaluate(const double time) const {
+	PlatformPose pose;
+
+	if (m_Legs.empty()) {
+		pose.finished = true;
+
+		return pose;
+	}
+
+	auto local = GetLocalTime(time);
+
+	if (m_Repeats && local >= m_CycleStartTime) {
+		local = m_CycleStartTime + std::fmod(local - m_CycleStartTime, m_Duration - m_CycleStartTime);
+	} else if (!m_Repeats && local >= m_Duration) {
+		const auto& last = m_Legs.back();
+
+		pose.position = last.toPosition;
+		pose.current = last.to;
+		pose.next = last.to;
+		pose.finished = true;
+
+		return pose;
+	}
+
+	const auto leg = std::upper_bound(m_Legs.begin(), m_Legs.end(), local, [](const double value, const PlatformLeg& leg) {
+		return value < leg.arrive;
+	});
+
+	pose.current = leg->from;
+	pose.next = leg->to;
+
+	if (local < leg->depart) {
+		pose.position = leg->fromPosition;
+
+		return pose;
+	}
+
+	const auto travelTime = leg->arrive - leg->depart;
+
+	pose.percent = travelTime > 0.0 ? static_cast<float>((local - leg->depart) / travelTime) : 1.0f;
+	pose.position = leg->fromPosition + (leg->toPosition - leg->fromPosition) * pose.percent;
+	pose.moving = leg->from != leg->to;
+
+	return pose;
+}
+
+uint64_t PlatformTimeline::GetCompletedLegs(const double time) const {
+	if (m_Legs.empty()) {
+		return 0;
+	}
+
+	auto local = GetLocalTime(time);
+	uint64_t cycles = 0;
+
+	if (m_Repeats && local >= m_CycleStartTime) {
+		const auto cycleDuration = m_Duration - m_CycleStartTime;
+
+		cycles = static_cast<uint64_t>((local - m_CycleStartTime) / cycleDuration);
+		local -= cycles * cycleDuration;
+	}
+
+	const auto leg = std::upper_bound(m_Legs.begin(), m_Legs.end(), local, [](const double value, const PlatformLeg& leg) {
+		return value < leg.arrive;
+	});
+
+	return cycles * (m_Legs.size() - m_CycleStart) + (leg - m_Legs.begin());
+}
+
+double PlatformTimeline::GetArriveTime(const uint64_t leg) const {
+	if (m_Legs.empty() || (!m_Repeats && leg >= m_Legs.size())) {
+		return std::numeric_limits<double>::infinity();
+	}
+
+	const auto cycles = leg < m_CycleStart ? 0 : (leg - m_CycleStart) / (m_Legs.size() - m_CycleStart);
+
+	return m_StartTime - m_HeadStart + cycles * (m_Duration - m_CycleStartTime) + m_Legs[GetLegIndex(leg)].arrive;
+}
+
+double PlatformTimeline::GetLocalTime(const double time) const {
+	const auto local = std::max(time - m_StartTime, 0.0);
+
+	if (m_HeadStart <= 0.0 || m_Legs.empty()) {
+		return local;
+	}
+
+	const auto& first = m_Legs.front();
+	const auto firstArrive = first.arrive - m_HeadStart;
+
+	if (local >= firstArrive) {
+		return local + m_HeadStart;
+	}
+
+	if (local <= first.depart || firstArrive <= first.depart) {
+		return local;
+	}
+
+	// The quicker first move is stretched over the first leg
+	return first.depart + (local - first.depart) * (first.arrive - first.depart) / (firstArrive - first.depart);
+}
+
+size_t PlatformTimeline::GetLegIndex(const uint64_t leg) const {
+	if (leg < m_CycleStart || !m_Repeats) {
+		return std::min<size_t>(leg, m_Legs.size() - 1);
+	}
+
+	return m_CycleStart + (leg - m_CycleStart) % (m_Legs.size() - m_CycleStart);
+}
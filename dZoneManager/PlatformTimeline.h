@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "NiPoint3.h"
+
+struct Path;
+enum class PathBehavior : uint32_t;
+
+/**
+ * One move of a platform from a waypoint to the next, with times relative to the start of the timeline
+ */
+struct PlatformLeg {
+	uint32_t from;
+	uint32_t to;
+
+	/**
+	 * Where the platform moves between, the waypoints unless the platform started the leg between them
+	 */
+	NiPoint3 fromPosition;
+	NiPoint3 toPosition;
+
+	/**
+	 * When the platform leaves the waypoint it is at, after waiting there
+	 */
+	double depart;
+
+	/**
+	 * When the platform arrives at the next waypoint
+	 */
+	double arrive;
+};
+
+/**
+ * Where a platform is at some time on its timeline
+ */
+struct PlatformPose {
+	NiPoint3 position;
+	uint32_t current = 0;
+	uint32_t next = 0;
+
+	/**
+	 * How far the platform is between the current and the next waypoint, from 0 to 1
+	 */
+	float percent = 0.0f;
+
+	bool moving = false;
+
+	/**
+	 * Whether the platform reached the end of a timeline that doesn't repeat
+	 */
+	bool finished = false;
+};
+
+/**
+ * The movement of a platform along its path as a list of timed legs, so where it is can be worked out for any time
+ * without stepping it every frame. A timeline that repeats covers one cycle of the path, after the move to the first
+ * waypoint if the platform started between two.
+ */
+class PlatformTimeline {
+public:
+	/**
+	 * Builds the timeline of a platform that follows its path
+	 * @param path the path of the platform
+	 * @param start the waypoint the platform starts at
+	 * @param stopAt the waypoint the platform stops at, or -1 to follow the path behavior
+	 * @param behavior what the platform does at the end of the path
+	 * @param extraTravelTime seconds added to every move
+	 * @param firstExtraTravelTime seconds added to the first move instead, at most extraTravelTime
+	 * @param startTime the zone time the platform starts at
+	 * @param between where the platform is if it is moving towards start, it finishes that move first
+	 * @return the timeline of the platform
+	 */
+	static PlatformTimeline Build(const Path& path, uint32_t start, int32_t stopAt, PathBehavior behavior, float extraTravelTime, float firstExtraTravelTime, double startTime, const PlatformPose* between = nullptr);
+
+	/**
+	 * Returns where the platform is at a zone time
+	 * @param time the zone time
+	 * @return where the platform is
+	 */
+	PlatformPose Evaluate(double time) const;
+
+	/**
+	 * Returns the number of legs the platform has completed at a zone time, counting every cycle
+	 * @param time the zone time
+	 * @return the number of completed legs
+	 */
+	uint64_t GetCompletedLegs(double time) const;
+
+	/**
+	 * Returns the zone time the platform completes a leg at, counting every cycle
+	 * @param leg the number of the leg
+	 * @return the zone time the leg is completed at
+	 */
+	double GetArriveTime(uint64_t leg) const;
+
+	/**
+	 * Returns a leg, counting every cycle
+	 */
+	const PlatformLeg& GetLeg(uint64_t leg) const { return m_Legs[GetLegIndex(leg)]; }
+
+	bool IsEmpty() const { return m_Legs.empty(); }
+
+	bool GetRepeats() const { return m_Repeats; }
+
+	double GetStartTime() const { return m_StartTime; }
+
+private:
+	/**
+	 * Converts a zone time to the time into the legs, taking the quicker first move into account
+	 */
+	double GetLocalTime(double time) const;
+
+	/**
+	 * Converts a leg counting every cycle to its index in the legs
+	 */
+	size_t GetLegIndex(uint64_t leg) const;
+
+	std::vector<PlatformLeg> m_Legs;
+
+	bool m_Repeats = false;
+
+	/**
+	 * The index of the first leg that repeats, legs before it are only moved once
+	 */
+	size_t m_CycleStart = 0;
+
+	/**
+	 * The arrive time of the last leg
+	 */
+	double m_Duration = 0.0;
+
+	/**
+	 * When the legs that repeat start, the arrive time of the legs before them
+	 */
+	double m_CycleStartTime = 0.0;
+
+	double m_StartTime = 0.0;
+
+	/**
+	 * How much quicker the first move is than the same move in the legs, every later leg is reached this much sooner
+	 */
+	double m_HeadStart = 0.0;
+};
@@ -0,0 +1,108 @@
+#include "RaceTrack.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Zone.h"
+
+RaceTrack::RaceTrack(const Path& path, const float checkpointRadius) {
+	m_CheckpointRadius = checkpointRadius;
+
+	// A waypoint covers at most two cells on each axis
+	m_CellSize = checkpointRadius * 2.0f;
+
+	for (const auto& waypoint : path.pathWaypoints) {
+		if (!m_Waypoints.empty()) {
+			m_Length += Vector3::Distance(m_Waypoints.back(), waypoint.position);
+		}
+
+		m_Distances.push_back(m_Length);
+		m_Waypoints.push_back(waypoint.position);
+	}
+
+	// The track loops back to the start
+	if (!m_Waypoints.empty()) {
+		m_Length += Vector3::Distance(m_Waypoints.back(), m_Waypoints.front());
+	}
+
+	for (uint32_t i = 0; i < m_Waypoints.size(); i++) {
+		const auto& position = m_Waypoints[i];
+
+		const auto minX = static_cast<int64_t>(std::floor((position.x - checkpointRadius) / m_CellSize));
+		const auto maxX = static_cast<int64_t>(std::floor((position.x + checkpointRadius) / m_CellSize));
+		const auto minZ = static_cast<int64_t>(std::floor((position.z - checkpointRadius) / m_CellSize));
+		const auto maxZ = static_cast<int64_t>(std::floor((position.z + checkpointRadius) / m_CellSize));
+
+		for (auto x = minX; x <= maxX; x++) {
+			for (auto z = minZ; z <= maxZ; z++) {
+				m_Cells[GetCellKey(x, z)].push_back(i);
+			}
+		}
+	}
+}
+
+bool RaceTrack::FindCheckpoint(const uint32_t current, const NiPoint3& position, uint32_t& reached) const {
+	const auto cell = m_Cells.find(GetCell(position.x, position.z));
+
+	if (cell == m_Cells.end()) {
+		return false;
+	}
+
+	const auto count = GetWaypointCount();
+
+	// On a short track every waypoint is in the window, so a waypoint behind the racer would also be ahead of
+	// them. Only the waypoints closer going forward than going back count, and those are at least one ahead.
+	const auto maxOffset = std::min(MAX_SKIPPED_WAYPOINTS, std::max<uint32_t>((count - 1) / 2, 1));
+	uint32_t closestOffset = maxOffset + 1;
+
+	for (const auto waypoint : cell->second) {
+		// How many waypoints ahead of the racer this one is, wrapping around the start
+		const auto offset = (waypoint + count - current) % count;
+
+		if (offset == 0 || offset >= closestOffset) {
+			continue;
+		}
+
+		if (Vector3::DistanceSquared(m_Waypoints[waypoint], position) > m_CheckpointRadius * m_CheckpointRadius) {
+			continue;
+		}
+
+		closestOffset = offset;
+		reached = waypoint;
+	}
+
+	return closestOffset <= maxOffset;
+}
+
+float RaceTrack::GetDistance(const uint32_t waypoint, const NiPoint3& position) const {
+	if (waypoint >= m_Waypoints.size()) {
+		return 0.0f;
+	}
+
+	const auto& start = m_Waypoints[waypoint];
+	const auto& end = m_Waypoints[(waypoint + 1) % m_Waypoints.size()];
+
+	const auto segment = end - start;
+	const auto lengthSquared = segment.SquaredLength();
+
+	if (lengthSquared == 0.0f) {
+		return m_Distances[waypoint];
+	}
+
+	// Project the position onto the segment, staying between its waypoints
+	const auto along = std::clamp((position - start).DotProduct(segment) / lengthSquared, 0.0f, 1.0f);
+
+	return m_Distances[waypoint] + along * std::sqrt(lengthSquared);
+}
+
+int64_t RaceTrack::GetCell(const float x, const float z) const {
+	const auto cellX = static_cast<int64_t>(std::floor(x / m_CellSize));
+	const auto cellZ = static_cast<int64_t>(std::floor(z / m_CellSize));
+
+	return GetCellKey(cellX, cellZ);
+}
+
+int64_t RaceTrack::GetCellKey(const int64_t x, const int64_t z) {
+	// Shifted as unsigned, the cells left of or behind the origin are negative
+	return static_cast<int64_t>(static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32 | static_cast<uint32_t>(z));
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "NiPoint3.h"
+
+struct Path;
+
+/**
+ * The waypoints of a race path as a loop of segments, built once per race. Waypoints are placed in a grid so the
+ * checkpoints near a racer are found without walking the whole path, which keeps updating a racer constant time.
+ */
+class RaceTrack {
+public:
+	/**
+	 * Builds the track from a race path
+	 * @param path the path to build the track from
+	 * @param checkpointRadius how close a racer has to come to a waypoint to reach it
+	 */
+	RaceTrack(const Path& path, float checkpointRadius = 50.0f);
+
+	/**
+	 * Finds the checkpoint a racer reached, if any. Only the checkpoints up to MAX_SKIPPED_WAYPOINTS ahead of
+	 * the racer count, so cutting across the track doesn't move them ahead. On tracks too short for that only the
+	 * checkpoints in the half of the track ahead of the racer count, so going back over the start is not a lap.
+	 * @param current the index of the last checkpoint the racer reached
+	 * @param position where the racer is now
+	 * @param reached set to the index of the checkpoint the racer reached
+	 * @return true if the racer reached a new checkpoint, it is lower than current if they passed the start
+	 */
+	bool FindCheckpoint(uint32_t current, const NiPoint3& position, uint32_t& reached) const;
+
+	/**
+	 * Returns how far along the lap a position is, measured from the start of the segment after a waypoint
+	 * @param waypoint the index of the waypoint the segment starts at
+	 * @param position the position to measure
+	 * @return the distance from the start of the lap
+	 */
+	float GetDistance(uint32_t waypoint, const NiPoint3& position) const;
+
+	uint32_t GetWaypointCount() const { return static_cast<uint32_t>(m_Waypoints.size()); }
+
+	const NiPoint3& GetWaypoint(uint32_t waypoint) const { return m_Waypoints[waypoint]; }
+
+	/**
+	 * Returns the length of a lap
+	 */
+	float GetLength() const { return m_Length; }
+
+	/**
+	 * The most waypoints a racer can skip at once
+	 */
+	static constexpr uint32_t MAX_SKIPPED_WAYPOINTS = 10;
+
+private:
+	int64_t GetCell(float x, float z) const;
+
+	static int64_t GetCellKey(int64_t x, int64_t z);
+
+	std::vector<NiPoint3> m_Waypoints;
+
+	/**
+	 * The distance from the start of the lap to each waypoint
+	 */
+	std::vector<float> m_Distances;
+
+	float m_Length = 0.0f;
+
+	float m_CheckpointRadius;
+
+	float m_CellSize;
+
+	/**
+	 * The waypoints a racer in each cell may be close enough to, in path order
+	 */
+	std::unordered_map<int64_t, std::vector<uint32_t>> m_Cells;
+};
@@ -0,0 +1,29 @@
+#include "RespawnScheduler.h"
+
+#include "dZoneManager.h"
+#include "Spawner.h"
+
+void RespawnScheduler::Schedule(const LWOOBJID spawnerId, const uint32_t generation, const float delay) {
+	m_Queue.push({ m_Time + delay, m_NextSequence++, spawnerId, generation });
+}
+
+void RespawnScheduler::Update(const float deltaTime) {
+	m_Time += deltaTime;
+
+	uint32_t handled = 0;
+
+	while (!m_Queue.empty() && m_Queue.top().dueTime <= m_Time) {
+		if (m_MaxRespawnsPerFrame != 0 && handled >= m_MaxRespawnsPerFrame) break;
+
+		// Pop before notifying, the spawner may schedule new respawns.
+		const auto respawn = m_Queue.top();
+		m_Queue.pop();
+
+		// The spawner may have been removed since this was scheduled.
+		auto* spawner = dZoneManager::Instance()->GetSpawner(respawn.spawnerId);
+
+		if (spawner == nullptr) continue;
+
+		if (spawner->OnRespawnDue(respawn.generation)) handled++;
+	}
+}
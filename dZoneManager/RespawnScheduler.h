@@ -0,0 +1,78 @@
+#pragma once
+
+#include <queue>
+#include <vector>
+
+#include "dCommonVars.h"
+
+/**
+ * Keeps the pending respawns of every spawner in the zone ordered by the time they are due,
+ * so spawners are only touched when one of their respawns actually has to happen.
+ */
+class RespawnScheduler {
+public:
+	/**
+	 * Schedules a respawn for a spawner
+	 * @param spawnerId the ID of the spawner to notify
+	 * @param generation the generation of the spawner's timers this respawn belongs to
+	 * @param delay the number of seconds from now the respawn is due
+	 */
+	void Schedule(LWOOBJID spawnerId, uint32_t generation, float delay);
+
+	/**
+	 * Advances the clock and notifies the spawners of every respawn that is due, up to the per frame budget.
+	 * Respawns over budget stay queued and are handled first next frame.
+	 * @param deltaTime the time since the last update
+	 */
+	void Update(float deltaTime);
+
+	/**
+	 * Returns a generation number that has never been handed out before.  Spawners take a new
+	 * generation to cancel all of their scheduled respawns at once.
+	 * @return a new generation number
+	 */
+	uint32_t NextGeneration() { return ++m_LastGeneration; }
+
+	/**
+	 * Sets the maximum number of respawns handled in a single frame
+	 * @param value the maximum, 0 for no limit
+	 */
+	void SetMaxRespawnsPerFrame(uint32_t value) { m_MaxRespawnsPerFrame = value; }
+
+	/**
+	 * Returns the number of respawns that are still queued, including cancelled ones that haven't been popped yet
+	 * @return the number of respawns that are still queued
+	 */
+	size_t GetQueuedCount() const { return m_Queue.size(); }
+
+private:
+	struct ScheduledRespawn {
+		double dueTime;
+		uint64_t sequence;
+		LWOOBJID spawnerId;
+		uint32_t generation;
+	};
+
+	/**
+	 * Orders the queue by due time, respawns due at the same time are handled in the order they were scheduled
+	 */
+	struct DueLater {
+		bool operator()(const ScheduledRespawn& a, const ScheduledRespawn& b) const {
+			if (a.dueTime != b.dueTime) return a.dueTime > b.dueTime;
+			return a.sequence > b.sequence;
+		}
+	};
+
+	std::priority_queue<ScheduledRespawn, std::vector<ScheduledRespawn>, DueLater> m_Queue;
+
+	/**
+	 * Seconds since the scheduler was created
+	 */
+	double m_Time = 0.0;
+
+	uint64_t m_NextSequence = 0;
+
+	uint32_t m_LastGeneration = 0;
+
+	uint32_t m_MaxRespawnsPerFrame = 0;
+};
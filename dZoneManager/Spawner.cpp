@@ -6,6 +6,7 @@
 #include <functional>
 #include "GeneralUtils.h"
 #include "dZoneManager.h"
+#include "RespawnScheduler.h"
 
 Spawner::Spawner(const SpawnerInfo info) {
 	m_Info = info;
@@ -41,8 +42,18 @@ Spawner::Spawner(const SpawnerInfo info) {
 		timerCount = m_Info.nodes.size();
 	}
 
-	for (int i = 0; i < timerCount; ++i) {
-		m_WaitTimes.push_back(m_Info.respawnTime);
+	// The initial timers start out expired, so the spawner fills up on the first update.
+	m_PendingRespawns = timerCount;
+
+	auto& scheduler = dZoneManager::Instance()->GetRespawnScheduler();
+	m_RespawnGeneration = scheduler.NextGeneration();
+
+	if (m_Start) {
+		scheduler.Schedule(m_Info.spawnerID, m_RespawnGeneration, 0.0f);
+	} else {
+		for (int i = 0; i < timerCount; ++i) {
+			scheduler.Schedule(m_Info.spawnerID, m_RespawnGeneration, 0.0f);
+		}
 	}
 
 	if (m_Info.spawnOnSmashGroupName != "") {
@@ -110,9 +121,6 @@ Entity* Spawner::Spawn(std::vector<SpawnerNode*> freeNodes, const bool force) {
 
 		m_Entities.insert({ rezdE->GetObjectID(), spawnNode });
 		spawnNode->entities.push_back(rezdE->GetObjectID());
-		if (m_Entities.size() == m_Info.amountMaintained) {
-			m_NeedsUpdate = false;
-		}
 
 		for (const auto& cb : m_EntitySpawnedCallbacks) {
 			cb(rezdE);
@@ -133,7 +141,7 @@ void Spawner::AddEntitySpawnedCallback(std::function<void(Entity*)> callback) {
 }
 
 void Spawner::Reset() {
-	m_Start = true;
+	ScheduleStart();
 
 	for (auto* node : m_Info.nodes) {
 		for (const auto& spawned : node->entities) {
@@ -149,32 +157,39 @@ void Spawner::Reset() {
 
 	m_Entities.clear();
 	m_AmountSpawned = 0;
-	m_NeedsUpdate = true;
 }
 
 void Spawner::SoftReset() {
-	m_Start = true;
+	ScheduleStart();
 	m_AmountSpawned = 0;
-	m_NeedsUpdate = true;
 }
 
 void Spawner::SetRespawnTime(float time) {
 	m_Info.respawnTime = time;
 
-	for (size_t i = 0; i < m_WaitTimes.size(); ++i) {
-		m_WaitTimes[i] = 0;
-	};
-
-	m_Start = true;
-	m_NeedsUpdate = true;
+	ScheduleStart();
 }
 
 void Spawner::SetNumToMaintain(int32_t value) {
 	m_Info.amountMaintained = value;
 }
 
-void Spawner::Update(const float deltaTime) {
-	if (m_Start && m_Active) {
+void Spawner::ScheduleStart() {
+	m_Start = true;
+
+	auto& scheduler = dZoneManager::Instance()->GetRespawnScheduler();
+	m_RespawnGeneration = scheduler.NextGeneration();
+	scheduler.Schedule(m_Info.spawnerID, m_RespawnGeneration, 0.0f);
+}
+
+bool Spawner::OnRespawnDue(const uint32_t generation) {
+	// Cancelled by a reset or activation, which scheduled its own respawns.
+	if (generation != m_RespawnGeneration) return false;
+
+	// Timers don't run while inactive, Activate restarts them.
+	if (!m_Active) return false;
+
+	if (m_Start) {
 		m_Start = false;
 
 		const auto toSpawn = m_Info.amountMaintained - m_AmountSpawned;
@@ -182,28 +197,22 @@ void Spawner::Update(const float deltaTime) {
 			Spawn();
 		}
 
-		m_WaitTimes.clear();
+		// Refilling replaces any timers that were still running.
+		m_PendingRespawns = 0;
+		m_RespawnGeneration = dZoneManager::Instance()->GetRespawnScheduler().NextGeneration();
 
-		return;
+		return true;
 	}
 
-	if (!m_NeedsUpdate) return;
-	if (!m_Active) return;
-	//if (m_Info.noTimedSpawn) return;
-	if (m_Info.spawnsOnSmash) {
-		if (!m_SpawnSmashFoundGroup) {
+	if (m_Info.spawnsOnSmash) return false;
 
-		}
-		return;
-	}
-	for (size_t i = 0; i < m_WaitTimes.size(); ++i) {
-		m_WaitTimes[i] += deltaTime;
-		if (m_WaitTimes[i] >= m_Info.respawnTime) {
-			m_WaitTimes.erase(m_WaitTimes.begin() + i);
+	if (m_PendingRespawns == 0) return false;
 
-			Spawn();
-		}
-	}
+	m_PendingRespawns--;
+
+	Spawn();
+
+	return true;
 }
 
 void Spawner::NotifyOfEntityDeath(const LWOOBJID& objectID) {
@@ -211,9 +220,9 @@ void Spawner::NotifyOfEntityDeath(const LWOOBJID& objectID) {
 		cb();
 	}
 
-	m_NeedsUpdate = true;
-	//m_RespawnTime = 10.0f;
-	m_WaitTimes.push_back(0.0f);
+	m_PendingRespawns++;
+	dZoneManager::Instance()->GetRespawnScheduler().Schedule(m_Info.spawnerID, m_RespawnGeneration, m_Info.respawnTime);
+
 	SpawnerNode* node;
 
 	auto it = m_Entities.find(objectID);
@@ -238,10 +247,18 @@ void Spawner::NotifyOfEntityDeath(const LWOOBJID& objectID) {
 
 void Spawner::Activate() {
 	m_Active = true;
-	m_NeedsUpdate = true;
 
-	for (auto& time : m_WaitTimes) {
-		time = 0;
+	if (m_Start) {
+		ScheduleStart();
+		return;
+	}
+
+	// Running timers start over from the full respawn time.
+	auto& scheduler = dZoneManager::Instance()->GetRespawnScheduler();
+	m_RespawnGeneration = scheduler.NextGeneration();
+
+	for (uint32_t i = 0; i < m_PendingRespawns; ++i) {
+		scheduler.Schedule(m_Info.spawnerID, m_RespawnGeneration, m_Info.respawnTime);
 	}
 }
 
@@ -49,7 +49,6 @@ public:
 
 	Entity* Spawn();
 	Entity* Spawn(std::vector<SpawnerNode*> freeNodes, bool force = false);
-	void Update(float deltaTime);
 	void NotifyOfEntityDeath(const LWOOBJID& objectID);
 	void Activate();
 	void Deactivate() { m_Active = false; };
@@ -65,6 +64,13 @@ public:
 	void SetNumToMaintain(int32_t value);
 	bool GetIsSpawnSmashGroup() const { return m_SpawnSmashFoundGroup; };
 
+	/**
+	 * Called by the respawn scheduler when one of this spawner's respawns is due
+	 * @param generation the generation the respawn was scheduled with
+	 * @return whether or not the respawn did anything
+	 */
+	bool OnRespawnDue(uint32_t generation);
+
 	SpawnerInfo m_Info;
 	bool m_Active = true;
 private:
@@ -72,9 +78,22 @@ private:
 	std::vector<std::function<void(Entity*)>> m_EntitySpawnedCallbacks = {};
 
 
+	/**
+	 * Cancels all scheduled respawns and schedules a respawn that refills the spawner
+	 */
+	void ScheduleStart();
+
 	bool m_SpawnSmashFoundGroup = false;
-	std::vector<float> m_WaitTimes = {};
-	bool m_NeedsUpdate = true;
+
+	/**
+	 * Number of respawn timers that are running, each of them spawns one entity when it runs out
+	 */
+	uint32_t m_PendingRespawns = 0;
+
+	/**
+	 * Respawns scheduled with any other generation have been cancelled
+	 */
+	uint32_t m_RespawnGeneration = 0;
 	std::map<LWOOBJID, SpawnerNode*> m_Entities = {};
 	EntityInfo m_EntityInfo;
 	int32_t m_AmountSpawned = 0;
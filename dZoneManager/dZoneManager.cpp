@@ -3,7 +3,7 @@
 #include "dZoneManager.h"
 #include "EntityManager.h"
 #include "dLogger.h"
-#include "dConfig.h"
+#include "ConfigOptions.h"
 #include "InventoryComponent.h"
 #include "DestroyableComponent.h"
 #include "GameMessages.h"
@@ -142,9 +142,9 @@ int32_t dZoneManager::GetLevelCapCurrencyConversion() {
 }
 
 void dZoneManager::Update(float deltaTime) {
-	for (auto spawner : m_Spawners) {
-		spawner.second->Update(deltaTime);
-	}
+	// Read every frame so it follows the config when it is reloaded
+	m_RespawnScheduler.SetMaxRespawnsPerFrame(ConfigOptions::maxRespawnsPerFrame.Get());
+	m_RespawnScheduler.Update(deltaTime);
 
 	// m_RandomQBManager->Update(deltaTime);
 }
@@ -2,6 +2,7 @@
 #include "dZMCommon.h"
 #include "Zone.h"
 #include "Spawner.h"
+#include "RespawnScheduler.h"
 #include <map>
 
 // class RandomQBManager;
@@ -43,6 +44,7 @@ public:
 	std::vector<Spawner*> GetSpawnersByName(std::string spawnerName);
 	std::vector<Spawner*> GetSpawnersInGroup(std::string group);
 	void Update(float deltaTime);
+	RespawnScheduler& GetRespawnScheduler() { return m_RespawnScheduler; }
 	Entity* GetZoneControlObject() { return m_ZoneControlObject; }
 	bool GetPlayerLoseCoinOnDeath() { return m_PlayerLoseCoinsOnDeath; }
 	uint32_t GetUniqueMissionIdStartingValue();
@@ -68,6 +70,7 @@ private:
 	LWOZONEID m_ZoneID;
 	bool m_PlayerLoseCoinsOnDeath; //Do players drop coins in this zone when smashed
 	std::map<LWOOBJID, Spawner*> m_Spawners;
+	RespawnScheduler m_RespawnScheduler;
 
 	Entity* m_ZoneControlObject;
 	// RandomQBManager* m_RandomQBManager;
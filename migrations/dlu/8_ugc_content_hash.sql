@@ -0,0 +1,4 @@
+-- Identical models are stored once: a ugc row may be used by the models of several characters, and stays
+-- credited to the character that uploaded it first. Delete ugc rows only once no properties_contents use them.
+ALTER TABLE ugc ADD COLUMN content_hash CHAR(32) NULL DEFAULT NULL;
+CREATE INDEX ugc_content_hash ON ugc (content_hash);
@@ -0,0 +1,2 @@
+ALTER TABLE behaviors ADD COLUMN character_id BIGINT NOT NULL DEFAULT 0;
+UPDATE behaviors SET character_id = COALESCE((SELECT properties.owner_id FROM properties_contents JOIN properties ON properties.id = properties_contents.property_id WHERE behaviors.id IN (properties_contents.behavior_1, properties_contents.behavior_2, properties_contents.behavior_3, properties_contents.behavior_4, properties_contents.behavior_5) LIMIT 1), 0);
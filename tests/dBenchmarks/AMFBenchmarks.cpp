@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "AMFDeserialize.h"
+#include "AMFFormat.h"
+#include "AMFFormat_BitStream.h"
+#include "BitStream.h"
+
+namespace {
+	/**
+	 * Builds arguments shaped like the UI messages the server sends, a few named values and a list of entries
+	 * @param entries the number of entries in the list
+	 */
+	AMFArrayValue* CreateArguments(const uint32_t entries) {
+		auto* args = new AMFArrayValue();
+
+		auto* title = new AMFStringValue();
+		title->SetStringValue("Synthetic Leaderboard");
+		args->InsertValue("title", title);
+
+		auto* visible = new AMFTrueValue();
+		args->InsertValue("visible", visible);
+
+		auto* list = new AMFArrayValue();
+
+		for (uint32_t i = 0; i < entries; i++) {
+			auto* entry = new AMFArrayValue();
+
+			auto* name = new AMFStringValue();
+			name->SetStringValue("SyntheticPlayer" + std::to_string(i));
+			entry->InsertValue("name", name);
+
+			auto* score = new AMFDoubleValue();
+			score->SetDoubleValue(1000.0 - i * 0.5);
+			entry->InsertValue("score", score);
+
+			auto* rank = new AMFDoubleValue();
+			rank->SetDoubleValue(i + 1);
+			entry->InsertValue("rank", rank);
+
+			list->PushBackValue(entry);
+		}
+
+		args->InsertValue("entries", list);
+
+		return args;
+	}
+}
+
+static void BM_AMFSerialize(benchmark::State& state) {
+	std::unique_ptr<AMFArrayValue> args(CreateArguments(state.range(0)));
+
+	for (auto _ : state) {
+		RakNet::BitStream bitStream;
+		bitStream.Write<AMFValue*>(args.get());
+		benchmark::DoNotOptimize(bitStream.GetData());
+		state.counters["bytes"] = bitStream.GetNumberOfBytesUsed();
+	}
+}
+BENCHMARK(BM_AMFSerialize)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_AMFBuildAndSerialize(benchmark::State& state) {
+	for (auto _ : state) {
+		std::unique_ptr<AMFArrayValue> args(CreateArguments(state.range(0)));
+
+		RakNet::BitStream bitStream;
+		bitStream.Write<AMFValue*>(args.get());
+		benchmark::DoNotOptimize(bitStream.GetData());
+	}
+}
+BENCHMARK(BM_AMFBuildAndSerialize)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_AMFDeserialize(benchmark::State& state) {
+	std::unique_ptr<AMFArrayValue> args(CreateArguments(state.range(0)));
+
+	RakNet::BitStream bitStream;
+	bitStream.Write<AMFValue*>(args.get());
+
+	for (auto _ : state) {
+		bitStream.ResetReadPointer();
+
+		AMFDeserialize deserializer;
+		std::unique_ptr<AMFValue> value(deserializer.Read(&bitStream));
+		benchmark::DoNotOptimize(value.get());
+	}
+}
+BENCHMARK(BM_AMFDeserialize)->RangeMultiplier(4)->Range(1, 256);
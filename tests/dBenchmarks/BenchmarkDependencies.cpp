@@ -0,0 +1,99 @@
+#include "BenchmarkDependencies.h"
+
+#include <string>
+#include <vector>
+
+#include "dLogger.h"
+#include "CDClientDatabase.h"
+#include "CDClientManager.h"
+
+namespace Game {
+	dLogger* logger;
+	dServer* server;
+	dZoneManager* zoneManager;
+	dpWorld* physicsWorld;
+	dChatFilter* chatFilter;
+	dConfig* config;
+	std::mt19937 randomEngine;
+	RakPeerInterface* chatServer;
+	AssetManager* assetManager;
+	SystemAddress chatSysAddr;
+}
+
+namespace {
+	/**
+	 * Every table the CDClientManager loads, keyed by table name rather than the name the manager files them under
+	 */
+	const std::vector<std::string> cdClientTables = {
+		"Activities", "ActivityRewards", "Animations", "BehaviorParameter", "BehaviorTemplate", "BrickIDTable",
+		"ComponentsRegistry", "CurrencyTable", "DestructibleComponent", "Emotes", "FaceItemComponent", "FeatureGating",
+		"InventoryComponent", "ItemComponent", "ItemSetSkills", "ItemSets", "LevelProgressionLookup", "LootMatrix",
+		"LootTable", "MissionEmail", "MissionNPCComponent", "MissionTasks", "Missions", "MovementAIComponent",
+		"ObjectSkills", "Objects", "PackageComponent", "PhysicsComponent", "PropertyEntranceComponent", "PropertyTemplate",
+		"ProximityMonitorComponent", "RailActivatorComponent", "RarityTable", "RebuildComponent", "Rewards",
+		"ScriptComponent", "SkillBehavior", "VendorComponent", "ZoneTable"
+	};
+
+	/**
+	 * The tables are read by column index, so they only need enough untyped columns to cover the widest one
+	 */
+	constexpr uint32_t cdClientColumns = 64;
+}
+
+void BenchmarkDependencies::SetUp() {
+	if (Game::logger != nullptr) return;
+
+	Game::logger = new dLogger("./benchmarks.log", false, false);
+	Game::server = new dServerBenchmarkMock();
+	Game::randomEngine = std::mt19937(0);
+}
+
+void BenchmarkDependencies::SetUpCDClient() {
+	static bool initialized = false;
+
+	if (initialized) return;
+
+	initialized = true;
+
+	SetUp();
+
+	CDClientDatabase::Connect(":memory:");
+
+	std::string columns = "id";
+	for (uint32_t i = 1; i < cdClientColumns; i++) {
+		columns += ", c" + std::to_string(i);
+	}
+
+	for (const auto& table : cdClientTables) {
+		CDClientDatabase::ExecuteDML("CREATE TABLE " + table + " (" + columns + ");");
+	}
+
+	CDClientDatabase::ExecuteDML("CREATE TABLE Preconditions (id, type, targetLOT, targetCount);");
+
+	CDClientDatabase::ExecuteDML("BEGIN;");
+
+	// Every object gets a render, simple physics and destroyable component, the item range also gets an item component
+	for (uint32_t lot = 1; lot <= OBJECT_COUNT; lot++) {
+		const auto id = std::to_string(lot);
+
+		// id, name and type
+		CDClientDatabase::ExecuteDML("INSERT INTO Objects (id, c1, c3) VALUES (" + id + ", 'Synthetic Object " + id + "', 'Smashables');");
+		CDClientDatabase::ExecuteDML("INSERT INTO ComponentsRegistry (id, c1, c2) VALUES (" + id + ", " + std::to_string(COMPONENT_TYPE_RENDER) + ", " + id + ");");
+		CDClientDatabase::ExecuteDML("INSERT INTO ComponentsRegistry (id, c1, c2) VALUES (" + id + ", " + std::to_string(COMPONENT_TYPE_SIMPLE_PHYSICS) + ", " + id + ");");
+		CDClientDatabase::ExecuteDML("INSERT INTO ComponentsRegistry (id, c1, c2) VALUES (" + id + ", " + std::to_string(COMPONENT_TYPE_DESTROYABLE) + ", " + id + ");");
+	}
+
+	for (uint32_t i = 0; i < ITEM_COUNT; i++) {
+		const auto lot = std::to_string(FIRST_ITEM_LOT + i);
+		const auto componentId = std::to_string(i + 1);
+
+		CDClientDatabase::ExecuteDML("INSERT INTO ComponentsRegistry (id, c1, c2) VALUES (" + lot + ", " + std::to_string(COMPONENT_TYPE_ITEM) + ", " + componentId + ");");
+
+		// id, equipLocation, baseValue, itemType (brick) and stackSize
+		CDClientDatabase::ExecuteDML("INSERT INTO ItemComponent (id, c1, c2, c5, c16, c21) VALUES (" + componentId + ", '', 10, 1, 999, '');");
+	}
+
+	CDClientDatabase::ExecuteDML("COMMIT;");
+
+	CDClientManager::Instance()->Initialize();
+}
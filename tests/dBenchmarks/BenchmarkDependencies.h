@@ -0,0 +1,45 @@
+#ifndef __BENCHMARKDEPENDENCIES__H__
+#define __BENCHMARKDEPENDENCIES__H__
+
+#include "Game.h"
+#include "dCommonVars.h"
+#include "dServer.h"
+
+class dZoneManager;
+class AssetManager;
+
+class dServerBenchmarkMock : public dServer {
+public:
+	dServerBenchmarkMock() {};
+	~dServerBenchmarkMock() {};
+	void Send(RakNet::BitStream* bitStream, const SystemAddress& sysAddr, bool broadcast) override {};
+};
+
+/**
+ * Synthetic fixtures shared by the benchmarks, none of them need any client data or a database.
+ */
+namespace BenchmarkDependencies {
+	/**
+	 * The range of LOTs which have an item component in the synthetic CDClient
+	 */
+	constexpr LOT FIRST_ITEM_LOT = 10000;
+	constexpr uint32_t ITEM_COUNT = 1000;
+
+	/**
+	 * The number of objects in the synthetic components registry, every object has a few components
+	 */
+	constexpr uint32_t OBJECT_COUNT = 20000;
+
+	/**
+	 * Sets up the logger and a server which drops everything sent through it, only the first call does anything
+	 */
+	void SetUp();
+
+	/**
+	 * Builds a CDClient in memory holding every table the CDClientManager loads and initializes the manager from it.
+	 * Only the first call does anything.
+	 */
+	void SetUpCDClient();
+}
+
+#endif //!__BENCHMARKDEPENDENCIES__H__
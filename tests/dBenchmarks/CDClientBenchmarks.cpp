@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkDependencies.h"
+#include "CDClientDatabase.h"
+#include "CDClientManager.h"
+
+namespace {
+	/**
+	 * Random LOTs out of the synthetic objects, so lookups don't keep hitting the same cache lines
+	 */
+	std::vector<LOT> CreateLookups(const LOT first, const uint32_t count) {
+		std::mt19937 random(0);
+		std::uniform_int_distribution<LOT> lots(first, first + count - 1);
+
+		std::vector<LOT> lookups(4096);
+		for (auto& lot : lookups) {
+			lot = lots(random);
+		}
+
+		return lookups;
+	}
+}
+
+static void BM_CDClientGetTable(benchmark::State& state) {
+	BenchmarkDependencies::SetUpCDClient();
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(CDClientManager::Instance()->GetTable<CDComponentsRegistryTable>("ComponentsRegistry"));
+		benchmark::DoNotOptimize(CDClientManager::Instance()->GetTable<CDItemComponentTable>("ItemComponent"));
+	}
+}
+BENCHMARK(BM_CDClientGetTable);
+
+static void BM_CDComponentsRegistryLookup(benchmark::State& state) {
+	BenchmarkDependencies::SetUpCDClient();
+
+	auto* registry = CDClientManager::Instance()->GetTable<CDComponentsRegistryTable>("ComponentsRegistry");
+	const auto lookups = CreateLookups(1, BenchmarkDependencies::OBJECT_COUNT);
+
+	size_t index = 0;
+
+	for (auto _ : state) {
+		const auto lot = lookups[index++ % lookups.size()];
+
+		benchmark::DoNotOptimize(registry->GetByIDAndType(lot, COMPONENT_TYPE_DESTROYABLE));
+		benchmark::DoNotOptimize(registry->GetByIDAndType(lot, COMPONENT_TYPE_SKILL, -1));
+	}
+}
+BENCHMARK(BM_CDComponentsRegistryLookup);
+
+static void BM_CDObjectsLookup(benchmark::State& state) {
+	BenchmarkDependencies::SetUpCDClient();
+
+	auto* objects = CDClientManager::Instance()->GetTable<CDObjectsTable>("Objects");
+	const auto lookups = CreateLookups(1, BenchmarkDependencies::OBJECT_COUNT);
+
+	size_t index = 0;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(&objects->GetByID(lookups[index++ % lookups.size()]));
+	}
+}
+BENCHMARK(BM_CDObjectsLookup);
+
+/**
+ * What every item lookup goes through, the registry to find the item component and then the component itself
+ */
+static void BM_CDItemComponentLookup(benchmark::State& state) {
+	BenchmarkDependencies::SetUpCDClient();
+
+	auto* registry = CDClientManager::Instance()->GetTable<CDComponentsRegistryTable>("ComponentsRegistry");
+	auto* itemComponents = CDClientManager::Instance()->GetTable<CDItemComponentTable>("ItemComponent");
+	const auto lookups = CreateLookups(BenchmarkDependencies::FIRST_ITEM_LOT, BenchmarkDependencies::ITEM_COUNT);
+
+	size_t index = 0;
+
+	for (auto _ : state) {
+		const auto componentId = registry->GetByIDAndType(lookups[index++ % lookups.size()], COMPONENT_TYPE_ITEM);
+
+		benchmark::DoNotOptimize(&itemComponents->GetItemComponentByID(componentId));
+	}
+}
+BENCHMARK(BM_CDItemComponentLookup);
+
+/**
+ * A lookup which goes to SQLite, as tables do for rows they haven't cached
+ */
+static void BM_CDClientQuery(benchmark::State& state) {
+	BenchmarkDependencies::SetUpCDClient();
+
+	const auto lookups = CreateLookups(1, BenchmarkDependencies::OBJECT_COUNT);
+
+	size_t index = 0;
+
+	for (auto _ : state) {
+		auto result = CDClientDatabase::ExecuteQuery("SELECT * FROM Objects WHERE id = " + std::to_string(lookups[index++ % lookups.size()]));
+
+		if (!result.eof()) {
+			benchmark::DoNotOptimize(result.getIntField(0, -1));
+		}
+
+		result.finalize();
+	}
+}
+BENCHMARK(BM_CDClientQuery);
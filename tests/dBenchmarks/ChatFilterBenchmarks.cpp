@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "BenchmarkDependencies.h"
+#include "dChatFilter.h"
+
+namespace {
+	constexpr uint32_t approvedWordCount = 20000;
+	constexpr uint32_t deniedWordCount = 500;
+
+	/**
+	 * Writes a synthetic word list and returns the path to it
+	 */
+	std::string WriteWordlist(const std::string& name, const std::string& prefix, const uint32_t count) {
+		const auto path = "./" + name + ".txt";
+
+		std::ofstream file(path);
+		for (uint32_t i = 0; i < count; i++) {
+			file << prefix << i << '\n';
+		}
+
+		return path;
+	}
+
+	/**
+	 * Builds a sentence out of words which are all on the approved list
+	 */
+	std::string CreateSentence(const uint32_t words) {
+		std::string sentence;
+
+		for (uint32_t i = 0; i < words; i++) {
+			if (i != 0) sentence += ' ';
+			sentence += "word" + std::to_string((i * 7919) % approvedWordCount);
+		}
+
+		return sentence + '!';
+	}
+
+	std::unique_ptr<dChatFilter> CreateFilter(const bool useWhitelist) {
+		BenchmarkDependencies::SetUp();
+
+		auto filter = std::make_unique<dChatFilter>(useWhitelist);
+		filter->ReadWordlistPlaintext(WriteWordlist("benchmark_approved_words", "word", approvedWordCount), true);
+		filter->ReadWordlistPlaintext(WriteWordlist("benchmark_denied_words", "badword", deniedWordCount), false);
+
+		return filter;
+	}
+}
+
+static void BM_ChatFilterWhitelist(benchmark::State& state) {
+	auto filter = CreateFilter(true);
+	const auto sentence = CreateSentence(state.range(0));
+
+	for (auto _ : state) {
+		auto segments = filter->IsSentenceOkay(sentence, 0);
+		benchmark::DoNotOptimize(segments.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChatFilterWhitelist)->RangeMultiplier(4)->Range(1, 64);
+
+static void BM_ChatFilterBlacklist(benchmark::State& state) {
+	auto filter = CreateFilter(false);
+	const auto sentence = CreateSentence(state.range(0));
+
+	for (auto _ : state) {
+		auto segments = filter->IsSentenceOkay(sentence, 0, false);
+		benchmark::DoNotOptimize(segments.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChatFilterBlacklist)->RangeMultiplier(4)->Range(1, 64);
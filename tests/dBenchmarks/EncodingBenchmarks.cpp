@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "GeneralUtils.h"
+
+namespace {
+	/**
+	 * Repeats a chat line until the string is at least length bytes long
+	 */
+	std::string CreateText(const std::string& line, const size_t length) {
+		std::string text;
+		text.reserve(length + line.size());
+
+		while (text.size() < length) {
+			text += line;
+		}
+
+		return text;
+	}
+
+	const std::string asciiLine = "Hello there, want to race to the top of the tower? ";
+	const std::string multiByteLine = u8"Grüße aus Nimbus Station, こんにちは 🚀 ";
+}
+
+static void BM_UTF8ToUTF16Ascii(benchmark::State& state) {
+	const auto text = CreateText(asciiLine, state.range(0));
+
+	for (auto _ : state) {
+		auto converted = GeneralUtils::UTF8ToUTF16(text);
+		benchmark::DoNotOptimize(converted.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_UTF8ToUTF16Ascii)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+static void BM_UTF8ToUTF16MultiByte(benchmark::State& state) {
+	const auto text = CreateText(multiByteLine, state.range(0));
+
+	for (auto _ : state) {
+		auto converted = GeneralUtils::UTF8ToUTF16(text);
+		benchmark::DoNotOptimize(converted.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_UTF8ToUTF16MultiByte)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+static void BM_ASCIIToUTF16(benchmark::State& state) {
+	const auto text = CreateText(asciiLine, state.range(0));
+
+	for (auto _ : state) {
+		auto converted = GeneralUtils::ASCIIToUTF16(text);
+		benchmark::DoNotOptimize(converted.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_ASCIIToUTF16)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+static void BM_UTF16ToWTF8Ascii(benchmark::State& state) {
+	const auto text = GeneralUtils::UTF8ToUTF16(CreateText(asciiLine, state.range(0)));
+
+	for (auto _ : state) {
+		auto converted = GeneralUtils::UTF16ToWTF8(text);
+		benchmark::DoNotOptimize(converted.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(BM_UTF16ToWTF8Ascii)->RangeMultiplier(8)->Range(16, 16 << 10);
+
+static void BM_UTF16ToWTF8MultiByte(benchmark::State& state) {
+	const auto text = GeneralUtils::UTF8ToUTF16(CreateText(multiByteLine, state.range(0)));
+
+	for (auto _ : state) {
+		auto converted = GeneralUtils::UTF16ToWTF8(text);
+		benchmark::DoNotOptimize(converted.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(BM_UTF16ToWTF8MultiByte)->RangeMultiplier(8)->Range(16, 16 << 10);
@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "BenchmarkDependencies.h"
+#include "BitStream.h"
+#include "DestroyableComponent.h"
+#include "Entity.h"
+#include "EntityManager.h"
+#include "MessageIdentifiers.h"
+
+namespace {
+	/**
+	 * Creates entities the way the component tests do, without going through the entity manager, so no zone or
+	 * client data is needed.
+	 */
+	std::vector<Entity*> CreateEntities(const uint32_t count) {
+		BenchmarkDependencies::SetUp();
+
+		std::vector<Entity*> entities;
+		entities.reserve(count);
+
+		for (uint32_t i = 0; i < count; i++) {
+			EntityInfo info;
+			info.pos = NiPoint3(i * 2.0f, 0.0f, 0.0f);
+			info.rot = NiQuaternion::IDENTITY;
+			info.scale = 1.0f;
+			info.spawner = nullptr;
+			info.lot = 999;
+
+			auto* entity = new Entity(i + 1, info);
+
+			auto* destroyableComponent = new DestroyableComponent(entity);
+			destroyableComponent->SetMaxHealth(12.0f);
+			destroyableComponent->SetHealth(12);
+			destroyableComponent->SetMaxArmor(4.0f);
+			destroyableComponent->SetArmor(4);
+			destroyableComponent->SetIsSmashable(true);
+			destroyableComponent->AddFactionNoLookup(4);
+			entity->AddComponent(COMPONENT_TYPE_DESTROYABLE, destroyableComponent);
+
+			entities.push_back(entity);
+		}
+
+		return entities;
+	}
+
+	void DeleteEntities(std::vector<Entity*>& entities) {
+		for (auto* entity : entities) {
+			delete entity;
+		}
+
+		entities.clear();
+	}
+}
+
+/**
+ * The update pass of EntityManager::UpdateEntities
+ */
+static void BM_EntityUpdate(benchmark::State& state) {
+	auto entities = CreateEntities(state.range(0));
+
+	for (auto _ : state) {
+		for (auto* entity : entities) {
+			entity->Update(1.0f / 60.0f);
+		}
+	}
+
+	DeleteEntities(entities);
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityUpdate)->RangeMultiplier(4)->Range(64, 16 << 10);
+
+/**
+ * The serialization pass of EntityManager::UpdateEntities, every entity is dirty
+ */
+static void BM_EntitySerialization(benchmark::State& state) {
+	auto entities = CreateEntities(state.range(0));
+
+	for (auto _ : state) {
+		for (auto* entity : entities) {
+			RakNet::BitStream stream;
+			stream.Write(static_cast<char>(ID_REPLICA_MANAGER_SERIALIZE));
+			stream.Write(static_cast<unsigned short>(entity->GetNetworkId()));
+
+			entity->WriteBaseReplicaData(&stream, PACKET_TYPE_SERIALIZATION);
+			entity->WriteComponents(&stream, PACKET_TYPE_SERIALIZATION);
+
+			Game::server->Send(&stream, UNASSIGNED_SYSTEM_ADDRESS, true);
+		}
+	}
+
+	DeleteEntities(entities);
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntitySerialization)->RangeMultiplier(4)->Range(64, 16 << 10);
+
+/**
+ * The construction packets ghosting sends when entities come into range of a player
+ */
+static void BM_EntityConstruction(benchmark::State& state) {
+	auto entities = CreateEntities(state.range(0));
+
+	for (auto _ : state) {
+		for (auto* entity : entities) {
+			RakNet::BitStream stream;
+			stream.Write(static_cast<char>(ID_REPLICA_MANAGER_CONSTRUCTION));
+			stream.Write(true);
+			stream.Write(static_cast<unsigned short>(entity->GetNetworkId()));
+
+			entity->WriteBaseReplicaData(&stream, PACKET_TYPE_CONSTRUCTION);
+			entity->WriteComponents(&stream, PACKET_TYPE_CONSTRUCTION);
+
+			Game::server->Send(&stream, UNASSIGNED_SYSTEM_ADDRESS, false);
+		}
+	}
+
+	DeleteEntities(entities);
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityConstruction)->RangeMultiplier(4)->Range(64, 16 << 10);
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchmarkDependencies.h"
+#include "Inventory.h"
+#include "Item.h"
+
+namespace {
+	/**
+	 * Fills an inventory the way loading a character does, the items cycle through the synthetic item LOTs
+	 * @param size the size of the inventory
+	 * @param count the number of items, slots are left empty at random when this is smaller than the size
+	 */
+	std::unique_ptr<Inventory> CreateInventory(const uint32_t size, const uint32_t count) {
+		BenchmarkDependencies::SetUpCDClient();
+
+		std::unique_ptr<Inventory> inventory(new Inventory(eInventoryType::ITEMS, size, {}, nullptr));
+
+		std::vector<uint32_t> slots(size);
+		for (uint32_t i = 0; i < size; i++) {
+			slots[i] = i;
+		}
+
+		std::shuffle(slots.begin(), slots.end(), std::mt19937(0));
+
+		for (uint32_t i = 0; i < count; i++) {
+			const LOT lot = BenchmarkDependencies::FIRST_ITEM_LOT + i % BenchmarkDependencies::ITEM_COUNT;
+
+			new Item(i + 1, lot, inventory.get(), slots[i], 1 + i % 10, false, {}, LWOOBJID_EMPTY, LWOOBJID_EMPTY);
+		}
+
+		return inventory;
+	}
+}
+
+static void BM_InventoryLoad(benchmark::State& state) {
+	for (auto _ : state) {
+		auto inventory = CreateInventory(state.range(0), state.range(0));
+		benchmark::DoNotOptimize(inventory.get());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InventoryLoad)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_InventoryFindEmptySlot(benchmark::State& state) {
+	// Only the last few slots are free, so the search has to walk past everything else
+	auto inventory = CreateInventory(state.range(0), state.range(0) - 8);
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(inventory->FindEmptySlot());
+	}
+}
+BENCHMARK(BM_InventoryFindEmptySlot)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_InventoryFindItemByLot(benchmark::State& state) {
+	auto inventory = CreateInventory(state.range(0), state.range(0));
+
+	LOT lot = BenchmarkDependencies::FIRST_ITEM_LOT;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(inventory->FindItemByLot(lot));
+		benchmark::DoNotOptimize(inventory->GetLotCount(lot));
+
+		if (++lot == BenchmarkDependencies::FIRST_ITEM_LOT + BenchmarkDependencies::ITEM_COUNT) {
+			lot = BenchmarkDependencies::FIRST_ITEM_LOT;
+		}
+	}
+}
+BENCHMARK(BM_InventoryFindItemByLot)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_InventoryFindItemBySlot(benchmark::State& state) {
+	auto inventory = CreateInventory(state.range(0), state.range(0));
+
+	uint32_t slot = 0;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(inventory->FindItemBySlot(slot));
+
+		if (++slot == state.range(0)) slot = 0;
+	}
+}
+BENCHMARK(BM_InventoryFindItemBySlot)->RangeMultiplier(4)->Range(16, 4096);
+
+/**
+ * Moving items around, as the client does when the player sorts their backpack
+ */
+static void BM_InventoryMoveItem(benchmark::State& state) {
+	auto inventory = CreateInventory(state.range(0), state.range(0) / 2);
+
+	std::mt19937 random(0);
+	std::uniform_int_distribution<uint32_t> slots(0, state.range(0) - 1);
+
+	std::vector<Item*> items;
+	for (const auto& [id, item] : inventory->GetItems()) {
+		items.push_back(item);
+	}
+
+	size_t index = 0;
+
+	for (auto _ : state) {
+		items[index]->SetSlot(slots(random));
+
+		if (++index == items.size()) index = 0;
+	}
+}
+BENCHMARK(BM_InventoryMoveItem)->RangeMultiplier(4)->Range(16, 4096);
+
+/**
+ * Picking up a stack of an item and dropping it again, which adds and removes it from the indexes
+ */
+static void BM_InventoryAddRemoveItem(benchmark::State& state) {
+	auto inventory = CreateInventory(state.range(0), state.range(0) - 1);
+
+	const LOT lot = BenchmarkDependencies::FIRST_ITEM_LOT;
+	LWOOBJID id = state.range(0) + 1;
+
+	for (auto _ : state) {
+		auto* item = new Item(id++, lot, inventory.get(), inventory->FindEmptySlot(), 1, false, {}, LWOOBJID_EMPTY, LWOOBJID_EMPTY);
+
+		inventory->RemoveManagedItem(item);
+		delete item;
+	}
+}
+BENCHMARK(BM_InventoryAddRemoveItem)->RangeMultiplier(4)->Range(16, 4096);
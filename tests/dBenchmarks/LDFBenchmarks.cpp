@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "LDFFormat.h"
+
+namespace {
+	/**
+	 * A spread of the value types level files and object configs use
+	 */
+	const std::vector<std::string> ldfStrings = {
+		"npcName=0:Synthetic Vendor",
+		"spawntemplate=1:6604",
+		"respawn=3:30.5",
+		"custom_script_server=0:scripts\\ai\\GF\\L_SYNTHETIC_SCRIPT.lua",
+		"startsInactive=7:1",
+		"objid=9:1152921504606846976",
+		"attached_path=0:synthetic_path_01",
+		"rotation_offset=4:3.14159265359",
+		"max_spawn_count=5:12",
+		"groupID=0:synthetic_group_a;synthetic_group_b;",
+		"isSmashable=7:0",
+		"spawnActivator=13:synthetic"
+	};
+}
+
+static void BM_LDFDataFromString(benchmark::State& state) {
+	const auto& format = ldfStrings[state.range(0)];
+
+	for (auto _ : state) {
+		auto* data = LDFBaseData::DataFromString(format);
+		benchmark::DoNotOptimize(data);
+		delete data;
+	}
+
+	state.SetLabel(format.substr(0, format.find(':')));
+}
+BENCHMARK(BM_LDFDataFromString)->DenseRange(0, ldfStrings.size() - 1);
+
+/**
+ * Parsing the whole config of an object, as happens for every object in a level file
+ */
+static void BM_LDFParseObjectConfig(benchmark::State& state) {
+	std::vector<LDFBaseData*> config;
+	config.reserve(ldfStrings.size());
+
+	for (auto _ : state) {
+		for (const auto& format : ldfStrings) {
+			config.push_back(LDFBaseData::DataFromString(format));
+		}
+
+		benchmark::DoNotOptimize(config.data());
+
+		for (auto* data : config) {
+			delete data;
+		}
+
+		config.clear();
+	}
+
+	state.SetItemsProcessed(state.iterations() * ldfStrings.size());
+}
+BENCHMARK(BM_LDFParseObjectConfig);
+
+static void BM_LDFGetString(benchmark::State& state) {
+	std::vector<LDFBaseData*> config;
+
+	for (const auto& format : ldfStrings) {
+		config.push_back(LDFBaseData::DataFromString(format));
+	}
+
+	for (auto _ : state) {
+		for (auto* data : config) {
+			auto string = data->GetString();
+			benchmark::DoNotOptimize(string);
+		}
+	}
+
+	for (auto* data : config) {
+		delete data;
+	}
+
+	state.SetItemsProcessed(state.iterations() * ldfStrings.size());
+}
+BENCHMARK(BM_LDFGetString);
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "dpEntity.h"
+#include "dpGrid.h"
+#include "dpWorld.h"
+#include "NiPoint3.h"
+
+namespace {
+	// The grid dpWorld creates with the default spatial partitioning settings
+	constexpr int gridCellCount = 12;
+	constexpr int gridCellSize = 205;
+
+	/**
+	 * Entities are kept well inside the grid, positions outside of it are clamped onto the edge cells
+	 */
+	constexpr float worldExtent = 1000.0f;
+
+	/**
+	 * Creates a mix of static proximity spheres, like the ones of scripted objects, and small dynamic spheres
+	 * for the players and enemies moving through them.
+	 */
+	std::vector<dpEntity*> CreateEntities(const uint32_t count, std::vector<dpEntity*>& dynamicEntities) {
+		std::mt19937 random(0);
+		std::uniform_real_distribution<float> position(-worldExtent, worldExtent);
+
+		std::vector<dpEntity*> entities;
+		entities.reserve(count);
+
+		for (uint32_t i = 0; i < count; i++) {
+			const auto isStatic = i % 4 != 0;
+
+			auto* entity = new dpEntity(i + 1, isStatic ? 20.0f : 2.0f, isStatic);
+			entity->SetPosition(NiPoint3(position(random), 0.0f, position(random)));
+
+			if (!isStatic) dynamicEntities.push_back(entity);
+
+			entities.push_back(entity);
+		}
+
+		return entities;
+	}
+
+	/**
+	 * Moves the dynamic entities along circles, about the distance a running player covers in a frame
+	 */
+	void MoveEntities(std::vector<dpEntity*>& dynamicEntities, const float time) {
+		for (size_t i = 0; i < dynamicEntities.size(); i++) {
+			auto* entity = dynamicEntities[i];
+			const auto& position = entity->GetPosition();
+			const auto angle = time + i;
+
+			entity->SetPosition(NiPoint3(position.x + std::cos(angle) * 0.5f, position.y, position.z + std::sin(angle) * 0.5f));
+		}
+	}
+}
+
+static void BM_dpGridUpdate(benchmark::State& state) {
+	dpGrid grid(gridCellCount, gridCellSize);
+
+	std::vector<dpEntity*> dynamicEntities;
+	for (auto* entity : CreateEntities(state.range(0), dynamicEntities)) {
+		entity->SetGrid(&grid);
+	}
+
+	float time = 0.0f;
+
+	for (auto _ : state) {
+		time += 1.0f / 60.0f;
+		MoveEntities(dynamicEntities, time);
+
+		grid.Update(1.0f / 60.0f);
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_dpGridUpdate)->RangeMultiplier(4)->Range(64, 16 << 10);
+
+static void BM_dpGridAddDelete(benchmark::State& state) {
+	dpGrid grid(gridCellCount, gridCellSize);
+
+	std::vector<dpEntity*> dynamicEntities;
+	for (auto* entity : CreateEntities(state.range(0), dynamicEntities)) {
+		entity->SetGrid(&grid);
+	}
+
+	LWOOBJID nextId = state.range(0) + 1;
+
+	for (auto _ : state) {
+		auto* entity = new dpEntity(nextId++, 2.0f, false);
+		entity->SetPosition(NiPoint3(static_cast<float>(nextId % 2000) - worldExtent, 0.0f, 0.0f));
+		entity->SetGrid(&grid);
+
+		grid.Delete(entity);
+	}
+}
+BENCHMARK(BM_dpGridAddDelete)->RangeMultiplier(4)->Range(64, 16 << 10);
+
+/**
+ * dpWorld without spatial partitioning, every dynamic entity is checked against every static one.
+ * With partitioning enabled StepWorld only forwards to dpGrid::Update, which is covered above.
+ */
+static void BM_dpWorldStepWorld(benchmark::State& state) {
+	static std::vector<dpEntity*> dynamicEntities;
+
+	// The world is a singleton without a way to clear it, so it is only filled once
+	if (dynamicEntities.empty()) {
+		for (auto* entity : CreateEntities(1024, dynamicEntities)) {
+			dpWorld::Instance().AddEntity(entity);
+		}
+	}
+
+	float time = 0.0f;
+
+	for (auto _ : state) {
+		time += 1.0f / 60.0f;
+		MoveEntities(dynamicEntities, time);
+
+		dpWorld::Instance().StepWorld(1.0f / 60.0f);
+	}
+}
+BENCHMARK(BM_dpWorldStepWorld);
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "BinaryPathFinder.h"
+#include "dConfig.h"
+#include "Game.h"
+
+// Invalid values are only logged when there is a logger
+namespace Game {
+	dLogger* logger = nullptr;
+}
+
+namespace {
+	void WriteConfig(const std::filesystem::path& path, const std::string& contents) {
+		std::ofstream file(path, std::ios::trunc);
+		file << contents;
+	}
+}
+
+/**
+ * @brief Test that numeric options parse their value, and fall back to their default when it is missing or invalid
+ *
+ */
+TEST(dCommonTests, ConfigOptionParseTest) {
+	ConfigOption<uint32_t> option("test_config_option_uint", 64, [](uint32_t value) { return value > 0; });
+
+	ASSERT_EQ(option.Get(), 64);
+
+	ASSERT_TRUE(option.Load("12"));
+	ASSERT_EQ(option.Get(), 12);
+
+	// Missing values are valid and give the default
+	ASSERT_TRUE(option.Load(""));
+	ASSERT_EQ(option.Get(), 64);
+
+	ASSERT_FALSE(option.Load("twelve"));
+	ASSERT_EQ(option.Get(), 64);
+
+	// Rejected by the validator
+	ASSERT_FALSE(option.Load("0"));
+	ASSERT_EQ(option.Get(), 64);
+
+	ConfigOption<float> interval("test_config_option_float", 0.0f, [](float value) { return value >= 0.0f; });
+
+	ASSERT_TRUE(interval.Load("2.5"));
+	ASSERT_FLOAT_EQ(interval.Get(), 2.5f);
+	ASSERT_FALSE(interval.Load("-1"));
+	ASSERT_FLOAT_EQ(interval.Get(), 0.0f);
+}
+
+/**
+ * @brief Test that flags only accept 0 and 1
+ *
+ */
+TEST(dCommonTests, ConfigOptionBoolTest) {
+	ConfigOption<bool> flag("test_config_option_bool", false);
+
+	ASSERT_TRUE(flag.Load("1"));
+	ASSERT_TRUE(flag.Get());
+
+	ASSERT_TRUE(flag.Load("0"));
+	ASSERT_FALSE(flag.Get());
+
+	ASSERT_FALSE(flag.Load("true"));
+	ASSERT_EQ(flag.Get(), flag.GetDefault());
+}
+
+/**
+ * @brief Test that options follow the config when it is loaded and reloaded
+ *
+ */
+TEST(dCommonTests, ConfigOptionReloadTest) {
+	ConfigOption<uint32_t> option("test_config_option_reload", 7);
+
+	const auto path = BinaryPathFinder::GetBinaryDir() / "testconfigoption.ini";
+	WriteConfig(path, "test_config_option_reload=20\n");
+
+	dConfig config("testconfigoption.ini");
+	ASSERT_EQ(option.Get(), 20);
+
+	// Nothing was written since it was loaded
+	ASSERT_FALSE(config.ReloadIfChanged());
+
+	WriteConfig(path, "test_config_option_reload=30\n");
+	std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(5));
+
+	ASSERT_TRUE(config.ReloadIfChanged());
+	ASSERT_EQ(option.Get(), 30);
+
+	// Removing the key goes back to the default
+	WriteConfig(path, "\n");
+	config.ReloadConfig();
+	ASSERT_EQ(option.Get(), 7);
+
+	std::filesystem::remove(path);
+}
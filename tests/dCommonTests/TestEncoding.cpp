@@ -1,3 +1,4 @@
+#include <random>
 #include <string>
 #include <gtest/gtest.h>
 #include <string_view>
@@ -66,3 +67,128 @@ TEST_F(EncodingTest, TestEncodingEmoji) {
 
 	EXPECT_EQ(GeneralUtils::UTF8ToUTF16("👨‍⚖️"), u"👨‍⚖️");
 };
+
+namespace {
+	// The one code unit at a time conversions the block conversions replaced, to check them against
+
+	void PushScalarUTF8(std::string& ret, char32_t cp) {
+		if (cp <= 0x007F) {
+			ret.push_back(static_cast<char>(cp));
+		} else if (cp <= 0x07FF) {
+			ret.push_back(0xC0 | (cp >> 6));
+			ret.push_back(0x80 | (cp & 0x3F));
+		} else if (cp <= 0xFFFF) {
+			ret.push_back(0xE0 | (cp >> 12));
+			ret.push_back(0x80 | ((cp >> 6) & 0x3F));
+			ret.push_back(0x80 | (cp & 0x3F));
+		} else {
+			ret.push_back(0xF0 | (cp >> 18));
+			ret.push_back(0x80 | ((cp >> 12) & 0x3F));
+			ret.push_back(0x80 | ((cp >> 6) & 0x3F));
+			ret.push_back(0x80 | (cp & 0x3F));
+		}
+	}
+
+	std::string ScalarUTF16ToWTF8(const std::u16string& string) {
+		std::string ret;
+		for (size_t i = 0; i < string.size(); i++) {
+			char16_t u = string[i];
+			if (u >= 0xD800 && u <= 0xDBFF && i + 1 < string.size() && string[i + 1] >= 0xDC00 && string[i + 1] <= 0xDFFF) {
+				PushScalarUTF8(ret, 0x10000 + ((static_cast<char32_t>(u) - 0xD800) << 10) + (static_cast<char32_t>(string[++i]) - 0xDC00));
+			} else {
+				PushScalarUTF8(ret, u);
+			}
+		}
+		return ret;
+	}
+
+	std::u16string ScalarASCIIToUTF16(const std::string& string) {
+		std::u16string ret;
+		for (const unsigned char c : string) ret.push_back((c > 0 && c <= 127) ? static_cast<char16_t>(c) : 0xFFFD);
+		return ret;
+	}
+
+	std::u16string ScalarUTF8ToUTF16(const std::string& string) {
+		std::u16string ret;
+		std::string_view iterator = string;
+		uint32_t c;
+		while (GeneralUtils::_NextUTF8Char(iterator, c)) {
+			if (c < 0x10000) ret.push_back(static_cast<char16_t>(c));
+			else if (c > 0x10FFFF) ret.push_back(0xFFFD);
+			else {
+				ret.push_back(static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10)));
+				ret.push_back(static_cast<char16_t>(0xDC00 + ((c - 0x10000) & 0x3FF)));
+			}
+		}
+		return ret;
+	}
+};
+
+TEST_F(EncodingTest, TestEncodingEveryCodeUnit) {
+	// Every code unit, at every offset in a block, surrounded by ASCII on both sides
+	for (uint32_t unit = 0; unit <= 0xFFFF; unit++) {
+		const size_t offset = unit % 37;
+		std::u16string utf16(offset, u'a');
+		utf16.push_back(static_cast<char16_t>(unit));
+		utf16.append(40 - offset, u'b');
+
+		const auto utf8 = GeneralUtils::UTF16ToWTF8(utf16);
+		ASSERT_EQ(utf8, ScalarUTF16ToWTF8(utf16)) << "code unit " << unit;
+		ASSERT_EQ(GeneralUtils::UTF8ToUTF16(utf8), ScalarUTF8ToUTF16(utf8)) << "code unit " << unit;
+	}
+
+	for (uint32_t byte = 0; byte <= 0xFF; byte++) {
+		for (size_t offset = 0; offset < 40; offset++) {
+			std::string ascii(40, 'c');
+			ascii[offset] = static_cast<char>(byte);
+
+			ASSERT_EQ(GeneralUtils::ASCIIToUTF16(ascii), ScalarASCIIToUTF16(ascii)) << "byte " << byte;
+			ASSERT_EQ(GeneralUtils::UTF8ToUTF16(ascii), ScalarUTF8ToUTF16(ascii)) << "byte " << byte;
+		}
+	}
+};
+
+TEST_F(EncodingTest, TestEncodingRandomStrings) {
+	std::mt19937 random(1337);
+	std::uniform_int_distribution<uint32_t> length(0, 100);
+	std::uniform_int_distribution<uint32_t> kind(0, 9);
+	std::uniform_int_distribution<uint32_t> unit(0, 0xFFFF);
+	std::uniform_int_distribution<uint32_t> supplementary(0x10000, 0x10FFFF);
+
+	for (uint32_t i = 0; i < 20000; i++) {
+		// Mostly ASCII, like the strings the server converts
+		std::u16string utf16;
+		for (uint32_t j = length(random); j > 0; j--) {
+			switch (kind(random)) {
+			case 0:
+				utf16.push_back(static_cast<char16_t>(unit(random)));
+				break;
+			case 1: {
+				const auto cp = supplementary(random) - 0x10000;
+				utf16.push_back(static_cast<char16_t>(0xD800 + (cp >> 10)));
+				utf16.push_back(static_cast<char16_t>(0xDC00 + (cp & 0x3FF)));
+				break;
+			}
+			default:
+				utf16.push_back(static_cast<char16_t>(unit(random) % 0x80));
+				break;
+			}
+		}
+
+		const auto utf8 = GeneralUtils::UTF16ToWTF8(utf16);
+		ASSERT_EQ(utf8, ScalarUTF16ToWTF8(utf16));
+		ASSERT_EQ(GeneralUtils::UTF8ToUTF16(utf8), ScalarUTF8ToUTF16(utf8));
+		ASSERT_EQ(GeneralUtils::ASCIIToUTF16(utf8), ScalarASCIIToUTF16(utf8));
+
+		// Trimming cuts the input of UTF16ToWTF8 and the output of the others
+		const auto trim = utf16.size() / 2;
+		ASSERT_EQ(GeneralUtils::UTF16ToWTF8(utf16, trim), ScalarUTF16ToWTF8(utf16.substr(0, trim)));
+		ASSERT_EQ(GeneralUtils::ASCIIToUTF16(utf8, trim), ScalarASCIIToUTF16(utf8.substr(0, trim)));
+
+		const auto trimmed = GeneralUtils::UTF8ToUTF16(utf8, trim);
+		const auto expected = ScalarUTF8ToUTF16(utf8);
+		ASSERT_LE(trimmed.size(), trim);
+		ASSERT_EQ(trimmed, expected.substr(0, trimmed.size()));
+		ASSERT_GE(trimmed.size() + 1, std::min<size_t>(trim, expected.size()));
+	}
+};
@@ -23,3 +23,72 @@ TEST(dCommonTests, LDFTest) {
 	// Cleanup the object
 	delete data;
 }
+
+/**
+ * @brief Test parsing every LDF type, including values with colons in them
+ */
+TEST(dCommonTests, LDFParseTypesTest) {
+	auto* s32 = LDFBaseData::DataFromString("KEY=1:-12");
+	ASSERT_EQ(((LDFData<int32_t>*)s32)->GetValue(), -12);
+	delete s32;
+
+	auto* u32 = LDFBaseData::DataFromString("KEY=5:true");
+	ASSERT_EQ(((LDFData<uint32_t>*)u32)->GetValue(), 1);
+	delete u32;
+
+	auto* boolean = LDFBaseData::DataFromString("KEY=7:0");
+	ASSERT_FALSE(((LDFData<bool>*)boolean)->GetValue());
+	delete boolean;
+
+	auto* objid = LDFBaseData::DataFromString("KEY=9:1152921504606846976");
+	ASSERT_EQ(((LDFData<LWOOBJID>*)objid)->GetValue(), 1152921504606846976);
+	delete objid;
+
+	auto* floating = LDFBaseData::DataFromString("KEY=3:30.5");
+	ASSERT_FLOAT_EQ(((LDFData<float>*)floating)->GetValue(), 30.5f);
+	delete floating;
+
+	auto* utf8 = LDFBaseData::DataFromString("KEY=13:a:b:c");
+	ASSERT_EQ(((LDFData<std::string>*)utf8)->GetValue(), "a:b:c");
+	delete utf8;
+
+	auto* empty = LDFBaseData::DataFromString("KEY=0");
+	ASSERT_EQ(((LDFData<std::u16string>*)empty)->GetValue(), u"");
+	delete empty;
+
+	// Malformed data is rejected rather than throwing
+	ASSERT_EQ(LDFBaseData::DataFromString("KEY=1:"), nullptr);
+	ASSERT_EQ(LDFBaseData::DataFromString("KEY"), nullptr);
+	ASSERT_EQ(LDFBaseData::DataFromString("KEY=x:1"), nullptr);
+}
+
+/**
+ * @brief Test that the size of a list of LDF data is what is written
+ */
+TEST(dCommonTests, LDFWriteListTest) {
+	std::vector<LDFBaseData*> data = {
+		LDFBaseData::DataFromString("name=0:VALUE"),
+		LDFBaseData::DataFromString("count=1:5"),
+		LDFBaseData::DataFromString("flag=7:1"),
+		nullptr,
+		LDFBaseData::DataFromString("script=13:scripts")
+	};
+
+	RakNet::BitStream bitStream;
+	LDFBaseData::WriteListToPacket(&bitStream, data);
+
+	uint32_t size = 0;
+	uint8_t compressed = 1;
+	uint32_t count = 0;
+	bitStream.Read(size);
+	bitStream.Read(compressed);
+	bitStream.Read(count);
+
+	ASSERT_EQ(size, bitStream.GetNumberOfBytesUsed() - sizeof(uint32_t));
+	ASSERT_EQ(compressed, 0);
+	ASSERT_EQ(count, 4);
+
+	for (auto* entry : data) {
+		delete entry;
+	}
+}
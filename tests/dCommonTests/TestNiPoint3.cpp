@@ -12,3 +12,28 @@ TEST(dCommonTests, NiPoint3Test) {
 	// Check what unitize does to a vector of length 0
 	ASSERT_EQ(NiPoint3::ZERO.Unitize(), NiPoint3::ZERO);
 }
+
+/**
+ * @brief Test sweeping a point against a sphere
+ *
+ */
+TEST(dCommonTests, NiPoint3SweepSphereTest) {
+	float fraction = -1.0f;
+
+	// Passing through the sphere touches it where it enters
+	ASSERT_TRUE(NiPoint3::SweepSphere(NiPoint3(-10, 0, 0), NiPoint3(10, 0, 0), NiPoint3::ZERO, 2.0f, fraction));
+	ASSERT_FLOAT_EQ(fraction, 0.4f);
+
+	// A sweep that skips over the sphere in one step still hits it
+	ASSERT_TRUE(NiPoint3::SweepSphere(NiPoint3(-100, 1, 0), NiPoint3(100, 1, 0), NiPoint3::ZERO, 2.0f, fraction));
+
+	// Starting inside is a hit right away
+	ASSERT_TRUE(NiPoint3::SweepSphere(NiPoint3(1, 0, 0), NiPoint3(10, 0, 0), NiPoint3::ZERO, 2.0f, fraction));
+	ASSERT_FLOAT_EQ(fraction, 0.0f);
+
+	// Missing, stopping short, moving away and not moving at all are not
+	ASSERT_FALSE(NiPoint3::SweepSphere(NiPoint3(-10, 3, 0), NiPoint3(10, 3, 0), NiPoint3::ZERO, 2.0f, fraction));
+	ASSERT_FALSE(NiPoint3::SweepSphere(NiPoint3(-10, 0, 0), NiPoint3(-5, 0, 0), NiPoint3::ZERO, 2.0f, fraction));
+	ASSERT_FALSE(NiPoint3::SweepSphere(NiPoint3(5, 0, 0), NiPoint3(10, 0, 0), NiPoint3::ZERO, 2.0f, fraction));
+	ASSERT_FALSE(NiPoint3::SweepSphere(NiPoint3(5, 0, 0), NiPoint3(5, 0, 0), NiPoint3::ZERO, 2.0f, fraction));
+}
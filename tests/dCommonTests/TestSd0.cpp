@@ -0,0 +1,66 @@
+#include <string>
+#include <sstream>
+#include <gtest/gtest.h>
+
+#include "Sd0.h"
+#include "ZCompression.h"
+
+/**
+ * @brief Compresses a model and checks that it inflates back to the same data
+ */
+void RoundTrip(const std::string& original) {
+	const auto sd0 = Sd0::Compress(original.data(), original.size());
+	ASSERT_FALSE(sd0.empty());
+
+	std::istringstream stream(sd0);
+	ASSERT_TRUE(Sd0::CheckMagic(stream));
+
+	std::string inflated{};
+	int32_t error{};
+	ASSERT_TRUE(Sd0::Decompress(stream, inflated, error));
+	ASSERT_EQ(inflated, original);
+}
+
+TEST(Sd0Tests, Sd0SmallModelTest) {
+	RoundTrip("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\" ?><LXFML versionMajor=\"5\" versionMinor=\"0\"></LXFML>");
+}
+
+TEST(Sd0Tests, Sd0EmptyModelTest) {
+	RoundTrip("");
+}
+
+TEST(Sd0Tests, Sd0MultipleChunksTest) {
+	std::string model{};
+	while (model.size() < ZCompression::MAX_SD0_CHUNK_SIZE * 2 + 100) {
+		model += "<Brick refID=\"" + std::to_string(model.size()) + "\" designID=\"3001\"/>";
+	}
+
+	RoundTrip(model);
+}
+
+TEST(Sd0Tests, Sd0BadMagicTest) {
+	std::istringstream stream("sd1\x01\xFF");
+	ASSERT_FALSE(Sd0::CheckMagic(stream));
+}
+
+TEST(Sd0Tests, Sd0TruncatedChunkTest) {
+	const std::string model(1000, 'a');
+	auto sd0 = Sd0::Compress(model.data(), model.size());
+	sd0.resize(sd0.size() - 2);
+
+	std::istringstream stream(sd0);
+	ASSERT_TRUE(Sd0::CheckMagic(stream));
+
+	std::string inflated{};
+	int32_t error{};
+	ASSERT_FALSE(Sd0::Decompress(stream, inflated, error));
+}
+
+TEST(Sd0Tests, Sd0ContentHashTest) {
+	const std::string first = "<LXFML></LXFML>";
+	const std::string second = "<LXFML> </LXFML>";
+
+	ASSERT_EQ(Sd0::ContentHash(first.data(), first.size()), Sd0::ContentHash(first.data(), first.size()));
+	ASSERT_NE(Sd0::ContentHash(first.data(), first.size()), Sd0::ContentHash(second.data(), second.size()));
+	ASSERT_EQ(Sd0::ContentHash(first.data(), first.size()).size(), 32);
+}
@@ -298,3 +298,25 @@ TEST_F(DestroyableTest, DestroyableComponentValiditiyTest) {
 	EXPECT_FALSE(destroyableComponent->IsFriend(enemyEntity));
 	delete enemyEntity;
 }
+
+TEST_F(DestroyableTest, DestroyableComponentFactionMaskTest) {
+	auto* enemyEntity = new Entity(20, info);
+	auto* enemyDestroyableComponent = new DestroyableComponent(enemyEntity);
+	enemyEntity->AddComponent(COMPONENT_TYPE_DESTROYABLE, enemyDestroyableComponent);
+	enemyDestroyableComponent->AddFactionNoLookup(4);
+	enemyDestroyableComponent->AddFactionNoLookup(17);
+
+	EXPECT_FALSE(destroyableComponent->IsEnemy(enemyEntity));
+	EXPECT_TRUE(destroyableComponent->IsFriend(enemyEntity));
+
+	destroyableComponent->AddEnemyFaction(17);
+	EXPECT_TRUE(destroyableComponent->IsEnemy(enemyEntity));
+	EXPECT_FALSE(enemyDestroyableComponent->IsEnemy(baseEntity));
+
+	// Setting the faction drops the enemies of the previous ones
+	destroyableComponent->SetFaction(6);
+	EXPECT_FALSE(destroyableComponent->IsEnemy(enemyEntity));
+	EXPECT_TRUE(destroyableComponent->HasFaction(6));
+	EXPECT_FALSE(destroyableComponent->HasFaction(-1));
+	delete enemyEntity;
+}
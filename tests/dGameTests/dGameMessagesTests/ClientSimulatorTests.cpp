@@ -0,0 +1,35 @@
+#include "GameMessages.h"
+#include "SimulatedClient.h"
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+/**
+ * @brief Tests that the skill casts of simulated clients are read by the start skill handler like a client's
+ *
+ */
+TEST(ClientSimulatorTests, SimulatedStartSkillIsReadByHandler) {
+	RakNet::BitStream payload;
+	SimulatedClient::WriteStartSkill(payload, 1152921510436607007, 1234, 3);
+
+	// The world server reads the message ID, then the handler of the message reads the rest
+	uint16_t messageId{};
+	payload.Read(messageId);
+	ASSERT_EQ(messageId, GAME_MSG_START_SKILL);
+
+	GameMessages::StartSkill startSkill;
+	ASSERT_TRUE(startSkill.Deserialize(&payload));
+	ASSERT_EQ(payload.GetNumberOfUnreadBits(), 0);
+
+	ASSERT_EQ(startSkill.optionalOriginatorID, 1152921510436607007);
+	ASSERT_EQ(startSkill.skillID, 1234);
+	ASSERT_EQ(startSkill.uiSkillHandle, 3);
+	ASSERT_TRUE(startSkill.sBitStream.empty());
+
+	// It is the message a client casting the same skill sends
+	RakNet::BitStream expected;
+	startSkill.Serialize(&expected);
+
+	ASSERT_EQ(payload.GetNumberOfBitsUsed(), expected.GetNumberOfBitsUsed());
+	ASSERT_EQ(memcmp(payload.GetData(), expected.GetData(), expected.GetNumberOfBytesUsed()), 0);
+}
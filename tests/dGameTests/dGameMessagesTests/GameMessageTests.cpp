@@ -2,6 +2,8 @@
 #include "GameDependencies.h"
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 class GameMessageTests : public GameDependenciesTest {
 	protected:
 		void SetUp() override {
@@ -50,3 +52,161 @@ TEST_F(GameMessageTests, SendBlueprintLoadItemResponse) {
 
 	ASSERT_EQ(bitStream->GetNumberOfUnreadBits(), 0);
 }
+
+/**
+ * @brief Tests that StartSkill reads back exactly what it wrote
+ *
+ */
+TEST_F(GameMessageTests, StartSkillRoundTrip) {
+	GameMessages::StartSkill original(
+		1, std::string("\x01\x00\xFF skill data", 15), 42, true, 2, 0.5f, 3, NiPoint3(1.0f, 2.0f, 3.0f), 4, NiQuaternion(0.0f, 1.0f, 0.0f, 0.0f), 5);
+
+	RakNet::BitStream bitStream;
+	original.Serialize(&bitStream);
+
+	uint16_t messageId{};
+	bitStream.Read(messageId);
+	ASSERT_EQ(messageId, GAME_MSG_START_SKILL);
+
+	GameMessages::StartSkill result;
+	ASSERT_TRUE(result.Deserialize(&bitStream));
+
+	ASSERT_EQ(result.bUsedMouse, original.bUsedMouse);
+	ASSERT_EQ(result.consumableItemID, original.consumableItemID);
+	ASSERT_EQ(result.fCasterLatency, original.fCasterLatency);
+	ASSERT_EQ(result.iCastType, original.iCastType);
+	ASSERT_EQ(result.lastClickedPosit, original.lastClickedPosit);
+	ASSERT_EQ(result.optionalOriginatorID, original.optionalOriginatorID);
+	ASSERT_EQ(result.optionalTargetID, original.optionalTargetID);
+	ASSERT_EQ(result.originatorRot, original.originatorRot);
+	ASSERT_EQ(result.sBitStream, original.sBitStream);
+	ASSERT_EQ(result.skillID, original.skillID);
+	ASSERT_EQ(result.uiSkillHandle, original.uiSkillHandle);
+	ASSERT_EQ(bitStream.GetNumberOfUnreadBits(), 0);
+}
+
+/**
+ * @brief Tests that the sized string of SyncSkill is written unaligned exactly as it was read
+ *
+ */
+TEST_F(GameMessageTests, SyncSkillRoundTrip) {
+	GameMessages::SyncSkill original(std::string(300, '\xAB'), 7, 8, true);
+
+	RakNet::BitStream bitStream;
+	original.Serialize(&bitStream);
+
+	uint16_t messageId{};
+	bitStream.Read(messageId);
+	ASSERT_EQ(messageId, GAME_MSG_SYNC_SKILL);
+
+	GameMessages::SyncSkill result;
+	ASSERT_TRUE(result.Deserialize(&bitStream));
+
+	ASSERT_EQ(result.bDone, original.bDone);
+	ASSERT_EQ(result.sBitStream, original.sBitStream);
+	ASSERT_EQ(result.uiBehaviorHandle, original.uiBehaviorHandle);
+	ASSERT_EQ(result.uiSkillHandle, original.uiSkillHandle);
+	ASSERT_EQ(bitStream.GetNumberOfUnreadBits(), 0);
+}
+
+/**
+ * @brief Tests that a message claiming more data than the stream holds is rejected
+ *
+ */
+TEST_F(GameMessageTests, RequestServerProjectileImpactTruncated) {
+	RakNet::BitStream bitStream;
+	bitStream.Write(false);
+	bitStream.Write(false);
+	bitStream.Write<uint32_t>(1000);
+	bitStream.Write<uint8_t>(1);
+
+	GameMessages::RequestServerProjectileImpact result;
+	ASSERT_FALSE(result.Deserialize(&bitStream));
+}
+
+/**
+ * @brief Tests that an empty sized string is read at an offset that isn't byte aligned
+ *
+ */
+TEST_F(GameMessageTests, SyncSkillEmptyBitStream) {
+	GameMessages::SyncSkill original("", 7, 8, true);
+
+	RakNet::BitStream bitStream;
+	original.Serialize(&bitStream);
+
+	uint16_t messageId{};
+	bitStream.Read(messageId);
+
+	// The done flag leaves the length and contents a bit past the byte boundary
+	GameMessages::SyncSkill result("leftover", 0, 0);
+	ASSERT_TRUE(result.Deserialize(&bitStream));
+
+	ASSERT_EQ(result.sBitStream, "");
+	ASSERT_EQ(result.uiBehaviorHandle, original.uiBehaviorHandle);
+	ASSERT_EQ(result.uiSkillHandle, original.uiSkillHandle);
+	ASSERT_EQ(bitStream.GetNumberOfUnreadBits(), 0);
+}
+
+/**
+ * @brief Tests that the StartSkill written from its fields matches the layout the hand written serializer had
+ *
+ */
+TEST_F(GameMessageTests, StartSkillMatchesHandWrittenLayout) {
+	GameMessages::StartSkill message(
+		1, std::string("payload"), 42, true, LWOOBJID_EMPTY, 0.5f, 0, NiPoint3(1.0f, 2.0f, 3.0f), 4, NiQuaternion::IDENTITY, 5);
+
+	RakNet::BitStream generated;
+	message.Serialize(&generated);
+
+	RakNet::BitStream expected;
+	expected.Write<unsigned short>(GAME_MSG_START_SKILL);
+	expected.Write(true);
+	expected.Write(false);
+	expected.Write(true);
+	expected.Write(0.5f);
+	expected.Write(false);
+	expected.Write(true);
+	expected.Write(NiPoint3(1.0f, 2.0f, 3.0f));
+	expected.Write<LWOOBJID>(1);
+	expected.Write(true);
+	expected.Write<LWOOBJID>(4);
+	expected.Write(false);
+	expected.Write<uint32_t>(7);
+	expected.Write("payload", 7);
+	expected.Write<TSkillID>(42);
+	expected.Write(true);
+	expected.Write<unsigned int>(5);
+
+	ASSERT_EQ(generated.GetNumberOfBitsUsed(), expected.GetNumberOfBitsUsed());
+	ASSERT_EQ(memcmp(generated.GetData(), expected.GetData(), expected.GetNumberOfBytesUsed()), 0);
+}
+
+/**
+ * @brief Tests that the projectile impact written from its fields matches the layout the hand written serializer had
+ *
+ */
+TEST_F(GameMessageTests, RequestServerProjectileImpactMatchesHandWrittenLayout) {
+	GameMessages::RequestServerProjectileImpact message("impact", LWOOBJID_EMPTY, 9);
+
+	RakNet::BitStream generated;
+	message.Serialize(&generated);
+
+	RakNet::BitStream expected;
+	expected.Write<unsigned short>(GAME_MSG_REQUEST_SERVER_PROJECTILE_IMPACT);
+	expected.Write(false);
+	expected.Write(true);
+	expected.Write<LWOOBJID>(9);
+	expected.Write<uint32_t>(6);
+	expected.Write("impact", 6);
+
+	ASSERT_EQ(generated.GetNumberOfBitsUsed(), expected.GetNumberOfBitsUsed());
+	ASSERT_EQ(memcmp(generated.GetData(), expected.GetData(), expected.GetNumberOfBytesUsed()), 0);
+
+	generated.IgnoreBits(16);
+
+	GameMessages::RequestServerProjectileImpact result;
+	ASSERT_TRUE(result.Deserialize(&generated));
+	ASSERT_EQ(result.i64LocalID, LWOOBJID_EMPTY);
+	ASSERT_EQ(result.i64TargetID, 9);
+	ASSERT_EQ(result.sBitStream, "impact");
+}
@@ -0,0 +1,217 @@
+#include "GameDependencies.h"
+#include <gtest/gtest.h>
+
+#include "AMFFormat.h"
+#include "ControlBehaviors.h"
+#include "Entity.h"
+#include "ModelBehavior.h"
+#include "ModelBehaviorScheduler.h"
+#include "ModelComponent.h"
+
+class ControlBehaviorsTest : public GameDependenciesTest {
+protected:
+	Entity* baseEntity;
+	ModelComponent* modelComponent;
+	ModelBehavior* behavior;
+
+	void SetUp() override {
+		SetUpDependencies();
+		baseEntity = new Entity(15, GameDependenciesTest::info);
+		modelComponent = new ModelComponent(baseEntity);
+		baseEntity->AddComponent(COMPONENT_TYPE_MODEL, modelComponent);
+
+		// A behavior the player already owns, so editing it doesn't request a new ID
+		behavior = new ModelBehavior(42);
+		modelComponent->AddBehavior(behavior, 0);
+
+		ModelBehaviorScheduler::Instance()->SetActionBudget(0);
+	}
+
+	void TearDown() override {
+		delete baseEntity;
+		TearDownDependencies();
+	}
+
+	AMFArrayValue* MakeAction(const std::string& type, const std::string& parameterName = "", double value = 0.0) {
+		auto* action = new AMFArrayValue();
+
+		auto* typeValue = new AMFStringValue();
+		typeValue->SetStringValue(type);
+		action->InsertValue("Type", typeValue);
+
+		if (!parameterName.empty()) {
+			auto* parameter = new AMFDoubleValue();
+			parameter->SetDoubleValue(value);
+			action->InsertValue(parameterName, parameter);
+		}
+
+		return action;
+	}
+
+	void InsertIDs(AMFArrayValue& arguments, STRIPID stripID, BEHAVIORSTATE stateID) {
+		auto* behaviorID = new AMFStringValue();
+		behaviorID->SetStringValue("42");
+		arguments.InsertValue("BehaviorID", behaviorID);
+
+		auto* strip = new AMFDoubleValue();
+		strip->SetDoubleValue(stripID);
+		arguments.InsertValue("stripID", strip);
+
+		auto* state = new AMFDoubleValue();
+		state->SetDoubleValue(stateID);
+		arguments.InsertValue("stateID", state);
+	}
+
+	void AddStrip(STRIPID stripID, BEHAVIORSTATE stateID, const std::vector<AMFArrayValue*>& actions) {
+		AMFArrayValue arguments;
+		InsertIDs(arguments, stripID, stateID);
+
+		auto* strip = new AMFArrayValue();
+		auto* stripActions = new AMFArrayValue();
+		for (auto* action : actions) stripActions->PushBackValue(action);
+		strip->InsertValue("actions", stripActions);
+		arguments.InsertValue("strip", strip);
+
+		auto* ui = new AMFArrayValue();
+		auto* x = new AMFDoubleValue();
+		x->SetDoubleValue(10.0);
+		ui->InsertValue("x", x);
+		auto* y = new AMFDoubleValue();
+		y->SetDoubleValue(20.0);
+		ui->InsertValue("y", y);
+		arguments.InsertValue("ui", ui);
+
+		ControlBehaviors::ProcessCommand(baseEntity, UNASSIGNED_SYSTEM_ADDRESS, &arguments, "addStrip", baseEntity);
+	}
+
+	void AddAction(STRIPID stripID, BEHAVIORSTATE stateID, uint32_t actionIndex, AMFArrayValue* action) {
+		AMFArrayValue arguments;
+		InsertIDs(arguments, stripID, stateID);
+
+		auto* index = new AMFDoubleValue();
+		index->SetDoubleValue(actionIndex);
+		arguments.InsertValue("actionIndex", index);
+		arguments.InsertValue("action", action);
+
+		ControlBehaviors::ProcessCommand(baseEntity, UNASSIGNED_SYSTEM_ADDRESS, &arguments, "addAction", baseEntity);
+	}
+};
+
+/**
+ * Test that strips built through the editor commands compile into the program
+ */
+TEST_F(ControlBehaviorsTest, ControlBehaviorsCompileStripsTest) {
+	AddStrip(0, HOME_STATE, { MakeAction("OnInteract"), MakeAction("Wait", "Delay", 2.0) });
+	AddAction(0, HOME_STATE, 2, MakeAction("SetState", "State", 2.0));
+
+	// Strips without a trigger first never run
+	AddStrip(1, HOME_STATE, { MakeAction("Wait", "Delay", 1.0) });
+
+	const auto& program = behavior->GetProgram();
+	ASSERT_EQ(program.GetStrips().size(), 1);
+	ASSERT_EQ(program.GetInstructionCount(), 2);
+
+	const auto strips = program.FindStrips(HOME_STATE, eBehaviorTrigger::INTERACT);
+	ASSERT_EQ(strips.second - strips.first, 1);
+
+	const auto& strip = program.GetStrips()[strips.first];
+	ASSERT_EQ(strip.instructionCount, 2);
+	ASSERT_EQ(program.GetInstruction(strip.firstInstruction).op, eBehaviorOp::WAIT);
+	ASSERT_FLOAT_EQ(program.GetInstruction(strip.firstInstruction).value, 2.0f);
+	ASSERT_EQ(program.GetInstruction(strip.firstInstruction + 1).op, eBehaviorOp::SET_STATE);
+
+	const auto none = program.FindStrips(HOME_STATE, eBehaviorTrigger::ATTACK);
+	ASSERT_EQ(none.first, none.second);
+}
+
+/**
+ * Test that a behavior reads back what it wrote
+ */
+TEST_F(ControlBehaviorsTest, ControlBehaviorsSerializeTest) {
+	AddStrip(3, 2, { MakeAction("OnAttack"), MakeAction("MoveLeft", "Distance", 5.0), MakeAction("Spin", "Not an \"attribute\"", 1.0) });
+	behavior->SetName("Walker");
+
+	ModelBehavior loaded(42);
+	ASSERT_TRUE(loaded.Deserialize(behavior->Serialize()));
+	ASSERT_EQ(loaded.GetName(), "Walker");
+
+	const auto& strips = loaded.GetStates().at(2);
+	ASSERT_EQ(strips.size(), 1);
+
+	const auto& strip = strips.at(3);
+	ASSERT_DOUBLE_EQ(strip.xPosition, 10.0);
+	ASSERT_DOUBLE_EQ(strip.yPosition, 20.0);
+	ASSERT_EQ(strip.actions.size(), 3);
+	ASSERT_EQ(strip.actions[1].type, "MoveLeft");
+	ASSERT_EQ(strip.actions[1].parameterName, "Distance");
+	ASSERT_DOUBLE_EQ(strip.actions[1].parameterValueDouble, 5.0);
+
+	// Parameter names come from the client and are read back as they were sent
+	ASSERT_EQ(strip.actions[2].parameterName, "Not an \"attribute\"");
+	ASSERT_DOUBLE_EQ(strip.actions[2].parameterValueDouble, 1.0);
+}
+
+/**
+ * Test that a running strip waits before its next action, and that switching state stops it
+ */
+TEST_F(ControlBehaviorsTest, ControlBehaviorsRunStripTest) {
+	AddStrip(0, HOME_STATE, { MakeAction("OnInteract"), MakeAction("Wait", "Delay", 2.0), MakeAction("SetState", "State", 2.0) });
+
+	auto* scheduler = ModelBehaviorScheduler::Instance();
+
+	modelComponent->OnUse(baseEntity);
+
+	scheduler->Update(0.0f);
+	ASSERT_EQ(behavior->GetState(), HOME_STATE);
+
+	scheduler->Update(1.0f);
+	ASSERT_EQ(behavior->GetState(), HOME_STATE);
+
+	scheduler->Update(1.5f);
+	ASSERT_EQ(behavior->GetState(), 2);
+
+	// Nothing is left running
+	scheduler->Update(10.0f);
+	ASSERT_EQ(scheduler->GetQueuedCount(), 0);
+}
+
+/**
+ * Test that only the budgeted number of actions run in a frame
+ */
+TEST_F(ControlBehaviorsTest, ControlBehaviorsActionBudgetTest) {
+	AddStrip(0, HOME_STATE, { MakeAction("OnInteract"), MakeAction("SetState", "State", 2.0) });
+	AddStrip(1, HOME_STATE, { MakeAction("OnInteract"), MakeAction("Wait", "Delay", 1.0) });
+
+	auto* scheduler = ModelBehaviorScheduler::Instance();
+	scheduler->SetActionBudget(1);
+
+	modelComponent->OnUse(baseEntity);
+
+	// The strips run in the order they were started, the second is picked up on the next frame
+	scheduler->Update(0.0f);
+	ASSERT_EQ(behavior->GetState(), 2);
+	ASSERT_EQ(scheduler->GetQueuedCount(), 1);
+
+	// Switching state stopped the second strip
+	scheduler->Update(0.0f);
+	ASSERT_EQ(scheduler->GetQueuedCount(), 0);
+}
+
+/**
+ * Test that templates take up a behavior slot without being a behavior the model runs
+ */
+TEST_F(ControlBehaviorsTest, ControlBehaviorsTemplateTest) {
+	ASSERT_TRUE(modelComponent->AddTemplate(7));
+	ASSERT_FALSE(modelComponent->AddTemplate(7));
+	ASSERT_EQ(modelComponent->FindBehavior(7), nullptr);
+
+	for (auto i = 1; modelComponent->GetBehaviors().size() + modelComponent->GetTemplates().size() < ModelComponent::MAX_BEHAVIORS; i++) {
+		ASSERT_TRUE(modelComponent->AddTemplate(100 + i));
+	}
+
+	ASSERT_FALSE(modelComponent->AddBehavior(new ModelBehavior(43), 0));
+
+	ASSERT_TRUE(modelComponent->RemoveTemplate(7));
+	ASSERT_FALSE(modelComponent->RemoveTemplate(7));
+	ASSERT_TRUE(modelComponent->AddBehavior(new ModelBehavior(43), 0));
+}
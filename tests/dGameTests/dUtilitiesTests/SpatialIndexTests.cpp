@@ -0,0 +1,165 @@
+#include "GameDependencies.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "Entity.h"
+#include "SimplePhysicsComponent.h"
+#include "SpatialIndex.h"
+
+class SpatialIndexTest : public GameDependenciesTest {
+protected:
+	std::vector<Entity*> entities;
+
+	void SetUp() override {
+		SetUpDependencies();
+		SpatialIndex::Instance()->Clear();
+	}
+
+	void TearDown() override {
+		SpatialIndex::Instance()->Clear();
+
+		for (auto* entity : entities) delete entity;
+
+		TearDownDependencies();
+	}
+
+	Entity* AddEntity(const NiPoint3& position, LOT lot = 999) {
+		auto entityInfo = info;
+		entityInfo.lot = lot;
+		entityInfo.pos = position;
+
+		auto* entity = new Entity(100 + entities.size(), entityInfo);
+		entity->AddComponent(COMPONENT_TYPE_SIMPLE_PHYSICS, new SimplePhysicsComponent(0, entity));
+
+		SpatialIndex::Instance()->Add(entity);
+		entities.push_back(entity);
+
+		return entity;
+	}
+
+	/**
+	 * The entities within a radius by checking every one of them, ordered like the index orders them
+	 */
+	std::vector<Entity*> FindInRadiusLinear(const NiPoint3& position, float radius) {
+		std::vector<std::pair<float, Entity*>> found;
+
+		for (auto* entity : entities) {
+			const auto distance = NiPoint3::DistanceSquared(position, entity->GetPosition());
+
+			if (distance <= radius * radius) found.emplace_back(distance, entity);
+		}
+
+		std::sort(found.begin(), found.end(), [](const auto& a, const auto& b) {
+			if (a.first != b.first) return a.first < b.first;
+			return a.second->GetObjectID() < b.second->GetObjectID();
+			});
+
+		std::vector<Entity*> result;
+		for (const auto& entry : found) result.push_back(entry.second);
+
+		return result;
+	}
+};
+
+/**
+ * Test that the nearest entities are found in order, ties going to the lowest object ID
+ */
+TEST_F(SpatialIndexTest, SpatialIndexNearestTest) {
+	auto* far = AddEntity(NiPoint3(500.0f, 0.0f, 500.0f));
+	auto* tieHigh = AddEntity(NiPoint3(0.0f, 0.0f, 10.0f));
+	auto* tieLow = AddEntity(NiPoint3(10.0f, 0.0f, 0.0f));
+	auto* closest = AddEntity(NiPoint3(1.0f, 0.0f, 1.0f));
+
+	auto* index = SpatialIndex::Instance();
+
+	ASSERT_EQ(index->FindNearest(NiPoint3::ZERO), closest);
+
+	const auto nearest = index->FindNearest(NiPoint3::ZERO, 3);
+	ASSERT_EQ(nearest.size(), 3);
+	ASSERT_EQ(nearest[0], closest);
+	ASSERT_EQ(nearest[1], tieHigh->GetObjectID() < tieLow->GetObjectID() ? tieHigh : tieLow);
+	ASSERT_EQ(nearest[2], tieHigh->GetObjectID() < tieLow->GetObjectID() ? tieLow : tieHigh);
+
+	// The far entity is only found when the search reaches it
+	ASSERT_EQ(index->FindNearest(NiPoint3(400.0f, 0.0f, 400.0f)), far);
+	ASSERT_EQ(index->FindNearest(NiPoint3(400.0f, 0.0f, 400.0f), {}, 100.0f), nullptr);
+
+	SpatialFilter filter{};
+	filter.exclude = closest->GetObjectID();
+	ASSERT_NE(index->FindNearest(NiPoint3::ZERO, filter), closest);
+}
+
+/**
+ * Test that entities are found where they moved to, and not where they were
+ */
+TEST_F(SpatialIndexTest, SpatialIndexMoveTest) {
+	auto* entity = AddEntity(NiPoint3::ZERO);
+	auto* index = SpatialIndex::Instance();
+
+	entity->GetComponent<SimplePhysicsComponent>()->SetPosition(NiPoint3(300.0f, 0.0f, -300.0f));
+
+	ASSERT_TRUE(index->FindInRadius(NiPoint3::ZERO, 50.0f).empty());
+	ASSERT_EQ(index->FindInRadius(NiPoint3(300.0f, 0.0f, -300.0f), 1.0f).size(), 1);
+
+	index->Remove(entity->GetObjectID());
+	ASSERT_EQ(index->GetCount(), 0);
+	ASSERT_EQ(index->FindNearest(NiPoint3::ZERO), nullptr);
+}
+
+/**
+ * Test that the queries agree with checking every entity
+ */
+TEST_F(SpatialIndexTest, SpatialIndexMatchesLinearTest) {
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> coordinate(-400.0f, 400.0f);
+
+	for (auto i = 0; i < 500; i++) {
+		AddEntity(NiPoint3(coordinate(random), coordinate(random) * 0.1f, coordinate(random)), i % 2 == 0 ? 1000 : 1001);
+	}
+
+	// Some entities move around after being added
+	for (auto i = 0; i < 100; i++) {
+		entities[i]->GetComponent<SimplePhysicsComponent>()->SetPosition(NiPoint3(coordinate(random), 0.0f, coordinate(random)));
+	}
+
+	auto* index = SpatialIndex::Instance();
+
+	for (auto query = 0; query < 50; query++) {
+		const NiPoint3 position(coordinate(random), 0.0f, coordinate(random));
+
+		for (const auto radius : { 5.0f, 40.0f, 150.0f, 2000.0f }) {
+			ASSERT_EQ(index->FindInRadius(position, radius), FindInRadiusLinear(position, radius));
+		}
+
+		const auto all = FindInRadiusLinear(position, 10000.0f);
+		const auto nearest = index->FindNearest(position, 7);
+		ASSERT_EQ(nearest, std::vector<Entity*>(all.begin(), all.begin() + 7));
+
+		SpatialFilter filter{};
+		filter.lot = 1001;
+
+		const auto nearestOdd = index->FindNearest(position, 3, filter);
+		std::vector<Entity*> expected;
+		for (auto* entity : all) {
+			if (entity->GetLOT() == 1001 && expected.size() < 3) expected.push_back(entity);
+		}
+		ASSERT_EQ(nearestOdd, expected);
+
+		// Everything in a cone is in front of the tip, within the angle
+		const NiPoint3 direction(1.0f, 0.0f, 0.0f);
+		const auto cone = index->FindInCone(position, direction, 30.0f, 200.0f);
+		for (auto* entity : cone) {
+			const auto offset = entity->GetPosition() - position;
+			ASSERT_GE(offset.DotProduct(direction), std::cos(30.0f * 3.14159265f / 180.0f) * offset.Length() - 0.001f);
+		}
+
+		size_t inCone = 0;
+		for (auto* entity : FindInRadiusLinear(position, 200.0f)) {
+			const auto offset = entity->GetPosition() - position;
+			if (offset.DotProduct(direction) >= std::cos(30.0f * 3.14159265f / 180.0f) * offset.Length()) inCone++;
+		}
+		ASSERT_EQ(cone.size(), inCone);
+	}
+}
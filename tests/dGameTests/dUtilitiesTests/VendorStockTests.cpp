@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "Game.h"
+#include "VendorStock.h"
+
+/**
+ * Test that vendors of a template without random rows share one inventory
+ */
+TEST(VendorStockTest, VendorStockSharedTemplateTest) {
+	const auto stockTemplate = VendorStock::Compile({
+		VendorStockEntry{ { { 100, 1 }, { 101, 2 } }, 0, 0 },
+		VendorStockEntry{ { { 101, 5 }, { 102, 3 } }, 2, 0 },
+		});
+
+	ASSERT_NE(stockTemplate.shared, nullptr);
+
+	const auto first = VendorStock::Roll(stockTemplate);
+	const auto second = VendorStock::Roll(stockTemplate);
+	ASSERT_EQ(first, second);
+
+	// Items in more than one row keep the sort priority of the first
+	const VendorInventory expected{ { 100, 1 }, { 101, 2 }, { 102, 3 } };
+	ASSERT_EQ(*first, expected);
+}
+
+/**
+ * Test that restocks of a template with random rows pick between the minimum and maximum of different candidates
+ */
+TEST(VendorStockTest, VendorStockRandomTemplateTest) {
+	Game::randomEngine = std::mt19937(42);
+
+	const auto stockTemplate = VendorStock::Compile({
+		VendorStockEntry{ { { 100, 0 } }, 0, 0 },
+		VendorStockEntry{ { { 200, 0 }, { 201, 0 }, { 202, 0 }, { 203, 0 }, { 204, 0 } }, 2, 3 },
+		});
+
+	ASSERT_EQ(stockTemplate.shared, nullptr);
+
+	for (auto i = 0; i < 100; i++) {
+		const auto inventory = VendorStock::Roll(stockTemplate);
+
+		ASSERT_EQ(inventory->count(100), 1);
+
+		const auto picked = inventory->size() - 1;
+		ASSERT_GE(picked, 2);
+		ASSERT_LE(picked, 3);
+
+		for (const auto& [lot, sortPriority] : *inventory) {
+			ASSERT_TRUE(lot == 100 || (lot >= 200 && lot <= 204));
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "PlatformTimeline.h"
+#include "Zone.h"
+
+namespace {
+	Path BuildPath() {
+		Path path{};
+
+		for (const auto x : { 0.0f, 10.0f, 30.0f }) {
+			PathWaypoint waypoint{};
+			waypoint.position = NiPoint3(x, 0.0f, 0.0f);
+			waypoint.movingPlatform.speed = 1.0f;
+			waypoint.movingPlatform.wait = 2.0f;
+
+			path.pathWaypoints.push_back(waypoint);
+		}
+
+		return path;
+	}
+}
+
+/**
+ * Test that a first move with less extra time reaches its waypoint sooner, and every later leg moves up with it
+ */
+TEST(PlatformTimelineTest, PlatformTimelineFirstMoveTest) {
+	const auto path = BuildPath();
+
+	const auto timeline = PlatformTimeline::Build(path, 0, -1, PathBehavior::Bounce, 21.5f, 1.5f, 100.0);
+	const auto regular = PlatformTimeline::Build(path, 0, -1, PathBehavior::Bounce, 21.5f, 21.5f, 100.0);
+
+	// Waiting at the first waypoint, then halfway through the quicker first move
+	ASSERT_EQ(timeline.Evaluate(101.0).position, NiPoint3::ZERO);
+	ASSERT_FALSE(timeline.Evaluate(101.0).moving);
+	ASSERT_FLOAT_EQ(timeline.Evaluate(102.0 + 11.5 / 2.0).percent, 0.5f);
+
+	ASSERT_DOUBLE_EQ(timeline.GetArriveTime(0), 100.0 + 2.0 + 10.0 + 1.5);
+	ASSERT_DOUBLE_EQ(regular.GetArriveTime(0), 100.0 + 2.0 + 10.0 + 21.5);
+
+	// Later legs, also in later cycles, take the full time and are 20 seconds ahead of the regular timeline
+	for (uint64_t leg = 1; leg < 8; leg++) {
+		ASSERT_DOUBLE_EQ(timeline.GetArriveTime(leg), regular.GetArriveTime(leg) - 20.0);
+
+		const auto time = timeline.GetArriveTime(leg) - 1.0;
+		ASSERT_NEAR(NiPoint3::Distance(timeline.Evaluate(time).position, regular.Evaluate(time + 20.0).position), 0.0f, 0.001f);
+		ASSERT_EQ(timeline.GetCompletedLegs(time), leg);
+	}
+}
+
+/**
+ * Test that a platform sent to the waypoint it is at still arrives there, without waiting or moving
+ */
+TEST(PlatformTimelineTest, PlatformTimelineSameWaypointTest) {
+	const auto path = BuildPath();
+
+	const auto timeline = PlatformTimeline::Build(path, 0, 0, PathBehavior::Once, 1.5f, 1.5f, 100.0);
+
+	ASSERT_FALSE(timeline.IsEmpty());
+	ASSERT_DOUBLE_EQ(timeline.GetArriveTime(0), 101.5);
+	ASSERT_EQ(timeline.GetCompletedLegs(101.0), 0);
+	ASSERT_EQ(timeline.GetCompletedLegs(101.5), 1);
+	ASSERT_EQ(timeline.GetLeg(0).to, 0);
+
+	const auto pose = timeline.Evaluate(101.0);
+	ASSERT_EQ(pose.position, NiPoint3::ZERO);
+	ASSERT_FALSE(pose.moving);
+	ASSERT_TRUE(timeline.Evaluate(102.0).finished);
+}
+
+/**
+ * Test that a platform between two waypoints finishes its move from where it is before following the new route
+ */
+TEST(PlatformTimelineTest, PlatformTimelineBetweenTest) {
+	const auto path = BuildPath();
+
+	PlatformPose between;
+	between.position = NiPoint3(4.0f, 0.0f, 0.0f);
+	between.current = 0;
+	between.next = 1;
+	between.moving = true;
+
+	const auto timeline = PlatformTimeline::Build(path, 1, -1, PathBehavior::Loop, 0.0f, 0.0f, 100.0, &between);
+
+	// Moving on right away from where it was, 6 units from the waypoint
+	ASSERT_TRUE(timeline.Evaluate(100.0).moving);
+	ASSERT_EQ(timeline.Evaluate(100.0).position, between.position);
+	ASSERT_DOUBLE_EQ(timeline.GetArriveTime(0), 106.0);
+	ASSERT_EQ(timeline.GetLeg(0).to, 1);
+
+	// The loop repeats from the waypoint, the move from between the waypoints only happens once
+	ASSERT_EQ(timeline.GetLeg(1).from, 1);
+	ASSERT_EQ(timeline.GetLeg(4).from, 1);
+	ASSERT_DOUBLE_EQ(timeline.GetArriveTime(4) - timeline.GetArriveTime(1), timeline.GetArriveTime(3) - timeline.GetArriveTime(0));
+
+	for (uint64_t leg = 0; leg < 8; leg++) {
+		ASSERT_EQ(timeline.GetCompletedLegs(timeline.GetArriveTime(leg) - 0.5), leg);
+		ASSERT_EQ(timeline.GetCompletedLegs(timeline.GetArriveTime(leg)), leg + 1);
+	}
+}
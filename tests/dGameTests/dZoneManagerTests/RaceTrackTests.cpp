@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "RaceTrack.h"
+#include "Zone.h"
+
+class RaceTrackTest : public ::testing::Test {
+protected:
+	Path path{};
+
+	/**
+	 * A loop of waypoints around the origin, so the track crosses into negative cells on both axes
+	 */
+	void SetUp() override {
+		for (auto i = 0; i < 40; i++) {
+			const auto angle = static_cast<float>(i) / 40.0f * 2.0f * 3.14159265f;
+
+			PathWaypoint waypoint{};
+			waypoint.position = NiPoint3(std::cos(angle) * 1000.0f, 0.0f, std::sin(angle) * 1000.0f);
+
+			path.pathWaypoints.push_back(waypoint);
+		}
+	}
+};
+
+/**
+ * Test that racers reach the checkpoints in front of them, and that the distance along the lap grows with them
+ */
+TEST_F(RaceTrackTest, RaceTrackProgressTest) {
+	const RaceTrack track(path);
+
+	ASSERT_EQ(track.GetWaypointCount(), 40);
+
+	uint32_t current = 0;
+	float lastDistance = 0.0f;
+
+	for (uint32_t next = 1; next < track.GetWaypointCount(); next++) {
+		// Halfway to the next waypoint the racer is further along, but hasn't reached it yet
+		const auto halfway = (track.GetWaypoint(current) + track.GetWaypoint(next)) / 2.0f;
+
+		const auto distance = track.GetDistance(current, halfway);
+		ASSERT_GT(distance, lastDistance);
+		lastDistance = distance;
+
+		uint32_t reached = 0;
+		ASSERT_FALSE(track.FindCheckpoint(current, halfway, reached));
+
+		ASSERT_TRUE(track.FindCheckpoint(current, track.GetWaypoint(next), reached));
+		ASSERT_EQ(reached, next);
+
+		current = reached;
+	}
+
+	// Waypoints further ahead than a racer can skip don't count
+	uint32_t reached = 0;
+	ASSERT_FALSE(track.FindCheckpoint(0, track.GetWaypoint(RaceTrack::MAX_SKIPPED_WAYPOINTS + 5), reached));
+	ASSERT_TRUE(track.FindCheckpoint(0, track.GetWaypoint(RaceTrack::MAX_SKIPPED_WAYPOINTS), reached));
+	ASSERT_EQ(reached, RaceTrack::MAX_SKIPPED_WAYPOINTS);
+}
+
+/**
+ * Test that passing the start from the last checkpoint is found as a new lap
+ */
+TEST_F(RaceTrackTest, RaceTrackLapTest) {
+	const RaceTrack track(path);
+
+	const auto last = track.GetWaypointCount() - 1;
+
+	uint32_t reached = last;
+	ASSERT_TRUE(track.FindCheckpoint(last, track.GetWaypoint(0), reached));
+	ASSERT_EQ(reached, 0);
+	ASSERT_LT(reached, last);
+
+	// The lap is as long as the distance up to the last waypoint and back to the start
+	const auto closing = track.GetDistance(last, track.GetWaypoint(0));
+	ASSERT_FLOAT_EQ(closing, track.GetLength());
+
+	// Going back over the start the wrong way is not a lap
+	ASSERT_FALSE(track.FindCheckpoint(0, track.GetWaypoint(last), reached));
+}
+
+/**
+ * Test that on a track with fewer waypoints than a racer can skip, going back over the start is not a lap
+ */
+TEST_F(RaceTrackTest, RaceTrackShortLapTest) {
+	path.pathWaypoints.resize(6);
+
+	const RaceTrack track(path);
+
+	// Backing up from the first checkpoint to the start
+	uint32_t reached = 1;
+	ASSERT_FALSE(track.FindCheckpoint(1, track.GetWaypoint(0), reached));
+
+	// Backing up past the start to the last checkpoint
+	ASSERT_FALSE(track.FindCheckpoint(0, track.GetWaypoint(5), reached));
+
+	// Driving forward all the way around is
+	uint32_t current = 0;
+	for (uint32_t next = 1; next <= track.GetWaypointCount(); next++) {
+		ASSERT_TRUE(track.FindCheckpoint(current, track.GetWaypoint(next % track.GetWaypointCount()), reached));
+		ASSERT_EQ(reached, next % track.GetWaypointCount());
+
+		current = reached;
+	}
+
+	ASSERT_EQ(current, 0);
+}